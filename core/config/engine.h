@@ -83,6 +83,7 @@ private:
 	bool editor_hint = false;
 	bool project_manager_hint = false;
 	bool extension_reloading = false;
+	bool server_profile = false;
 
 	static Engine *singleton;
 
@@ -155,6 +156,10 @@ public:
 	_FORCE_INLINE_ bool is_extension_reloading_enabled() const { return false; }
 #endif
 
+	// Dedicated server mode: skips work whose only output is rendered or heard.
+	_FORCE_INLINE_ void set_server_profile_enabled(bool p_enabled) { server_profile = p_enabled; }
+	_FORCE_INLINE_ bool is_server_profile_enabled() const { return server_profile; }
+
 	Dictionary get_version_info() const;
 	Dictionary get_author_info() const;
 	TypedArray<Dictionary> get_copyright_info() const;
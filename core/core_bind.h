@@ -68,9 +68,16 @@ public:
 		CACHE_MODE_REPLACE, // Resource and subresource use path cache, but replace existing loaded resources when available with information from disk.
 	};
 
+protected:
+#ifndef DISABLE_DEPRECATED
+	Error _load_threaded_request_bind_compat_high_priority(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, CacheMode p_cache_mode);
+	static void _bind_compatibility_methods();
+#endif
+
+public:
 	static ResourceLoader *get_singleton() { return singleton; }
 
-	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE);
+	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE, bool p_high_priority = false);
 	ThreadLoadStatus load_threaded_get_status(const String &p_path, Array r_progress = Array());
 	Ref<Resource> load_threaded_get(const String &p_path);
 
@@ -95,6 +102,13 @@ protected:
 	static ResourceSaver *singleton;
 
 public:
+	enum ThreadSaveStatus {
+		THREAD_SAVE_INVALID_RESOURCE,
+		THREAD_SAVE_IN_PROGRESS,
+		THREAD_SAVE_FAILED,
+		THREAD_SAVE_SAVED,
+	};
+
 	enum SaverFlags {
 		FLAG_NONE = 0,
 		FLAG_RELATIVE_PATHS = 1,
@@ -109,6 +123,9 @@ public:
 	static ResourceSaver *get_singleton() { return singleton; }
 
 	Error save(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags);
+	Error save_threaded_request(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags);
+	ThreadSaveStatus save_threaded_get_status(const String &p_path);
+	Error save_threaded_get(const String &p_path);
 	Vector<String> get_recognized_extensions(const Ref<Resource> &p_resource);
 	void add_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver, bool p_at_front);
 	void remove_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver);
@@ -520,6 +537,9 @@ public:
 	void set_editor_hint(bool p_enabled);
 	bool is_editor_hint() const;
 
+	// `set_server_profile_enabled()` is not exposed either, as it only takes effect at startup.
+	bool is_server_profile_enabled() const;
+
 	// `set_write_movie_path()` is not exposed to the scripting API as changing it at run-time has no effect.
 	String get_write_movie_path() const;
 
@@ -568,6 +588,7 @@ public:
 VARIANT_ENUM_CAST(core_bind::ResourceLoader::ThreadLoadStatus);
 VARIANT_ENUM_CAST(core_bind::ResourceLoader::CacheMode);
 
+VARIANT_ENUM_CAST(core_bind::ResourceSaver::ThreadSaveStatus);
 VARIANT_BITFIELD_CAST(core_bind::ResourceSaver::SaverFlags);
 
 VARIANT_ENUM_CAST(core_bind::OS::RenderingDriver);
@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*  engine_tracer.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "engine_tracer.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+
+SafeFlag EngineTracer::enabled;
+thread_local EngineTracer::ThreadBuffer *EngineTracer::thread_buffer = nullptr;
+thread_local uint32_t EngineTracer::thread_buffer_generation = 0;
+SafeNumeric<uint32_t> EngineTracer::buffers_generation;
+Mutex EngineTracer::buffers_mutex;
+LocalVector<EngineTracer::ThreadBuffer *> EngineTracer::buffers;
+EngineTracer::ThreadBuffer *EngineTracer::gpu_buffer = nullptr;
+
+static Mutex interned_names_mutex;
+static HashMap<String, CharString> interned_names;
+
+static Mutex trace_file_mutex;
+static Ref<FileAccess> trace_file;
+static bool trace_file_has_events = false;
+
+EngineTracer::ThreadBuffer *EngineTracer::_register_buffer(uint64_t p_thread_id) {
+	ThreadBuffer *buffer = memnew(ThreadBuffer);
+	buffer->thread_id = p_thread_id;
+	buffer->written.set(0);
+
+	MutexLock lock(buffers_mutex);
+	buffers.push_back(buffer);
+	return buffer;
+}
+
+EngineTracer::ThreadBuffer *EngineTracer::_register_thread() {
+	if (!is_enabled()) {
+		// A zone that was open when tracing stopped, don't allocate a buffer that may never be freed for it.
+		thread_buffer = nullptr;
+		return nullptr;
+	}
+	thread_buffer_generation = buffers_generation.get();
+	thread_buffer = _register_buffer(Thread::get_caller_id());
+	return thread_buffer;
+}
+
+void EngineTracer::record_gpu(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+	if (unlikely(!gpu_buffer)) {
+		gpu_buffer = _register_buffer(GPU_TRACK_ID);
+	}
+	_record(gpu_buffer, p_name, p_begin_usec, p_end_usec);
+}
+
+const char *EngineTracer::intern_name(const String &p_name) {
+	MutexLock lock(interned_names_mutex);
+	HashMap<String, CharString>::Iterator E = interned_names.find(p_name);
+	if (!E) {
+		E = interned_names.insert(p_name, p_name.utf8());
+	}
+	return E->value.get_data();
+}
+
+void EngineTracer::set_enabled(bool p_enabled) {
+	enabled.set_to(p_enabled);
+}
+
+uint64_t EngineTracer::get_ticks_usec() {
+	OS *os = OS::get_singleton();
+	return os ? os->get_ticks_usec() : 0;
+}
+
+void EngineTracer::drain(LocalVector<ThreadEvent> &r_events) {
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		uint64_t written = buffer->written.get();
+		uint64_t from = MAX(buffer->read, written > THREAD_BUFFER_SIZE ? written - THREAD_BUFFER_SIZE : 0);
+		uint32_t first = r_events.size();
+		for (uint64_t i = from; i < written; i++) {
+			ThreadEvent thread_event;
+			thread_event.thread_id = buffer->thread_id;
+			thread_event.event = buffer->events[i % THREAD_BUFFER_SIZE];
+			r_events.push_back(thread_event);
+		}
+
+		// The owning thread kept recording while copying; drop anything it may have overwritten meanwhile.
+		// It may also be writing event `written_after` right now, which overwrites one more slot.
+		uint64_t written_after = buffer->written.get();
+		if (written_after >= from + THREAD_BUFFER_SIZE) {
+			uint64_t overwritten = MIN(written_after + 1 - THREAD_BUFFER_SIZE - from, written - from);
+			for (uint32_t i = first; i + overwritten < r_events.size(); i++) {
+				r_events[i] = r_events[i + overwritten];
+			}
+			r_events.resize(r_events.size() - overwritten);
+		}
+		buffer->read = written;
+	}
+}
+
+String EngineTracer::events_to_chrome_json(const LocalVector<ThreadEvent> &p_events) {
+	String json;
+	for (uint32_t i = 0; i < p_events.size(); i++) {
+		const ThreadEvent &e = p_events[i];
+		if (i > 0) {
+			json += ",\n";
+		}
+		json += vformat("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%d,\"dur\":%d}", String(e.event.name).json_escape(), e.thread_id, e.event.begin_usec, e.event.end_usec - e.event.begin_usec);
+	}
+	return json;
+}
+
+Error EngineTracer::start_file_capture(const String &p_path) {
+	MutexLock lock(trace_file_mutex);
+	ERR_FAIL_COND_V_MSG(trace_file.is_valid(), ERR_ALREADY_IN_USE, "A trace capture is already in progress.");
+
+	Error err;
+	trace_file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open trace file for writing: " + p_path);
+
+	trace_file->store_string("[\n");
+	trace_file->store_string(vformat("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"GPU\"}}", GPU_TRACK_ID));
+	trace_file_has_events = true;
+	set_enabled(true);
+	return OK;
+}
+
+void EngineTracer::flush_file_capture() {
+	MutexLock lock(trace_file_mutex);
+	if (trace_file.is_null()) {
+		return;
+	}
+
+	LocalVector<ThreadEvent> events;
+	drain(events);
+	if (events.is_empty()) {
+		return;
+	}
+
+	if (trace_file_has_events) {
+		trace_file->store_string(",\n");
+	}
+	trace_file->store_string(events_to_chrome_json(events));
+	trace_file_has_events = true;
+}
+
+void EngineTracer::stop_file_capture() {
+	if (!is_capturing_to_file()) {
+		return;
+	}
+	set_enabled(false);
+	flush_file_capture();
+
+	MutexLock lock(trace_file_mutex);
+	trace_file->store_string("\n]\n");
+	trace_file.unref();
+}
+
+bool EngineTracer::is_capturing_to_file() {
+	MutexLock lock(trace_file_mutex);
+	return trace_file.is_valid();
+}
+
+void EngineTracer::finish() {
+	stop_file_capture();
+	set_enabled(false);
+
+	MutexLock lock(buffers_mutex);
+	buffers_generation.increment();
+	for (ThreadBuffer *buffer : buffers) {
+		memdelete(buffer);
+	}
+	buffers.clear();
+	thread_buffer = nullptr;
+	gpu_buffer = nullptr;
+
+	MutexLock names_lock(interned_names_mutex);
+	interned_names.clear();
+}
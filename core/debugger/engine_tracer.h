@@ -0,0 +1,155 @@
+/**************************************************************************/
+/*  engine_tracer.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ENGINE_TRACER_H
+#define ENGINE_TRACER_H
+
+#include "core/os/mutex.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/typedefs.h"
+
+// Timeline tracing of scoped zones, available in all build types.
+// Each thread records completed zones into its own ring buffer without locking; a single consumer drains
+// them periodically (to a Chrome/Perfetto JSON file or to the remote debugger). Zone names must be
+// string literals, as only the pointer is stored.
+class EngineTracer {
+public:
+	struct Event {
+		const char *name = nullptr;
+		uint64_t begin_usec = 0;
+		uint64_t end_usec = 0;
+	};
+
+	struct ThreadEvent {
+		uint64_t thread_id = 0;
+		Event event;
+	};
+
+	enum {
+		THREAD_BUFFER_SIZE = 16384, // Events recorded per thread between two drains before the oldest are lost.
+		GPU_TRACK_ID = 0, // Pseudo thread ID used for GPU timestamps; no real thread uses it.
+	};
+
+private:
+	struct ThreadBuffer {
+		uint64_t thread_id = 0;
+		SafeNumeric<uint64_t> written;
+		uint64_t read = 0;
+		Event events[THREAD_BUFFER_SIZE];
+	};
+
+	static SafeFlag enabled;
+	static thread_local ThreadBuffer *thread_buffer;
+	// finish() frees the buffers of all threads but can only reset the calling thread's pointer, the others
+	// compare their generation to find out their buffer is gone.
+	static thread_local uint32_t thread_buffer_generation;
+	static SafeNumeric<uint32_t> buffers_generation;
+
+	static Mutex buffers_mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+
+	static ThreadBuffer *gpu_buffer;
+
+	static ThreadBuffer *_register_thread();
+	static ThreadBuffer *_register_buffer(uint64_t p_thread_id);
+
+	_FORCE_INLINE_ static void _record(ThreadBuffer *p_buffer, const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+		// Single producer: only the owning thread writes, the consumer validates what it read against `written`.
+		uint64_t index = p_buffer->written.get();
+		Event &event = p_buffer->events[index % THREAD_BUFFER_SIZE];
+		event.name = p_name;
+		event.begin_usec = p_begin_usec;
+		event.end_usec = p_end_usec;
+		p_buffer->written.set(index + 1);
+	}
+
+public:
+	_FORCE_INLINE_ static bool is_enabled() { return enabled.is_set(); }
+	static void set_enabled(bool p_enabled);
+
+	static uint64_t get_ticks_usec();
+
+	_FORCE_INLINE_ static void record(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec) {
+		ThreadBuffer *buffer = thread_buffer;
+		if (unlikely(!buffer || thread_buffer_generation != buffers_generation.get())) {
+			buffer = _register_thread();
+			if (!buffer) {
+				return;
+			}
+		}
+		_record(buffer, p_name, p_begin_usec, p_end_usec);
+	}
+
+	// Records a zone on the GPU track. Times are on the CPU clock; only the rendering thread may call this.
+	static void record_gpu(const char *p_name, uint64_t p_begin_usec, uint64_t p_end_usec);
+
+	// Returns a pointer that stays valid until finish() for names that are not string literals.
+	static const char *intern_name(const String &p_name);
+
+	// Moves all events recorded since the last drain into r_events. Events overwritten before they could be
+	// drained are dropped.
+	static void drain(LocalVector<ThreadEvent> &r_events);
+
+	static String events_to_chrome_json(const LocalVector<ThreadEvent> &p_events);
+
+	// Streams drained events to p_path in the Chrome trace event (JSON array) format, which Perfetto and
+	// chrome://tracing can open.
+	static Error start_file_capture(const String &p_path);
+	static void flush_file_capture();
+	static void stop_file_capture();
+	static bool is_capturing_to_file();
+
+	static void finish();
+};
+
+class EngineTraceZone {
+	const char *name = nullptr;
+	uint64_t begin_usec = 0;
+
+public:
+	_FORCE_INLINE_ EngineTraceZone(const char *p_name) {
+		if (unlikely(EngineTracer::is_enabled())) {
+			name = p_name;
+			begin_usec = EngineTracer::get_ticks_usec();
+		}
+	}
+	_FORCE_INLINE_ ~EngineTraceZone() {
+		if (unlikely(name)) {
+			EngineTracer::record(name, begin_usec, EngineTracer::get_ticks_usec());
+		}
+	}
+};
+
+// Records the time spent until the end of the current scope as a zone named m_name on the calling thread.
+#define ENGINE_TRACE_ZONE(m_name) EngineTraceZone _engine_trace_zone_(m_name)
+
+#endif // ENGINE_TRACER_H
@@ -34,6 +34,7 @@
 #include "core/debugger/debugger_marshalls.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/engine_profiler.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/debugger/script_debugger.h"
 #include "core/input/input.h"
 #include "core/object/script_language.h"
@@ -91,6 +92,54 @@ public:
 	}
 };
 
+// Streams the EngineTracer timeline while the "tracer" profiler is enabled, as flat
+// [name, thread_id, begin_usec, duration_usec, ...] arrays.
+class RemoteDebugger::TraceProfiler : public EngineProfiler {
+	uint64_t last_send_time = 0;
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (EngineTracer::is_capturing_to_file()) {
+			return; // The file capture owns the recorded events.
+		}
+		if (p_enable) {
+			// Discard whatever was recorded before the profiler was enabled.
+			LocalVector<EngineTracer::ThreadEvent> stale;
+			EngineTracer::drain(stale);
+		}
+		EngineTracer::set_enabled(p_enable);
+	}
+	void add(const Array &p_data) {}
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		if (!EngineTracer::is_enabled() || EngineTracer::is_capturing_to_file()) {
+			return;
+		}
+
+		uint64_t pt = OS::get_singleton()->get_ticks_msec();
+		if (pt - last_send_time < 250) {
+			return;
+		}
+		last_send_time = pt;
+
+		LocalVector<EngineTracer::ThreadEvent> events;
+		EngineTracer::drain(events);
+		if (events.is_empty()) {
+			return;
+		}
+
+		Array arr;
+		arr.resize(events.size() * 4);
+		for (uint32_t i = 0; i < events.size(); i++) {
+			const EngineTracer::ThreadEvent &e = events[i];
+			arr[i * 4 + 0] = e.event.name;
+			arr[i * 4 + 1] = e.thread_id;
+			arr[i * 4 + 2] = e.event.begin_usec;
+			arr[i * 4 + 3] = e.event.end_usec - e.event.begin_usec;
+		}
+		EngineDebugger::get_singleton()->send_message("tracer:events", arr);
+	}
+};
+
 Error RemoteDebugger::_put_msg(String p_message, Array p_data) {
 	Array msg;
 	msg.push_back(p_message);
@@ -624,6 +673,91 @@ Error RemoteDebugger::_core_capture(const String &p_cmd, const Array &p_data, bo
 	return OK;
 }
 
+Error RemoteDebugger::_objects_capture(const String &p_cmd, const Array &p_data, bool &r_captured) {
+	r_captured = true;
+	if (p_cmd == "track") {
+		ERR_FAIL_COND_V(p_data.size() < 1, ERR_INVALID_DATA);
+		ObjectDB::set_allocation_tracking_enabled(p_data[0]);
+
+	} else if (p_cmd == "snapshot") {
+		int id = ++last_object_snapshot;
+		LocalVector<ObjectDB::AllocationInfo> &snapshot = object_snapshots[id];
+		ObjectDB::get_allocations(snapshot);
+
+		HashMap<StringName, int> counts;
+		for (const ObjectDB::AllocationInfo &info : snapshot) {
+			counts[info.class_name]++;
+		}
+		// Format: [id, object count, class, count, class, count, ...].
+		Array arr;
+		arr.push_back(id);
+		arr.push_back(snapshot.size());
+		for (const KeyValue<StringName, int> &E : counts) {
+			arr.push_back(E.key);
+			arr.push_back(E.value);
+		}
+		send_message("objects:snapshot", arr);
+
+	} else if (p_cmd == "diff") {
+		ERR_FAIL_COND_V(p_data.size() < 2, ERR_INVALID_DATA);
+		const int from = p_data[0];
+		const int to = p_data[1];
+		ERR_FAIL_COND_V_MSG(!object_snapshots.has(from) || !object_snapshots.has(to), ERR_INVALID_PARAMETER, "Invalid object snapshot.");
+		const LocalVector<ObjectDB::AllocationInfo> &before = object_snapshots[from];
+		const LocalVector<ObjectDB::AllocationInfo> &after = object_snapshots[to];
+
+		HashSet<ObjectID> before_ids;
+		HashSet<ObjectID> after_ids;
+		before_ids.reserve(before.size());
+		after_ids.reserve(after.size());
+		for (const ObjectDB::AllocationInfo &info : before) {
+			before_ids.insert(info.id);
+		}
+		for (const ObjectDB::AllocationInfo &info : after) {
+			after_ids.insert(info.id);
+		}
+
+		// Group by class and creation site, which is what points at the code responsible for a leak.
+		HashMap<String, int> added;
+		HashMap<String, int> removed;
+		for (const ObjectDB::AllocationInfo &info : after) {
+			if (!before_ids.has(info.id)) {
+				added[String(info.class_name) + "|" + info.site]++;
+			}
+		}
+		for (const ObjectDB::AllocationInfo &info : before) {
+			if (!after_ids.has(info.id)) {
+				removed[String(info.class_name) + "|" + info.site]++;
+			}
+		}
+
+		// Format: [from, to, added, removed], the last two as [class, site, count, ...].
+		Array arr;
+		arr.push_back(from);
+		arr.push_back(to);
+		for (const HashMap<String, int> *groups : { &added, &removed }) {
+			Array group_arr;
+			for (const KeyValue<String, int> &E : *groups) {
+				const int separator = E.key.find("|");
+				group_arr.push_back(E.key.substr(0, separator));
+				group_arr.push_back(E.key.substr(separator + 1));
+				group_arr.push_back(E.value);
+			}
+			arr.push_back(group_arr);
+		}
+		send_message("objects:diff", arr);
+
+	} else if (p_cmd == "discard") {
+		for (int i = 0; i < p_data.size(); i++) {
+			object_snapshots.erase(p_data[i]);
+		}
+
+	} else {
+		r_captured = false;
+	}
+	return OK;
+}
+
 Error RemoteDebugger::_profiler_capture(const String &p_cmd, const Array &p_data, bool &r_captured) {
 	r_captured = false;
 	ERR_FAIL_COND_V(p_data.size() < 1, ERR_INVALID_DATA);
@@ -653,12 +787,21 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 		profiler_enable("performance", true);
 	}
 
+	// Tracer, enabled on demand by the client.
+	trace_profiler.instantiate();
+	trace_profiler->bind("tracer");
+
 	// Core and profiler captures.
 	Capture core_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
 				return static_cast<RemoteDebugger *>(p_user)->_core_capture(p_cmd, p_data, r_captured);
 			});
 	register_message_capture("core", core_cap);
+	Capture objects_cap(this,
+			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
+				return static_cast<RemoteDebugger *>(p_user)->_objects_capture(p_cmd, p_data, r_captured);
+			});
+	register_message_capture("objects", objects_cap);
 	Capture profiler_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
 				return static_cast<RemoteDebugger *>(p_user)->_profiler_capture(p_cmd, p_data, r_captured);
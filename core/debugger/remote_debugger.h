@@ -51,8 +51,10 @@ private:
 	typedef DebuggerMarshalls::OutputError ErrorMessage;
 
 	class PerformanceProfiler;
+	class TraceProfiler;
 
 	Ref<PerformanceProfiler> performance_profiler;
+	Ref<TraceProfiler> trace_profiler;
 
 	Ref<RemoteDebuggerPeer> peer;
 
@@ -75,6 +77,10 @@ private:
 	int last_reset = 0;
 	bool reload_all_scripts = false;
 
+	// Heap snapshots, taken and compared on request of the client.
+	HashMap<int, LocalVector<ObjectDB::AllocationInfo>> object_snapshots;
+	int last_object_snapshot = 0;
+
 	// Make handlers and send_message thread safe.
 	Mutex mutex;
 	bool flushing = false;
@@ -106,6 +112,7 @@ private:
 
 	Error _profiler_capture(const String &p_cmd, const Array &p_data, bool &r_captured);
 	Error _core_capture(const String &p_cmd, const Array &p_data, bool &r_captured);
+	Error _objects_capture(const String &p_cmd, const Array &p_data, bool &r_captured);
 
 	template <typename T>
 	void _bind_profiler(const String &p_name, T *p_prof);
@@ -1067,6 +1067,46 @@ static GDExtensionTypePtr gdextension_packed_vector3_array_operator_index_const(
 	return (GDExtensionTypePtr)&self->ptr()[p_index];
 }
 
+static GDExtensionInt gdextension_packed_byte_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedByteArray *self = (PackedByteArray *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_color_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedColorArray *self = (PackedColorArray *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_float32_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedFloat32Array *self = (PackedFloat32Array *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_float64_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedFloat64Array *self = (PackedFloat64Array *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_int32_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedInt32Array *self = (PackedInt32Array *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_int64_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedInt64Array *self = (PackedInt64Array *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_vector2_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedVector2Array *self = (PackedVector2Array *)p_self;
+	return self->resize(p_size);
+}
+
+static GDExtensionInt gdextension_packed_vector3_array_resize_uninitialized(GDExtensionTypePtr p_self, GDExtensionInt p_size) {
+	PackedVector3Array *self = (PackedVector3Array *)p_self;
+	return self->resize(p_size);
+}
+
 static GDExtensionVariantPtr gdextension_array_operator_index(GDExtensionTypePtr p_self, GDExtensionInt p_index) {
 	Array *self = (Array *)p_self;
 	if (unlikely(p_index < 0 || p_index >= self->size())) {
@@ -1131,6 +1171,21 @@ static void gdextension_object_method_bind_ptrcall(GDExtensionMethodBindPtr p_me
 	mb->ptrcall(o, (const void **)p_args, p_ret);
 }
 
+static void gdextension_object_method_bind_ptrcall_batch(GDExtensionMethodBindPtr p_method_bind, GDExtensionObjectPtr p_instance, const GDExtensionConstTypePtr *const *p_args, GDExtensionTypePtr *r_rets, GDExtensionInt p_call_count) {
+	const MethodBind *mb = reinterpret_cast<const MethodBind *>(p_method_bind);
+	Object *o = (Object *)p_instance;
+	ERR_FAIL_COND_MSG(!r_rets && mb->has_return(), "Return value pointers must be provided for methods that return a value.");
+	if (r_rets) {
+		for (GDExtensionInt i = 0; i < p_call_count; i++) {
+			mb->ptrcall(o, (const void **)p_args[i], r_rets[i]);
+		}
+	} else {
+		for (GDExtensionInt i = 0; i < p_call_count; i++) {
+			mb->ptrcall(o, (const void **)p_args[i], nullptr);
+		}
+	}
+}
+
 static void gdextension_object_destroy(GDExtensionObjectPtr p_o) {
 	memdelete((Object *)p_o);
 }
@@ -1482,6 +1537,14 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(packed_vector2_array_operator_index_const);
 	REGISTER_INTERFACE_FUNC(packed_vector3_array_operator_index);
 	REGISTER_INTERFACE_FUNC(packed_vector3_array_operator_index_const);
+	REGISTER_INTERFACE_FUNC(packed_byte_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_color_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_float32_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_float64_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_int32_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_int64_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_vector2_array_resize_uninitialized);
+	REGISTER_INTERFACE_FUNC(packed_vector3_array_resize_uninitialized);
 	REGISTER_INTERFACE_FUNC(array_operator_index);
 	REGISTER_INTERFACE_FUNC(array_operator_index_const);
 	REGISTER_INTERFACE_FUNC(array_ref);
@@ -1490,6 +1553,7 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(dictionary_operator_index_const);
 	REGISTER_INTERFACE_FUNC(object_method_bind_call);
 	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall);
+	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall_batch);
 	REGISTER_INTERFACE_FUNC(object_destroy);
 	REGISTER_INTERFACE_FUNC(global_get_singleton);
 	REGISTER_INTERFACE_FUNC(object_get_instance_binding);
@@ -2037,6 +2037,147 @@ typedef GDExtensionTypePtr (*GDExtensionInterfacePackedVector3ArrayOperatorIndex
  */
 typedef GDExtensionTypePtr (*GDExtensionInterfacePackedVector3ArrayOperatorIndexConst)(GDExtensionConstTypePtr p_self, GDExtensionInt p_index);
 
+/**
+ * @name packed_byte_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedByteArray without initializing the new elements.
+ *
+ * Unlike calling the "resize" method, the added elements are not zero-filled, which avoids
+ * redundant work when the whole buffer is about to be overwritten. The contents of the added
+ * elements are unspecified until written. Use the operator_index function to get a pointer to
+ * the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedByteArray object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedByteArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_color_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedColorArray without zero-filling the new elements.
+ *
+ * The added elements are default-constructed, as Color has a constructor, so this behaves like
+ * calling the "resize" method. It is provided so the same code path can be used for every
+ * packed array type. Use the operator_index function to get a pointer to the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedColorArray object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedColorArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_float32_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedFloat32Array without initializing the new elements.
+ *
+ * Unlike calling the "resize" method, the added elements are not zero-filled, which avoids
+ * redundant work when the whole buffer is about to be overwritten. The contents of the added
+ * elements are unspecified until written. Use the operator_index function to get a pointer to
+ * the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedFloat32Array object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedFloat32ArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_float64_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedFloat64Array without initializing the new elements.
+ *
+ * Unlike calling the "resize" method, the added elements are not zero-filled, which avoids
+ * redundant work when the whole buffer is about to be overwritten. The contents of the added
+ * elements are unspecified until written. Use the operator_index function to get a pointer to
+ * the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedFloat64Array object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedFloat64ArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_int32_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedInt32Array without initializing the new elements.
+ *
+ * Unlike calling the "resize" method, the added elements are not zero-filled, which avoids
+ * redundant work when the whole buffer is about to be overwritten. The contents of the added
+ * elements are unspecified until written. Use the operator_index function to get a pointer to
+ * the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedInt32Array object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedInt32ArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_int64_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedInt64Array without initializing the new elements.
+ *
+ * Unlike calling the "resize" method, the added elements are not zero-filled, which avoids
+ * redundant work when the whole buffer is about to be overwritten. The contents of the added
+ * elements are unspecified until written. Use the operator_index function to get a pointer to
+ * the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedInt64Array object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedInt64ArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_vector2_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedVector2Array without zero-filling the new elements.
+ *
+ * The added elements are default-constructed, as Vector2 has a constructor, so this behaves like
+ * calling the "resize" method. It is provided so the same code path can be used for every
+ * packed array type. Use the operator_index function to get a pointer to the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedVector2Array object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedVector2ArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
+/**
+ * @name packed_vector3_array_resize_uninitialized
+ * @since 4.2
+ *
+ * Resizes a PackedVector3Array without zero-filling the new elements.
+ *
+ * The added elements are default-constructed, as Vector3 has a constructor, so this behaves like
+ * calling the "resize" method. It is provided so the same code path can be used for every
+ * packed array type. Use the operator_index function to get a pointer to the array data afterwards.
+ *
+ * @param p_self A pointer to a PackedVector3Array object.
+ * @param p_size The new size of the array.
+ *
+ * @return Error code signifying if the operation successful.
+ */
+typedef GDExtensionInt (*GDExtensionInterfacePackedVector3ArrayResizeUninitialized)(GDExtensionTypePtr p_self, GDExtensionInt p_size);
+
 /**
  * @name array_operator_index
  * @since 4.1
@@ -2145,6 +2286,23 @@ typedef void (*GDExtensionInterfaceObjectMethodBindCall)(GDExtensionMethodBindPt
  */
 typedef void (*GDExtensionInterfaceObjectMethodBindPtrcall)(GDExtensionMethodBindPtr p_method_bind, GDExtensionObjectPtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_ret);
 
+/**
+ * @name object_method_bind_ptrcall_batch
+ * @since 4.2
+ *
+ * Calls the same method on an Object several times (using "ptrcalls"), with a different set of arguments for each call.
+ *
+ * This is meant for hot loops calling engine singletons, such as setting the transforms of many
+ * RenderingServer instances, as it avoids crossing the interface boundary once per call.
+ *
+ * @param p_method_bind A pointer to the MethodBind representing the method on the Object's class.
+ * @param p_instance A pointer to the Object.
+ * @param p_args A pointer to a C array of p_call_count argument arrays, one per call.
+ * @param r_rets A pointer to a C array of p_call_count pointers that will receive the return values. Can only be NULL if the method doesn't return a value.
+ * @param p_call_count The number of calls to make.
+ */
+typedef void (*GDExtensionInterfaceObjectMethodBindPtrcallBatch)(GDExtensionMethodBindPtr p_method_bind, GDExtensionObjectPtr p_instance, const GDExtensionConstTypePtr *const *p_args, GDExtensionTypePtr *r_rets, GDExtensionInt p_call_count);
+
 /**
  * @name object_destroy
  * @since 4.1
@@ -556,6 +556,7 @@ void Input::_parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_em
 			touch_event->set_position(mb->get_position());
 			touch_event->set_double_tap(mb->is_double_click());
 			touch_event->set_device(InputEvent::DEVICE_ID_EMULATION);
+			touch_event->set_timestamp(mb->get_timestamp());
 			_THREAD_SAFE_UNLOCK_
 			event_dispatch_function(touch_event);
 			_THREAD_SAFE_LOCK_
@@ -583,6 +584,7 @@ void Input::_parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_em
 			drag_event->set_pressure(mm->get_pressure());
 			drag_event->set_velocity(get_last_mouse_velocity());
 			drag_event->set_device(InputEvent::DEVICE_ID_EMULATION);
+			drag_event->set_timestamp(mm->get_timestamp());
 
 			_THREAD_SAFE_UNLOCK_
 			event_dispatch_function(drag_event);
@@ -621,6 +623,7 @@ void Input::_parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_em
 				button_event.instantiate();
 
 				button_event->set_device(InputEvent::DEVICE_ID_EMULATION);
+				button_event->set_timestamp(st->get_timestamp());
 				button_event->set_position(st->get_position());
 				button_event->set_global_position(st->get_position());
 				button_event->set_pressed(st->is_pressed());
@@ -653,6 +656,7 @@ void Input::_parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_em
 			motion_event.instantiate();
 
 			motion_event->set_device(InputEvent::DEVICE_ID_EMULATION);
+			motion_event->set_timestamp(sd->get_timestamp());
 			motion_event->set_tilt(sd->get_tilt());
 			motion_event->set_pen_inverted(sd->get_pen_inverted());
 			motion_event->set_pressure(sd->get_pressure());
@@ -960,6 +964,13 @@ void Input::parse_input_event(const Ref<InputEvent> &p_event) {
 
 	ERR_FAIL_COND(p_event.is_null());
 
+	if (p_event->timestamp == 0 || p_event->timestamp_from_input) {
+		// Platforms that know when the event happened set it before. Otherwise use the time it reached the engine,
+		// which is also renewed when an event is parsed again on a later frame.
+		p_event->timestamp = OS::get_singleton()->get_ticks_usec();
+		p_event->timestamp_from_input = true;
+	}
+
 #ifdef DEBUG_ENABLED
 	uint64_t curr_frame = Engine::get_singleton()->get_process_frames();
 	if (curr_frame != last_parsed_frame) {
@@ -988,6 +999,11 @@ void Input::parse_input_event(const Ref<InputEvent> &p_event) {
 	if (use_accumulated_input) {
 		if (buffered_events.is_empty() || !buffered_events.back()->get()->accumulate(p_event)) {
 			buffered_events.push_back(p_event);
+		} else {
+			// The merged event reflects the state of the latest one.
+			const Ref<InputEvent> &merged = buffered_events.back()->get();
+			merged->timestamp = p_event->timestamp;
+			merged->timestamp_from_input = p_event->timestamp_from_input;
 		}
 	} else if (use_input_buffering) {
 		buffered_events.push_back(p_event);
@@ -47,6 +47,15 @@ int InputEvent::get_device() const {
 	return device;
 }
 
+void InputEvent::set_timestamp(uint64_t p_timestamp) {
+	timestamp = p_timestamp;
+	timestamp_from_input = false;
+}
+
+uint64_t InputEvent::get_timestamp() const {
+	return timestamp;
+}
+
 bool InputEvent::is_action(const StringName &p_action, bool p_exact_match) const {
 	return InputMap::get_singleton()->event_is_action(Ref<InputEvent>(const_cast<InputEvent *>(this)), p_action, p_exact_match);
 }
@@ -110,6 +119,8 @@ bool InputEvent::is_action_type() const {
 void InputEvent::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_device", "device"), &InputEvent::set_device);
 	ClassDB::bind_method(D_METHOD("get_device"), &InputEvent::get_device);
+	ClassDB::bind_method(D_METHOD("set_timestamp", "timestamp"), &InputEvent::set_timestamp);
+	ClassDB::bind_method(D_METHOD("get_timestamp"), &InputEvent::get_timestamp);
 
 	ClassDB::bind_method(D_METHOD("is_action", "action", "exact_match"), &InputEvent::is_action, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("is_action_pressed", "action", "allow_echo", "exact_match"), &InputEvent::is_action_pressed, DEFVAL(false), DEFVAL(false));
@@ -697,6 +708,7 @@ Ref<InputEvent> InputEventMouseButton::xformed_by(const Transform2D &p_xform, co
 	mb.instantiate();
 
 	mb->set_device(get_device());
+	mb->set_timestamp(get_timestamp());
 	mb->set_window_id(get_window_id());
 	mb->set_modifiers_from_event(this);
 
@@ -898,6 +910,7 @@ Ref<InputEvent> InputEventMouseMotion::xformed_by(const Transform2D &p_xform, co
 	mm.instantiate();
 
 	mm->set_device(get_device());
+	mm->set_timestamp(get_timestamp());
 	mm->set_window_id(get_window_id());
 
 	mm->set_modifiers_from_event(this);
@@ -1287,6 +1300,7 @@ Ref<InputEvent> InputEventScreenTouch::xformed_by(const Transform2D &p_xform, co
 	Ref<InputEventScreenTouch> st;
 	st.instantiate();
 	st->set_device(get_device());
+	st->set_timestamp(get_timestamp());
 	st->set_window_id(get_window_id());
 	st->set_index(index);
 	st->set_position(p_xform.xform(pos + p_local_ofs));
@@ -1394,6 +1408,7 @@ Ref<InputEvent> InputEventScreenDrag::xformed_by(const Transform2D &p_xform, con
 	sd.instantiate();
 
 	sd->set_device(get_device());
+	sd->set_timestamp(get_timestamp());
 	sd->set_window_id(get_window_id());
 
 	sd->set_index(index);
@@ -1586,6 +1601,7 @@ Ref<InputEvent> InputEventMagnifyGesture::xformed_by(const Transform2D &p_xform,
 	ev.instantiate();
 
 	ev->set_device(get_device());
+	ev->set_timestamp(get_timestamp());
 	ev->set_window_id(get_window_id());
 
 	ev->set_modifiers_from_event(this);
@@ -1626,6 +1642,7 @@ Ref<InputEvent> InputEventPanGesture::xformed_by(const Transform2D &p_xform, con
 	ev.instantiate();
 
 	ev->set_device(get_device());
+	ev->set_timestamp(get_timestamp());
 	ev->set_window_id(get_window_id());
 
 	ev->set_modifiers_from_event(this);
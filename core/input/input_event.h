@@ -54,6 +54,10 @@ class InputEvent : public Resource {
 	GDCLASS(InputEvent, Resource);
 
 	int device = 0;
+	uint64_t timestamp = 0;
+	bool timestamp_from_input = false; // Assigned by Input on arrival, rather than reported by the platform.
+
+	friend class Input;
 
 protected:
 	bool canceled = false;
@@ -68,6 +72,9 @@ public:
 	void set_device(int p_device);
 	int get_device() const;
 
+	void set_timestamp(uint64_t p_timestamp);
+	uint64_t get_timestamp() const;
+
 	bool is_action(const StringName &p_action, bool p_exact_match = false) const;
 	bool is_action_pressed(const StringName &p_action, bool p_allow_echo = false, bool p_exact_match = false) const;
 	bool is_action_released(const StringName &p_action, bool p_exact_match = false) const;
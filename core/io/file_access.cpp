@@ -494,6 +494,23 @@ Vector<uint8_t> FileAccess::get_buffer(int64_t p_length) const {
 	return data;
 }
 
+const uint8_t *FileAccess::get_mapped_buffer(uint64_t p_length) {
+	const uint64_t position = get_position();
+	const uint64_t length = get_length();
+	if (p_length == 0 || position + p_length > length) {
+		return nullptr;
+	}
+
+	// Map the whole file, so the following calls reuse the same mapping.
+	const uint8_t *data = map_region(0, length);
+	if (!data) {
+		return nullptr;
+	}
+
+	seek(position + p_length);
+	return data + position;
+}
+
 String FileAccess::get_as_utf8_string(bool p_skip_cr) const {
 	Vector<uint8_t> sourcef;
 	uint64_t len = get_length();
@@ -149,6 +149,13 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+
+	/**
+	 * Memory mapping, only provided by some implementations and for files opened for reading.
+	 * The data stays valid until the file is closed or a region outside of it is mapped.
+	 */
+	virtual const uint8_t *map_region(uint64_t p_offset, uint64_t p_length) const { return nullptr; } ///< map a read-only region of the file, or return nullptr if not supported
+	const uint8_t *get_mapped_buffer(uint64_t p_length); ///< get the next bytes without copying them and skip past them, or return nullptr if the file can't be mapped
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
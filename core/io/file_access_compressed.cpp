@@ -30,6 +30,7 @@
 
 #include "file_access_compressed.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
@@ -125,6 +126,17 @@ Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags
 	return OK;
 }
 
+void FileAccessCompressed::_compress_block(uint32_t p_index, void *p_userdata) {
+	uint32_t bc = write_blocks.size();
+	uint32_t bl = p_index == (bc - 1) ? write_max % block_size : block_size;
+	uint8_t *bp = &write_ptr[p_index * block_size];
+
+	Vector<uint8_t> &cblock = write_blocks.write[p_index];
+	cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
+	int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+	cblock.resize(MAX(s, 0));
+}
+
 void FileAccessCompressed::_close() {
 	if (f.is_null()) {
 		return;
@@ -144,26 +156,30 @@ void FileAccessCompressed::_close() {
 			f->store_32(0); //compressed sizes, will update later
 		}
 
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+		// Blocks are compressed independently, so they can be processed in parallel and stored in order afterwards.
+		write_blocks.resize(bc);
+		WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+		if (bc >= PARALLEL_COMPRESS_MIN_BLOCKS && wtp && wtp->get_thread_count() > 1) {
+			WorkerThreadPool::GroupID group_task = wtp->add_template_group_task(this, &FileAccessCompressed::_compress_block, (void *)nullptr, bc, -1, true, SNAME("FileAccessCompressedBlocks"));
+			wtp->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < bc; i++) {
+				_compress_block(i, nullptr);
+			}
+		}
 
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+		for (uint32_t i = 0; i < bc; i++) {
+			f->store_buffer(write_blocks[i].ptr(), write_blocks[i].size());
 		}
 
 		f->seek(16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
+			f->store_32(write_blocks[i].size());
 		}
 		f->seek_end();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
 
+		write_blocks.clear();
 		buffer.clear();
 
 	} else {
@@ -302,9 +318,14 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
+	uint64_t dst_idx = 0;
+	while (dst_idx < p_length) {
+		// Copy whatever is left of the decompressed block in one go.
+		uint64_t to_copy = MIN(p_length - dst_idx, read_pos < read_block_size ? read_block_size - read_pos : 0);
+		memcpy(p_dst + dst_idx, read_ptr + read_pos, to_copy);
+		dst_idx += to_copy;
+		read_pos += to_copy;
+
 		if (read_pos >= read_block_size) {
 			read_block++;
 
@@ -319,10 +340,10 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 			} else {
 				read_block--;
 				at_end = true;
-				if (i + 1 < p_length) {
+				if (dst_idx < p_length) {
 					read_eof = true;
 				}
-				return i + 1;
+				return dst_idx;
 			}
 		}
 	}
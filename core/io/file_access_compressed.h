@@ -63,6 +63,14 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	enum {
+		// Below this many blocks, dispatching to the worker threads costs more than it saves.
+		PARALLEL_COMPRESS_MIN_BLOCKS = 4,
+	};
+
+	Vector<Vector<uint8_t>> write_blocks; // Compressed blocks, filled in by _compress_block() on close.
+
+	void _compress_block(uint32_t p_index, void *p_userdata);
 	void _close();
 
 public:
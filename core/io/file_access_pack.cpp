@@ -337,6 +337,17 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::map_region(uint64_t p_offset, uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), nullptr, "File must be opened before use.");
+
+	// Encrypted files have to be decrypted, they can't be read in place.
+	if (pf.encrypted || p_offset + p_length > pf.size) {
+		return nullptr;
+	}
+
+	return f->map_region(off + p_offset, p_length);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -172,6 +172,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
 
+	virtual const uint8_t *map_region(uint64_t p_offset, uint64_t p_length) const override;
+
 	virtual void set_big_endian(bool p_big_endian) override;
 
 	virtual Error get_error() const override;
@@ -46,38 +46,48 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
+void JSON::_append_indent(StringBuilder &r_out, const String &p_indent, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		r_out += p_indent;
+	}
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
+void JSON::_stringify(StringBuilder &r_out, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (unlikely(p_cur_indent > Variant::MAX_RECURSION_DEPTH)) {
+		r_out += "...";
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
+	}
 
-	String colon = ":";
-	String end_statement = "";
+	// Only string literals may be appended as C strings, the builder keeps the pointers.
+	const char *colon = ":";
+	const char *end_statement = "";
 
 	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+		colon = ": ";
+		end_statement = "\n";
 	}
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_out += "null";
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_out += p_var.operator bool() ? "true" : "false";
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_out += itos(p_var);
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 			if (p_full_precision) {
 				// Store unreliable digits (17) instead of just reliable
 				// digits (14) so that the value can be decoded exactly.
-				return String::num(num, 17 - (int)floor(log10(num)));
+				r_out += String::num(num, 17 - (int)floor(log10(num)));
 			} else {
 				// Store only reliable digits (14) by default.
-				return String::num(num, 14 - (int)floor(log10(num)));
+				r_out += String::num(num, 14 - (int)floor(log10(num)));
 			}
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -87,33 +97,45 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.size() == 0) {
-				return "[]";
+				r_out += "[]";
+				return;
 			}
-			String s = "[";
-			s += end_statement;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
+			if (unlikely(p_markers.has(a.id()))) {
+				r_out += "\"[...]\"";
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(a.id());
 
+			r_out += "[";
+			r_out += end_statement;
+
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					r_out += ",";
+					r_out += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_append_indent(r_out, p_indent, p_cur_indent + 1);
+				_stringify(r_out, a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			r_out += end_statement;
+			_append_indent(r_out, p_indent, p_cur_indent);
+			r_out += "]";
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (unlikely(p_markers.has(d.id()))) {
+				r_out += "\"{...}\"";
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
+			r_out += "{";
+			r_out += end_statement;
+
 			List<Variant> keys;
 			d.get_key_list(&keys);
 
@@ -126,20 +148,26 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_out += ",";
+					r_out += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_append_indent(r_out, p_indent, p_cur_indent + 1);
+				_stringify(r_out, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_out += colon;
+				_stringify(r_out, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			r_out += end_statement;
+			_append_indent(r_out, p_indent, p_cur_indent);
+			r_out += "}";
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_out += "\"";
+			r_out += String(p_var).json_escape();
+			r_out += "\"";
+			return;
 	}
 }
 
@@ -313,10 +341,16 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						str += res;
 
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
+						// Copy the whole run of unescaped characters at once.
+						const int run_start = index;
+						while (p_str[index] != 0 && p_str[index] != '"' && p_str[index] != '\\') {
+							if (p_str[index] == '\n') {
+								line++;
+							}
+							index++;
 						}
-						str += p_str[index];
+						str += String(&p_str[run_start], index - run_start);
+						continue;
 					}
 					index++;
 				}
@@ -342,15 +376,13 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 					return OK;
 
 				} else if (is_ascii_char(p_str[index])) {
-					String id;
-
+					const int id_start = index;
 					while (is_ascii_char(p_str[index])) {
-						id += p_str[index];
 						index++;
 					}
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = String(&p_str[id_start], index - id_start);
 					return OK;
 				} else {
 					r_err_str = "Unexpected character.";
@@ -560,10 +592,10 @@ String JSON::get_parsed_text() const {
 }
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	Ref<JSON> jason;
-	jason.instantiate();
+	StringBuilder out;
 	HashSet<const void *> markers;
-	return jason->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	_stringify(out, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return out.as_string();
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -53,6 +53,15 @@ public:
 		TYPE_UDP,
 	};
 
+	// A datagram for batched receive/send. When receiving, `len` is the buffer capacity on input,
+	// and the datagram size on output.
+	struct Datagram {
+		uint8_t *buffer = nullptr;
+		int len = 0;
+		IPAddress ip;
+		uint16_t port = 0;
+	};
+
 	virtual Error open(Type p_type, IP::Type &ip_type) = 0;
 	virtual void close() = 0;
 	virtual Error bind(IPAddress p_addr, uint16_t p_port) = 0;
@@ -65,6 +74,11 @@ public:
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) = 0;
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port) = 0;
 
+	// Receive/send multiple datagrams at once. The default implementation calls recvfrom/sendto in a loop.
+	// Return ERR_BUSY if no datagram could be received/sent, otherwise OK and the number of datagrams processed.
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received);
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent);
+
 	virtual bool is_open() const = 0;
 	virtual int get_available_bytes() const = 0;
 	virtual Error get_socket_address(IPAddress *r_ip, uint16_t *r_port) const = 0;
@@ -255,6 +255,7 @@ void PacketPeerUDP::close() {
 		_sock->close();
 	}
 	rb.resize(16);
+	recv_buffer.reset();
 	queue_count = 0;
 	connected = false;
 }
@@ -274,19 +275,20 @@ Error PacketPeerUDP::_poll() {
 		return OK; // Handled by UDPServer.
 	}
 
+	if (recv_buffer.is_empty()) {
+		recv_buffer.resize(RECV_BATCH_SIZE * PACKET_BUFFER_SIZE);
+	}
+
 	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	int received;
 
 	while (true) {
-		if (connected) {
-			err = _sock->recv(recv_buffer, sizeof(recv_buffer), read);
-			ip = peer_addr;
-			port = peer_port;
-		} else {
-			err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
+		for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+			recv_batch[i].buffer = &recv_buffer[i * PACKET_BUFFER_SIZE];
+			recv_batch[i].len = PACKET_BUFFER_SIZE;
 		}
+		// A connected socket only receives from its peer, so recvfrom is equivalent to recv.
+		err = _sock->recvfrom_batch(recv_batch, RECV_BATCH_SIZE, received);
 
 		if (err != OK) {
 			if (err == ERR_BUSY) {
@@ -295,12 +297,22 @@ Error PacketPeerUDP::_poll() {
 			return FAILED;
 		}
 
-		err = store_packet(ip, port, recv_buffer, read);
+		for (int i = 0; i < received; i++) {
+			const NetSocket::Datagram &d = recv_batch[i];
+			if (connected) {
+				err = store_packet(peer_addr, peer_port, d.buffer, d.len);
+			} else {
+				err = store_packet(d.ip, d.port, d.buffer, d.len);
+			}
 #ifdef TOOLS_ENABLED
-		if (err != OK) {
-			WARN_PRINT("Buffer full, dropping packets!");
-		}
+			if (err != OK) {
+				WARN_PRINT("Buffer full, dropping packets!");
+			}
 #endif
+		}
+		if (received < RECV_BATCH_SIZE) {
+			break; // The socket queue has been drained.
+		}
 	}
 
 	return OK;
@@ -37,6 +37,7 @@
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -155,14 +156,19 @@ StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
+		const uint8_t *mapped_str = f->get_mapped_buffer(len);
+		if (mapped_str) {
+			s.parse_utf8((const char *)mapped_str, len);
+			return s;
+		}
+		if ((int)len > str_buf.size()) {
+			str_buf.resize(len);
+		}
+		f->get_buffer((uint8_t *)&str_buf[0], len);
 		s.parse_utf8(&str_buf[0]);
 		return s;
 	}
@@ -408,11 +414,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					const HashMap<String, Ref<Resource>> &index_cache = chunk_owner ? chunk_owner->internal_index_cache : internal_index_cache;
+					const Ref<Resource> *cached = index_cache.getptr(path);
+					if (!cached) {
 						WARN_PRINT(String("Couldn't load resource (no cache): " + path).utf8().get_data());
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = *cached;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
@@ -426,8 +434,9 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						path = ProjectSettings::get_singleton()->localize_path(res_path.get_base_dir().path_join(path));
 					}
 
-					if (remaps.find(path)) {
-						path = remaps[path];
+					const HashMap<String, String> &path_remaps = chunk_owner ? chunk_owner->remaps : remaps;
+					if (path_remaps.has(path)) {
+						path = path_remaps[path];
 					}
 
 					Ref<Resource> res = ResourceLoader::load(path, exttype);
@@ -445,8 +454,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
+					} else if (external_resources[erindex].cache.is_valid()) {
+						r_v = external_resources[erindex].cache;
 					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
+						const Ref<ResourceLoader::LoadToken> &load_token = external_resources[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
 							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
@@ -694,173 +705,301 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	LocalVector<IntResourceLoad> loads;
+	loads.resize(internal_resources.size());
+
+	// Waiting for a group from a pool thread can deadlock when every worker is busy doing the
+	// same, so a load already running as a task reads the properties serially.
+	bool parallel = use_sub_threads && !compressed && !file_path.is_empty() && internal_resources.size() >= PARALLEL_LOAD_MIN_RESOURCES && !WorkerThreadPool::get_singleton()->is_pool_thread();
+	if (parallel) {
+		// A cyclic load is only detected from the thread in charge of it, so the workers must not
+		// wait for the external resources. Wait for all of them here instead, and read the file
+		// on this thread alone if any of them isn't available.
+		for (int i = 0; i < external_resources.size() && parallel; i++) {
+			ExtResource &er = external_resources.write[i];
+			if (er.load_token.is_valid()) {
+				Error err;
+				er.cache = ResourceLoader::_load_complete(*er.load_token.ptr(), &err);
+				parallel = err == OK && er.cache.is_valid();
+			}
+		}
+	}
+
 	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+		IntResourceLoad &load = loads[i];
+		Error err = _create_internal_resource(i, load);
+		if (err != OK) {
+			return err;
+		}
+		if (parallel || load.skipped) {
+			continue;
+		}
+
+		err = _read_internal_resource_properties(load);
+		if (err != OK) {
+			return err;
+		}
+		_set_internal_resource_properties(load);
+
+		if (progress) {
+			*progress = (i + 1) / float(internal_resources.size());
+		}
 
-		//maybe it is loaded already
-		String path;
-		String id;
+		resource_cache.push_back(load.resource);
 
-		if (!main) {
-			path = internal_resources[i].path;
+		if (load.main) {
+			f.unref();
+			resource = load.resource;
+			resource->set_as_translation_remapped(translation_remapped);
+			error = OK;
+			return OK;
+		}
+	}
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	if (parallel) {
+		IntResourceChunks chunks;
+		chunks.loads = loads.ptr();
+		chunks.load_count = loads.size();
+		const uint32_t chunk_count = CLAMP((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count() * 4, 1u, loads.size());
+		chunks.chunk_size = (loads.size() + chunk_count - 1) / chunk_count;
 
-				internal_resources.write[i].path = path; // Update path.
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_read_internal_resources_chunk, &chunks, chunk_count, -1, true, SNAME("ResourceLoaderBinaryProperties"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (uint32_t i = 0; i < loads.size(); i++) {
+			IntResourceLoad &load = loads[i];
+			if (load.skipped) {
+				continue;
+			}
+			if (load.error != OK) {
+				error = load.error;
+				return error;
 			}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
+			_set_internal_resource_properties(load);
+			load.properties.clear();
+
+			if (progress) {
+				*progress = (i + 1) / float(internal_resources.size());
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			resource_cache.push_back(load.resource);
+
+			if (load.main) {
+				f.unref();
+				resource = load.resource;
+				resource->set_as_translation_remapped(translation_remapped);
+				error = OK;
+				return OK;
 			}
 		}
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	return ERR_FILE_EOF;
+}
 
-		f->seek(offset);
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, IntResourceLoad &r_load) {
+	bool main = p_index == (internal_resources.size() - 1);
+	r_load.main = main;
 
-		String t = get_unicode_string();
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		Ref<Resource> res;
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-			//use the existing one
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
+		}
+
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
 			Ref<Resource> cached = ResourceCache::get_ref(path);
-			if (cached->get_class() == t) {
-				cached->reset_state();
-				res = cached;
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				r_load.skipped = true;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
+	}
 
-		MissingResource *missing_resource = nullptr;
+	uint64_t offset = internal_resources[p_index].offset;
 
-		if (res.is_null()) {
-			//did not replace
+	f->seek(offset);
 
-			Object *obj = ClassDB::instantiate(t);
-			if (!obj) {
-				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-					//create a missing resource
-					missing_resource = memnew(MissingResource);
-					missing_resource->set_original_class(t);
-					missing_resource->set_recording_properties(true);
-					obj = missing_resource;
-				} else {
-					error = ERR_FILE_CORRUPT;
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-				}
-			}
+	String t = get_unicode_string();
+
+	Ref<Resource> res;
+
+	if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+		//use the existing one
+		Ref<Resource> cached = ResourceCache::get_ref(path);
+		if (cached->get_class() == t) {
+			cached->reset_state();
+			res = cached;
+		}
+	}
 
-			Resource *r = Object::cast_to<Resource>(obj);
-			if (!r) {
-				String obj_class = obj->get_class();
+	MissingResource *missing_resource = nullptr;
+
+	if (res.is_null()) {
+		//did not replace
+
+		Object *obj = ClassDB::instantiate(t);
+		if (!obj) {
+			if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				//create a missing resource
+				missing_resource = memnew(MissingResource);
+				missing_resource->set_original_class(t);
+				missing_resource->set_recording_properties(true);
+				obj = missing_resource;
+			} else {
 				error = ERR_FILE_CORRUPT;
-				memdelete(obj); //bye
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 			}
+		}
 
-			res = Ref<Resource>(r);
-			if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
-			}
-			r->set_scene_unique_id(id);
+		Resource *r = Object::cast_to<Resource>(obj);
+		if (!r) {
+			String obj_class = obj->get_class();
+			error = ERR_FILE_CORRUPT;
+			memdelete(obj); //bye
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		res = Ref<Resource>(r);
+		if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+			r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		int pc = f->get_32();
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		//set properties
+	r_load.resource = res;
+	r_load.missing_resource = missing_resource;
+	r_load.property_count = f->get_32();
+	r_load.properties_offset = f->get_position();
 
-		Dictionary missing_resource_properties;
+	return OK;
+}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+Error ResourceLoaderBinary::_read_internal_resource_properties(IntResourceLoad &r_load) {
+	f->seek(r_load.properties_offset);
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	r_load.properties.resize(r_load.property_count);
+	for (uint32_t j = 0; j < r_load.property_count; j++) {
+		StringName name = _get_string();
+
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
 
-			Variant value;
+		r_load.properties[j].first = name;
+		error = parse_variant(r_load.properties[j].second);
+		if (error) {
+			return error;
+		}
+	}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+	return OK;
+}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+void ResourceLoaderBinary::_set_internal_resource_properties(IntResourceLoad &r_load) {
+	Ref<Resource> &res = r_load.resource;
+	MissingResource *missing_resource = r_load.missing_resource;
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+	Dictionary missing_resource_properties;
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+	for (Pair<StringName, Variant> &property : r_load.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
 
-			if (set_valid) {
-				res->set(name, value);
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		if (set_valid) {
+			res->set(name, value);
 		}
+	}
+
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
 #ifdef TOOLS_ENABLED
-		res->set_edited(false);
+	res->set_edited(false);
 #endif
+}
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+void ResourceLoaderBinary::_read_internal_resources_chunk(uint32_t p_chunk, IntResourceChunks *p_chunks) {
+	const uint32_t from = p_chunk * p_chunks->chunk_size;
+	const uint32_t to = MIN(from + p_chunks->chunk_size, p_chunks->load_count);
+
+	// Each chunk reads through its own file and string buffer. The vectors are copy-on-write and
+	// the maps are read from this loader, so setting up the reader copies nothing per resource.
+	ResourceLoaderBinary chunk_loader;
+	chunk_loader.chunk_owner = this;
+	chunk_loader.local_path = local_path;
+	chunk_loader.res_path = res_path;
+	chunk_loader.ver_format = ver_format;
+	chunk_loader.using_named_scene_ids = using_named_scene_ids;
+	chunk_loader.string_map = string_map;
+	chunk_loader.internal_resources = internal_resources;
+	chunk_loader.external_resources = external_resources;
+	chunk_loader.f = FileAccess::open(file_path, FileAccess::READ);
+	for (uint32_t i = from; i < to; i++) {
+		IntResourceLoad &load = p_chunks->loads[i];
+		if (load.skipped) {
+			continue;
 		}
-
-		resource_cache.push_back(res);
-
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
-			return OK;
+		if (chunk_loader.f.is_null()) {
+			load.error = ERR_FILE_CANT_OPEN;
+			continue;
 		}
+		chunk_loader.f->set_big_endian(f->is_big_endian());
+		chunk_loader.f->real_is_double = f->real_is_double;
+		load.error = chunk_loader._read_internal_resource_properties(load);
 	}
-
-	return ERR_FILE_EOF;
 }
 
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
@@ -885,14 +1024,19 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
+	if (len <= 0) {
+		return String();
+	}
+	String s;
+	const uint8_t *mapped_str = f->get_mapped_buffer(len);
+	if (mapped_str) {
+		s.parse_utf8((const char *)mapped_str, len);
+		return s;
+	}
 	if (len > str_buf.size()) {
 		str_buf.resize(len);
 	}
-	if (len == 0) {
-		return String();
-	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
-	String s;
 	s.parse_utf8(&str_buf[0]);
 	return s;
 }
@@ -960,6 +1104,7 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 			ERR_FAIL_MSG("Failed to open binary resource file: " + local_path + ".");
 		}
 		f = fac;
+		compressed = true;
 
 	} else if (header[0] != 'R' || header[1] != 'S' || header[2] != 'R' || header[3] != 'C') {
 		// Not normal.
@@ -1191,6 +1336,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
+	loader.file_path = p_path;
 	loader.open(f);
 
 	err = loader.load();
@@ -34,6 +34,9 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -61,6 +64,7 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		Ref<Resource> cache; // Resolved before reading properties on other threads.
 	};
 
 	bool using_named_scene_ids = false;
@@ -78,6 +82,39 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	enum {
+		// Below this many internal resources, reading their properties on other threads isn't worth it.
+		PARALLEL_LOAD_MIN_RESOURCES = 16,
+	};
+
+	// Internal resources are created first, then their properties are read and set in file order.
+	// With sub-threads, the properties of all of them can be read concurrently before being set.
+	struct IntResourceLoad {
+		Ref<Resource> resource;
+		MissingResource *missing_resource = nullptr;
+		bool main = false;
+		bool skipped = false; // Reused from the cache, nothing to read.
+		uint64_t properties_offset = 0;
+		uint32_t property_count = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	struct IntResourceChunks {
+		IntResourceLoad *loads = nullptr;
+		uint32_t load_count = 0;
+		uint32_t chunk_size = 0;
+	};
+
+	String file_path; // Used to open the file again from other threads.
+	bool compressed = false;
+	const ResourceLoaderBinary *chunk_owner = nullptr; // Set on chunk readers, which share the owner's lookup tables.
+
+	Error _create_internal_resource(int p_index, IntResourceLoad &r_load);
+	Error _read_internal_resource_properties(IntResourceLoad &r_load);
+	void _set_internal_resource_properties(IntResourceLoad &r_load);
+	void _read_internal_resources_chunk(uint32_t p_chunk, IntResourceChunks *p_chunks);
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
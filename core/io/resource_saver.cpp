@@ -40,6 +40,8 @@ int ResourceSaver::saver_count = 0;
 bool ResourceSaver::timestamp_on_save = false;
 ResourceSavedCallback ResourceSaver::save_callback = nullptr;
 ResourceSaverGetResourceIDForPath ResourceSaver::save_get_id_for_path = nullptr;
+Mutex ResourceSaver::thread_save_mutex;
+HashMap<String, ResourceSaver::ThreadSaveTask *> ResourceSaver::thread_save_tasks;
 
 Error ResourceFormatSaver::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
 	Error err = ERR_METHOD_NOT_FOUND;
@@ -97,14 +99,17 @@ void ResourceFormatSaver::_bind_methods() {
 	GDVIRTUAL_BIND(_recognize_path, "resource", "path");
 }
 
-Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+String ResourceSaver::_get_save_path(const Ref<Resource> &p_resource, const String &p_path) {
 	String path = p_path;
 	if (path.is_empty()) {
 		path = p_resource->get_path();
 	}
-	ERR_FAIL_COND_V_MSG(path.is_empty(), ERR_INVALID_PARAMETER, "Can't save resource to empty path. Provide non-empty path or a Resource with non-empty resource_path.");
+	ERR_FAIL_COND_V_MSG(path.is_empty(), String(), "Can't save resource to empty path. Provide non-empty path or a Resource with non-empty resource_path.");
+	return path;
+}
 
-	String extension = path.get_extension();
+Error ResourceSaver::_save_with_savers(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	const String &path = p_path;
 	Error err = ERR_FILE_UNRECOGNIZED;
 
 	for (int i = 0; i < saver_count; i++) {
@@ -128,28 +133,172 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 		err = saver[i]->save(p_resource, path, p_flags);
 
 		if (err == OK) {
-#ifdef TOOLS_ENABLED
+			if (p_flags & FLAG_CHANGE_PATH) {
+				rwcopy->set_path(old_path);
+			}
+
+			return OK;
+		}
+	}
+
+	return err;
+}
 
-			((Resource *)p_resource.ptr())->set_edited(false);
-			if (timestamp_on_save) {
-				uint64_t mt = FileAccess::get_modified_time(path);
+void ResourceSaver::_resource_saved(const Ref<Resource> &p_resource, const String &p_path) {
+#ifdef TOOLS_ENABLED
+	((Resource *)p_resource.ptr())->set_edited(false);
+	if (timestamp_on_save) {
+		uint64_t mt = FileAccess::get_modified_time(p_path);
 
-				((Resource *)p_resource.ptr())->set_last_modified_time(mt);
-			}
+		((Resource *)p_resource.ptr())->set_last_modified_time(mt);
+	}
 #endif
 
-			if (p_flags & FLAG_CHANGE_PATH) {
-				rwcopy->set_path(old_path);
-			}
+	if (save_callback && p_path.begins_with("res://")) {
+		save_callback(p_resource, p_path);
+	}
+}
+
+Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	String path = _get_save_path(p_resource, p_path);
+	if (path.is_empty()) {
+		return ERR_INVALID_PARAMETER;
+	}
+
+	Error err = _save_with_savers(p_resource, path, p_flags);
+	if (err == OK) {
+		_resource_saved(p_resource, path);
+	}
+	return err;
+}
 
-			if (save_callback && path.begins_with("res://")) {
-				save_callback(p_resource, path);
+Variant ResourceSaver::_snapshot_variant(const Variant &p_value, HashMap<Ref<Resource>, Ref<Resource>> &r_remap) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Ref<Resource> res = p_value;
+			if (res.is_valid()) {
+				return _snapshot_resource(res, r_remap, false);
+			}
+			return p_value;
+		}
+		case Variant::ARRAY: {
+			Array src = p_value;
+			Array dst = src.duplicate(false);
+			for (int i = 0; i < dst.size(); i++) {
+				dst[i] = _snapshot_variant(src[i], r_remap);
+			}
+			return dst;
+		}
+		case Variant::DICTIONARY: {
+			Dictionary src = p_value;
+			Dictionary dst;
+			for (const Variant *key = src.next(nullptr); key; key = src.next(key)) {
+				dst[_snapshot_variant(*key, r_remap)] = _snapshot_variant(src[*key], r_remap);
 			}
+			return dst;
+		}
+		default: {
+			// Packed arrays are copy-on-write, so sharing them is a snapshot already.
+			return p_value;
+		}
+	}
+}
 
-			return OK;
+Ref<Resource> ResourceSaver::_snapshot_resource(const Ref<Resource> &p_resource, HashMap<Ref<Resource>, Ref<Resource>> &r_remap, bool p_main) {
+	if (!p_main && !p_resource->is_built_in()) {
+		return p_resource; // External resources are only saved as a reference to their path.
+	}
+
+	HashMap<Ref<Resource>, Ref<Resource>>::Iterator E = r_remap.find(p_resource);
+	if (E) {
+		return E->value;
+	}
+
+	Ref<Resource> r = static_cast<Resource *>(ClassDB::instantiate(p_resource->get_class()));
+	ERR_FAIL_COND_V(r.is_null(), Ref<Resource>());
+	r_remap[p_resource] = r;
+
+	List<PropertyInfo> plist;
+	p_resource->get_property_list(&plist);
+	for (const PropertyInfo &F : plist) {
+		if (!(F.usage & PROPERTY_USAGE_STORAGE)) {
+			continue;
 		}
+		r->set(F.name, _snapshot_variant(p_resource->get(F.name), r_remap));
+	}
+
+	r->set_scene_unique_id(p_resource->get_scene_unique_id());
+	return r;
+}
+
+void ResourceSaver::_thread_save_function(void *p_userdata) {
+	ThreadSaveTask &task = *(ThreadSaveTask *)p_userdata;
+
+	// The snapshot is pathless and not cached, so there is no path to change temporarily.
+	Error err = _save_with_savers(task.snapshot, task.path, task.flags & ~FLAG_CHANGE_PATH);
+
+	MutexLock lock(thread_save_mutex);
+	task.error = err;
+	task.status = err == OK ? THREAD_SAVE_SAVED : THREAD_SAVE_FAILED;
+}
+
+Error ResourceSaver::save_threaded_request(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	ERR_FAIL_COND_V(p_resource.is_null(), ERR_INVALID_PARAMETER);
+	String path = _get_save_path(p_resource, p_path);
+	if (path.is_empty()) {
+		return ERR_INVALID_PARAMETER;
+	}
+
+	{
+		MutexLock lock(thread_save_mutex);
+		ERR_FAIL_COND_V_MSG(thread_save_tasks.has(path), ERR_BUSY, vformat("A threaded save to '%s' is already in progress. Call save_threaded_get() on it first.", path));
+	}
+
+	// Copy the resource and its built-in subresources on the calling thread, so the worker
+	// doesn't race with changes made to them meanwhile. Their data (packed arrays) is shared
+	// copy-on-write, so this is cheap compared to serializing and writing the file.
+	HashMap<Ref<Resource>, Ref<Resource>> remap;
+	Ref<Resource> snapshot = _snapshot_resource(p_resource, remap, true);
+	ERR_FAIL_COND_V(snapshot.is_null(), ERR_CANT_CREATE);
+
+	ThreadSaveTask *task = memnew(ThreadSaveTask);
+	task->resource = p_resource;
+	task->snapshot = snapshot;
+	task->path = path;
+	task->flags = p_flags;
+
+	MutexLock lock(thread_save_mutex);
+	thread_save_tasks[path] = task;
+	task->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceSaver::_thread_save_function, task, false, SNAME("ResourceSaver"));
+	return OK;
+}
+
+ResourceSaver::ThreadSaveStatus ResourceSaver::save_threaded_get_status(const String &p_path) {
+	MutexLock lock(thread_save_mutex);
+	ThreadSaveTask **task = thread_save_tasks.getptr(p_path);
+	if (!task) {
+		return THREAD_SAVE_INVALID_RESOURCE;
+	}
+	return (*task)->status;
+}
+
+Error ResourceSaver::save_threaded_get(const String &p_path) {
+	ThreadSaveTask *task = nullptr;
+	{
+		MutexLock lock(thread_save_mutex);
+		ThreadSaveTask **E = thread_save_tasks.getptr(p_path);
+		ERR_FAIL_NULL_V_MSG(E, ERR_DOES_NOT_EXIST, vformat("No threaded save to '%s' was requested.", p_path));
+		task = *E;
+		thread_save_tasks.erase(p_path);
 	}
 
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task->task_id);
+
+	Error err = task->error;
+	if (err == OK) {
+		_resource_saved(task->resource, task->path);
+	}
+	memdelete(task);
 	return err;
 }
 
@@ -33,6 +33,8 @@
 
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 
 class ResourceFormatSaver : public RefCounted {
 	GDCLASS(ResourceFormatSaver, RefCounted);
@@ -72,6 +74,35 @@ class ResourceSaver {
 
 	static Ref<ResourceFormatSaver> _find_custom_resource_format_saver(String path);
 
+public:
+	enum ThreadSaveStatus {
+		THREAD_SAVE_INVALID_RESOURCE,
+		THREAD_SAVE_IN_PROGRESS,
+		THREAD_SAVE_FAILED,
+		THREAD_SAVE_SAVED,
+	};
+
+private:
+	struct ThreadSaveTask {
+		Ref<Resource> resource; // The one requested, only touched again once saved.
+		Ref<Resource> snapshot; // What's actually serialized, not shared with anyone else.
+		String path;
+		uint32_t flags = 0;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		ThreadSaveStatus status = THREAD_SAVE_IN_PROGRESS;
+		Error error = OK;
+	};
+
+	static Mutex thread_save_mutex;
+	static HashMap<String, ThreadSaveTask *> thread_save_tasks;
+
+	static String _get_save_path(const Ref<Resource> &p_resource, const String &p_path);
+	static Error _save_with_savers(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags);
+	static void _resource_saved(const Ref<Resource> &p_resource, const String &p_path);
+	static Variant _snapshot_variant(const Variant &p_value, HashMap<Ref<Resource>, Ref<Resource>> &r_remap);
+	static Ref<Resource> _snapshot_resource(const Ref<Resource> &p_resource, HashMap<Ref<Resource>, Ref<Resource>> &r_remap, bool p_main);
+	static void _thread_save_function(void *p_userdata);
+
 public:
 	enum SaverFlags {
 		FLAG_NONE = 0,
@@ -85,6 +116,9 @@ public:
 	};
 
 	static Error save(const Ref<Resource> &p_resource, const String &p_path = "", uint32_t p_flags = (uint32_t)FLAG_NONE);
+	static Error save_threaded_request(const Ref<Resource> &p_resource, const String &p_path = "", uint32_t p_flags = (uint32_t)FLAG_NONE);
+	static ThreadSaveStatus save_threaded_get_status(const String &p_path);
+	static Error save_threaded_get(const String &p_path);
 	static void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions);
 	static void add_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver, bool p_at_front = false);
 	static void remove_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver);
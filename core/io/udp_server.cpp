@@ -48,40 +48,51 @@ Error UDPServer::poll() {
 	if (!_sock->is_open()) {
 		return ERR_UNCONFIGURED;
 	}
+	if (recv_buffer.is_empty()) {
+		recv_buffer.resize(RECV_BATCH_SIZE * PACKET_BUFFER_SIZE);
+	}
 	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	int received;
 	while (true) {
-		err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
+		for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+			recv_batch[i].buffer = &recv_buffer[i * PACKET_BUFFER_SIZE];
+			recv_batch[i].len = PACKET_BUFFER_SIZE;
+		}
+		err = _sock->recvfrom_batch(recv_batch, RECV_BATCH_SIZE, received);
 		if (err != OK) {
 			if (err == ERR_BUSY) {
 				break;
 			}
 			return FAILED;
 		}
-		Peer p;
-		p.ip = ip;
-		p.port = port;
-		List<Peer>::Element *E = peers.find(p);
-		if (!E) {
-			E = pending.find(p);
-		}
-		if (E) {
-			E->get().peer->store_packet(ip, port, recv_buffer, read);
-		} else {
-			if (pending.size() >= max_pending_connections) {
-				// Drop connection.
-				continue;
+		for (int i = 0; i < received; i++) {
+			const NetSocket::Datagram &d = recv_batch[i];
+			Peer p;
+			p.ip = d.ip;
+			p.port = d.port;
+			List<Peer>::Element *E = peers.find(p);
+			if (!E) {
+				E = pending.find(p);
+			}
+			if (E) {
+				E->get().peer->store_packet(d.ip, d.port, d.buffer, d.len);
+			} else {
+				if (pending.size() >= max_pending_connections) {
+					// Drop connection.
+					continue;
+				}
+				// It's a new peer, add it to the pending list.
+				Peer peer;
+				peer.ip = d.ip;
+				peer.port = d.port;
+				peer.peer = memnew(PacketPeerUDP);
+				peer.peer->connect_shared_socket(_sock, d.ip, d.port, this);
+				peer.peer->store_packet(d.ip, d.port, d.buffer, d.len);
+				pending.push_back(peer);
 			}
-			// It's a new peer, add it to the pending list.
-			Peer peer;
-			peer.ip = ip;
-			peer.port = port;
-			peer.peer = memnew(PacketPeerUDP);
-			peer.peer->connect_shared_socket(_sock, ip, port, this);
-			peer.peer->store_packet(ip, port, recv_buffer, read);
-			pending.push_back(peer);
+		}
+		if (received < RECV_BATCH_SIZE) {
+			break; // The socket queue has been drained.
 		}
 	}
 	return OK;
@@ -181,6 +192,7 @@ void UDPServer::stop() {
 	if (_sock.is_valid()) {
 		_sock->close();
 	}
+	recv_buffer.reset();
 	List<Peer>::Element *E = peers.front();
 	while (E) {
 		E->get().peer->disconnect_shared_socket();
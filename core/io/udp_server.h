@@ -33,13 +33,15 @@
 
 #include "core/io/net_socket.h"
 #include "core/io/packet_peer_udp.h"
+#include "core/templates/local_vector.h"
 
 class UDPServer : public RefCounted {
 	GDCLASS(UDPServer, RefCounted);
 
 protected:
 	enum {
-		PACKET_BUFFER_SIZE = 65536
+		PACKET_BUFFER_SIZE = 65536,
+		RECV_BATCH_SIZE = 8, // Datagrams received per NetSocket::recvfrom_batch call.
 	};
 
 	struct Peer {
@@ -51,7 +53,8 @@ protected:
 			return (ip == p_other.ip && port == p_other.port);
 		}
 	};
-	uint8_t recv_buffer[PACKET_BUFFER_SIZE];
+	LocalVector<uint8_t> recv_buffer; // RECV_BATCH_SIZE slots of PACKET_BUFFER_SIZE, allocated on first poll.
+	NetSocket::Datagram recv_batch[RECV_BATCH_SIZE];
 
 	List<Peer> peers;
 	List<Peer> pending;
@@ -327,15 +327,22 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	LocalVector<OpenPoint> open_list;
+	SortArray<OpenPoint, SortOpenPoints> sorter;
 
 	begin_point->g_score = 0;
 	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	open_list.push_back(OpenPoint(begin_point));
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		Point *p = open_list[0].point; // The currently processed point.
+
+		if (p->closed_pass == pass || open_list[0].g_score != p->g_score) {
+			// Outdated entry, the point was reached again through a better path.
+			sorter.pop_heap(0, open_list.size(), open_list.ptr());
+			open_list.remove_at(open_list.size() - 1);
+			continue;
+		}
 
 		if (p == end_point) {
 			found_route = true;
@@ -355,12 +362,8 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 
 			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
 
-			bool new_point = false;
-
 			if (e->open_pass != pass) { // The point wasn't inside the open list.
 				e->open_pass = pass;
-				open_list.push_back(e);
-				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
 				continue;
 			}
@@ -369,11 +372,8 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 			e->g_score = tentative_g_score;
 			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
+			open_list.push_back(OpenPoint(e));
+			sorter.push_heap(0, open_list.size() - 1, 0, open_list[open_list.size() - 1], open_list.ptr());
 		}
 	}
 
@@ -794,15 +794,22 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 
 	bool found_route = false;
 
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
+	LocalVector<AStar3D::OpenPoint> open_list;
+	SortArray<AStar3D::OpenPoint, AStar3D::SortOpenPoints> sorter;
 
 	begin_point->g_score = 0;
 	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	open_list.push_back(AStar3D::OpenPoint(begin_point));
 
 	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
+		AStar3D::Point *p = open_list[0].point; // The currently processed point.
+
+		if (p->closed_pass == astar.pass || open_list[0].g_score != p->g_score) {
+			// Outdated entry, the point was reached again through a better path.
+			sorter.pop_heap(0, open_list.size(), open_list.ptr());
+			open_list.remove_at(open_list.size() - 1);
+			continue;
+		}
 
 		if (p == end_point) {
 			found_route = true;
@@ -822,12 +829,8 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 
 			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
 
-			bool new_point = false;
-
 			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
 				e->open_pass = astar.pass;
-				open_list.push_back(e);
-				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
 				continue;
 			}
@@ -836,11 +839,8 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 			e->g_score = tentative_g_score;
 			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
+			open_list.push_back(AStar3D::OpenPoint(e));
+			sorter.push_heap(0, open_list.size() - 1, 0, open_list[open_list.size() - 1], open_list.ptr());
 		}
 	}
 
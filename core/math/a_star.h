@@ -62,14 +62,26 @@ class AStar3D : public RefCounted {
 		uint64_t closed_pass = 0;
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+	// Entry of the open list. A point is pushed again whenever a better path to it is found,
+	// instead of being searched for in the list, and the outdated entries are skipped when popped.
+	struct OpenPoint {
+		Point *point = nullptr;
+		real_t f_score = 0;
+		real_t g_score = 0;
+
+		OpenPoint() {}
+		OpenPoint(Point *p_point) :
+				point(p_point), f_score(p_point->f_score), g_score(p_point->g_score) {}
+	};
+
+	struct SortOpenPoints {
+		_FORCE_INLINE_ bool operator()(const OpenPoint &A, const OpenPoint &B) const { // Returns true when the entry A is worse than entry B.
+			if (A.f_score > B.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (A.f_score < B.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return A.g_score < B.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
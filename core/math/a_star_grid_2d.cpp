@@ -107,17 +107,22 @@ Size2 AStarGrid2D::get_cell_size() const {
 }
 
 void AStarGrid2D::update() {
-	points.clear();
-
 	const int32_t end_x = region.get_end().x;
 	const int32_t end_y = region.get_end().y;
 
+	// Reuse the previous storage, only growing it when the region gets larger.
+	const uint32_t point_count = region.size.x * region.size.y;
+	points.resize(point_count);
+	solid_mask.resize((point_count + 63) / 64);
+	if (solid_mask.size()) {
+		memset(solid_mask.ptr(), 0, solid_mask.size() * sizeof(uint64_t));
+	}
+
+	Point *w = points.ptr();
 	for (int32_t y = region.position.y; y < end_y; y++) {
-		LocalVector<Point> line;
 		for (int32_t x = region.position.x; x < end_x; x++) {
-			line.push_back(Point(Vector2i(x, y), offset + Vector2(x, y) * cell_size));
+			*w++ = Point(Vector2i(x, y), offset + Vector2(x, y) * cell_size);
 		}
-		points.push_back(line);
 	}
 
 	dirty = false;
@@ -173,13 +178,14 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
-	_get_point_unchecked(p_id)->solid = p_solid;
+	const uint32_t index = _get_point_index(p_id.x, p_id.y);
+	_set_solid_range(index, index + 1, p_solid);
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, false, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), false, vformat("Can't get if point is disabled. Point %s out of bounds %s.", p_id, region));
-	return _get_point_unchecked(p_id)->solid;
+	return _is_solid_index(_get_point_index(p_id.x, p_id.y));
 }
 
 void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_scale) {
@@ -202,10 +208,27 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 	const int32_t end_x = safe_region.get_end().x;
 	const int32_t end_y = safe_region.get_end().y;
 
+	if (safe_region.position.x >= end_x) {
+		return;
+	}
 	for (int32_t y = safe_region.position.y; y < end_y; y++) {
-		for (int32_t x = safe_region.position.x; x < end_x; x++) {
-			_get_point_unchecked(x, y)->solid = p_solid;
+		_set_solid_range(_get_point_index(safe_region.position.x, y), _get_point_index(end_x - 1, y) + 1, p_solid);
+	}
+}
+
+void AStarGrid2D::_set_solid_range(uint32_t p_from, uint32_t p_to, bool p_solid) {
+	// Sets the bits in [p_from, p_to) a whole word at a time where possible.
+	while (p_from < p_to) {
+		const uint32_t word = p_from >> 6;
+		const uint32_t first_bit = p_from & 63;
+		const uint32_t bit_count = MIN(64 - first_bit, p_to - p_from);
+		const uint64_t bits = (bit_count == 64 ? ~uint64_t(0) : ((uint64_t(1) << bit_count) - 1)) << first_bit;
+		if (p_solid) {
+			solid_mask[word] |= bits;
+		} else {
+			solid_mask[word] &= ~bits;
 		}
+		p_from += bit_count;
 	}
 }
 
@@ -225,7 +248,7 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 }
 
 AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
-	if (!p_to || p_to->solid) {
+	if (!p_to || _is_point_solid(p_to)) {
 		return nullptr;
 	}
 	if (p_to == end) {
@@ -360,19 +383,19 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 		}
 	}
 
-	if (top && !top->solid) {
+	if (top && !_is_point_solid(top)) {
 		r_nbors.push_back(top);
 		ts0 = true;
 	}
-	if (right && !right->solid) {
+	if (right && !_is_point_solid(right)) {
 		r_nbors.push_back(right);
 		ts1 = true;
 	}
-	if (bottom && !bottom->solid) {
+	if (bottom && !_is_point_solid(bottom)) {
 		r_nbors.push_back(bottom);
 		ts2 = true;
 	}
-	if (left && !left->solid) {
+	if (left && !_is_point_solid(left)) {
 		r_nbors.push_back(left);
 		ts3 = true;
 	}
@@ -402,16 +425,16 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 			break;
 	}
 
-	if (td0 && (top_left && !top_left->solid)) {
+	if (td0 && (top_left && !_is_point_solid(top_left))) {
 		r_nbors.push_back(top_left);
 	}
-	if (td1 && (top_right && !top_right->solid)) {
+	if (td1 && (top_right && !_is_point_solid(top_right))) {
 		r_nbors.push_back(top_right);
 	}
-	if (td2 && (bottom_right && !bottom_right->solid)) {
+	if (td2 && (bottom_right && !_is_point_solid(bottom_right))) {
 		r_nbors.push_back(bottom_right);
 	}
-	if (td3 && (bottom_left && !bottom_left->solid)) {
+	if (td3 && (bottom_left && !_is_point_solid(bottom_left))) {
 		r_nbors.push_back(bottom_left);
 	}
 }
@@ -419,7 +442,7 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	pass++;
 
-	if (p_end_point->solid) {
+	if (_is_point_solid(p_end_point)) {
 		return false;
 	}
 
@@ -433,6 +456,8 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	open_list.push_back(p_begin_point);
 	end = p_end_point;
 
+	LocalVector<Point *> nbors;
+
 	while (!open_list.is_empty()) {
 		Point *p = open_list[0]; // The currently processed point.
 
@@ -445,7 +470,7 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 		open_list.remove_at(open_list.size() - 1);
 		p->closed_pass = pass; // Mark the point as closed.
 
-		LocalVector<Point *> nbors;
+		nbors.clear(); // Keeps the capacity, so the list is only allocated once per solve.
 		_get_nbors(p, nbors);
 
 		for (Point *e : nbors) {
@@ -458,7 +483,7 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 					continue;
 				}
 			} else {
-				if (e->solid || e->closed_pass == pass) {
+				if (_is_point_solid(e) || e->closed_pass == pass) {
 					continue;
 				}
 				weight_scale = e->weight_scale;
@@ -508,6 +533,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 
 void AStarGrid2D::clear() {
 	points.clear();
+	solid_mask.clear();
 	region = Rect2i();
 }
 
@@ -70,7 +70,6 @@ private:
 	struct Point {
 		Vector2i id;
 
-		bool solid = false;
 		Vector2 pos;
 		real_t weight_scale = 1.0;
 
@@ -99,38 +98,55 @@ private:
 		}
 	};
 
-	LocalVector<LocalVector<Point>> points;
+	// Points are stored row by row. Solid cells are kept apart in a bitset with the same layout,
+	// so walkability checks touch far less memory than the points themselves.
+	LocalVector<Point> points;
+	LocalVector<uint64_t> solid_mask;
 	Point *end = nullptr;
 
 	uint64_t pass = 1;
 
 private: // Internal routines.
+	_FORCE_INLINE_ uint32_t _get_point_index(int32_t p_x, int32_t p_y) const {
+		return (p_y - region.position.y) * region.size.x + (p_x - region.position.x);
+	}
+
+	_FORCE_INLINE_ bool _is_solid_index(uint32_t p_index) const {
+		return (solid_mask[p_index >> 6] >> (p_index & 63)) & 1;
+	}
+
+	_FORCE_INLINE_ bool _is_point_solid(const Point *p_point) const {
+		return _is_solid_index(p_point - points.ptr());
+	}
+
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
 		if (region.has_point(Vector2i(p_x, p_y))) {
-			return !points[p_y - region.position.y][p_x - region.position.x].solid;
+			return !_is_solid_index(_get_point_index(p_x, p_y));
 		}
 		return false;
 	}
 
 	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
 		if (region.has_point(Vector2i(p_x, p_y))) {
-			return &points[p_y - region.position.y][p_x - region.position.x];
+			return &points[_get_point_index(p_x, p_y)];
 		}
 		return nullptr;
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(int32_t p_x, int32_t p_y) {
-		return &points[p_y - region.position.y][p_x - region.position.x];
+		return &points[_get_point_index(p_x, p_y)];
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(const Vector2i &p_id) {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+		return &points[_get_point_index(p_id.x, p_id.y)];
 	}
 
 	_FORCE_INLINE_ const Point *_get_point_unchecked(const Vector2i &p_id) const {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+		return &points[_get_point_index(p_id.x, p_id.y)];
 	}
 
+	void _set_solid_range(uint32_t p_from, uint32_t p_to, bool p_solid);
+
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
 	Point *_jump(Point *p_from, Point *p_to);
 	bool _solve(Point *p_begin_point, Point *p_end_point);
@@ -83,6 +83,8 @@ struct _NO_DISCARD_ Transform3D {
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ AABB xform(const AABB &p_aabb) const;
 	_FORCE_INLINE_ Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
+	// Transforms p_count points from p_src into p_dst, which may be the same array.
+	_FORCE_INLINE_ void xform_array(const Vector3 *p_src, Vector3 *p_dst, int p_count) const;
 
 	// NOTE: These are UNSAFE with non-uniform scaling, and will produce incorrect results.
 	// They use the transpose.
@@ -213,13 +215,26 @@ Vector<Vector3> Transform3D::xform(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
 
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
+	xform_array(p_array.ptr(), array.ptrw(), p_array.size());
+	return array;
+}
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
+void Transform3D::xform_array(const Vector3 *p_src, Vector3 *p_dst, int p_count) const {
+	// Copy the matrix to locals, so the compiler doesn't have to assume writes
+	// to p_dst can modify it. This keeps the loop free of reloads and lets it vectorize.
+	const real_t m00 = basis.rows[0][0], m01 = basis.rows[0][1], m02 = basis.rows[0][2];
+	const real_t m10 = basis.rows[1][0], m11 = basis.rows[1][1], m12 = basis.rows[1][2];
+	const real_t m20 = basis.rows[2][0], m21 = basis.rows[2][1], m22 = basis.rows[2][2];
+	const real_t ox = origin.x, oy = origin.y, oz = origin.z;
+
+	for (int i = 0; i < p_count; ++i) {
+		const real_t x = p_src[i].x;
+		const real_t y = p_src[i].y;
+		const real_t z = p_src[i].z;
+		p_dst[i].x = m00 * x + m01 * y + m02 * z + ox;
+		p_dst[i].y = m10 * x + m11 * y + m12 * z + oy;
+		p_dst[i].z = m20 * x + m21 * y + m22 * z + oz;
 	}
-	return array;
 }
 
 Vector<Vector3> Transform3D::xform_inv(const Vector<Vector3> &p_array) const {
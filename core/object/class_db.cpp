@@ -69,6 +69,69 @@ HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+Mutex ClassDB::deferred_binds_mutex;
+HashMap<StringName, ClassDB::DeferredBind> ClassDB::deferred_binds;
+SafeNumeric<uint32_t> ClassDB::deferred_binds_pending;
+#endif
+
+void ClassDB::_add_class_bind(const StringName &p_class, const StringName &p_inherits, void (*p_bind_func)()) {
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+	// Object methods are needed by everything, so they are never deferred.
+	if (p_class != Object::get_class_static()) {
+		MutexLock deferred_lock(deferred_binds_mutex);
+		DeferredBind deferred;
+		deferred.inherits = p_inherits;
+		deferred.bind_func = p_bind_func;
+		deferred_binds.insert(p_class, deferred);
+		deferred_binds_pending.increment();
+		return;
+	}
+#endif
+	p_bind_func();
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+	classes[p_class].bound.flag.set();
+#endif
+}
+
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+void ClassDB::_bind_deferred(const StringName &p_class) {
+	// The mutex is recursive and held while binding: other threads looking up these
+	// classes wait until they are complete, and lookups made by _bind_methods()
+	// itself on this thread return immediately.
+	MutexLock deferred_lock(deferred_binds_mutex);
+
+	// Bind from the root of the hierarchy down, so properties can use inherited accessors.
+	LocalVector<StringName> chain;
+	StringName class_name = p_class;
+	while (const DeferredBind *deferred = deferred_binds.getptr(class_name)) {
+		chain.push_back(class_name);
+		class_name = deferred->inherits;
+	}
+
+	for (int i = int(chain.size()) - 1; i >= 0; i--) {
+		const DeferredBind *deferred = deferred_binds.getptr(chain[i]);
+		if (!deferred) {
+			continue; // Already bound by a recursive lookup.
+		}
+		void (*bind_func)() = deferred->bind_func;
+		deferred_binds.erase(chain[i]);
+		bind_func();
+		classes[chain[i]].bound.flag.set();
+		deferred_binds_pending.decrement();
+	}
+}
+#endif
+
+void ClassDB::bind_deferred_classes() {
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+	MutexLock deferred_lock(deferred_binds_mutex);
+	while (deferred_binds.size()) {
+		_bind_deferred(deferred_binds.begin()->key);
+	}
+#endif
+}
+
 bool ClassDB::_is_parent_class(const StringName &p_class, const StringName &p_inherits) {
 	if (!classes.has(p_class)) {
 		return false;
@@ -166,6 +229,8 @@ ClassDB::APIType ClassDB::get_api_type(const StringName &p_class) {
 
 uint32_t ClassDB::get_api_hash(APIType p_api) {
 #ifdef DEBUG_METHODS_ENABLED
+	bind_deferred_classes();
+
 	OBJTYPE_WLOCK;
 
 	if (api_hashes_cache.has(p_api)) {
@@ -467,6 +532,7 @@ static MethodInfo info_from_bind(MethodBind *p_method) {
 }
 
 void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance, bool p_exclude_from_properties) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -513,6 +579,7 @@ void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_met
 }
 
 void ClassDB::get_method_list_with_compatibility(const StringName &p_class, List<Pair<MethodInfo, uint32_t>> *p_methods, bool p_no_inheritance, bool p_exclude_from_properties) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -573,6 +640,7 @@ void ClassDB::get_method_list_with_compatibility(const StringName &p_class, List
 }
 
 bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance, bool p_exclude_from_properties) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -623,6 +691,7 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 }
 
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -638,6 +707,7 @@ MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_n
 }
 
 Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -657,6 +727,7 @@ Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_cl
 }
 
 MethodBind *ClassDB::get_method_with_compatibility(const StringName &p_class, const StringName &p_name, uint64_t p_hash, bool *r_method_exists, bool *r_is_deprecated) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -729,6 +800,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 }
 
 void ClassDB::get_integer_constant_list(const StringName &p_class, List<String> *p_constants, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -754,6 +826,7 @@ void ClassDB::get_integer_constant_list(const StringName &p_class, List<String>
 }
 
 int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringName &p_name, bool *p_success) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -778,6 +851,7 @@ int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringNam
 }
 
 bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -797,6 +871,7 @@ bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &
 }
 
 StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -821,6 +896,7 @@ StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const S
 }
 
 void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -839,6 +915,7 @@ void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums
 }
 
 void ClassDB::get_enum_constants(const StringName &p_class, const StringName &p_enum, List<StringName> *p_constants, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -872,6 +949,7 @@ void ClassDB::set_method_error_return_values(const StringName &p_class, const St
 }
 
 Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class, const StringName &p_method) {
+	ensure_class_bound(p_class);
 #ifdef DEBUG_METHODS_ENABLED
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
@@ -888,6 +966,7 @@ Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class,
 }
 
 bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -907,6 +986,7 @@ bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool
 }
 
 bool ClassDB::is_enum_bitfield(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -945,6 +1025,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -966,6 +1047,7 @@ void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_sig
 }
 
 bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -983,6 +1065,7 @@ bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal,
 }
 
 bool ClassDB::get_signal(const StringName &p_class, const StringName &p_signal, MethodInfo *r_signal) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1121,6 +1204,7 @@ void ClassDB::add_linked_property(const StringName &p_class, const String &p_pro
 }
 
 void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p_list, bool p_no_inheritance, const Object *p_validator) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -1145,6 +1229,7 @@ void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p
 }
 
 void ClassDB::get_linked_properties_info(const StringName &p_class, const StringName &p_property, List<StringName> *r_properties, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 #ifdef TOOLS_ENABLED
 	ClassInfo *check = classes.getptr(p_class);
 	while (check) {
@@ -1164,6 +1249,7 @@ void ClassDB::get_linked_properties_info(const StringName &p_class, const String
 }
 
 bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance, const Object *p_validator) {
+	ensure_class_bound(p_class);
 	OBJTYPE_RLOCK;
 
 	ClassInfo *check = classes.getptr(p_class);
@@ -1288,6 +1374,7 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1310,6 +1397,7 @@ int ClassDB::get_property_index(const StringName &p_class, const StringName &p_p
 }
 
 Variant::Type ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1332,6 +1420,7 @@ Variant::Type ClassDB::get_property_type(const StringName &p_class, const String
 }
 
 StringName ClassDB::get_property_setter(const StringName &p_class, const StringName &p_property) {
+	ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1347,6 +1436,7 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 }
 
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
+	ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1361,7 +1451,52 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_setter_method(const StringName &p_class, const StringName &p_property) {
+	ensure_class_bound(p_class);
+	ClassInfo *type = classes.getptr(p_class);
+	if (type && type->gdextension) {
+		return nullptr; // Extension instances may handle the property themselves first.
+	}
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			// Indexed properties need the index passed as an extra argument.
+			return psg->index < 0 ? psg->_setptr : nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
+MethodBind *ClassDB::get_property_getter_method(const StringName &p_class, const StringName &p_property) {
+	ensure_class_bound(p_class);
+	ClassInfo *type = classes.getptr(p_class);
+	if (type && type->gdextension) {
+		return nullptr;
+	}
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg->index < 0 ? psg->_getptr : nullptr;
+		}
+
+		// Same lookup order as get_property(), which lets these shadow inherited properties.
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			return nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1388,6 +1523,7 @@ void ClassDB::set_method_flags(const StringName &p_class, const StringName &p_me
 }
 
 bool ClassDB::has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1573,6 +1709,7 @@ void ClassDB::add_virtual_method(const StringName &p_class, const MethodInfo &p_
 }
 
 void ClassDB::get_virtual_methods(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance) {
+	ensure_class_bound(p_class);
 	ERR_FAIL_COND_MSG(!classes.has(p_class), "Request for nonexistent class '" + p_class + "'.");
 
 #ifdef DEBUG_METHODS_ENABLED
@@ -1660,6 +1797,7 @@ HashMap<StringName, HashMap<StringName, Variant>> ClassDB::default_values;
 HashSet<StringName> ClassDB::default_values_cached;
 
 Variant ClassDB::class_get_default_property_value(const StringName &p_class, const StringName &p_property, bool *r_valid) {
+	ensure_class_bound(p_class);
 	if (!default_values_cached.has(p_class)) {
 		if (!default_values.has(p_class)) {
 			default_values[p_class] = HashMap<StringName, Variant>();
@@ -1734,6 +1872,9 @@ Variant ClassDB::class_get_default_property_value(const StringName &p_class, con
 }
 
 void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
+	// Lookups on the extension class walk up into the native ones, which must be complete.
+	ensure_class_bound(p_extension->parent_class_name);
+
 	GLOBAL_LOCK_FUNCTION;
 
 	ERR_FAIL_COND_MSG(classes.has(p_extension->class_name), "Class already registered: " + String(p_extension->class_name));
@@ -1760,6 +1901,9 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 	c.inherits = parent->name;
 	c.class_ptr = parent->class_ptr;
 	c.inherits_ptr = parent;
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+	c.bound.flag.set(); // Extension classes are bound by their library as they are registered.
+#endif
 	c.exposed = p_extension->is_exposed;
 	if (c.exposed) {
 		// The parent classes should be exposed if it has an exposed child class.
@@ -1832,6 +1976,10 @@ void ClassDB::cleanup() {
 	}
 
 	classes.clear();
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+	deferred_binds.clear();
+	deferred_binds_pending.set(0);
+#endif
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
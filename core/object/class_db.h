@@ -33,6 +33,7 @@
 
 #include "core/object/method_bind.h"
 #include "core/object/object.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 
 // Makes callable_mp readily available in all classes connecting signals.
@@ -134,6 +135,16 @@ public:
 		bool reloadable = false;
 		bool is_virtual = false;
 		Object *(*creation_func)() = nullptr;
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+		// Set once _bind_methods() has run, checked without locking by ensure_class_bound().
+		struct BoundFlag {
+			SafeFlag flag;
+			BoundFlag() {}
+			BoundFlag(const BoundFlag &p_other) :
+					flag(p_other.flag.is_set()) {}
+			void operator=(const BoundFlag &p_other) { flag.set_to(p_other.flag.is_set()); }
+		} bound;
+#endif
 
 		ClassInfo() {}
 		~ClassInfo() {}
@@ -170,6 +181,20 @@ public:
 	};
 	static HashMap<StringName, NativeStruct> native_structs;
 
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+	// Classes whose _bind_methods() has not run yet. They are bound the first
+	// time they are instantiated or looked up by name, see ensure_class_bound().
+	struct DeferredBind {
+		StringName inherits;
+		void (*bind_func)() = nullptr;
+	};
+	static Mutex deferred_binds_mutex;
+	static HashMap<StringName, DeferredBind> deferred_binds;
+	static SafeNumeric<uint32_t> deferred_binds_pending;
+
+	static void _bind_deferred(const StringName &p_class);
+#endif
+
 private:
 	// Non-locking variants of get_parent_class and is_parent_class.
 	static StringName _get_parent_class(const StringName &p_class);
@@ -184,6 +209,20 @@ public:
 	static void _add_class() {
 		_add_class2(T::get_class_static(), T::get_parent_class_static());
 	}
+	static void _add_class_bind(const StringName &p_class, const StringName &p_inherits, void (*p_bind_func)());
+
+	_FORCE_INLINE_ static void ensure_class_bound(const StringName &p_class) {
+#ifdef DEFERRED_CLASS_BINDING_ENABLED
+		if (unlikely(deferred_binds_pending.get() != 0)) {
+			// Classes are only registered at startup, so like the other lookups this one doesn't lock.
+			const ClassInfo *type = classes.getptr(p_class);
+			if (type && !type->bound.flag.is_set()) {
+				_bind_deferred(p_class);
+			}
+		}
+#endif
+	}
+	static void bind_deferred_classes();
 
 	template <class T>
 	static void register_class(bool p_virtual = false) {
@@ -394,6 +433,10 @@ public:
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
+	// Method binds that set_property() and get_property() call directly for a property, if they do.
+	// Always null for extension classes.
+	static MethodBind *get_property_setter_method(const StringName &p_class, const StringName &p_property);
+	static MethodBind *get_property_getter_method(const StringName &p_class, const StringName &p_property);
 
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
 	static void set_method_flags(const StringName &p_class, const StringName &p_method, int p_flags);
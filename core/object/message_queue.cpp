@@ -87,6 +87,7 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
+	_collect_staging_queues_before_push();
 	LOCK_MUTEX;
 
 	_ensure_first_page();
@@ -126,6 +127,7 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	}
 
 	page_bytes[pages_used - 1] += room_needed;
+	_mark_if_staging();
 
 	UNLOCK_MUTEX;
 
@@ -133,6 +135,7 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	_collect_staging_queues_before_push();
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
@@ -167,6 +170,7 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	*v = p_value;
 
 	page_bytes[pages_used - 1] += room_needed;
+	_mark_if_staging();
 	UNLOCK_MUTEX;
 
 	return OK;
@@ -174,6 +178,7 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
+	_collect_staging_queues_before_push();
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
@@ -200,6 +205,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	msg->notification = p_notification;
 
 	page_bytes[pages_used - 1] += room_needed;
+	_mark_if_staging();
 	UNLOCK_MUTEX;
 
 	return OK;
@@ -274,11 +280,49 @@ Error CallQueue::_transfer_messages_to_main_queue() {
 	return OK;
 }
 
+void CallQueue::_mark_if_staging() {
+	if (unlikely(is_staging)) {
+		// Set while the staging queue is still locked, so a collection can't miss the message.
+		MessageQueue::staging_pending.set();
+	}
+}
+
+void CallQueue::_collect_staging_queues_before_push() {
+	// Calls staged by worker threads happened before this one, as far as the pushing thread can tell, so keep them first.
+	if (this == MessageQueue::main_singleton) {
+		_collect_staging_queues();
+	}
+}
+
+void CallQueue::_collect_staging_queues() {
+	if (!MessageQueue::staging_pending.is_set()) {
+		return;
+	}
+
+	MutexLock lock(MessageQueue::staging_mutex);
+	MessageQueue::staging_pending.clear();
+	for (CallQueue *staging : MessageQueue::staging_queues) {
+		MutexLock staging_lock(staging->mutex);
+		if (staging->has_messages()) {
+			staging->_transfer_messages_to_main_queue();
+		}
+	}
+}
+
 Error CallQueue::flush() {
 	// Thread overrides are not meant to be flushed, but appended to the main one.
 	if (unlikely(this == MessageQueue::thread_singleton)) {
 		return _transfer_messages_to_main_queue();
 	}
+	// Same for staging queues, which must not run messages on their thread.
+	if (unlikely(is_staging)) {
+		MutexLock lock(mutex);
+		return _transfer_messages_to_main_queue();
+	}
+
+	if (this == MessageQueue::main_singleton && !flushing) {
+		_collect_staging_queues();
+	}
 
 	LOCK_MUTEX;
 
@@ -298,7 +342,23 @@ Error CallQueue::flush() {
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
+	while (i < pages_used) {
+		if (offset == page_bytes[i]) {
+			if (i + 1 < pages_used) {
+				i++;
+				offset = 0;
+				continue;
+			}
+			if (this == MessageQueue::main_singleton && MessageQueue::staging_pending.is_set()) {
+				// Calls staged while flushing run in this flush too, after the ones already queued.
+				UNLOCK_MUTEX;
+				_collect_staging_queues();
+				LOCK_MUTEX;
+				continue;
+			}
+			break;
+		}
+
 		Page *page = pages[i];
 
 		//lock on each iteration, so a call can re-add itself to the message queue
@@ -347,10 +407,6 @@ Error CallQueue::flush() {
 		message->~Message();
 
 		LOCK_MUTEX;
-		if (offset == page_bytes[i]) {
-			i++;
-			offset = 0;
-		}
 	}
 
 	page_bytes[0] = 0;
@@ -546,6 +602,10 @@ CallQueue::~CallQueue() {
 //////////////////////
 
 CallQueue *MessageQueue::main_singleton = nullptr;
+thread_local CallQueue *MessageQueue::thread_staging = nullptr;
+Mutex MessageQueue::staging_mutex;
+LocalVector<CallQueue *> MessageQueue::staging_queues;
+SafeFlag MessageQueue::staging_pending;
 thread_local CallQueue *MessageQueue::thread_singleton = nullptr;
 
 void MessageQueue::set_thread_singleton_override(CallQueue *p_thread_singleton) {
@@ -571,6 +631,41 @@ MessageQueue::MessageQueue() :
 	main_singleton = this;
 }
 
+void MessageQueue::add_thread_staging_queue(CallQueue *p_queue) {
+	ERR_FAIL_NULL(p_queue);
+	ERR_FAIL_COND_MSG(thread_staging != nullptr, "This thread already has a staging queue.");
+	DEV_ASSERT(!p_queue->allocator_is_custom); // Staged pages are transferred to the main queue.
+
+	p_queue->is_staging = true;
+	thread_staging = p_queue;
+
+	MutexLock lock(staging_mutex);
+	staging_queues.push_back(p_queue);
+}
+
+void MessageQueue::collect_thread_staging_queues() {
+	if (main_singleton) {
+		main_singleton->_collect_staging_queues();
+	}
+}
+
+void MessageQueue::remove_thread_staging_queue(CallQueue *p_queue) {
+	ERR_FAIL_COND(thread_staging != p_queue);
+
+	{
+		MutexLock lock(staging_mutex);
+		staging_queues.erase(p_queue);
+	}
+	thread_staging = nullptr;
+
+	// Don't lose what was queued since the last flush.
+	if (main_singleton && p_queue->has_messages()) {
+		MutexLock lock(p_queue->mutex);
+		p_queue->_transfer_messages_to_main_queue();
+	}
+	p_queue->is_staging = false;
+}
+
 MessageQueue::~MessageQueue() {
 	main_singleton = nullptr;
 }
@@ -35,6 +35,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -76,6 +77,7 @@ private:
 	uint32_t max_pages = 0;
 	uint32_t pages_used = 0;
 	bool flushing = false;
+	bool is_staging = false;
 
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
@@ -99,6 +101,9 @@ private:
 	}
 
 	Error _transfer_messages_to_main_queue();
+	void _mark_if_staging();
+	void _collect_staging_queues_before_push();
+	void _collect_staging_queues();
 
 	void _add_page();
 
@@ -162,13 +167,30 @@ public:
 class MessageQueue : public CallQueue {
 	static CallQueue *main_singleton;
 	static thread_local CallQueue *thread_singleton;
+	static thread_local CallQueue *thread_staging;
+	static Mutex staging_mutex;
+	static LocalVector<CallQueue *> staging_queues;
+	static SafeFlag staging_pending;
 	friend class CallQueue;
 
 public:
-	_FORCE_INLINE_ static CallQueue *get_singleton() { return thread_singleton ? thread_singleton : main_singleton; }
+	_FORCE_INLINE_ static CallQueue *get_singleton() {
+		if (thread_singleton) {
+			return thread_singleton;
+		}
+		return thread_staging ? thread_staging : main_singleton;
+	}
 
 	static void set_thread_singleton_override(CallQueue *p_thread_singleton);
 
+	// Messages pushed from the current thread go to p_queue, which is only contended when the main
+	// queue collects it. Meant for long-lived worker threads.
+	static void add_thread_staging_queue(CallQueue *p_queue);
+	static void remove_thread_staging_queue(CallQueue *p_queue);
+	// Appends the staged messages to the main queue now. Done before every push to the main queue
+	// and after waiting for tasks, so deferred calls keep the order in which they were made.
+	static void collect_thread_staging_queues();
+
 	MessageQueue();
 	~MessageQueue();
 };
@@ -210,6 +210,7 @@ void Object::_postinitialize() {
 	_class_name_ptr = _get_class_namev(); // Set the direct pointer, which is much faster to obtain, but can only happen after postinitialize.
 	_initialize_classv();
 	_class_name_ptr = nullptr; // May have been called from a constructor.
+	ClassDB::ensure_class_bound(*_get_class_namev());
 	notification(NOTIFICATION_POSTINITIALIZE);
 }
 
@@ -1094,22 +1095,37 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	// Ensure that disconnecting the signal or even deleting the object
 	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
+	// Only the callables and flags are copied, and they are kept on the stack
+	// for the common case of a few connections, so emitting doesn't allocate.
+	constexpr uint32_t MAX_SLOTS_ON_STACK = 5;
+	const uint32_t slot_count = s->slot_map.size();
+	alignas(Callable) uint8_t slot_callable_stack[sizeof(Callable) * MAX_SLOTS_ON_STACK];
+	uint32_t slot_flags_stack[MAX_SLOTS_ON_STACK];
+	Callable *slot_callables = (Callable *)slot_callable_stack;
+	uint32_t *slot_flags = slot_flags_stack;
+	if (slot_count > MAX_SLOTS_ON_STACK) {
+		slot_callables = (Callable *)memalloc(sizeof(Callable) * slot_count);
+		slot_flags = (uint32_t *)memalloc(sizeof(uint32_t) * slot_count);
+	}
 	{
 		uint32_t idx = 0;
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
+			memnew_placement(&slot_callables[idx], Callable(slot_kv.value.conn.callable));
+			slot_flags[idx] = slot_kv.value.conn.flags;
+			idx++;
 		}
-		DEV_ASSERT(idx == s->slot_map.size());
+		DEV_ASSERT(idx == slot_count);
 	}
 
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
 
-	for (const Connection &c : slot_conns) {
-		if (!c.callable.is_valid()) {
+	for (uint32_t i = 0; i < slot_count; ++i) {
+		const Callable &callable = slot_callables[i];
+		const uint32_t flags = slot_flags[i];
+
+		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
@@ -1117,34 +1133,34 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		const Variant **args = p_args;
 		int argc = p_argcount;
 
-		if (c.flags & CONNECT_DEFERRED) {
-			MessageQueue::get_singleton()->push_callablep(c.callable, args, argc, true);
+		if (flags & CONNECT_DEFERRED) {
+			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			c.callable.callp(args, argc, ret, ce);
+			callable.callp(args, argc, ret, ce);
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
 #ifdef DEBUG_ENABLED
-				if (c.flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
+				if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
 					continue;
 				}
 #endif
-				Object *target = c.callable.get_object();
+				Object *target = callable.get_object();
 				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
 					//most likely object is not initialized yet, do not throw error.
 				} else {
-					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(c.callable, args, argc, ce) + ".");
+					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(callable, args, argc, ce) + ".");
 					err = ERR_METHOD_NOT_FOUND;
 				}
 			}
 		}
 
-		bool disconnect = c.flags & CONNECT_ONE_SHOT;
+		bool disconnect = flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (c.flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			//this signal was connected from the editor, and is being edited. just don't disconnect for now
 			disconnect = false;
 		}
@@ -1152,11 +1168,20 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		if (disconnect) {
 			_ObjectSignalDisconnectData dd;
 			dd.signal = p_name;
-			dd.callable = c.callable;
+			dd.callable = callable;
 			disconnect_data.push_back(dd);
 		}
 	}
 
+	for (uint32_t i = 0; i < slot_count; ++i) {
+		slot_callables[i].~Callable();
+	}
+
+	if (slot_count > MAX_SLOTS_ON_STACK) {
+		memfree(slot_callables);
+		memfree(slot_flags);
+	}
+
 	while (!disconnect_data.is_empty()) {
 		const _ObjectSignalDisconnectData &dd = disconnect_data.front()->get();
 
@@ -2052,6 +2077,9 @@ bool predelete_handler(Object *p_object) {
 
 void postinitialize_handler(Object *p_object) {
 	p_object->_postinitialize();
+	if (unlikely(ObjectDB::allocation_tracking)) {
+		ObjectDB::_track_allocation(p_object);
+	}
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
@@ -2115,10 +2143,111 @@ uint32_t ObjectDB::slot_max = 0;
 ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
 uint64_t ObjectDB::validator_counter = 0;
 
+bool ObjectDB::allocation_tracking = false;
+Mutex ObjectDB::allocation_mutex;
+HashMap<ObjectID, uint32_t> ObjectDB::allocation_sites;
+HashMap<String, uint32_t> ObjectDB::allocation_site_indices;
+LocalVector<String> ObjectDB::allocation_site_names;
+
 int ObjectDB::get_object_count() {
 	return slot_count;
 }
 
+String ObjectDB::_get_allocation_site() {
+	// Script stacks are per thread, so this describes whoever is creating the object right now.
+	const int max_depth = 4;
+	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+		ScriptLanguage *language = ScriptServer::get_language(i);
+		int depth = MIN(language->debug_get_stack_level_count(), max_depth);
+		if (depth <= 0) {
+			continue;
+		}
+		String site;
+		for (int j = 0; j < depth; j++) {
+			if (j > 0) {
+				site += " <- ";
+			}
+			site += vformat("%s:%d %s()", language->debug_get_stack_level_source(j), language->debug_get_stack_level_line(j), language->debug_get_stack_level_function(j));
+		}
+		return site;
+	}
+	return String();
+}
+
+void ObjectDB::_track_allocation(Object *p_object) {
+	String site = _get_allocation_site();
+	if (site.is_empty()) {
+		return; // Native allocation, nothing worth storing.
+	}
+
+	MutexLock lock(allocation_mutex);
+	if (!allocation_tracking) {
+		return; // Disabled meanwhile.
+	}
+	HashMap<String, uint32_t>::Iterator E = allocation_site_indices.find(site);
+	uint32_t index;
+	if (E) {
+		index = E->value;
+	} else {
+		index = allocation_site_names.size();
+		allocation_site_names.push_back(site);
+		allocation_site_indices.insert(site, index);
+	}
+	allocation_sites.insert(p_object->get_instance_id(), index);
+}
+
+void ObjectDB::set_allocation_tracking_enabled(bool p_enabled) {
+	MutexLock lock(allocation_mutex);
+	allocation_tracking = p_enabled;
+	if (!p_enabled) {
+		allocation_sites.clear();
+		allocation_site_indices.clear();
+		allocation_site_names.clear();
+	}
+}
+
+void ObjectDB::get_class_counts(HashMap<StringName, int> &r_counts) {
+	spin_lock.lock();
+	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
+		if (object_slots[i].validator) {
+			HashMap<StringName, int>::Iterator E = r_counts.find(object_slots[i].object->get_class_name());
+			if (E) {
+				E->value++;
+			} else {
+				r_counts.insert(object_slots[i].object->get_class_name(), 1);
+			}
+			count--;
+		}
+	}
+	spin_lock.unlock();
+}
+
+void ObjectDB::get_allocations(LocalVector<AllocationInfo> &r_allocations) {
+	spin_lock.lock();
+	r_allocations.reserve(r_allocations.size() + slot_count);
+	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
+		if (object_slots[i].validator) {
+			AllocationInfo info;
+			info.id = object_slots[i].object->get_instance_id();
+			info.class_name = object_slots[i].object->get_class_name();
+			r_allocations.push_back(info);
+			count--;
+		}
+	}
+	spin_lock.unlock();
+
+	MutexLock lock(allocation_mutex);
+	if (allocation_sites.is_empty()) {
+		return;
+	}
+	for (AllocationInfo &info : r_allocations) {
+		HashMap<ObjectID, uint32_t>::ConstIterator E = allocation_sites.find(info.id);
+		if (E) {
+			info.site = allocation_site_names[E->value];
+		}
+	}
+}
+
 ObjectID ObjectDB::add_instance(Object *p_object) {
 	spin_lock.lock();
 	if (unlikely(slot_count == slot_max)) {
@@ -2194,6 +2323,11 @@ void ObjectDB::remove_instance(Object *p_object) {
 	object_slots[slot].object = nullptr;
 
 	spin_lock.unlock();
+
+	if (unlikely(allocation_tracking)) {
+		MutexLock lock(allocation_mutex);
+		allocation_sites.erase(ObjectID(t));
+	}
 }
 
 void ObjectDB::setup() {
@@ -2225,6 +2359,11 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
+					HashMap<ObjectID, uint32_t>::ConstIterator site = allocation_sites.find(obj->get_instance_id());
+					if (site) {
+						extra_info += " - Created at: " + allocation_site_names[site->value];
+					}
+
 					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_VALIDATOR_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(id) + extra_info);
 
@@ -2236,6 +2375,8 @@ void ObjectDB::cleanup() {
 		spin_lock.unlock();
 	}
 
+	set_allocation_tracking_enabled(false);
+
 	if (object_slots) {
 		memfree(object_slots);
 	}
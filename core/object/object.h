@@ -34,11 +34,13 @@
 #include "core/extension/gdextension_interface.h"
 #include "core/object/message_queue.h"
 #include "core/object/object_id.h"
+#include "core/os/mutex.h"
 #include "core/os/rw_lock.h"
 #include "core/os/spin_lock.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -458,16 +460,19 @@ public:
 		}                                                                                                                                        \
 		m_inherits::initialize_class();                                                                                                          \
 		::ClassDB::_add_class<m_class>();                                                                                                        \
+		::ClassDB::_add_class_bind(get_class_static(), m_inherits::get_class_static(), &m_class::_bind_class_methods);                           \
+		initialized = true;                                                                                                                      \
+	}                                                                                                                                            \
+                                                                                                                                                 \
+protected:                                                                                                                                       \
+	static void _bind_class_methods() {                                                                                                          \
 		if (m_class::_get_bind_methods() != m_inherits::_get_bind_methods()) {                                                                   \
 			_bind_methods();                                                                                                                     \
 		}                                                                                                                                        \
 		if (m_class::_get_bind_compatibility_methods() != m_inherits::_get_bind_compatibility_methods()) {                                       \
 			_bind_compatibility_methods();                                                                                                       \
 		}                                                                                                                                        \
-		initialized = true;                                                                                                                      \
 	}                                                                                                                                            \
-                                                                                                                                                 \
-protected:                                                                                                                                       \
 	virtual void _initialize_classv() override {                                                                                                 \
 		initialize_class();                                                                                                                      \
 	}                                                                                                                                            \
@@ -1011,6 +1016,14 @@ class ObjectDB {
 	static ObjectSlot *object_slots;
 	static uint64_t validator_counter;
 
+	// Allocation sites, only recorded while tracking is enabled. Sites are interned,
+	// as a leak usually means many objects created from the same place.
+	static bool allocation_tracking;
+	static Mutex allocation_mutex;
+	static HashMap<ObjectID, uint32_t> allocation_sites;
+	static HashMap<String, uint32_t> allocation_site_indices;
+	static LocalVector<String> allocation_site_names;
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1018,12 +1031,22 @@ class ObjectDB {
 	static ObjectID add_instance(Object *p_object);
 	static void remove_instance(Object *p_object);
 
+	friend void postinitialize_handler(Object *p_object);
+	static String _get_allocation_site();
+	static void _track_allocation(Object *p_object);
+
 	friend void register_core_types();
 	static void setup();
 
 public:
 	typedef void (*DebugFunc)(Object *p_obj);
 
+	struct AllocationInfo {
+		ObjectID id;
+		StringName class_name;
+		String site; // Script call stack at creation, empty if created from native code or while not tracking.
+	};
+
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
@@ -1047,6 +1070,11 @@ public:
 	}
 	static void debug_objects(DebugFunc p_func);
 	static int get_object_count();
+
+	static void set_allocation_tracking_enabled(bool p_enabled);
+	static bool is_allocation_tracking_enabled() { return allocation_tracking; }
+	static void get_class_counts(HashMap<StringName, int> &r_counts);
+	static void get_allocations(LocalVector<AllocationInfo> &r_allocations);
 };
 
 #endif // OBJECT_H
@@ -30,6 +30,8 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/engine_tracer.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/os/thread_safe.h"
 
@@ -51,6 +53,7 @@ void WorkerThreadPool::_process_task_queue() {
 }
 
 void WorkerThreadPool::_process_task(Task *p_task) {
+	ENGINE_TRACE_ZONE("WorkerThreadPool::task");
 	bool low_priority = p_task->low_priority;
 	int pool_thread_index = -1;
 	Task *prev_low_prio_task = nullptr; // In case this is recursively called.
@@ -75,25 +78,31 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
+		Group *group = p_task->group;
 
 		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
+			// Elements are claimed in chunks, so threads only contend for the shared counter once per chunk.
+			// Threads that finish early keep claiming the chunks left, balancing the load among them.
+			uint32_t work_index = group->index.postadd(group->chunk_size);
 
-			if (work_index >= p_task->group->max) {
+			if (work_index >= group->max) {
 				break;
 			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
+			uint32_t work_end = MIN(work_index + group->chunk_size, group->max);
+			for (uint32_t i = work_index; i < work_end; i++) {
+				if (p_task->native_group_func) {
+					p_task->native_group_func(p_task->native_func_userdata, i);
+				} else if (p_task->template_userdata) {
+					p_task->template_userdata->callback_indexed(i);
+				} else {
+					p_task->callable.call(i);
+				}
 			}
 
 			// This is the only way to ensure posting is done when all tasks are really complete.
-			uint32_t completed_amount = p_task->group->completed_index.increment();
+			uint32_t completed_amount = group->completed_index.add(work_end - work_index);
 
-			if (completed_amount == p_task->group->max) {
+			if (completed_amount == group->max) {
 				do_post = true;
 			}
 		}
@@ -106,20 +115,20 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->completed = true;
 			p_task->done_semaphore.post();
 			if (do_post) {
-				p_task->group->completed.set_to(true);
+				group->completed.set_to(true);
 			}
 		} else {
 			if (do_post) {
-				p_task->group->done_semaphore.post();
-				p_task->group->completed.set_to(true);
+				group->done_semaphore.post();
+				group->completed.set_to(true);
 			}
-			uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
-			uint32_t finished_users = p_task->group->finished.increment();
+			uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
+			uint32_t finished_users = group->finished.increment();
 
 			if (finished_users == max_users) {
 				// Get rid of the group, because nobody else is using it.
 				task_mutex.lock();
-				group_allocator.free(p_task->group);
+				group_allocator.free(group);
 				task_mutex.unlock();
 			}
 
@@ -147,7 +156,19 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (!use_native_low_priority_threads) {
 			p_task->pool_thread_index = -1;
 		}
+		TightLocalVector<Task *> ready_dependents;
+		for (Task *dependent : p_task->dependents) {
+			dependent->pending_dependencies--;
+			if (dependent->pending_dependencies == 0) {
+				ready_dependents.push_back(dependent);
+			}
+		}
+		p_task->dependents.clear();
 		task_mutex.unlock(); // Keep mutex down to here since on unlock the task may be freed.
+
+		for (Task *dependent : ready_dependents) {
+			_post_task(dependent, !dependent->low_priority);
+		}
 	}
 
 	// Task may have been freed by now (all callers notified).
@@ -178,6 +199,11 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
+	// Deferred calls made by tasks are staged here and collected by the main queue when it flushes,
+	// so worker threads don't all contend for the main queue's lock on every call.
+	CallQueue staging_queue;
+	MessageQueue::add_thread_staging_queue(&staging_queue);
+
 	while (true) {
 		singleton->task_available_semaphore.wait();
 		if (singleton->exit_threads) {
@@ -185,6 +211,8 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 		}
 		singleton->_process_task_queue();
 	}
+
+	MessageQueue::remove_thread_staging_queue(&staging_queue);
 }
 
 void WorkerThreadPool::_native_low_priority_thread_function(void *p_user) {
@@ -193,36 +221,54 @@ void WorkerThreadPool::_native_low_priority_thread_function(void *p_user) {
 }
 
 void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
+	_post_tasks(&p_task, 1, p_high_priority);
+}
+
+void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority) {
 	// Fall back to processing on the calling thread if there are no worker threads.
 	// Separated into its own variable to make it easier to extend this logic
 	// in custom builds.
 	bool process_on_calling_thread = threads.size() == 0;
 	if (process_on_calling_thread) {
-		_process_task(p_task);
+		for (uint32_t i = 0; i < p_count; i++) {
+			_process_task(p_tasks[i]);
+		}
 		return;
 	}
 
+	uint32_t to_post = 0;
+
 	task_mutex.lock();
-	p_task->low_priority = !p_high_priority;
-	if (!p_high_priority && use_native_low_priority_threads) {
-		p_task->low_priority_thread = native_thread_allocator.alloc();
-		task_mutex.unlock();
+	for (uint32_t i = 0; i < p_count; i++) {
+		Task *task = p_tasks[i];
+		task->low_priority = !p_high_priority;
+		if (!p_high_priority && use_native_low_priority_threads) {
+			task->low_priority_thread = native_thread_allocator.alloc();
+			task_mutex.unlock();
 
-		if (p_task->group) {
-			p_task->group->low_priority_native_tasks.push_back(p_task);
-		}
-		p_task->low_priority_thread->start(_native_low_priority_thread_function, p_task); // Pask task directly to thread.
-	} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-		task_queue.add_last(&p_task->task_elem);
-		if (!p_high_priority) {
-			low_priority_threads_used++;
+			if (task->group) {
+				task->group->low_priority_native_tasks.push_back(task);
+			}
+			task->low_priority_thread->start(_native_low_priority_thread_function, task); // Pask task directly to thread.
+
+			task_mutex.lock();
+		} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
+			task_queue.add_last(&task->task_elem);
+			if (!p_high_priority) {
+				low_priority_threads_used++;
+			}
+			to_post++;
+		} else {
+			// Too many threads using low priority, must go to queue.
+			low_priority_task_queue.add_last(&task->task_elem);
 		}
-		task_mutex.unlock();
+	}
+	task_mutex.unlock();
+
+	// Wake the workers only once all the tasks are queued, so the ones woken first
+	// don't have to fight the poster (and each other) for the queue lock.
+	for (uint32_t i = 0; i < to_post; i++) {
 		task_available_semaphore.post();
-	} else {
-		// Too many threads using low priority, must go to queue.
-		low_priority_task_queue.add_last(&p_task->task_elem);
-		task_mutex.unlock();
 	}
 }
 
@@ -259,7 +305,7 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -269,10 +315,22 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority; // Remembered in case posting is deferred until dependencies are done.
+	for (const TaskID &dependency_id : p_dependencies) {
+		Task **dependencyp = tasks.getptr(dependency_id);
+		// Dependencies no longer registered were already completed and awaited.
+		if (dependencyp && !(*dependencyp)->completed) {
+			(*dependencyp)->dependents.push_back(task);
+			task->pending_dependencies++;
+		}
+	}
 	tasks.insert(id, task);
+	bool ready = task->pending_dependencies == 0;
 	task_mutex.unlock();
 
-	_post_task(task, p_high_priority);
+	if (ready) {
+		_post_task(task, p_high_priority);
+	}
 
 	return id;
 }
@@ -281,6 +339,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_dependent_task(void (*p_func)(void *), void *p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_dependent_task(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	task_mutex.lock();
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -403,6 +469,9 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 
 	task_mutex.unlock();
+
+	// Whatever the task deferred must be queued before what the waiter defers next.
+	MessageQueue::collect_thread_staging_queues();
 	return OK;
 }
 
@@ -431,6 +500,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	} else {
 		group->tasks_used = p_tasks;
+		group->chunk_size = MAX(1u, (uint32_t)p_elements / ((uint32_t)p_tasks * GROUP_CHUNKS_PER_TASK));
 		tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
 		for (int i = 0; i < p_tasks; i++) {
 			Task *task = task_allocator.alloc();
@@ -448,9 +518,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	groups[id] = group;
 	task_mutex.unlock();
 
-	for (int i = 0; i < p_tasks; i++) {
-		_post_task(tasks_posted[i], p_high_priority);
-	}
+	_post_tasks(tasks_posted, p_tasks, p_high_priority);
 
 	return id;
 }
@@ -486,6 +554,10 @@ bool WorkerThreadPool::is_group_task_completed(GroupID p_group) const {
 	return completed;
 }
 
+bool WorkerThreadPool::is_pool_thread() const {
+	return thread_ids.has(Thread::get_caller_id());
+}
+
 void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	task_mutex.lock();
 	Group **groupp = groups.getptr(p_group);
@@ -524,6 +596,8 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	task_mutex.lock(); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
 	groups.erase(p_group);
 	task_mutex.unlock();
+
+	MessageQueue::collect_thread_staging_queues();
 }
 
 void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_priority, float p_low_priority_task_ratio) {
@@ -531,6 +605,17 @@ void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_pr
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
 	}
+#ifdef WEB_PTHREAD_POOL_SIZE
+	// Web Workers beyond the pre-spawned pool only start once the main thread yields to the browser,
+	// so waiting on them from the main thread would hang.
+	if (p_thread_count > WEB_PTHREAD_POOL_SIZE - 1) {
+		WARN_PRINT(vformat("Worker thread count limited to %d by the Web Worker pool size.", WEB_PTHREAD_POOL_SIZE - 1));
+		p_thread_count = MAX(WEB_PTHREAD_POOL_SIZE - 1, 1);
+	}
+	// For the same reason, a system thread started for a low priority task (e.g. a threaded resource load)
+	// would only run once the main thread stops waiting for it. Run them on the pool instead.
+	p_use_native_threads_low_priority = false;
+#endif
 
 	if (p_use_native_threads_low_priority) {
 		max_low_priority_threads = 0;
@@ -572,11 +657,34 @@ void WorkerThreadPool::finish() {
 		data.thread.wait_to_finish();
 	}
 
+	// Dependent tasks still waiting for their dependencies will never be posted now,
+	// so cancel them to release anyone waiting for their completion.
+	task_mutex.lock();
+	for (KeyValue<TaskID, Task *> &E : tasks) {
+		Task *task = E.value;
+		if (task->completed || task->pending_dependencies == 0) {
+			continue;
+		}
+		print_error("Dependent task was never posted: " + task->description);
+		if (task->template_userdata) {
+			memdelete(task->template_userdata);
+			task->template_userdata = nullptr;
+		}
+		task->pending_dependencies = 0;
+		task->dependents.clear();
+		task->completed = true;
+		for (uint32_t i = 0; i < task->waiting; i++) {
+			task->done_semaphore.post();
+		}
+	}
+	task_mutex.unlock();
+
 	threads.clear();
 }
 
 void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_dependent_task", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_dependent_task, DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
@@ -39,6 +39,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/sort_array.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -51,6 +52,12 @@ public:
 	typedef int64_t GroupID;
 
 private:
+	enum {
+		// How many element chunks each task of a group should get, on average.
+		// More chunks allow better load balancing; fewer ones mean less contention.
+		GROUP_CHUNKS_PER_TASK = 8,
+	};
+
 	struct Task;
 
 	struct BaseTemplateUserdata {
@@ -64,6 +71,7 @@ private:
 		SafeNumeric<uint32_t> index;
 		SafeNumeric<uint32_t> completed_index;
 		uint32_t max = 0;
+		uint32_t chunk_size = 1;
 		Semaphore done_semaphore;
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
@@ -86,6 +94,8 @@ private:
 		BaseTemplateUserdata *template_userdata = nullptr;
 		Thread *low_priority_thread = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0; // Not posted until all the tasks it depends on are completed.
+		TightLocalVector<Task *> dependents; // Tasks to release on completion.
 
 		void free_template_userdata();
 		Task() :
@@ -130,13 +140,14 @@ private:
 	void _process_task(Task *task);
 
 	void _post_task(Task *p_task, bool p_high_priority);
+	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority);
 
 	bool _try_promote_low_priority_task();
 	void _prevent_low_prio_saturation_deadlock();
 
 	static WorkerThreadPool *singleton;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
 
 	template <class C, class M, class U>
@@ -159,10 +170,46 @@ private:
 		}
 	};
 
+	template <class F>
+	struct ParallelForUserData {
+		const F *func = nullptr;
+		uint32_t count = 0;
+		uint32_t grain_size = 1;
+
+		static void run_chunk(void *p_userdata, uint32_t p_chunk) {
+			const ParallelForUserData *ud = (const ParallelForUserData *)p_userdata;
+			const uint32_t from = p_chunk * ud->grain_size;
+			(*ud->func)(from, MIN(from + ud->grain_size, ud->count));
+		}
+	};
+
+	template <class T, class Comparator>
+	static void _merge_sorted_runs(const T *p_src, T *p_dst, uint32_t p_from, uint32_t p_mid, uint32_t p_to, const Comparator &p_compare) {
+		uint32_t l = p_from;
+		uint32_t r = p_mid;
+		uint32_t w = p_from;
+		while (l < p_mid && r < p_to) {
+			// Only take from the right run when strictly smaller, so equal elements keep their run order.
+			if (p_compare(p_src[r], p_src[l])) {
+				p_dst[w++] = p_src[r++];
+			} else {
+				p_dst[w++] = p_src[l++];
+			}
+		}
+		while (l < p_mid) {
+			p_dst[w++] = p_src[l++];
+		}
+		while (r < p_to) {
+			p_dst[w++] = p_src[r++];
+		}
+	}
+
 protected:
 	static void _bind_methods();
 
 public:
+	bool is_pool_thread() const;
+
 	template <class C, class M, class U>
 	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
 		typedef TaskUserData<C, M, U> TUD;
@@ -175,6 +222,20 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Dependent tasks are only queued once all the tasks they depend on are completed,
+	// so chains of work don't need a blocking wait between each step.
+	template <class C, class M, class U>
+	TaskID add_template_dependent_task(C *p_instance, M p_method, U p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
+	}
+	TaskID add_native_dependent_task(void (*p_func)(void *), void *p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_dependent_task(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -193,6 +254,153 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Blocking data-parallel helpers built on group tasks. The range is split
+	// in chunks of p_grain_size elements, each processed by a single call.
+	// They run inline when there is a single chunk, or when called from a pool
+	// thread (waiting there could starve the pool).
+
+	// Calls p_func(from, to) for consecutive ranges covering [0, p_count).
+	template <class F>
+	void parallel_for(uint32_t p_count, uint32_t p_grain_size, const F &p_func, const String &p_description = String()) {
+		if (p_count == 0) {
+			return;
+		}
+		p_grain_size = MAX(1u, p_grain_size);
+		const uint32_t chunks = (p_count - 1) / p_grain_size + 1;
+		if (chunks == 1 || threads.size() <= 1 || is_pool_thread()) {
+			p_func(0, p_count);
+			return;
+		}
+
+		ParallelForUserData<F> ud;
+		ud.func = &p_func;
+		ud.count = p_count;
+		ud.grain_size = p_grain_size;
+		GroupID group = add_native_group_task(&ParallelForUserData<F>::run_chunk, &ud, chunks, -1, true, p_description);
+		wait_for_group_task_completion(group);
+	}
+
+	// Combines with p_reduce(a, b) the results of p_func(from, to) over ranges covering [0, p_count).
+	template <class T, class F, class R>
+	T parallel_reduce(uint32_t p_count, uint32_t p_grain_size, const T &p_identity, const F &p_func, const R &p_reduce, const String &p_description = String()) {
+		if (p_count == 0) {
+			return p_identity;
+		}
+		p_grain_size = MAX(1u, p_grain_size);
+		const uint32_t chunks = (p_count - 1) / p_grain_size + 1;
+
+		LocalVector<T> partials;
+		partials.resize(chunks);
+		parallel_for(
+				chunks, 1, [&](uint32_t p_from, uint32_t p_to) {
+					for (uint32_t i = p_from; i < p_to; i++) {
+						partials[i] = p_func(i * p_grain_size, MIN((i + 1) * p_grain_size, p_count));
+					}
+				},
+				p_description);
+
+		T result = p_identity;
+		for (const T &partial : partials) {
+			result = p_reduce(result, partial);
+		}
+		return result;
+	}
+
+	// Replaces p_array with its exclusive prefix sum and returns the total.
+	template <class T>
+	T parallel_prefix_sum(T *p_array, uint32_t p_count, uint32_t p_grain_size, const String &p_description = String()) {
+		if (p_count == 0) {
+			return T();
+		}
+		p_grain_size = MAX(1u, p_grain_size);
+		const uint32_t chunks = (p_count - 1) / p_grain_size + 1;
+
+		// Sum each chunk, scan the chunk sums, then scan each chunk from its offset.
+		LocalVector<T> offsets;
+		offsets.resize(chunks);
+		parallel_for(
+				p_count, p_grain_size, [&](uint32_t p_from, uint32_t p_to) {
+					T sum = T();
+					for (uint32_t i = p_from; i < p_to; i++) {
+						sum += p_array[i];
+					}
+					offsets[p_from / p_grain_size] = sum;
+				},
+				p_description);
+
+		T total = T();
+		for (T &offset : offsets) {
+			T sum = offset;
+			offset = total;
+			total += sum;
+		}
+
+		parallel_for(
+				p_count, p_grain_size, [&](uint32_t p_from, uint32_t p_to) {
+					T running = offsets[p_from / p_grain_size];
+					for (uint32_t i = p_from; i < p_to; i++) {
+						T value = p_array[i];
+						p_array[i] = running;
+						running += value;
+					}
+				},
+				p_description);
+
+		return total;
+	}
+
+	// Sorts chunks of p_grain_size elements with SortArray in parallel, then merges them pairwise.
+	// Like SortArray, the sort is not stable. Callers sorting every frame can pass r_buffer, which is
+	// used as the merge buffer and keeps its memory between calls.
+	template <class T, class Comparator = _DefaultComparator<T>>
+	void parallel_sort(T *p_array, uint32_t p_count, uint32_t p_grain_size, const Comparator &p_compare = Comparator(), const String &p_description = String(), LocalVector<T> *r_buffer = nullptr) {
+		p_grain_size = MAX(1u, p_grain_size);
+		if (p_count <= p_grain_size || threads.size() <= 1 || is_pool_thread()) {
+			SortArray<T, Comparator> sorter;
+			sorter.compare = p_compare;
+			sorter.sort(p_array, p_count);
+			return;
+		}
+
+		parallel_for(
+				p_count, p_grain_size, [&](uint32_t p_from, uint32_t p_to) {
+					SortArray<T, Comparator> sorter;
+					sorter.compare = p_compare;
+					sorter.sort(p_array + p_from, p_to - p_from);
+				},
+				p_description);
+
+		LocalVector<T> local_buffer;
+		LocalVector<T> &buffer = r_buffer ? *r_buffer : local_buffer;
+		buffer.resize(p_count);
+		T *src = p_array;
+		T *dst = buffer.ptr();
+		for (uint32_t width = p_grain_size; width < p_count; width *= 2) {
+			const uint32_t pairs = (p_count - 1) / (width * 2) + 1;
+			parallel_for(
+					pairs, 1, [&](uint32_t p_from, uint32_t p_to) {
+						for (uint32_t i = p_from; i < p_to; i++) {
+							const uint32_t from = i * width * 2;
+							const uint32_t mid = MIN(from + width, p_count);
+							const uint32_t to = MIN(from + width * 2, p_count);
+							_merge_sorted_runs(src, dst, from, mid, to, p_compare);
+						}
+					},
+					p_description);
+			SWAP(src, dst);
+		}
+
+		if (src != p_array) {
+			parallel_for(
+					p_count, p_grain_size, [&](uint32_t p_from, uint32_t p_to) {
+						for (uint32_t i = p_from; i < p_to; i++) {
+							p_array[i] = src[i];
+						}
+					},
+					p_description);
+		}
+	}
+
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
@@ -61,9 +61,13 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
-#endif
+SafeNumeric<uint64_t> Memory::tag_usage[Memory::TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_alloc_count[Memory::TAG_MAX];
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_GENERAL;
 
-SafeNumeric<uint64_t> Memory::alloc_count;
+#define HEADER_SIZE_MASK 0x00FFFFFFFFFFFFFF
+#define HEADER_TAG_SHIFT 56
+#endif
 
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
@@ -76,8 +80,6 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
-	alloc_count.increment();
-
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
 		*s = p_bytes;
@@ -87,6 +89,10 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+
+		*s |= uint64_t(current_tag) << HEADER_TAG_SHIFT;
+		tag_usage[current_tag].add(p_bytes);
+		tag_alloc_count[current_tag].increment();
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -112,11 +118,15 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)mem;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+		const uint64_t old_bytes = *s & HEADER_SIZE_MASK;
+		const Tag tag = Tag(*s >> HEADER_TAG_SHIFT);
+		if (p_bytes > old_bytes) {
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_bytes);
 			max_usage.exchange_if_greater(new_mem_usage);
+			tag_usage[tag].add(p_bytes - old_bytes);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(old_bytes - p_bytes);
+			tag_usage[tag].sub(old_bytes - p_bytes);
 		}
 #endif
 
@@ -132,6 +142,9 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			s = (uint64_t *)mem;
 
 			*s = p_bytes;
+#ifdef DEBUG_ENABLED
+			*s |= uint64_t(tag) << HEADER_TAG_SHIFT;
+#endif
 
 			return mem + PAD_ALIGN;
 		}
@@ -155,14 +168,13 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	alloc_count.decrement();
-
 	if (prepad) {
 		mem -= PAD_ALIGN;
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)mem;
-		mem_usage.sub(*s);
+		mem_usage.sub(*s & HEADER_SIZE_MASK);
+		tag_usage[*s >> HEADER_TAG_SHIFT].sub(*s & HEADER_SIZE_MASK);
 #endif
 
 		free(mem);
@@ -191,6 +203,34 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_mem_usage_for_tag(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_mem_alloc_count_for_tag(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_alloc_count[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+Memory::Tag Memory::set_current_tag(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	Tag previous = current_tag;
+	current_tag = p_tag;
+	return previous;
+#else
+	return TAG_GENERAL;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
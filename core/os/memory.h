@@ -43,12 +43,29 @@
 #endif
 
 class Memory {
+public:
+	// Subsystems allocations can be accounted to, see MEMORY_TAG_SCOPE().
+	enum Tag {
+		TAG_GENERAL,
+		TAG_PHYSICS,
+		TAG_NAVIGATION,
+		TAG_SCRIPT,
+		TAG_TEXT,
+		TAG_RESOURCE_LOADING,
+		TAG_MAX,
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
-#endif
 
-	static SafeNumeric<uint64_t> alloc_count;
+	// The tag is stored in the top byte of the size kept in the allocation header,
+	// so memory is credited back to the subsystem that allocated it on free.
+	static SafeNumeric<uint64_t> tag_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_alloc_count[TAG_MAX];
+	static thread_local Tag current_tag;
+#endif
 
 public:
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
@@ -58,8 +75,32 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	// Per-subsystem accounting, only available in debug builds (returns 0 otherwise).
+	static uint64_t get_mem_usage_for_tag(Tag p_tag);
+	static uint64_t get_mem_alloc_count_for_tag(Tag p_tag);
+	static Tag set_current_tag(Tag p_tag);
 };
 
+#ifdef DEBUG_ENABLED
+class MemoryTagScope {
+	Memory::Tag previous_tag;
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {
+		previous_tag = Memory::set_current_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_current_tag(previous_tag);
+	}
+};
+
+// Accounts the allocations made by the current thread until the end of the scope to the given tag.
+#define MEMORY_TAG_SCOPE(m_tag) MemoryTagScope _memory_tag_scope_(Memory::m_tag)
+#else
+#define MEMORY_TAG_SCOPE(m_tag)
+#endif
+
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
@@ -613,21 +613,16 @@ String OS::get_benchmark_file() {
 }
 
 void OS::benchmark_begin_measure(const String &p_what) {
-#ifdef TOOLS_ENABLED
 	start_benchmark_from[p_what] = OS::get_singleton()->get_ticks_usec();
-#endif
 }
 void OS::benchmark_end_measure(const String &p_what) {
-#ifdef TOOLS_ENABLED
 	uint64_t total = OS::get_singleton()->get_ticks_usec() - start_benchmark_from[p_what];
 	double total_f = double(total) / double(1000000);
 
 	startup_benchmark_json[p_what] = total_f;
-#endif
 }
 
 void OS::benchmark_dump() {
-#ifdef TOOLS_ENABLED
 	if (!use_benchmark) {
 		return;
 	}
@@ -646,7 +641,6 @@ void OS::benchmark_dump() {
 			print_line("\t-", K, ": ", startup_benchmark_json[K], +" sec.");
 		}
 	}
-#endif
 }
 
 OS::OS() {
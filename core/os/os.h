@@ -308,7 +308,7 @@ public:
 	virtual Vector<String> get_granted_permissions() const { return Vector<String>(); }
 	virtual void revoke_granted_permissions() {}
 
-	// For recording / measuring benchmark data. Only enabled with tools
+	// For recording / measuring startup and shutdown times, see `--benchmark`.
 	void set_use_benchmark(bool p_use_benchmark);
 	bool is_use_benchmark_set();
 	void set_benchmark_file(const String &p_benchmark_file);
@@ -38,6 +38,7 @@
 #include "core/crypto/crypto.h"
 #include "core/crypto/hashing_context.h"
 #include "core/debugger/engine_profiler.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/extension/gdextension.h"
 #include "core/extension/gdextension_manager.h"
 #include "core/input/input.h"
@@ -369,6 +370,7 @@ void unregister_core_types() {
 	// Destroy singletons in reverse order to ensure dependencies are not broken.
 
 	memdelete(worker_thread_pool);
+	EngineTracer::finish(); // After the pool, so no thread can still be recording.
 
 	memdelete(_engine_debugger);
 	memdelete(_marshalls);
@@ -47,6 +47,31 @@ StringName _scs_create(const char *p_chr, bool p_static) {
 
 bool StringName::configured = false;
 Mutex StringName::mutex;
+Mutex StringName::table_mutexes[STRING_TABLE_LOCK_COUNT];
+
+bool StringName::_Data::name_equals(const String &p_name) const {
+	return cname ? p_name == cname : name == p_name;
+}
+
+bool StringName::_Data::name_equals(const char *p_name) const {
+	return cname ? strcmp(cname, p_name) == 0 : name == p_name;
+}
+
+bool StringName::_Data::name_equals(const char32_t *p_name) const {
+	if (!cname) {
+		return name == p_name;
+	}
+	const char *l = cname;
+	const char32_t *r = p_name;
+	while (*l && *r) {
+		if ((char32_t)(uint8_t)*l != *r) {
+			return false;
+		}
+		l++;
+		r++;
+	}
+	return !*l && !*r;
+}
 
 #ifdef DEBUG_ENABLED
 bool StringName::debug_stringname = false;
@@ -120,7 +145,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(_get_table_mutex(_data->idx));
 
 		if (_data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -152,7 +177,7 @@ bool StringName::operator==(const String &p_name) const {
 		return (p_name.length() == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	return _data->name_equals(p_name);
 }
 
 bool StringName::operator==(const char *p_name) const {
@@ -160,7 +185,7 @@ bool StringName::operator==(const char *p_name) const {
 		return (p_name[0] == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	return _data->name_equals(p_name);
 }
 
 bool StringName::operator!=(const String &p_name) const {
@@ -216,17 +241,16 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && _data->name_equals(p_name)) {
 			break;
 		}
 		_data = _data->next;
@@ -275,17 +299,16 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
+		if (_data->hash == hash && _data->name_equals(p_static_string.ptr)) {
 			break;
 		}
 		_data = _data->next;
@@ -335,15 +358,15 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && _data->name_equals(p_name)) {
 			break;
 		}
 		_data = _data->next;
@@ -393,16 +416,16 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && _data->name_equals(p_name)) {
 			break;
 		}
 		_data = _data->next;
@@ -429,17 +452,16 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && _data->name_equals(p_name)) {
 			break;
 		}
 		_data = _data->next;
@@ -455,17 +477,16 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && p_name == _data->get_name()) {
+		if (_data->hash == hash && _data->name_equals(p_name)) {
 			break;
 		}
 		_data = _data->next;
@@ -483,16 +504,17 @@ StringName StringName::search(const String &p_name) {
 	return StringName(); //does not exist
 }
 
+// Compare against the interned data directly, converting to String would allocate for static names.
 bool operator==(const String &p_name, const StringName &p_string_name) {
-	return p_name == p_string_name.operator String();
+	return p_string_name == p_name;
 }
 bool operator!=(const String &p_name, const StringName &p_string_name) {
-	return p_name != p_string_name.operator String();
+	return p_string_name != p_name;
 }
 
 bool operator==(const char *p_name, const StringName &p_string_name) {
-	return p_name == p_string_name.operator String();
+	return p_string_name == p_name;
 }
 bool operator!=(const char *p_name, const StringName &p_string_name) {
-	return p_name != p_string_name.operator String();
+	return p_string_name != p_name;
 }
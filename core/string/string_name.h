@@ -48,7 +48,12 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// The table is split in stripes, each one guarded by its own lock,
+		// so threads creating unrelated names don't serialize on a single mutex.
+		STRING_TABLE_LOCK_BITS = 6,
+		STRING_TABLE_LOCK_COUNT = 1 << STRING_TABLE_LOCK_BITS,
+		STRING_TABLE_LOCK_MASK = STRING_TABLE_LOCK_COUNT - 1,
 	};
 
 	struct _Data {
@@ -60,6 +65,10 @@ class StringName {
 		uint32_t debug_references = 0;
 #endif
 		String get_name() const { return cname ? String(cname) : name; }
+		// Compare without building a String out of cname.
+		bool name_equals(const String &p_name) const;
+		bool name_equals(const char *p_name) const;
+		bool name_equals(const char32_t *p_name) const;
 		int idx = 0;
 		uint32_t hash = 0;
 		_Data *prev = nullptr;
@@ -81,6 +90,8 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static Mutex mutex;
+	static Mutex table_mutexes[STRING_TABLE_LOCK_COUNT];
+	static _FORCE_INLINE_ Mutex &_get_table_mutex(uint32_t p_idx) { return table_mutexes[p_idx & STRING_TABLE_LOCK_MASK]; }
 	static void setup();
 	static void cleanup();
 	static bool configured;
@@ -674,19 +674,14 @@ bool String::operator==(const String &p_str) const {
 		return true;
 	}
 
-	int l = length();
-
 	const char32_t *src = get_data();
 	const char32_t *dst = p_str.get_data();
 
-	/* Compare char by char */
-	for (int i = 0; i < l; i++) {
-		if (src[i] != dst[i]) {
-			return false;
-		}
+	if (src == dst) {
+		return true; // Copy-on-write share the same buffer.
 	}
 
-	return true;
+	return memcmp(src, dst, length() * sizeof(char32_t)) == 0;
 }
 
 bool String::operator==(const StrRange &p_str_range) const {
@@ -1806,6 +1801,44 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		}
 	}
 
+	/* Fast path for pure ASCII input (most text files, paths and identifiers), which needs no decoding */
+	{
+		const char *ptrtmp = p_utf8;
+		const char *ptrtmp_limit = &p_utf8[p_len];
+		int cr_count = 0;
+		bool is_ascii = true;
+		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			if (unlikely(uint8_t(*ptrtmp) >= 0x80)) {
+				is_ascii = false;
+				break;
+			}
+			if (*ptrtmp == '\r') {
+				cr_count++;
+			}
+			ptrtmp++;
+		}
+
+		if (is_ascii) {
+			const int ascii_len = ptrtmp - p_utf8;
+			const int ascii_size = p_skip_cr ? ascii_len - cr_count : ascii_len;
+			if (ascii_size == 0) {
+				clear();
+				return OK; // empty string
+			}
+
+			resize(ascii_size + 1);
+			char32_t *dst = ptrw();
+			for (int i = 0; i < ascii_len; i++) {
+				if (p_skip_cr && p_utf8[i] == '\r') {
+					continue;
+				}
+				*(dst++) = char32_t(p_utf8[i]);
+			}
+			*dst = 0;
+			return OK;
+		}
+	}
+
 	bool decode_error = false;
 	bool decode_failed = false;
 	{
@@ -2989,24 +3022,13 @@ int String::find(const String &p_str, int p_from) const {
 
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
+	const char32_t first = str[0];
+	const size_t tail_size = (src_len - 1) * sizeof(char32_t);
 
+	// Scan for the first character, and only compare the rest of the needle
+	// (as a block) where it matches.
 	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			if (src[read_pos] != str[j]) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
+		if (src[i] == first && memcmp(src + i + 1, str + 1, tail_size) == 0) {
 			return i;
 		}
 	}
@@ -3276,13 +3298,7 @@ bool String::ends_with(const String &p_string) const {
 	const char32_t *p = &p_string[0];
 	const char32_t *s = &operator[](length() - l);
 
-	for (int i = 0; i < l; i++) {
-		if (p[i] != s[i]) {
-			return false;
-		}
-	}
-
-	return true;
+	return memcmp(p, s, l * sizeof(char32_t)) == 0;
 }
 
 bool String::begins_with(const String &p_string) const {
@@ -3298,13 +3314,7 @@ bool String::begins_with(const String &p_string) const {
 	const char32_t *p = &p_string[0];
 	const char32_t *s = &operator[](0);
 
-	for (int i = 0; i < l; i++) {
-		if (p[i] != s[i]) {
-			return false;
-		}
-	}
-
-	return true;
+	return memcmp(p, s, l * sizeof(char32_t)) == 0;
 }
 
 bool String::begins_with(const char *p_string) const {
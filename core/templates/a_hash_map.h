@@ -0,0 +1,673 @@
+/**************************************************************************/
+/*  a_hash_map.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef A_HASH_MAP_H
+#define A_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hash_map.h"
+
+struct AHashMapData {
+	uint32_t hash;
+	uint32_t hash_to_key;
+};
+
+static_assert(sizeof(AHashMapData) == 8);
+
+/**
+ * An array-based implementation of a hash map. It is very efficient in terms
+ * of performance and memory usage. Works like a dynamic array, adding elements
+ * to the end of the array, and allows you to access array elements by their
+ * index by using `get_by_index` method.
+ *
+ * Keys and values are stored contiguously in a single array, while a separate
+ * power of two sized metadata table (hash + element index, 8 bytes per slot)
+ * is probed with Robin Hood hashing and backward shift deletion. Lookups never
+ * chase per-element pointers and iteration is a linear walk over the array.
+ *
+ * Iteration follows insertion order until an element is erased: erasing moves
+ * the last element into the freed slot. Use HashMap if the order must be kept.
+ *
+ * The assignment operator copy the pairs from one map to the other.
+ */
+
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class AHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t INITIAL_CAPACITY = 16;
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static_assert(EMPTY_HASH == 0, "EMPTY_HASH must always be 0 for the zeroed allocation of the metadata to work.");
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+	MapKeyValue *elements = nullptr;
+	AHashMapData *map_data = nullptr;
+
+	// Due to optimization, this is `capacity - 1`. Use + 1 to get normal capacity.
+	uint32_t capacity = 0;
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	// Maximum amount of elements that fit before a resize, minus one.
+	// Equals `(p_capacity + 1) * 0.75 - 1`, only valid when `p_capacity` is 2^n - 1.
+	static _FORCE_INLINE_ uint32_t _get_resize_count(const uint32_t p_capacity) {
+		return p_capacity ^ ((p_capacity + 1) >> 2);
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(const uint32_t p_pos, const uint32_t p_hash, const uint32_t p_capacity) {
+		const uint32_t original_pos = p_hash & p_capacity;
+		return (p_pos - original_pos + p_capacity + 1) & p_capacity;
+	}
+
+	static AHashMapData *_alloc_map_data(uint32_t p_real_capacity) {
+		AHashMapData *data = reinterpret_cast<AHashMapData *>(Memory::alloc_static(sizeof(AHashMapData) * p_real_capacity));
+		memset(data, 0, sizeof(AHashMapData) * p_real_capacity);
+		return data;
+	}
+
+	bool _lookup_idx(const TKey &p_key, uint32_t &r_element_idx, uint32_t &r_meta_idx) const {
+		if (elements == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements.
+		}
+		return _lookup_idx_with_hash(p_key, r_element_idx, r_meta_idx, _hash(p_key));
+	}
+
+	bool _lookup_idx_with_hash(const TKey &p_key, uint32_t &r_element_idx, uint32_t &r_meta_idx, uint32_t p_hash) const {
+		if (elements == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements.
+		}
+
+		uint32_t meta_idx = p_hash & capacity;
+		uint32_t distance = 0;
+
+		while (true) {
+			const AHashMapData &data = map_data[meta_idx];
+			if (data.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (distance > _get_probe_length(meta_idx, data.hash, capacity)) {
+				return false;
+			}
+
+			if (data.hash == p_hash && Comparator::compare(elements[data.hash_to_key].key, p_key)) {
+				r_element_idx = data.hash_to_key;
+				r_meta_idx = meta_idx;
+				return true;
+			}
+
+			meta_idx = (meta_idx + 1) & capacity;
+			distance++;
+		}
+	}
+
+	void _insert_meta(uint32_t p_hash, uint32_t p_element_idx) {
+		uint32_t meta_idx = p_hash & capacity;
+
+		AHashMapData data;
+		data.hash = p_hash;
+		data.hash_to_key = p_element_idx;
+		uint32_t distance = 0;
+
+		while (true) {
+			if (map_data[meta_idx].hash == EMPTY_HASH) {
+				map_data[meta_idx] = data;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(meta_idx, map_data[meta_idx].hash, capacity);
+			if (existing_probe_len < distance) {
+				SWAP(data, map_data[meta_idx]);
+				distance = existing_probe_len;
+			}
+
+			meta_idx = (meta_idx + 1) & capacity;
+			distance++;
+		}
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		uint32_t real_old_capacity = capacity + 1;
+		// Capacity can't be 0 and must be 2^n - 1.
+		capacity = MAX(4u, p_new_capacity);
+		uint32_t real_capacity = next_power_of_2(capacity);
+		capacity = real_capacity - 1;
+
+		AHashMapData *old_map_data = map_data;
+
+		map_data = _alloc_map_data(real_capacity);
+		// Keys and values are relocated bitwise, like LocalVector does.
+		elements = reinterpret_cast<MapKeyValue *>(Memory::realloc_static(elements, sizeof(MapKeyValue) * (_get_resize_count(capacity) + 1)));
+
+		if (num_elements != 0) {
+			for (uint32_t i = 0; i < real_old_capacity; i++) {
+				const AHashMapData &data = old_map_data[i];
+				if (data.hash != EMPTY_HASH) {
+					_insert_meta(data.hash, data.hash_to_key);
+				}
+			}
+		}
+
+		if (old_map_data) {
+			Memory::free_static(old_map_data);
+		}
+	}
+
+	int32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(elements == nullptr)) {
+			// Allocate on demand to save memory.
+			uint32_t real_capacity = capacity + 1;
+			map_data = _alloc_map_data(real_capacity);
+			elements = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * (_get_resize_count(capacity) + 1)));
+		}
+
+		if (unlikely(num_elements > _get_resize_count(capacity))) {
+			_resize_and_rehash(capacity * 2);
+		}
+
+		memnew_placement(&elements[num_elements], MapKeyValue(p_key, p_value));
+
+		_insert_meta(p_hash, num_elements);
+		num_elements++;
+		return num_elements - 1;
+	}
+
+	void _init_from(const AHashMap &p_other) {
+		capacity = p_other.capacity;
+		num_elements = p_other.num_elements;
+
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		uint32_t real_capacity = capacity + 1;
+		map_data = reinterpret_cast<AHashMapData *>(Memory::alloc_static(sizeof(AHashMapData) * real_capacity));
+		elements = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * (_get_resize_count(capacity) + 1)));
+
+		if constexpr (std::is_trivially_copyable_v<TKey> && std::is_trivially_copyable_v<TValue>) {
+			memcpy(elements, p_other.elements, sizeof(MapKeyValue) * num_elements);
+		} else {
+			for (uint32_t i = 0; i < num_elements; i++) {
+				memnew_placement(&elements[i], MapKeyValue(p_other.elements[i]));
+			}
+		}
+
+		memcpy(map_data, p_other.map_data, sizeof(AHashMapData) * real_capacity);
+	}
+
+	void _clear_data() {
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			for (uint32_t i = 0; i < num_elements; i++) {
+				elements[i].key.~TKey();
+				elements[i].value.~TValue();
+			}
+		}
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity + 1; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || num_elements == 0) {
+			return;
+		}
+
+		_clear_data();
+
+		memset(map_data, EMPTY_HASH, sizeof(AHashMapData) * (capacity + 1));
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+		CRASH_COND_MSG(!exists, "AHashMap key not found.");
+		return elements[element_idx].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+		CRASH_COND_MSG(!exists, "AHashMap key not found.");
+		return elements[element_idx].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+
+		if (exists) {
+			return &elements[element_idx].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+
+		if (exists) {
+			return &elements[element_idx].value;
+		}
+		return nullptr;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t _idx = 0;
+		uint32_t meta_idx = 0;
+		return _lookup_idx(p_key, _idx, meta_idx);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t meta_idx = 0;
+		uint32_t element_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+
+		if (!exists) {
+			return false;
+		}
+
+		uint32_t next_meta_idx = (meta_idx + 1) & capacity;
+		while (map_data[next_meta_idx].hash != EMPTY_HASH && _get_probe_length(next_meta_idx, map_data[next_meta_idx].hash, capacity) != 0) {
+			SWAP(map_data[next_meta_idx], map_data[meta_idx]);
+
+			meta_idx = next_meta_idx;
+			next_meta_idx = (next_meta_idx + 1) & capacity;
+		}
+
+		map_data[meta_idx].hash = EMPTY_HASH;
+		elements[element_idx].key.~TKey();
+		elements[element_idx].value.~TValue();
+		num_elements--;
+
+		if (element_idx != num_elements) {
+			// Move the last element into the freed slot and repoint its metadata.
+			uint32_t last_meta_idx = _hash(elements[num_elements].key) & capacity;
+			while (map_data[last_meta_idx].hash == EMPTY_HASH || map_data[last_meta_idx].hash_to_key != num_elements) {
+				last_meta_idx = (last_meta_idx + 1) & capacity;
+			}
+			map_data[last_meta_idx].hash_to_key = element_idx;
+			memcpy((void *)&elements[element_idx], (const void *)&elements[num_elements], sizeof(MapKeyValue));
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		ERR_FAIL_COND_MSG(p_new_capacity < size(), "reserve() called with a capacity smaller than the current size. This is likely a mistake.");
+		if (elements == nullptr) {
+			capacity = MAX(4u, p_new_capacity);
+			capacity = next_power_of_2(capacity) - 1;
+			return; // Unallocated yet.
+		}
+		if (p_new_capacity <= get_capacity()) {
+			return;
+		}
+		_resize_and_rehash(p_new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return *pair;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return pair;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (pair) {
+				pair++;
+				if (pair == end) {
+					pair = nullptr;
+				}
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (pair) {
+				if (pair == begin) {
+					pair = nullptr;
+				} else {
+					pair--;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pair == b.pair; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pair != b.pair; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pair != nullptr;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const MapKeyValue *p_key, const MapKeyValue *p_begin, const MapKeyValue *p_end) {
+			pair = p_key;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			pair = p_it.pair;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			pair = p_it.pair;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+
+	private:
+		const MapKeyValue *pair = nullptr;
+		const MapKeyValue *begin = nullptr;
+		const MapKeyValue *end = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return *pair;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return pair;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (pair) {
+				pair++;
+				if (pair == end) {
+					pair = nullptr;
+				}
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (pair) {
+				if (pair == begin) {
+					pair = nullptr;
+				} else {
+					pair--;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pair == b.pair; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pair != b.pair; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pair != nullptr;
+		}
+
+		_FORCE_INLINE_ Iterator(MapKeyValue *p_key, MapKeyValue *p_begin, MapKeyValue *p_end) {
+			pair = p_key;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			pair = p_it.pair;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			pair = p_it.pair;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(pair, begin, end);
+		}
+
+	private:
+		MapKeyValue *pair = nullptr;
+		MapKeyValue *begin = nullptr;
+		MapKeyValue *end = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(num_elements ? elements : nullptr, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		if (unlikely(num_elements == 0)) {
+			return Iterator(nullptr, nullptr, nullptr);
+		}
+		return Iterator(elements + num_elements - 1, elements, elements + num_elements);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t meta_idx = 0;
+		uint32_t element_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+		if (!exists) {
+			return end();
+		}
+		return Iterator(elements + element_idx, elements, elements + num_elements);
+	}
+
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(num_elements ? elements : nullptr, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		if (unlikely(num_elements == 0)) {
+			return ConstIterator(nullptr, nullptr, nullptr);
+		}
+		return ConstIterator(elements + num_elements - 1, elements, elements + num_elements);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t meta_idx = 0;
+		uint32_t element_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+		if (!exists) {
+			return end();
+		}
+		return ConstIterator(elements + element_idx, elements, elements + num_elements);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+		CRASH_COND(!exists);
+		return elements[element_idx].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		uint32_t hash = _hash(p_key);
+		bool exists = _lookup_idx_with_hash(p_key, element_idx, meta_idx, hash);
+
+		if (exists) {
+			return elements[element_idx].value;
+		} else {
+			element_idx = _insert_element(p_key, TValue(), hash);
+			return elements[element_idx].value;
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		uint32_t hash = _hash(p_key);
+		bool exists = _lookup_idx_with_hash(p_key, element_idx, meta_idx, hash);
+
+		if (!exists) {
+			element_idx = _insert_element(p_key, p_value, hash);
+		} else {
+			elements[element_idx].value = p_value;
+		}
+		return Iterator(elements + element_idx, elements, elements + num_elements);
+	}
+
+	// Inserts an element without checking if it already exists.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		uint32_t hash = _hash(p_key);
+		uint32_t element_idx = _insert_element(p_key, p_value, hash);
+		return Iterator(elements + element_idx, elements, elements + num_elements);
+	}
+
+	/* Array methods. */
+
+	// Unsafe. Changing keys and going outside the bounds of an array can lead to undefined behavior.
+	MapKeyValue *get_elements_ptr() {
+		return elements;
+	}
+
+	// Returns the element index. If not found, returns -1.
+	int get_index(const TKey &p_key) {
+		uint32_t element_idx = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, element_idx, meta_idx);
+		if (!exists) {
+			return -1;
+		}
+		return element_idx;
+	}
+
+	MapKeyValue &get_by_index(uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		return elements[p_index];
+	}
+
+	bool erase_by_index(uint32_t p_index) {
+		if (p_index >= size()) {
+			return false;
+		}
+		return erase(elements[p_index].key);
+	}
+
+	/* Constructors */
+
+	AHashMap(const AHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	AHashMap(const HashMap<TKey, TValue, Hasher, Comparator> &p_other) {
+		reserve(p_other.size());
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			uint32_t hash = _hash(E.key);
+			_insert_element(E.key, E.value, hash);
+		}
+	}
+
+	void operator=(const AHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	void operator=(const HashMap<TKey, TValue, Hasher, Comparator> &p_other) {
+		reset();
+		if (p_other.size() > get_capacity()) {
+			reserve(p_other.size());
+		}
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			uint32_t hash = _hash(E.key);
+			_insert_element(E.key, E.value, hash);
+		}
+	}
+
+	AHashMap(uint32_t p_initial_capacity) {
+		// Capacity can't be 0 and must be 2^n - 1.
+		capacity = MAX(4u, p_initial_capacity);
+		capacity = next_power_of_2(capacity) - 1;
+	}
+	AHashMap() :
+			capacity(INITIAL_CAPACITY - 1) {
+	}
+
+	void reset() {
+		if (elements != nullptr) {
+			_clear_data();
+			Memory::free_static(elements);
+			elements = nullptr;
+			Memory::free_static(map_data);
+			map_data = nullptr;
+		}
+		capacity = INITIAL_CAPACITY - 1;
+		num_elements = 0;
+	}
+
+	~AHashMap() {
+		reset();
+	}
+};
+
+#endif // A_HASH_MAP_H
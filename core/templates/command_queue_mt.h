@@ -264,7 +264,7 @@
 #define DECL_PUSH_AND_RET(N)                                                                   \
 	template <class T, class M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) class R>                \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
-		SyncSemaphore *ss = _alloc_sync_sem();                                                 \
+		Semaphore *ss = _get_sync_semaphore();                                                 \
 		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>();                           \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
@@ -274,8 +274,7 @@
 		unlock();                                                                              \
 		if (sync)                                                                              \
 			sync->post();                                                                      \
-		ss->sem.wait();                                                                        \
-		ss->in_use = false;                                                                    \
+		ss->wait();                                                                            \
 	}
 
 #define CMD_SYNC_TYPE(N) CommandSync##N<T, M COMMA(N) COMMA_SEP_LIST(TYPE_ARG, N)>
@@ -283,7 +282,7 @@
 #define DECL_PUSH_AND_SYNC(N)                                                         \
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>                \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		SyncSemaphore *ss = _alloc_sync_sem();                                        \
+		Semaphore *ss = _get_sync_semaphore();                                        \
 		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>();                \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
@@ -292,18 +291,12 @@
 		unlock();                                                                     \
 		if (sync)                                                                     \
 			sync->post();                                                             \
-		ss->sem.wait();                                                               \
-		ss->in_use = false;                                                           \
+		ss->wait();                                                                   \
 	}
 
 #define MAX_CMD_PARAMS 15
 
 class CommandQueueMT {
-	struct SyncSemaphore {
-		Semaphore sem;
-		bool in_use = false;
-	};
-
 	struct CommandBase {
 		virtual void call() = 0;
 		virtual void post() {}
@@ -311,10 +304,10 @@ class CommandQueueMT {
 	};
 
 	struct SyncCommand : public CommandBase {
-		SyncSemaphore *sync_sem = nullptr;
+		Semaphore *sync_sem = nullptr;
 
 		virtual void post() override {
-			sync_sem->sem.post();
+			sync_sem->post();
 		}
 	};
 
@@ -333,22 +326,24 @@ class CommandQueueMT {
 
 	enum {
 		DEFAULT_COMMAND_MEM_SIZE_KB = 256,
-		SYNC_SEMAPHORES = 8
 	};
 
-	LocalVector<uint8_t> command_mem;
-	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
-	Mutex mutex;
+	// Commands are written to one buffer while the other one is being flushed,
+	// so pushing never has to wait for the commands already queued to run.
+	LocalVector<uint8_t> command_mem_buffers[2];
+	LocalVector<uint8_t> *command_mem = &command_mem_buffers[0];
+	bool flushing = false;
+	BinaryMutex mutex;
 	Semaphore *sync = nullptr;
 
 	template <class T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		uint64_t size = command_mem->size();
+		command_mem->resize(size + alloc_size + 8);
+		*(uint64_t *)&(*command_mem)[size] = alloc_size;
+		T *cmd = memnew_placement(&(*command_mem)[size + 8], T);
 		return cmd;
 	}
 
@@ -362,29 +357,45 @@ class CommandQueueMT {
 	void _flush() {
 		lock();
 
-		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
+		if (unlikely(flushing)) {
+			// Re-entrant call from a command; the ongoing flush will run the rest.
+			unlock();
+			return;
+		}
+		flushing = true;
+
+		while (command_mem->size()) {
+			// Swap buffers and run the commands outside of the lock, so new ones can be pushed meanwhile.
+			LocalVector<uint8_t> &flush_mem = *command_mem;
+			command_mem = command_mem == &command_mem_buffers[0] ? &command_mem_buffers[1] : &command_mem_buffers[0];
+			unlock();
+
+			uint64_t read_ptr = 0;
+			uint64_t limit = flush_mem.size();
+
+			while (read_ptr < limit) {
+				uint64_t size = *(uint64_t *)&flush_mem[read_ptr];
+				read_ptr += 8;
+				CommandBase *cmd = reinterpret_cast<CommandBase *>(&flush_mem[read_ptr]);
 
-		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
-			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+				cmd->call(); //execute the function
+				cmd->post(); //release in case it needs sync/ret
+				cmd->~CommandBase(); //should be done, so erase the command
 
-			cmd->call(); //execute the function
-			cmd->post(); //release in case it needs sync/ret
-			cmd->~CommandBase(); //should be done, so erase the command
+				read_ptr += size;
+			}
 
-			read_ptr += size;
+			flush_mem.clear();
+			lock();
 		}
 
-		command_mem.clear();
+		flushing = false;
 		unlock();
 	}
 
 	void lock();
 	void unlock();
-	void wait_for_flush();
-	SyncSemaphore *_alloc_sync_sem();
+	static Semaphore *_get_sync_semaphore();
 
 public:
 	/* NORMAL PUSH COMMANDS */
@@ -400,7 +411,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem->size() > 0)) {
 			_flush();
 		}
 	}
@@ -41,6 +41,7 @@
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
+#include <atomic>
 #include <typeinfo>
 
 class RID_AllocBase {
@@ -77,10 +78,38 @@ class RID_Alloc : public RID_AllocBase {
 	uint32_t max_alloc = 0;
 	uint32_t alloc_count = 0;
 
+	// Thread-safe allocators preallocate the chunk pointer arrays, so they never move
+	// and get_or_null()/owns() can validate RIDs without taking the lock.
+	uint32_t chunk_limit = 0;
+
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
+	// Lock-free readers only look at max_alloc and the validators, which are written
+	// with release semantics once everything they guard is in place.
+	_FORCE_INLINE_ uint32_t _load_max_alloc() const {
+		if (THREAD_SAFE) {
+			return ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_acquire);
+		}
+		return max_alloc;
+	}
+
+	_FORCE_INLINE_ uint32_t _load_validator(uint32_t p_chunk, uint32_t p_element) const {
+		if (THREAD_SAFE) {
+			return ((std::atomic<uint32_t> *)&validator_chunks[p_chunk][p_element])->load(std::memory_order_acquire);
+		}
+		return validator_chunks[p_chunk][p_element];
+	}
+
+	_FORCE_INLINE_ void _store_validator(uint32_t p_chunk, uint32_t p_element, uint32_t p_value) {
+		if (THREAD_SAFE) {
+			((std::atomic<uint32_t> *)&validator_chunks[p_chunk][p_element])->store(p_value, std::memory_order_release);
+		} else {
+			validator_chunks[p_chunk][p_element] = p_value;
+		}
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
 		if (THREAD_SAFE) {
 			spin_lock.lock();
@@ -90,15 +119,20 @@ class RID_Alloc : public RID_AllocBase {
 			//allocate a new chunk
 			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
 
-			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			if (THREAD_SAFE) {
+				if (unlikely(chunk_count == chunk_limit)) {
+					spin_lock.unlock();
+					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", description ? description : typeid(T).name()));
+				}
+			} else {
+				//grow chunk arrays
+				chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
+				validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+			}
 
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
 			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
 			//initialize
@@ -108,7 +142,12 @@ class RID_Alloc : public RID_AllocBase {
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			if (THREAD_SAFE) {
+				// Publish the new chunk to lock-free readers.
+				((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_release);
+			} else {
+				max_alloc += elements_in_chunk;
+			}
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
@@ -122,9 +161,7 @@ class RID_Alloc : public RID_AllocBase {
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_store_validator(free_chunk, free_element, validator | 0x80000000); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -156,6 +193,31 @@ public:
 		if (p_rid == RID()) {
 			return nullptr;
 		}
+
+		if (THREAD_SAFE && likely(!p_initialize)) {
+			// Validated read without locking, see _load_max_alloc().
+			uint64_t id = p_rid.get_id();
+			uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+			if (unlikely(idx >= _load_max_alloc())) {
+				return nullptr;
+			}
+
+			uint32_t idx_chunk = idx / elements_in_chunk;
+			uint32_t idx_element = idx % elements_in_chunk;
+
+			uint32_t validator = uint32_t(id >> 32);
+			uint32_t current_validator = _load_validator(idx_chunk, idx_element);
+
+			if (unlikely(current_validator != validator)) {
+				if ((current_validator & 0x80000000) && current_validator != 0xFFFFFFFF) {
+					ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
+				}
+				return nullptr;
+			}
+
+			return &chunks[idx_chunk][idx_element];
+		}
+
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
@@ -189,7 +251,7 @@ public:
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
+			_store_validator(idx_chunk, idx_element, validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF); //initialized
 
 		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
 			if (THREAD_SAFE) {
@@ -221,16 +283,9 @@ public:
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= _load_max_alloc())) {
 			return false;
 		}
 
@@ -239,13 +294,7 @@ public:
 
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (_load_validator(idx_chunk, idx_element) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -278,8 +327,8 @@ public:
 			ERR_FAIL();
 		}
 
+		_store_validator(idx_chunk, idx_element, 0xFFFFFFFF); // go invalid
 		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -329,8 +378,14 @@ public:
 		description = p_descrption;
 	}
 
-	RID_Alloc(uint32_t p_target_chunk_byte_size = 65536) {
+	RID_Alloc(uint32_t p_target_chunk_byte_size = 65536, uint32_t p_maximum_number_of_elements = 262144) {
 		elements_in_chunk = sizeof(T) > p_target_chunk_byte_size ? 1 : (p_target_chunk_byte_size / sizeof(T));
+		if (THREAD_SAFE) {
+			chunk_limit = (p_maximum_number_of_elements / elements_in_chunk) + 1;
+			chunks = (T **)memalloc(sizeof(T *) * chunk_limit);
+			validator_chunks = (uint32_t **)memalloc(sizeof(uint32_t *) * chunk_limit);
+			free_list_chunks = (uint32_t **)memalloc(sizeof(uint32_t *) * chunk_limit);
+		}
 	}
 
 	~RID_Alloc() {
@@ -419,8 +474,8 @@ public:
 		alloc.set_description(p_descrption);
 	}
 
-	RID_PtrOwner(uint32_t p_target_chunk_byte_size = 65536) :
-			alloc(p_target_chunk_byte_size) {}
+	RID_PtrOwner(uint32_t p_target_chunk_byte_size = 65536, uint32_t p_maximum_number_of_elements = 262144) :
+			alloc(p_target_chunk_byte_size, p_maximum_number_of_elements) {}
 };
 
 template <class T, bool THREAD_SAFE = false>
@@ -473,8 +528,8 @@ public:
 	void set_description(const char *p_descrption) {
 		alloc.set_description(p_descrption);
 	}
-	RID_Owner(uint32_t p_target_chunk_byte_size = 65536) :
-			alloc(p_target_chunk_byte_size) {}
+	RID_Owner(uint32_t p_target_chunk_byte_size = 65536, uint32_t p_maximum_number_of_elements = 262144) :
+			alloc(p_target_chunk_byte_size, p_maximum_number_of_elements) {}
 };
 
 #endif // RID_OWNER_H
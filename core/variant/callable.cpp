@@ -101,13 +101,26 @@ Error Callable::rpcp(int p_id, const Variant **p_arguments, int p_argcount, Call
 	}
 }
 
+static Callable _bind_arguments(const Callable &p_callable, Vector<Variant> &p_binds) {
+	// Binding on top of an already bound callable merges both argument lists,
+	// so calls don't have to go through a chain of nested binds.
+	if (p_callable.is_custom()) {
+		CallableCustomBind *ccb = dynamic_cast<CallableCustomBind *>(p_callable.get_custom());
+		if (ccb) {
+			p_binds.append_array(ccb->get_binds());
+			return Callable(memnew(CallableCustomBind(ccb->get_callable(), p_binds)));
+		}
+	}
+	return Callable(memnew(CallableCustomBind(p_callable, p_binds)));
+}
+
 Callable Callable::bindp(const Variant **p_arguments, int p_argcount) const {
 	Vector<Variant> args;
 	args.resize(p_argcount);
 	for (int i = 0; i < p_argcount; i++) {
 		args.write[i] = *p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return _bind_arguments(*this, args);
 }
 
 Callable Callable::bindv(const Array &p_arguments) {
@@ -120,7 +133,7 @@ Callable Callable::bindv(const Array &p_arguments) {
 	for (int i = 0; i < p_arguments.size(); i++) {
 		args.write[i] = p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return _bind_arguments(*this, args);
 }
 
 Callable Callable::unbind(int p_argcount) const {
@@ -80,28 +80,28 @@ Variant Dictionary::get_value_at_index(int p_index) const {
 }
 
 Variant &Dictionary::operator[](const Variant &p_key) {
+	// StringName and String keys hash and compare alike (see StringLikeVariantComparator),
+	// so existing entries can be found without converting the key first.
+	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(p_key);
+
 	if (unlikely(_p->read_only)) {
-		if (p_key.get_type() == Variant::STRING_NAME) {
-			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			const String &key = sn->operator String();
-			if (likely(_p->variant_map.has(key))) {
-				*_p->read_only = _p->variant_map[key];
-			} else {
-				*_p->read_only = Variant();
-			}
-		} else if (likely(_p->variant_map.has(p_key))) {
-			*_p->read_only = _p->variant_map[p_key];
+		if (likely(E)) {
+			*_p->read_only = E->value;
 		} else {
 			*_p->read_only = Variant();
 		}
 
 		return *_p->read_only;
 	} else {
+		if (likely(E)) {
+			return E->value;
+		}
 		if (p_key.get_type() == Variant::STRING_NAME) {
+			// StringName keys are stored as String.
 			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			return _p->variant_map[sn->operator String()];
+			return _p->variant_map.insert(sn->operator String(), Variant())->value;
 		} else {
-			return _p->variant_map[p_key];
+			return _p->variant_map.insert(p_key, Variant())->value;
 		}
 	}
 }
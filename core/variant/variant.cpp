@@ -1102,7 +1102,7 @@ void Variant::reference(const Variant &p_variant) {
 			memnew_placement(_data._mem, Rect2i(*reinterpret_cast<const Rect2i *>(p_variant._data._mem)));
 		} break;
 		case TRANSFORM2D: {
-			_data._transform2d = (Transform2D *)Pools::_bucket_small.alloc();
+			_data._transform2d = (Transform2D *)Pools::BucketSmallCache::alloc();
 			memnew_placement(_data._transform2d, Transform2D(*p_variant._data._transform2d));
 		} break;
 		case VECTOR3: {
@@ -1121,22 +1121,22 @@ void Variant::reference(const Variant &p_variant) {
 			memnew_placement(_data._mem, Plane(*reinterpret_cast<const Plane *>(p_variant._data._mem)));
 		} break;
 		case AABB: {
-			_data._aabb = (::AABB *)Pools::_bucket_small.alloc();
+			_data._aabb = (::AABB *)Pools::BucketSmallCache::alloc();
 			memnew_placement(_data._aabb, ::AABB(*p_variant._data._aabb));
 		} break;
 		case QUATERNION: {
 			memnew_placement(_data._mem, Quaternion(*reinterpret_cast<const Quaternion *>(p_variant._data._mem)));
 		} break;
 		case BASIS: {
-			_data._basis = (Basis *)Pools::_bucket_medium.alloc();
+			_data._basis = (Basis *)Pools::BucketMediumCache::alloc();
 			memnew_placement(_data._basis, Basis(*p_variant._data._basis));
 		} break;
 		case TRANSFORM3D: {
-			_data._transform3d = (Transform3D *)Pools::_bucket_medium.alloc();
+			_data._transform3d = (Transform3D *)Pools::BucketMediumCache::alloc();
 			memnew_placement(_data._transform3d, Transform3D(*p_variant._data._transform3d));
 		} break;
 		case PROJECTION: {
-			_data._projection = (Projection *)Pools::_bucket_large.alloc();
+			_data._projection = (Projection *)Pools::BucketLargeCache::alloc();
 			memnew_placement(_data._projection, Projection(*p_variant._data._projection));
 		} break;
 
@@ -1306,35 +1306,35 @@ void Variant::_clear_internal() {
 		case TRANSFORM2D: {
 			if (_data._transform2d) {
 				_data._transform2d->~Transform2D();
-				Pools::_bucket_small.free((Pools::BucketSmall *)_data._transform2d);
+				Pools::BucketSmallCache::free((Pools::BucketSmall *)_data._transform2d);
 				_data._transform2d = nullptr;
 			}
 		} break;
 		case AABB: {
 			if (_data._aabb) {
 				_data._aabb->~AABB();
-				Pools::_bucket_small.free((Pools::BucketSmall *)_data._aabb);
+				Pools::BucketSmallCache::free((Pools::BucketSmall *)_data._aabb);
 				_data._aabb = nullptr;
 			}
 		} break;
 		case BASIS: {
 			if (_data._basis) {
 				_data._basis->~Basis();
-				Pools::_bucket_medium.free((Pools::BucketMedium *)_data._basis);
+				Pools::BucketMediumCache::free((Pools::BucketMedium *)_data._basis);
 				_data._basis = nullptr;
 			}
 		} break;
 		case TRANSFORM3D: {
 			if (_data._transform3d) {
 				_data._transform3d->~Transform3D();
-				Pools::_bucket_medium.free((Pools::BucketMedium *)_data._transform3d);
+				Pools::BucketMediumCache::free((Pools::BucketMedium *)_data._transform3d);
 				_data._transform3d = nullptr;
 			}
 		} break;
 		case PROJECTION: {
 			if (_data._projection) {
 				_data._projection->~Projection();
-				Pools::_bucket_large.free((Pools::BucketLarge *)_data._projection);
+				Pools::BucketLargeCache::free((Pools::BucketLarge *)_data._projection);
 				_data._projection = nullptr;
 			}
 		} break;
@@ -2549,13 +2549,13 @@ Variant::Variant(const Plane &p_plane) {
 
 Variant::Variant(const ::AABB &p_aabb) {
 	type = AABB;
-	_data._aabb = (::AABB *)Pools::_bucket_small.alloc();
+	_data._aabb = (::AABB *)Pools::BucketSmallCache::alloc();
 	memnew_placement(_data._aabb, ::AABB(p_aabb));
 }
 
 Variant::Variant(const Basis &p_matrix) {
 	type = BASIS;
-	_data._basis = (Basis *)Pools::_bucket_medium.alloc();
+	_data._basis = (Basis *)Pools::BucketMediumCache::alloc();
 	memnew_placement(_data._basis, Basis(p_matrix));
 }
 
@@ -2566,19 +2566,19 @@ Variant::Variant(const Quaternion &p_quaternion) {
 
 Variant::Variant(const Transform3D &p_transform) {
 	type = TRANSFORM3D;
-	_data._transform3d = (Transform3D *)Pools::_bucket_medium.alloc();
+	_data._transform3d = (Transform3D *)Pools::BucketMediumCache::alloc();
 	memnew_placement(_data._transform3d, Transform3D(p_transform));
 }
 
 Variant::Variant(const Projection &pp_projection) {
 	type = PROJECTION;
-	_data._projection = (Projection *)Pools::_bucket_large.alloc();
+	_data._projection = (Projection *)Pools::BucketLargeCache::alloc();
 	memnew_placement(_data._projection, Projection(pp_projection));
 }
 
 Variant::Variant(const Transform2D &p_transform) {
 	type = TRANSFORM2D;
-	_data._transform2d = (Transform2D *)Pools::_bucket_small.alloc();
+	_data._transform2d = (Transform2D *)Pools::BucketSmallCache::alloc();
 	memnew_placement(_data._transform2d, Transform2D(p_transform));
 }
 
@@ -3536,7 +3536,7 @@ bool StringLikeVariantComparator::compare(const Variant &p_lhs, const Variant &p
 		return true;
 	}
 	if (p_lhs.get_type() == Variant::STRING && p_rhs.get_type() == Variant::STRING_NAME) {
-		return *VariantInternal::get_string(&p_lhs) == *VariantInternal::get_string_name(&p_rhs);
+		return *VariantInternal::get_string_name(&p_rhs) == *VariantInternal::get_string(&p_lhs);
 	}
 	if (p_lhs.get_type() == Variant::STRING_NAME && p_rhs.get_type() == Variant::STRING) {
 		return *VariantInternal::get_string_name(&p_lhs) == *VariantInternal::get_string(&p_rhs);
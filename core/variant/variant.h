@@ -157,6 +157,60 @@ private:
 		static PagedAllocator<BucketSmall, true> _bucket_small;
 		static PagedAllocator<BucketMedium, true> _bucket_medium;
 		static PagedAllocator<BucketLarge, true> _bucket_large;
+
+		// Keeps a few freed buckets per thread in front of a shared pool, so that most
+		// allocations and frees don't need to take the pool's lock.
+		template <class T, PagedAllocator<T, true> &p_pool>
+		class ThreadCache {
+			enum {
+				MAX_CACHED = 32,
+			};
+
+			T *cached[MAX_CACHED];
+			uint32_t count = 0;
+			bool *destroyed = nullptr;
+
+			static _FORCE_INLINE_ ThreadCache *get() {
+				static thread_local bool cache_destroyed = false;
+				if (unlikely(cache_destroyed)) {
+					return nullptr; // Variants freed while the thread exits, use the pool directly.
+				}
+				static thread_local ThreadCache cache(&cache_destroyed);
+				return &cache;
+			}
+
+			ThreadCache(bool *p_destroyed) :
+					destroyed(p_destroyed) {}
+
+		public:
+			static _FORCE_INLINE_ T *alloc() {
+				ThreadCache *cache = get();
+				if (likely(cache && cache->count > 0)) {
+					return cache->cached[--cache->count];
+				}
+				return p_pool.alloc();
+			}
+
+			static _FORCE_INLINE_ void free(T *p_mem) {
+				ThreadCache *cache = get();
+				if (likely(cache && cache->count < MAX_CACHED)) {
+					cache->cached[cache->count++] = p_mem;
+					return;
+				}
+				p_pool.free(p_mem);
+			}
+
+			~ThreadCache() {
+				for (uint32_t i = 0; i < count; i++) {
+					p_pool.free(cached[i]);
+				}
+				*destroyed = true;
+			}
+		};
+
+		typedef ThreadCache<BucketSmall, _bucket_small> BucketSmallCache;
+		typedef ThreadCache<BucketMedium, _bucket_medium> BucketMediumCache;
+		typedef ThreadCache<BucketLarge, _bucket_large> BucketLargeCache;
 	};
 
 	friend struct _VariantCall;
@@ -1019,6 +1019,98 @@ struct _VariantCall {
 		return len;
 	}
 
+	// Reductions over packed float arrays. Several independent accumulators are used
+	// so the loops don't serialize on a single addition, and can be vectorized.
+	template <class T>
+	static double _packed_float_sum(const Vector<T> &p_array) {
+		const T *r = p_array.ptr();
+		const int64_t size = p_array.size();
+		T acc[4] = { 0, 0, 0, 0 };
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			acc[0] += r[i + 0];
+			acc[1] += r[i + 1];
+			acc[2] += r[i + 2];
+			acc[3] += r[i + 3];
+		}
+		for (; i < size; i++) {
+			acc[0] += r[i];
+		}
+		return double((acc[0] + acc[1]) + (acc[2] + acc[3]));
+	}
+
+	template <class T>
+	static double _packed_float_dot(const Vector<T> &p_array, const Vector<T> &p_with) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_with.size(), 0.0, "Both arrays must have the same size.");
+		const T *a = p_array.ptr();
+		const T *b = p_with.ptr();
+		const int64_t size = p_array.size();
+		T acc[4] = { 0, 0, 0, 0 };
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			acc[0] += a[i + 0] * b[i + 0];
+			acc[1] += a[i + 1] * b[i + 1];
+			acc[2] += a[i + 2] * b[i + 2];
+			acc[3] += a[i + 3] * b[i + 3];
+		}
+		for (; i < size; i++) {
+			acc[0] += a[i] * b[i];
+		}
+		return double((acc[0] + acc[1]) + (acc[2] + acc[3]));
+	}
+
+	template <class T>
+	static double _packed_float_min(const Vector<T> &p_array) {
+		if (p_array.is_empty()) {
+			return 0.0;
+		}
+		const T *r = p_array.ptr();
+		T minval = r[0];
+		for (int64_t i = 1; i < p_array.size(); i++) {
+			minval = MIN(minval, r[i]);
+		}
+		return double(minval);
+	}
+
+	template <class T>
+	static double _packed_float_max(const Vector<T> &p_array) {
+		if (p_array.is_empty()) {
+			return 0.0;
+		}
+		const T *r = p_array.ptr();
+		T maxval = r[0];
+		for (int64_t i = 1; i < p_array.size(); i++) {
+			maxval = MAX(maxval, r[i]);
+		}
+		return double(maxval);
+	}
+
+	static double func_PackedFloat32Array_sum(PackedFloat32Array *p_instance) {
+		return _packed_float_sum(*p_instance);
+	}
+	static double func_PackedFloat32Array_dot(PackedFloat32Array *p_instance, const PackedFloat32Array &p_with) {
+		return _packed_float_dot(*p_instance, p_with);
+	}
+	static double func_PackedFloat32Array_min(PackedFloat32Array *p_instance) {
+		return _packed_float_min(*p_instance);
+	}
+	static double func_PackedFloat32Array_max(PackedFloat32Array *p_instance) {
+		return _packed_float_max(*p_instance);
+	}
+
+	static double func_PackedFloat64Array_sum(PackedFloat64Array *p_instance) {
+		return _packed_float_sum(*p_instance);
+	}
+	static double func_PackedFloat64Array_dot(PackedFloat64Array *p_instance, const PackedFloat64Array &p_with) {
+		return _packed_float_dot(*p_instance, p_with);
+	}
+	static double func_PackedFloat64Array_min(PackedFloat64Array *p_instance) {
+		return _packed_float_min(*p_instance);
+	}
+	static double func_PackedFloat64Array_max(PackedFloat64Array *p_instance) {
+		return _packed_float_max(*p_instance);
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2384,6 +2476,11 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloat32Array_dot, sarray("with"), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -2408,6 +2505,11 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloat64Array_sum, sarray(), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_PackedFloat64Array_dot, sarray("with"), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloat64Array_min, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloat64Array_max, sarray(), varray());
+
 	/* String Array */
 
 	bind_method(PackedStringArray, size, sarray(), varray());
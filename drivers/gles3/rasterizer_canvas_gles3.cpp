@@ -190,6 +190,11 @@ void RasterizerCanvasGLES3::canvas_render_items(RID p_to_render_target, Item *p_
 
 			state.light_uniforms[index].flags = l->blend_mode << LIGHT_FLAGS_BLEND_SHIFT;
 			state.light_uniforms[index].flags |= l->shadow_filter << LIGHT_FLAGS_FILTER_SHIFT;
+			if (l->shadow_filter == RS::CANVAS_LIGHT_FILTER_SDF) {
+				// Shadows are ray-marched from the canvas SDF, so pass the smoothing and march range instead of shadow map data.
+				state.light_uniforms[index].shadow_pixel_size = l->shadow_smooth;
+				state.light_uniforms[index].shadow_z_far_inv = 1.0 / MAX(l->directional_distance, 1.0);
+			}
 
 			if (clight->shadow.enabled) {
 				state.light_uniforms[index].flags |= LIGHT_FLAGS_HAS_SHADOW;
@@ -253,6 +258,11 @@ void RasterizerCanvasGLES3::canvas_render_items(RID p_to_render_target, Item *p_
 
 			state.light_uniforms[index].flags = l->blend_mode << LIGHT_FLAGS_BLEND_SHIFT;
 			state.light_uniforms[index].flags |= l->shadow_filter << LIGHT_FLAGS_FILTER_SHIFT;
+			if (l->shadow_filter == RS::CANVAS_LIGHT_FILTER_SDF) {
+				// Shadows are ray-marched from the canvas SDF, so pass the smoothing and march range instead of shadow map data.
+				state.light_uniforms[index].shadow_pixel_size = l->shadow_smooth;
+				state.light_uniforms[index].shadow_z_far_inv = 1.0 / MAX(l->directional_distance, 1.0);
+			}
 
 			if (clight->shadow.enabled) {
 				state.light_uniforms[index].flags |= LIGHT_FLAGS_HAS_SHADOW;
@@ -2785,6 +2795,8 @@ void fragment() {
 }
 
 RasterizerCanvasGLES3::~RasterizerCanvasGLES3() {
+	free_unused_shared_polygons();
+
 	singleton = nullptr;
 
 	GLES3::MaterialStorage *material_storage = GLES3::MaterialStorage::get_singleton();
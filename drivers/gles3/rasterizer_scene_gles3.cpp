@@ -2511,6 +2511,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 	GLES3::SceneMaterialData *prev_material_data = nullptr;
 	GLES3::SceneShaderData *prev_shader = nullptr;
 	GeometryInstanceGLES3 *prev_inst = nullptr;
+	void *prev_compressed_surface = nullptr; // Surface whose decompression uniforms are set on the bound shader.
 	SceneShaderGLES3::ShaderVariant prev_variant = SceneShaderGLES3::ShaderVariant::MODE_COLOR;
 	SceneShaderGLES3::ShaderVariant shader_variant = SceneShaderGLES3::MODE_COLOR; // Assigned to silence wrong -Wmaybe-initialized
 	uint64_t prev_spec_constants = 0;
@@ -2863,6 +2864,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				prev_shader = shader;
 				prev_variant = instance_variant;
 				prev_spec_constants = spec_constants;
+				prev_compressed_surface = nullptr;
 			}
 
 			// Pass in lighting uniforms.
@@ -2918,7 +2920,9 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			}
 
 			material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::WORLD_TRANSFORM, world_transform, shader->version, instance_variant, spec_constants);
-			{
+			// The render list is sorted by geometry, so consecutive instances of the same surface can skip these.
+			if (prev_compressed_surface != surf->surface) {
+				prev_compressed_surface = surf->surface;
 				GLES3::Mesh::Surface *s = reinterpret_cast<GLES3::Mesh::Surface *>(surf->surface);
 				if (s->format & RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES) {
 					material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::COMPRESSED_AABB_POSITION, s->aabb.position, shader->version, instance_variant, spec_constants);
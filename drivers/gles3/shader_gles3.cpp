@@ -590,6 +590,13 @@ bool ShaderGLES3::_load_from_cache(Version *p_version) {
 			glGetProgramiv(specialization.id, GL_LINK_STATUS, &link_status);
 			if (link_status != GL_TRUE) {
 				WARN_PRINT_ONCE("Failed to load cached shader, recompiling.");
+				glDeleteProgram(specialization.id);
+				variants.push_back(variant);
+				for (OAHashMap<uint64_t, Version::Specialization> &loaded : variants) {
+					for (OAHashMap<uint64_t, Version::Specialization>::Iterator it = loaded.iter(); it.valid; it = loaded.next_iter(it)) {
+						glDeleteProgram(it.value->id);
+					}
+				}
 				return false;
 			}
 
@@ -756,6 +763,11 @@ void ShaderGLES3::initialize(const String &p_general_defines, int p_base_texture
 
 		hash_build.append("[base_hash]");
 		hash_build.append(base_sha256);
+		// Program binaries are only valid for the driver that produced them.
+		hash_build.append("[driver]");
+		hash_build.append(String::utf8((const char *)glGetString(GL_VENDOR)));
+		hash_build.append(String::utf8((const char *)glGetString(GL_RENDERER)));
+		hash_build.append(String::utf8((const char *)glGetString(GL_VERSION)));
 		hash_build.append("[general_defines]");
 		hash_build.append(general_defines.get_data());
 		for (int i = 0; i < variant_count; i++) {
@@ -449,6 +449,58 @@ vec4 light_shadow_compute(uint light_base, vec4 light_color, vec4 shadow_uv
 	return mix(light_color, shadow_color, shadow);
 }
 
+#define SDF_SHADOW_MAX_STEPS 32
+
+// Ray-marches the canvas SDF from the pixel towards the light, both given in canvas coordinates.
+vec4 light_shadow_sdf_compute(uint light_base, vec4 light_color, vec2 p_vertex, vec2 p_light_pos
+#ifdef LIGHT_CODE_USED
+		,
+		vec3 shadow_modulate
+#endif
+) {
+	vec2 canvas_to_sdf = screen_pixel_size * screen_to_sdf;
+	vec2 from = p_vertex * canvas_to_sdf;
+	vec2 ray = p_light_pos * canvas_to_sdf - from;
+	float max_dist = length(ray);
+	float shadow = 0.0;
+
+	if (max_dist > 0.001) {
+		vec2 dir = ray / max_dist;
+		// Zero smoothing gives hard shadows, higher values widen the penumbra.
+		float smoothing = light_array[light_base].shadow_pixel_size;
+		float lit = 1.0;
+		float t = 0.0;
+		bool inside = true; // The occluder under the pixel doesn't shadow it.
+		for (int i = 0; i < SDF_SHADOW_MAX_STEPS; i++) {
+			float d = texture_sdf(from + dir * t);
+			inside = inside && d < 0.5;
+			if (!inside) {
+				if (d < 0.5) {
+					lit = 0.0;
+					break;
+				}
+				if (smoothing > 0.0) {
+					lit = min(lit, (d * 64.0) / (smoothing * max(t, 1.0)));
+				}
+			}
+			t += max(abs(d), 1.0);
+			if (t >= max_dist) {
+				break;
+			}
+		}
+		shadow = 1.0 - clamp(lit, 0.0, 1.0);
+	}
+
+	vec4 shadow_color = godot_unpackUnorm4x8(light_array[light_base].shadow_color);
+#ifdef LIGHT_CODE_USED
+	shadow_color.rgb *= shadow_modulate;
+#endif
+
+	shadow_color.a *= light_color.a; //respect light alpha
+
+	return mix(light_color, shadow_color, shadow);
+}
+
 void light_blend_compute(uint light_base, vec4 light_color, inout vec3 color) {
 	uint blend_mode = light_array[light_base].flags & LIGHT_FLAGS_BLEND_MASK;
 
@@ -681,7 +733,14 @@ void main() {
 		}
 #endif
 
-		if (bool(light_array[light_base].flags & LIGHT_FLAGS_HAS_SHADOW)) {
+		if ((light_array[light_base].flags & (LIGHT_FLAGS_HAS_SHADOW | LIGHT_FLAGS_FILTER_MASK)) == (LIGHT_FLAGS_HAS_SHADOW | LIGHT_FLAGS_SHADOW_SDF)) {
+			light_color = light_shadow_sdf_compute(light_base, light_color, shadow_vertex, shadow_vertex + direction / light_array[light_base].shadow_zfar_inv
+#ifdef LIGHT_CODE_USED
+					,
+					shadow_modulate.rgb
+#endif
+			);
+		} else if (bool(light_array[light_base].flags & LIGHT_FLAGS_HAS_SHADOW)) {
 			vec2 shadow_pos = (vec4(shadow_vertex, 0.0, 1.0) * mat4(light_array[light_base].shadow_matrix[0], light_array[light_base].shadow_matrix[1], vec4(0.0, 0.0, 1.0, 0.0), vec4(0.0, 0.0, 0.0, 1.0))).xy; //multiply inverse given its transposed. Optimizer removes useless operations.
 
 			vec4 shadow_uv = vec4(shadow_pos.x, light_array[light_base].shadow_y_ofs, shadow_pos.y * light_array[light_base].shadow_zfar_inv, 1.0);
@@ -754,7 +813,14 @@ void main() {
 			light_color.a = 0.0;
 		}
 
-		if (bool(light_array[light_base].flags & LIGHT_FLAGS_HAS_SHADOW)) {
+		if ((light_array[light_base].flags & (LIGHT_FLAGS_HAS_SHADOW | LIGHT_FLAGS_FILTER_MASK)) == (LIGHT_FLAGS_HAS_SHADOW | LIGHT_FLAGS_SHADOW_SDF)) {
+			light_color = light_shadow_sdf_compute(light_base, light_color, shadow_vertex, light_array[light_base].position
+#ifdef LIGHT_CODE_USED
+					,
+					shadow_modulate.rgb
+#endif
+			);
+		} else if (bool(light_array[light_base].flags & LIGHT_FLAGS_HAS_SHADOW)) {
 			vec2 shadow_pos = (vec4(shadow_vertex, 0.0, 1.0) * mat4(light_array[light_base].shadow_matrix[0], light_array[light_base].shadow_matrix[1], vec4(0.0, 0.0, 1.0, 0.0), vec4(0.0, 0.0, 0.0, 1.0))).xy; //multiply inverse given its transposed. Optimizer removes useless operations.
 
 			vec2 pos_norm = normalize(shadow_pos);
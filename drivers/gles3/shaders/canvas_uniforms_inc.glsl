@@ -65,6 +65,7 @@ layout(std140) uniform CanvasData { //ubo:0
 #define LIGHT_FLAGS_SHADOW_NEAREST uint(0 << 22)
 #define LIGHT_FLAGS_SHADOW_PCF5 uint(1 << 22)
 #define LIGHT_FLAGS_SHADOW_PCF13 uint(2 << 22)
+#define LIGHT_FLAGS_SHADOW_SDF uint(3 << 22)
 
 struct Light {
 	mat2x4 texture_matrix; //light to texture coordinate matrix (transposed)
@@ -1853,6 +1853,27 @@ void MeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_b
 	}
 }
 
+void MeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+
+	// Colors and custom data are packed as half floats here, so the range is patched into the buffer
+	// in its public layout, which is then uploaded as a whole.
+	int stride = multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	stride += multimesh->uses_colors ? 4 : 0;
+	stride += multimesh->uses_custom_data ? 4 : 0;
+	ERR_FAIL_COND(p_buffer.size() % stride != 0);
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + p_buffer.size() / stride > multimesh->instances);
+
+	Vector<float> buffer = multimesh_get_buffer(p_multimesh);
+	if (buffer.is_empty()) {
+		buffer.resize_zeroed(multimesh->instances * stride);
+	}
+
+	memcpy(buffer.ptrw() + p_first_instance * stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+	multimesh_set_buffer(p_multimesh, buffer);
+}
+
 Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
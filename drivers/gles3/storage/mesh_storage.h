@@ -351,9 +351,9 @@ public:
 		int32_t current_lod = -1;
 		r_index_count = s->index_count;
 
+		const float edge_length_threshold = p_mesh_lod_threshold * p_distance_threshold;
 		for (uint32_t i = 0; i < s->lod_count; i++) {
-			float screen_size = s->lods[i].edge_length * p_model_scale / p_distance_threshold;
-			if (screen_size > p_mesh_lod_threshold) {
+			if (s->lods[i].edge_length * p_model_scale > edge_length_threshold) {
 				break;
 			}
 			current_lod = i;
@@ -485,6 +485,7 @@ public:
 	virtual Color multimesh_instance_get_color(RID p_multimesh, int p_index) const override;
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const override;
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) override;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) override;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const override;
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
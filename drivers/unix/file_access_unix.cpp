@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -137,11 +138,21 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+void FileAccessUnix::_unmap() const {
+	if (mapping) {
+		munmap(mapping, mapping_size);
+		mapping = nullptr;
+		mapping_offset = 0;
+		mapping_size = 0;
+	}
+}
+
 void FileAccessUnix::_close() {
 	if (!f) {
 		return;
 	}
 
+	_unmap();
 	fclose(f);
 	f = nullptr;
 
@@ -237,6 +248,41 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::map_region(uint64_t p_offset, uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	// Files being written may change under the mapping.
+	if (flags != READ || p_length == 0) {
+		return nullptr;
+	}
+
+	if (mapping && p_offset >= mapping_offset && p_offset + p_length <= mapping_offset + mapping_size) {
+		return (const uint8_t *)mapping + (p_offset - mapping_offset);
+	}
+
+	// Pages past the end of the file can't be accessed.
+	if (p_offset + p_length > get_length()) {
+		return nullptr;
+	}
+
+	_unmap();
+
+	// Mappings have to start on a page boundary.
+	const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	const uint64_t offset = p_offset - p_offset % page_size;
+	const uint64_t size = p_length + (p_offset - offset);
+
+	void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(f), offset);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapping = data;
+	mapping_offset = offset;
+	mapping_size = size;
+	return (const uint8_t *)mapping + (p_offset - mapping_offset);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -49,6 +49,11 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	mutable void *mapping = nullptr;
+	mutable uint64_t mapping_offset = 0;
+	mutable uint64_t mapping_size = 0;
+
+	void _unmap() const;
 	void _close();
 
 public:
@@ -70,6 +75,8 @@ public:
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
 
+	virtual const uint8_t *map_region(uint64_t p_offset, uint64_t p_length) const override;
+
 	virtual Error get_error() const override; ///< get last error
 
 	virtual void flush() override;
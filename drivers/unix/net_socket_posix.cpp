@@ -652,6 +652,87 @@ Error NetSocketPosix::sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IP
 	return OK;
 }
 
+#ifdef NET_SOCKET_MMSG_ENABLED
+Error NetSocketPosix::recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	r_received = 0;
+
+	struct mmsghdr msgs[MMSG_MAX_BATCH];
+	struct iovec iovs[MMSG_MAX_BATCH];
+	struct sockaddr_storage addrs[MMSG_MAX_BATCH];
+	const int count = MIN(p_count, (int)MMSG_MAX_BATCH);
+	memset(msgs, 0, sizeof(struct mmsghdr) * count);
+	for (int i = 0; i < count; i++) {
+		iovs[i].iov_base = p_datagrams[i].buffer;
+		iovs[i].iov_len = p_datagrams[i].len;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+	}
+
+	// Only wait for the first datagram (i.e. when blocking), like recvfrom does.
+	int ret = ::recvmmsg(_sock, msgs, count, MSG_WAITFORONE, nullptr);
+	if (ret < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK) {
+			return ERR_BUSY;
+		}
+		return FAILED;
+	}
+
+	for (int i = 0; i < ret; i++) {
+		Datagram &d = p_datagrams[i];
+		d.len = msgs[i].msg_len;
+		_set_ip_port(&addrs[i], &d.ip, &d.port);
+	}
+	r_received = ret;
+	return ret ? OK : ERR_BUSY;
+}
+
+Error NetSocketPosix::sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	r_sent = 0;
+
+	struct mmsghdr msgs[MMSG_MAX_BATCH];
+	struct iovec iovs[MMSG_MAX_BATCH];
+	struct sockaddr_storage addrs[MMSG_MAX_BATCH];
+	while (r_sent < p_count) {
+		const int count = MIN(p_count - r_sent, (int)MMSG_MAX_BATCH);
+		memset(msgs, 0, sizeof(struct mmsghdr) * count);
+		for (int i = 0; i < count; i++) {
+			const Datagram &d = p_datagrams[r_sent + i];
+			iovs[i].iov_base = d.buffer;
+			iovs[i].iov_len = d.len;
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			msgs[i].msg_hdr.msg_name = &addrs[i];
+			msgs[i].msg_hdr.msg_namelen = _set_addr_storage(&addrs[i], d.ip, d.port, _ip_type);
+		}
+
+		int ret = ::sendmmsg(_sock, msgs, count, 0);
+		if (ret < 0) {
+			NetError err = _get_socket_error();
+			if (r_sent > 0) {
+				break; // Report the datagrams already sent.
+			}
+			if (err == ERR_NET_WOULD_BLOCK) {
+				return ERR_BUSY;
+			}
+			if (err == ERR_NET_BUFFER_TOO_SMALL) {
+				return ERR_OUT_OF_MEMORY;
+			}
+			return FAILED;
+		}
+		r_sent += ret;
+		if (ret < count) {
+			break; // Socket buffer is full.
+		}
+	}
+	return OK;
+}
+#endif // NET_SOCKET_MMSG_ENABLED
+
 Error NetSocketPosix::set_broadcasting_enabled(bool p_enabled) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 	// IPv6 has no broadcast support.
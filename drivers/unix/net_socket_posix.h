@@ -42,6 +42,11 @@
 #include <sys/socket.h>
 #define SOCKET_TYPE int
 
+#if defined(__linux__)
+// Batched datagram I/O via recvmmsg/sendmmsg.
+#define NET_SOCKET_MMSG_ENABLED
+#endif
+
 #endif
 
 class NetSocketPosix : public NetSocket {
@@ -60,6 +65,12 @@ private:
 		ERR_NET_OTHER,
 	};
 
+#ifdef NET_SOCKET_MMSG_ENABLED
+	enum {
+		MMSG_MAX_BATCH = 32, // Datagrams per recvmmsg/sendmmsg call.
+	};
+#endif
+
 	NetError _get_socket_error() const;
 	void _set_socket(SOCKET_TYPE p_sock, IP::Type p_ip_type, bool p_is_stream);
 	_FORCE_INLINE_ Error _change_multicast_group(IPAddress p_ip, String p_if_name, bool p_add);
@@ -87,6 +98,10 @@ public:
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent);
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port);
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port);
+#ifdef NET_SOCKET_MMSG_ENABLED
+	virtual Error recvfrom_batch(Datagram *p_datagrams, int p_count, int &r_received);
+	virtual Error sendto_batch(const Datagram *p_datagrams, int p_count, int &r_sent);
+#endif
 
 	virtual bool is_open() const;
 	virtual int get_available_bytes() const;
@@ -1408,7 +1408,7 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	bufferInfo.pQueueFamilyIndices = nullptr;
 
 	VmaAllocationCreateInfo allocInfo;
-	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 	allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
 	allocInfo.requiredFlags = 0;
 	allocInfo.preferredFlags = 0;
@@ -1417,10 +1417,18 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	allocInfo.pUserData = nullptr;
 
 	StagingBufferBlock block;
+	VmaAllocationInfo alloc_info;
 
-	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, nullptr);
+	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, &alloc_info);
 	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vmaCreateBuffer failed with error " + itos(err) + ".");
 
+	// Staging blocks stay mapped for their whole lifetime, so uploads don't pay for a map/unmap each time.
+	block.data_ptr = (uint8_t *)alloc_info.pMappedData;
+	if (!block.data_ptr) {
+		vmaDestroyBuffer(allocator, block.buffer, block.allocation);
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "Staging buffer block could not be mapped.");
+	}
+
 	block.frame_used = 0;
 	block.fill_amount = 0;
 
@@ -1575,19 +1583,11 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 			return err;
 		}
 
-		// Map staging buffer (It's CPU and coherent).
-
-		void *data_ptr = nullptr;
-		{
-			VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-			ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-		}
-
-		// Copy to staging buffer.
-		memcpy(((uint8_t *)data_ptr) + block_write_offset, p_data + submit_from, block_write_amount);
+		// Copy to staging buffer (it's persistently mapped).
+		const StagingBufferBlock &block = staging_buffer_blocks[staging_buffer_current];
+		memcpy(block.data_ptr + block_write_offset, p_data + submit_from, block_write_amount);
+		vmaFlushAllocation(allocator, block.allocation, block_write_offset, block_write_amount); // No-op on coherent memory.
 
-		// Unmap.
-		vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
 		// Insert a command to copy this.
 
 		VkBufferCopy region;
@@ -2563,15 +2563,7 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 					Error err = _staging_buffer_allocate(to_allocate, required_align, alloc_offset, alloc_size, false);
 					ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
-					uint8_t *write_ptr;
-
-					{ // Map.
-						void *data_ptr = nullptr;
-						VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-						ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-						write_ptr = (uint8_t *)data_ptr;
-						write_ptr += alloc_offset;
-					}
+					uint8_t *write_ptr = staging_buffer_blocks[staging_buffer_current].data_ptr + alloc_offset;
 
 					uint32_t block_w, block_h;
 					get_compressed_image_format_block_dimensions(texture->format, block_w, block_h);
@@ -2598,9 +2590,7 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 						_copy_region(read_ptr, write_ptr, x, y, region_w, region_h, width, pixel_size);
 					}
 
-					{ // Unmap.
-						vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
-					}
+					vmaFlushAllocation(allocator, staging_buffer_blocks[staging_buffer_current].allocation, alloc_offset, to_allocate);
 
 					VkBufferImageCopy buffer_image_copy;
 					buffer_image_copy.bufferOffset = alloc_offset;
@@ -7554,6 +7544,95 @@ void RenderingDeviceVulkan::draw_list_draw(DrawListID p_list, bool p_use_indices
 	}
 }
 
+void RenderingDeviceVulkan::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_NULL(dl);
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_NULL(buffer);
+
+	ERR_FAIL_COND_MSG(!(buffer->usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), "Buffer provided was not created to do indirect dispatch.");
+
+	if (p_draw_count == 0) {
+		return;
+	}
+
+	const uint32_t command_size = p_use_indices ? sizeof(VkDrawIndexedIndirectCommand) : sizeof(VkDrawIndirectCommand);
+	const uint32_t stride = p_stride ? p_stride : command_size;
+	ERR_FAIL_COND_MSG(stride < command_size || (stride % 4) != 0, "Stride must be a multiple of 4 and at least the size of a draw command (" + itos(command_size) + ").");
+	ERR_FAIL_COND_MSG(p_offset % 4 != 0, "Offset must be a multiple of 4.");
+	ERR_FAIL_COND_MSG(uint64_t(p_offset) + uint64_t(stride) * (p_draw_count - 1) + command_size > buffer->size, "Offset and draw count provided are past the end of buffer.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		// Pipeline uses vertices, validate format.
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		// Make sure format is right.
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		// Using push constants, check that they were supplied.
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_size,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	}
+#endif
+
+	// Bind descriptor sets.
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+#ifdef DEBUG_ENABLED
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+#endif
+		if (!dl->state.sets[i].bound) {
+			// All good, see if this requires re-binding.
+			vkCmdBindDescriptorSets(dl->command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, dl->state.pipeline_layout, i, 1, &dl->state.sets[i].descriptor_set, 0, nullptr);
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	// Without multi-draw support, each draw has to be recorded separately.
+	const bool multi_draw = p_draw_count > 1 && context->get_physical_device_features().multiDrawIndirect && p_draw_count <= context->get_device_limits().maxDrawIndirectCount;
+	const uint32_t draws_per_command = multi_draw ? p_draw_count : 1;
+	const uint32_t command_count = multi_draw ? 1 : p_draw_count;
+
+	for (uint32_t i = 0; i < command_count; i++) {
+		VkDeviceSize offset = VkDeviceSize(p_offset) + VkDeviceSize(stride) * i;
+		if (p_use_indices) {
+			vkCmdDrawIndexedIndirect(dl->command_buffer, buffer->buffer, offset, draws_per_command, stride);
+		} else {
+			vkCmdDrawIndirect(dl->command_buffer, buffer->buffer, offset, draws_per_command, stride);
+		}
+	}
+}
+
 void RenderingDeviceVulkan::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -8760,6 +8839,12 @@ void RenderingDeviceVulkan::swap_buffers() {
 	_begin_frame();
 }
 
+uint64_t RenderingDeviceVulkan::wait_for_present(uint64_t p_timeout_usec) {
+	ERR_FAIL_COND_V_MSG(local_device.is_valid(), 0, "Local devices can't wait for present.");
+	// Not locking the device: this only waits on swapchains, other threads may keep recording meanwhile.
+	return context->wait_for_present(p_timeout_usec);
+}
+
 void RenderingDeviceVulkan::submit() {
 	_THREAD_SAFE_METHOD_
 
@@ -9006,7 +9091,7 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 		frame_count = p_context->get_swapchain_image_count() + 1; // Always need one extra to ensure it's unused at any time, without having to use a fence for this.
 	}
 	limits = p_context->get_device_limits();
-	max_timestamp_query_elements = 256;
+	max_timestamp_query_elements = 512; // Leaves room for the nested "> " and "< " markers of every pass.
 
 	{ // Initialize allocator.
 
@@ -9142,6 +9227,7 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 		pipelines_cache.file_path += ".editor";
 	}
 	pipelines_cache.file_path += ".cache";
+	pipelines_cache.save_chunk_size_mb = GLOBAL_GET("rendering/rendering_device/pipeline_cache/save_chunk_size_mb");
 
 	// Prepare most fields now.
 	VkPhysicalDeviceProperties props;
@@ -9206,6 +9292,13 @@ void RenderingDeviceVulkan::_load_pipeline_cache() {
 }
 
 void RenderingDeviceVulkan::_update_pipeline_cache(bool p_closing) {
+	if (!p_closing) {
+		pipelines_cache.pipelines_since_size_check++;
+		if (pipelines_cache.pipelines_since_size_check < PIPELINE_CACHE_SIZE_CHECK_INTERVAL) {
+			return;
+		}
+	}
+
 	{
 		bool still_saving = pipelines_cache_save_task != WorkerThreadPool::INVALID_TASK_ID && !WorkerThreadPool::get_singleton()->is_task_completed(pipelines_cache_save_task);
 		if (still_saving) {
@@ -9226,6 +9319,7 @@ void RenderingDeviceVulkan::_update_pipeline_cache(bool p_closing) {
 		size_t pso_blob_size = 0;
 		VkResult vr = vkGetPipelineCacheData(device, pipelines_cache.cache_object, &pso_blob_size, nullptr);
 		ERR_FAIL_COND(vr);
+		pipelines_cache.pipelines_since_size_check = 0;
 		size_t difference = pso_blob_size - pipelines_cache.current_size;
 
 		bool must_save = false;
@@ -9233,8 +9327,7 @@ void RenderingDeviceVulkan::_update_pipeline_cache(bool p_closing) {
 		if (p_closing) {
 			must_save = difference > 0;
 		} else {
-			float save_interval = GLOBAL_GET("rendering/rendering_device/pipeline_cache/save_chunk_size_mb");
-			must_save = difference > 0 && difference / (1024.0f * 1024.0f) >= save_interval;
+			must_save = difference > 0 && difference / (1024.0f * 1024.0f) >= pipelines_cache.save_chunk_size_mb;
 		}
 
 		if (must_save) {
@@ -199,6 +199,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	struct StagingBufferBlock {
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VmaAllocation allocation = nullptr;
+		uint8_t *data_ptr = nullptr; // Persistently mapped.
 		uint64_t frame_used = 0;
 		uint32_t fill_amount = 0;
 	};
@@ -810,6 +811,14 @@ class RenderingDeviceVulkan : public RenderingDevice {
 		size_t current_size = 0;
 		LocalVector<uint8_t> buffer;
 		VkPipelineCache cache_object = VK_NULL_HANDLE;
+		float save_chunk_size_mb = 3.0;
+		uint32_t pipelines_since_size_check = 0;
+	};
+
+	enum {
+		// Querying the cache size may make the driver serialize the whole cache,
+		// so it's only checked after this many new pipelines.
+		PIPELINE_CACHE_SIZE_CHECK_INTERVAL = 16,
 	};
 
 	PipelineCache pipelines_cache;
@@ -1199,6 +1208,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect);
 	virtual void draw_list_disable_scissor(DrawListID p_list);
@@ -1255,6 +1265,7 @@ public:
 	void finalize();
 
 	virtual void swap_buffers(); // For main device.
+	virtual uint64_t wait_for_present(uint64_t p_timeout_usec); // For main device.
 
 	virtual void submit(); // For local device.
 	virtual void sync(); // For local device.
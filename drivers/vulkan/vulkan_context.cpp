@@ -527,6 +527,9 @@ Error VulkanContext::_initialize_device_extensions() {
 	if (VK_GOOGLE_display_timing_enabled) {
 		register_requested_device_extension(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME, false);
 	}
+	// Used by the low latency mode to wait for frames to reach the display.
+	register_requested_device_extension(VK_KHR_PRESENT_ID_EXTENSION_NAME, false);
+	register_requested_device_extension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, false);
 
 	// obtain available device extensions
 	uint32_t device_extension_count = 0;
@@ -774,6 +777,8 @@ Error VulkanContext::_check_capabilities() {
 			VkPhysicalDevice16BitStorageFeaturesKHR storage_feature = {};
 			VkPhysicalDeviceMultiviewFeatures multiview_features = {};
 			VkPhysicalDevicePipelineCreationCacheControlFeatures pipeline_cache_control_features = {};
+			VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+			VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
 
 			if (device_api_version >= VK_API_VERSION_1_2) {
 				device_features_vk12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
@@ -834,6 +839,20 @@ Error VulkanContext::_check_capabilities() {
 				next = &pipeline_cache_control_features;
 			}
 
+			if (is_device_extension_enabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && is_device_extension_enabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+				present_id_features = {
+					/*sType*/ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+					/*pNext*/ next,
+					/*presentId*/ false,
+				};
+				present_wait_features = {
+					/*sType*/ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+					/*pNext*/ &present_id_features,
+					/*presentWait*/ false,
+				};
+				next = &present_wait_features;
+			}
+
 			VkPhysicalDeviceFeatures2 device_features;
 			device_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
 			device_features.pNext = next;
@@ -878,6 +897,10 @@ Error VulkanContext::_check_capabilities() {
 			if (is_device_extension_enabled(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)) {
 				pipeline_cache_control_support = pipeline_cache_control_features.pipelineCreationCacheControl;
 			}
+
+			if (is_device_extension_enabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && is_device_extension_enabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+				present_wait_support = present_id_features.presentId && present_wait_features.presentWait;
+			}
 		}
 
 		// Check extended properties.
@@ -1553,6 +1576,19 @@ Error VulkanContext::_create_device() {
 		nextptr = &pipeline_cache_control_features;
 	}
 
+	VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+	VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
+	if (present_wait_support) {
+		present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+		present_id_features.pNext = nextptr;
+		present_id_features.presentId = VK_TRUE;
+		present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+		present_wait_features.pNext = &present_id_features;
+		present_wait_features.presentWait = VK_TRUE;
+
+		nextptr = &present_wait_features;
+	}
+
 	VkPhysicalDeviceVulkan11Features vulkan11features = {};
 	VkPhysicalDevice16BitStorageFeaturesKHR storage_feature = {};
 	VkPhysicalDeviceMultiviewFeatures multiview_features = {};
@@ -1702,6 +1738,9 @@ Error VulkanContext::_initialize_queues(VkSurfaceKHR p_surface) {
 		GET_DEVICE_PROC_ADDR(device, GetRefreshCycleDurationGOOGLE);
 		GET_DEVICE_PROC_ADDR(device, GetPastPresentationTimingGOOGLE);
 	}
+	if (present_wait_support) {
+		GET_DEVICE_PROC_ADDR(device, WaitForPresentKHR);
+	}
 
 	vkGetDeviceQueue(device, graphics_queue_family_index, 0, &graphics_queue);
 
@@ -1916,6 +1955,7 @@ Error VulkanContext::_clean_up_swap_chain(Window *window) {
 	// This destroys images associated it seems.
 	fpDestroySwapchainKHR(device, window->swapchain, nullptr);
 	window->swapchain = VK_NULL_HANDLE;
+	window->present_id_pending = false;
 	vkDestroyRenderPass(device, window->render_pass, nullptr);
 	window->render_pass = VK_NULL_HANDLE;
 	if (window->swapchain_image_resources) {
@@ -2664,6 +2704,29 @@ Error VulkanContext::swap_buffers() {
 		}
 	}
 #endif
+	uint64_t *present_ids = (uint64_t *)alloca(sizeof(uint64_t) * windows.size());
+	VkPresentIdKHR present_id_info = {};
+	if (present_wait_support) {
+		uint32_t present_id_count = 0;
+		for (KeyValue<int, Window> &E : windows) {
+			Window *w = &E.value;
+
+			if (w->swapchain == VK_NULL_HANDLE) {
+				continue;
+			}
+			w->present_id++;
+			w->present_id_pending = true;
+			present_ids[present_id_count++] = w->present_id;
+		}
+
+		present_id_info.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+		present_id_info.pNext = present.pNext;
+		present_id_info.swapchainCount = present.swapchainCount;
+		present_id_info.pPresentIds = present_ids;
+		present.pNext = &present_id_info;
+		present_queued_ticks = OS::get_singleton()->get_ticks_usec();
+	}
+
 	//	print_line("current buffer:  " + itos(current_buffer));
 	err = fpQueuePresentKHR(present_queue, &present);
 
@@ -2690,6 +2753,35 @@ Error VulkanContext::swap_buffers() {
 void VulkanContext::resize_notify() {
 }
 
+uint64_t VulkanContext::wait_for_present(uint64_t p_timeout_usec) {
+	if (!present_wait_support) {
+		return 0;
+	}
+
+	bool waited = false;
+	for (KeyValue<int, Window> &E : windows) {
+		Window *w = &E.value;
+
+		if (w->swapchain == VK_NULL_HANDLE || !w->present_id_pending) {
+			continue;
+		}
+		w->present_id_pending = false;
+
+		VkResult err = fpWaitForPresentKHR(device, w->swapchain, w->present_id, p_timeout_usec * 1000);
+		if (err == VK_SUCCESS) {
+			waited = true;
+		} else if (err != VK_TIMEOUT && err != VK_SUBOPTIMAL_KHR) {
+			// The swapchain is being recreated, or presentation is not possible (e.g. minimized window).
+			ERR_CONTINUE_MSG(err != VK_ERROR_OUT_OF_DATE_KHR && err != VK_ERROR_SURFACE_LOST_KHR, "Vulkan: Waiting for present failed. Error code: " + String(string_VkResult(err)));
+		}
+	}
+
+	if (waited) {
+		present_latency_usec = OS::get_singleton()->get_ticks_usec() - present_queued_ticks;
+	}
+	return waited ? MAX(present_latency_usec, (uint64_t)1) : 0;
+}
+
 VkDevice VulkanContext::get_device() {
 	return device;
 }
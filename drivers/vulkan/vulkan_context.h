@@ -120,6 +120,11 @@ private:
 	ShaderCapabilities shader_capabilities;
 	StorageBufferCapabilities storage_buffer_capabilities;
 	bool pipeline_cache_control_support = false;
+	bool present_wait_support = false;
+
+	// Time between queuing the last waited present and it reaching the display.
+	uint64_t present_queued_ticks = 0;
+	uint64_t present_latency_usec = 0;
 
 	String device_vendor;
 	String device_name;
@@ -165,6 +170,8 @@ private:
 		DisplayServer::VSyncMode vsync_mode = DisplayServer::VSYNC_ENABLED;
 		VkCommandPool present_cmd_pool = VK_NULL_HANDLE; // For separate present queue.
 		VkRenderPass render_pass = VK_NULL_HANDLE;
+		uint64_t present_id = 0; // Last id given to VK_KHR_present_id.
+		bool present_id_pending = false; // The last present was made on the current swapchain and not waited for yet.
 	};
 
 	struct LocalDevice {
@@ -218,6 +225,7 @@ private:
 	PFN_vkGetRefreshCycleDurationGOOGLE fpGetRefreshCycleDurationGOOGLE = nullptr;
 	PFN_vkGetPastPresentationTimingGOOGLE fpGetPastPresentationTimingGOOGLE = nullptr;
 	PFN_vkCreateRenderPass2KHR fpCreateRenderPass2KHR = nullptr;
+	PFN_vkWaitForPresentKHR fpWaitForPresentKHR = nullptr;
 
 	VkDebugUtilsMessengerEXT dbg_messenger = VK_NULL_HANDLE;
 	VkDebugReportCallbackEXT dbg_debug_report = VK_NULL_HANDLE;
@@ -286,6 +294,11 @@ public:
 	const StorageBufferCapabilities &get_storage_buffer_capabilities() const { return storage_buffer_capabilities; };
 	const VkPhysicalDeviceFeatures &get_physical_device_features() const { return physical_device_features; };
 	bool get_pipeline_cache_control_support() const { return pipeline_cache_control_support; };
+	bool get_present_wait_support() const { return present_wait_support; };
+
+	// Blocks until the last frame was presented on all windows (VK_KHR_present_wait).
+	// Returns the time it took from queuing the present to reaching the display, or 0 if unsupported.
+	uint64_t wait_for_present(uint64_t p_timeout_usec);
 
 	VkDevice get_device();
 	VkPhysicalDevice get_physical_device();
@@ -0,0 +1,212 @@
+/**************************************************************************/
+/*  editor_render_stats.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "editor_render_stats.h"
+
+#include "editor/editor_scale.h"
+#include "editor/editor_string_names.h"
+#include "scene/gui/button.h"
+#include "scene/gui/label.h"
+#include "scene/gui/tree.h"
+
+struct RenderStatsSort {
+	int column = 0;
+
+	bool operator()(const ServersDebugger::MaterialRenderStats &p_a, const ServersDebugger::MaterialRenderStats &p_b) const {
+		switch (column) {
+			case 0:
+				return p_a.material.naturalnocasecmp_to(p_b.material) < 0;
+			case 1:
+				return p_a.shader_path.naturalnocasecmp_to(p_b.shader_path) < 0;
+			case 2:
+				return p_a.pass < p_b.pass;
+			case 3:
+				return p_a.draw_calls > p_b.draw_calls;
+			case 4:
+				return p_a.instances > p_b.instances;
+			case 5:
+				return p_a.primitives > p_b.primitives;
+			default:
+				return p_a.shader_changes > p_b.shader_changes;
+		}
+	}
+};
+
+void EditorRenderStats::add_frame(const ServersDebugger::RenderStatsFrame &p_frame) {
+	materials = p_frame.materials;
+	_update_tree();
+}
+
+void EditorRenderStats::_update_tree() {
+	SortArray<ServersDebugger::MaterialRenderStats, RenderStatsSort> sorter;
+	sorter.compare.column = sort_column;
+	sorter.sort(materials.ptrw(), materials.size());
+
+	stats_tree->clear();
+	TreeItem *root = stats_tree->create_item();
+
+	int total_draw_calls = 0;
+	uint64_t total_primitives = 0;
+	int total_shader_changes = 0;
+
+	for (const ServersDebugger::MaterialRenderStats &E : materials) {
+		TreeItem *item = stats_tree->create_item(root);
+		item->set_text(COLUMN_MATERIAL, E.material);
+		item->set_tooltip_text(COLUMN_MATERIAL, E.material);
+		item->set_text(COLUMN_SHADER, E.shader_path);
+		item->set_tooltip_text(COLUMN_SHADER, E.shader_path);
+		item->set_text(COLUMN_PASS, E.pass.capitalize());
+		item->set_text(COLUMN_DRAW_CALLS, itos(E.draw_calls));
+		item->set_text(COLUMN_INSTANCES, itos(E.instances));
+		item->set_text(COLUMN_PRIMITIVES, itos(E.primitives));
+		item->set_text(COLUMN_SHADER_CHANGES, itos(E.shader_changes));
+		for (int i = COLUMN_DRAW_CALLS; i < COLUMN_MAX; i++) {
+			item->set_text_alignment(i, HORIZONTAL_ALIGNMENT_RIGHT);
+		}
+
+		total_draw_calls += E.draw_calls;
+		total_primitives += E.primitives;
+		total_shader_changes += E.shader_changes;
+	}
+
+	totals->set_text(vformat(TTR("%d materials, %d draw calls, %d primitives, %d shader changes"), materials.size(), total_draw_calls, total_primitives, total_shader_changes));
+}
+
+void EditorRenderStats::_column_title_clicked(int p_column, int p_mouse_button) {
+	if (p_mouse_button != (int)MouseButton::LEFT) {
+		return;
+	}
+	sort_column = p_column;
+	_update_tree();
+}
+
+void EditorRenderStats::clear() {
+	materials.clear();
+	stats_tree->clear();
+	totals->set_text(String());
+}
+
+void EditorRenderStats::_activate_pressed() {
+	_update_button_text();
+	if (activate->is_pressed()) {
+		_clear_pressed(); //always clear on start
+		clear_button->set_disabled(false);
+	}
+	emit_signal(SNAME("enable_profiling"), activate->is_pressed());
+}
+
+void EditorRenderStats::_clear_pressed() {
+	clear_button->set_disabled(true);
+	clear();
+}
+
+void EditorRenderStats::_update_button_text() {
+	if (activate->is_pressed()) {
+		activate->set_icon(get_editor_theme_icon(SNAME("Stop")));
+		activate->set_text(TTR("Stop"));
+	} else {
+		activate->set_icon(get_editor_theme_icon(SNAME("Play")));
+		activate->set_text(TTR("Start"));
+	}
+}
+
+void EditorRenderStats::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE:
+		case NOTIFICATION_THEME_CHANGED: {
+			_update_button_text();
+			clear_button->set_icon(get_editor_theme_icon(SNAME("Clear")));
+		} break;
+	}
+}
+
+void EditorRenderStats::_bind_methods() {
+	ADD_SIGNAL(MethodInfo("enable_profiling", PropertyInfo(Variant::BOOL, "enable")));
+}
+
+void EditorRenderStats::set_enabled(bool p_enable) {
+	activate->set_disabled(!p_enable);
+}
+
+void EditorRenderStats::set_pressed(bool p_pressed) {
+	activate->set_pressed(p_pressed);
+	_update_button_text();
+}
+
+bool EditorRenderStats::is_profiling() {
+	return activate->is_pressed();
+}
+
+EditorRenderStats::EditorRenderStats() {
+	set_name(TTR("Render Stats"));
+
+	HBoxContainer *hb = memnew(HBoxContainer);
+	add_child(hb);
+	activate = memnew(Button);
+	activate->set_toggle_mode(true);
+	activate->set_disabled(true);
+	activate->set_text(TTR("Start"));
+	activate->connect("pressed", callable_mp(this, &EditorRenderStats::_activate_pressed));
+	hb->add_child(activate);
+
+	clear_button = memnew(Button);
+	clear_button->set_text(TTR("Clear"));
+	clear_button->set_disabled(true);
+	clear_button->connect("pressed", callable_mp(this, &EditorRenderStats::_clear_pressed));
+	hb->add_child(clear_button);
+
+	hb->add_spacer();
+
+	totals = memnew(Label);
+	totals->set_tooltip_text(TTR("Shader changes count how often the renderer switched to a material's shader, an estimate of pipeline changes."));
+	totals->set_mouse_filter(MOUSE_FILTER_PASS);
+	hb->add_child(totals);
+
+	hb->add_theme_constant_override("separation", 8 * EDSCALE);
+
+	stats_tree = memnew(Tree);
+	stats_tree->set_v_size_flags(SIZE_EXPAND_FILL);
+	stats_tree->set_hide_root(true);
+	stats_tree->set_columns(COLUMN_MAX);
+	stats_tree->set_column_titles_visible(true);
+	stats_tree->set_column_title(COLUMN_MATERIAL, TTR("Material"));
+	stats_tree->set_column_expand_ratio(COLUMN_MATERIAL, 2);
+	stats_tree->set_column_clip_content(COLUMN_MATERIAL, true);
+	stats_tree->set_column_title(COLUMN_SHADER, TTR("Shader"));
+	stats_tree->set_column_expand_ratio(COLUMN_SHADER, 2);
+	stats_tree->set_column_clip_content(COLUMN_SHADER, true);
+	stats_tree->set_column_title(COLUMN_PASS, TTR("Pass"));
+	stats_tree->set_column_title(COLUMN_DRAW_CALLS, TTR("Draw Calls"));
+	stats_tree->set_column_title(COLUMN_INSTANCES, TTR("Instances"));
+	stats_tree->set_column_title(COLUMN_PRIMITIVES, TTR("Primitives"));
+	stats_tree->set_column_title(COLUMN_SHADER_CHANGES, TTR("Shader Changes"));
+	stats_tree->connect("column_title_clicked", callable_mp(this, &EditorRenderStats::_column_title_clicked));
+	add_child(stats_tree);
+}
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  editor_render_stats.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef EDITOR_RENDER_STATS_H
+#define EDITOR_RENDER_STATS_H
+
+#include "scene/gui/box_container.h"
+#include "servers/debugger/servers_debugger.h"
+
+class Button;
+class Label;
+class Tree;
+
+class EditorRenderStats : public VBoxContainer {
+	GDCLASS(EditorRenderStats, VBoxContainer);
+
+	enum Column {
+		COLUMN_MATERIAL,
+		COLUMN_SHADER,
+		COLUMN_PASS,
+		COLUMN_DRAW_CALLS,
+		COLUMN_INSTANCES,
+		COLUMN_PRIMITIVES,
+		COLUMN_SHADER_CHANGES,
+		COLUMN_MAX,
+	};
+
+	Button *activate = nullptr;
+	Button *clear_button = nullptr;
+	Label *totals = nullptr;
+	Tree *stats_tree = nullptr;
+
+	Vector<ServersDebugger::MaterialRenderStats> materials;
+	int sort_column = COLUMN_DRAW_CALLS;
+
+	void _update_button_text();
+	void _activate_pressed();
+	void _clear_pressed();
+	void _column_title_clicked(int p_column, int p_mouse_button);
+	void _update_tree();
+
+protected:
+	void _notification(int p_what);
+	static void _bind_methods();
+
+public:
+	void add_frame(const ServersDebugger::RenderStatsFrame &p_frame);
+	void set_enabled(bool p_enable);
+	void set_pressed(bool p_pressed);
+	bool is_profiling();
+	void clear();
+
+	EditorRenderStats();
+};
+
+#endif // EDITOR_RENDER_STATS_H
@@ -39,6 +39,7 @@
 #include "editor/debugger/debug_adapter/debug_adapter_protocol.h"
 #include "editor/debugger/editor_performance_profiler.h"
 #include "editor/debugger/editor_profiler.h"
+#include "editor/debugger/editor_render_stats.h"
 #include "editor/debugger/editor_visual_profiler.h"
 #include "editor/editor_file_system.h"
 #include "editor/editor_log.h"
@@ -345,6 +346,7 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 			}
 			profiler->set_enabled(false, false);
 			visual_profiler->set_enabled(false);
+			render_stats->set_enabled(false);
 		}
 		_update_buttons_state();
 
@@ -374,6 +376,7 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 				profiler->disable_seeking();
 
 				visual_profiler->set_enabled(true);
+				render_stats->set_enabled(true);
 
 				_set_reason_text(TTR("Execution resumed."), MESSAGE_SUCCESS);
 				emit_signal(SNAME("breaked"), false, false, "", false);
@@ -522,6 +525,10 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 			}
 		}
 		visual_profiler->add_frame_metric(metric);
+	} else if (p_msg == "render_stats:frame") {
+		ServersDebugger::RenderStatsFrame frame;
+		ERR_FAIL_COND_MSG(!frame.deserialize(p_data), "Failed to deserialize render stats frame.");
+		render_stats->add_frame(frame);
 	} else if (p_msg == "error") {
 		DebuggerMarshalls::OutputError oe;
 		ERR_FAIL_COND_MSG(oe.deserialize(p_data) == false, "Failed to deserialize error message");
@@ -997,6 +1004,7 @@ void ScriptEditorDebugger::start(Ref<RemoteDebuggerPeer> p_peer) {
 
 	profiler->set_enabled(true, true);
 	visual_profiler->set_enabled(true);
+	render_stats->set_enabled(true);
 
 	peer = p_peer;
 	ERR_FAIL_COND(p_peer.is_null());
@@ -1079,6 +1087,9 @@ void ScriptEditorDebugger::stop() {
 	visual_profiler->set_enabled(false);
 	visual_profiler->set_pressed(false);
 
+	render_stats->set_enabled(false);
+	render_stats->set_pressed(false);
+
 	inspector->edit(nullptr);
 	_update_buttons_state();
 }
@@ -1102,6 +1113,9 @@ void ScriptEditorDebugger::_profiler_activate(bool p_enable, int p_type) {
 			}
 			_put_msg("profiler:servers", msg_data);
 			break;
+		case PROFILER_RENDER_STATS:
+			_put_msg("profiler:render_stats", msg_data);
+			break;
 		default:
 			ERR_FAIL_MSG("Invalid profiler type");
 	}
@@ -2009,6 +2023,12 @@ ScriptEditorDebugger::ScriptEditorDebugger() {
 		visual_profiler->connect("enable_profiling", callable_mp(this, &ScriptEditorDebugger::_profiler_activate).bind(PROFILER_VISUAL));
 	}
 
+	{ //render stats
+		render_stats = memnew(EditorRenderStats);
+		tabs->add_child(render_stats);
+		render_stats->connect("enable_profiling", callable_mp(this, &ScriptEditorDebugger::_profiler_activate).bind(PROFILER_RENDER_STATS));
+	}
+
 	{ //monitors
 		performance_profiler = memnew(EditorPerformanceProfiler);
 		tabs->add_child(performance_profiler);
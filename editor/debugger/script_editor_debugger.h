@@ -51,6 +51,7 @@ class ItemList;
 class EditorProfiler;
 class EditorFileDialog;
 class EditorVisualProfiler;
+class EditorRenderStats;
 class EditorPerformanceProfiler;
 class SceneDebuggerTree;
 class EditorDebuggerPlugin;
@@ -73,7 +74,8 @@ private:
 
 	enum ProfilerType {
 		PROFILER_VISUAL,
-		PROFILER_SCRIPTS_SERVERS
+		PROFILER_SCRIPTS_SERVERS,
+		PROFILER_RENDER_STATS
 	};
 
 	enum Actions {
@@ -151,6 +153,7 @@ private:
 
 	EditorProfiler *profiler = nullptr;
 	EditorVisualProfiler *visual_profiler = nullptr;
+	EditorRenderStats *render_stats = nullptr;
 	EditorPerformanceProfiler *performance_profiler = nullptr;
 
 	OS::ProcessID remote_pid = 0;
@@ -39,6 +39,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/variant/variant_parser.h"
+#include "core/version.h"
 #include "editor/editor_help.h"
 #include "editor/editor_node.h"
 #include "editor/editor_paths.h"
@@ -1091,32 +1092,11 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 		String path = cd.path_join(p_dir->files[i]->file);
 
 		if (import_extensions.has(p_dir->files[i]->file.get_extension().to_lower())) {
-			//check here if file must be imported or not
-
-			uint64_t mt = FileAccess::get_modified_time(path);
-
-			bool reimport = false;
-
-			if (mt != p_dir->files[i]->modified_time) {
-				reimport = true; //it was modified, must be reimported.
-			} else if (!FileAccess::exists(path + ".import")) {
-				reimport = true; //no .import file, obviously reimport
-			} else {
-				uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
-				if (import_mt != p_dir->files[i]->import_modified_time) {
-					reimport = true;
-				} else if (_test_for_reimport(path, true)) {
-					reimport = true;
-				}
-			}
-
-			if (reimport) {
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = p_dir->files[i]->file;
-				scan_actions.push_back(ia);
-			}
+			//check later if file must be imported or not, see _check_reimports()
+			ReimportCheck check;
+			check.dir = p_dir;
+			check.file_index = i;
+			reimport_checks.push_back(check);
 		} else if (ResourceCache::has(path)) { //test for potential reload
 
 			uint64_t mt = FileAccess::get_modified_time(path);
@@ -1146,6 +1126,54 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 	}
 }
 
+void EditorFileSystem::_check_reimports(uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		ReimportCheck &check = reimport_checks[i];
+		const EditorFileSystemDirectory::FileInfo *fi = check.dir->files[check.file_index];
+		String path = check.dir->get_path().path_join(fi->file);
+
+		uint64_t mt = FileAccess::get_modified_time(path);
+
+		if (mt != fi->modified_time) {
+			check.reimport = true; //it was modified, must be reimported.
+		} else if (!FileAccess::exists(path + ".import")) {
+			check.reimport = true; //no .import file, obviously reimport
+		} else {
+			uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
+			if (import_mt != fi->import_modified_time) {
+				check.reimport = true;
+			} else if (_test_for_reimport(path, true)) {
+				check.reimport = true;
+			}
+		}
+	}
+}
+
+void EditorFileSystem::_scan_fs_changes_and_check_reimports(const ScanProgress &p_progress) {
+	reimport_checks.clear();
+	_scan_fs_changes(filesystem, p_progress);
+
+	// Checking an imported file means stat-ing it and reading its .import and .md5 files,
+	// which dominates rescans of large projects, so spread those checks on the thread pool.
+	WorkerThreadPool::get_singleton()->parallel_for(
+			reimport_checks.size(), 64, [this](uint32_t p_from, uint32_t p_to) {
+				_check_reimports(p_from, p_to);
+			},
+			"EditorFileSystemCheckReimports");
+
+	// Actions are queued in scan order so the result doesn't depend on scheduling.
+	for (const ReimportCheck &check : reimport_checks) {
+		if (check.reimport) {
+			ItemAction ia;
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+			ia.dir = check.dir;
+			ia.file = check.dir->files[check.file_index]->file;
+			scan_actions.push_back(ia);
+		}
+	}
+	reimport_checks.clear();
+}
+
 void EditorFileSystem::_delete_internal_files(String p_file) {
 	if (FileAccess::exists(p_file + ".import")) {
 		List<String> paths;
@@ -1166,7 +1194,7 @@ void EditorFileSystem::_thread_func_sources(void *_userdata) {
 		sp.progress = &pr;
 		sp.hi = 1;
 		sp.low = 0;
-		efs->_scan_fs_changes(efs->filesystem, sp);
+		efs->_scan_fs_changes_and_check_reimports(sp);
 	}
 	efs->scanning_changes_done = true;
 }
@@ -1192,7 +1220,7 @@ void EditorFileSystem::scan_changes() {
 			sp.hi = 1;
 			sp.low = 0;
 			scan_total = 0;
-			_scan_fs_changes(filesystem, sp);
+			_scan_fs_changes_and_check_reimports(sp);
 			bool changed = _update_scan_actions();
 			_update_pending_script_classes();
 			if (changed) {
@@ -2039,7 +2067,18 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+	String cache_key;
+	bool from_cache = false;
+	if (!import_cache_path.is_empty() && uid != ResourceUID::INVALID_ID && importer->can_cache_import_result(params)) {
+		cache_key = _get_import_cache_key(p_file, importer, opts, params, uid);
+		from_cache = _load_from_import_cache(cache_key, base_path, &import_variants, &gen_files, &meta);
+	}
+
+	Error err = OK;
+	if (!from_cache) {
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	}
 
 	ERR_FAIL_COND_V_MSG(err != OK, ERR_FILE_UNRECOGNIZED, "Error importing '" + p_file + "'.");
 
@@ -2148,6 +2187,10 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 		}
 	}
 
+	if (!cache_key.is_empty() && !from_cache) {
+		_store_in_import_cache(cache_key, base_path, dest_paths, import_variants, gen_files, meta);
+	}
+
 	//update modified times, to avoid reimport
 	fs->files[cpos]->modified_time = FileAccess::get_modified_time(p_file);
 	fs->files[cpos]->import_modified_time = FileAccess::get_modified_time(p_file + ".import");
@@ -2178,6 +2221,128 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	return OK;
 }
 
+String EditorFileSystem::_get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params, ResourceUID::ID p_uid) const {
+	// Everything the import result depends on: engine and importer versions, the project settings the importer
+	// uses, the source contents, its path and UID (which may end up in the imported resources) and the options
+	// in their declared order. Importers reading other files are not cached, see can_cache_import_result().
+	String key = String(VERSION_FULL_CONFIG) + "\n" + p_importer->get_importer_name() + "\n" + itos(p_importer->get_format_version()) + "\n";
+	key += p_importer->get_import_settings_string() + "\n";
+	key += FileAccess::get_md5(p_file) + "\n" + p_file + "\n" + ResourceUID::get_singleton()->id_to_text(p_uid) + "\n";
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		String value;
+		VariantWriter::write_to_string(p_params[E.option.name], value);
+		key += E.option.name + "=" + value + "\n";
+	}
+	return key.md5_text();
+}
+
+bool EditorFileSystem::_load_from_import_cache(const String &p_key, const String &p_base_path, List<String> *r_import_variants, List<String> *r_gen_files, Variant *r_metadata) const {
+	const String entry_dir = import_cache_path.path_join(p_key.substr(0, 2)).path_join(p_key);
+
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	if (manifest->load(entry_dir.path_join("manifest.cfg")) != OK) {
+		return false;
+	}
+
+	// Paths relative to the import base path are stored with a "*" prefix, as the base path is specific to each source file.
+	const PackedStringArray files = manifest->get_value("import", "files", PackedStringArray());
+	for (int i = 0; i < files.size(); i++) {
+		const String dest_path = files[i].begins_with("*") ? p_base_path + files[i].substr(1) : files[i];
+		Vector<uint8_t> data = FileAccess::get_file_as_bytes(entry_dir.path_join(itos(i) + ".bin"));
+		Ref<FileAccess> f = FileAccess::open(dest_path, FileAccess::WRITE);
+		ERR_FAIL_COND_V_MSG(f.is_null(), false, "Cannot restore cached import result to '" + dest_path + "'.");
+		f->store_buffer(data.ptr(), data.size());
+	}
+
+	const PackedStringArray variants = manifest->get_value("import", "variants", PackedStringArray());
+	for (const String &E : variants) {
+		r_import_variants->push_back(E);
+	}
+	const PackedStringArray gen_files = manifest->get_value("import", "gen_files", PackedStringArray());
+	for (const String &E : gen_files) {
+		r_gen_files->push_back(E);
+	}
+	*r_metadata = manifest->get_value("import", "metadata", Variant());
+
+	print_verbose("Restored import of '" + p_base_path + "' from the import cache.");
+	return true;
+}
+
+void EditorFileSystem::_store_in_import_cache(const String &p_key, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_import_variants, const List<String> &p_gen_files, const Variant &p_metadata) const {
+	const String bucket_dir = import_cache_path.path_join(p_key.substr(0, 2));
+	const String entry_dir = bucket_dir.path_join(p_key);
+	if (DirAccess::dir_exists_absolute(entry_dir)) {
+		return;
+	}
+
+	// Write to a temporary directory first and move it in place, so other machines
+	// sharing the cache never see a partially written entry.
+	const String temp_dir = bucket_dir.path_join(p_key + ".tmp" + itos(OS::get_singleton()->get_process_id()) + "_" + itos(Thread::get_caller_id()));
+	ERR_FAIL_COND_MSG(DirAccess::make_dir_recursive_absolute(temp_dir) != OK, "Cannot create import cache directory '" + temp_dir + "'.");
+
+	// Importers may write more than their declared outputs next to them, such as the editor-only
+	// textures of ResourceImporterTexture, so store everything written for this source file.
+	Vector<String> paths = p_dest_paths;
+	Ref<DirAccess> imported_dir = DirAccess::open(p_base_path.get_base_dir());
+	if (imported_dir.is_valid()) {
+		const String prefix = p_base_path.get_file() + ".";
+		imported_dir->list_dir_begin();
+		for (String name = imported_dir->get_next(); !name.is_empty(); name = imported_dir->get_next()) {
+			if (imported_dir->current_is_dir() || !name.begins_with(prefix) || name.get_extension() == "md5") {
+				continue;
+			}
+			const String path = p_base_path.get_base_dir().path_join(name);
+			if (!paths.has(path)) {
+				paths.push_back(path);
+			}
+		}
+		imported_dir->list_dir_end();
+	}
+
+	PackedStringArray files;
+	bool success = true;
+	for (int i = 0; i < paths.size() && success; i++) {
+		const String &path = paths[i];
+		files.push_back(path.begins_with(p_base_path) ? "*" + path.substr(p_base_path.length()) : path);
+
+		Vector<uint8_t> data = FileAccess::get_file_as_bytes(path);
+		Ref<FileAccess> f = FileAccess::open(temp_dir.path_join(itos(i) + ".bin"), FileAccess::WRITE);
+		success = f.is_valid() && (data.size() > 0 || FileAccess::exists(path));
+		if (success) {
+			f->store_buffer(data.ptr(), data.size());
+		}
+	}
+
+	if (success) {
+		PackedStringArray variants;
+		for (const String &E : p_import_variants) {
+			variants.push_back(E);
+		}
+		PackedStringArray gen_files;
+		for (const String &E : p_gen_files) {
+			gen_files.push_back(E);
+		}
+
+		Ref<ConfigFile> manifest;
+		manifest.instantiate();
+		manifest->set_value("import", "files", files);
+		manifest->set_value("import", "variants", variants);
+		manifest->set_value("import", "gen_files", gen_files);
+		manifest->set_value("import", "metadata", p_metadata);
+		success = manifest->save(temp_dir.path_join("manifest.cfg")) == OK;
+	}
+
+	if (!success || DirAccess::rename_absolute(temp_dir, entry_dir) != OK) {
+		// Either something failed or another editor stored the same entry meanwhile.
+		Ref<DirAccess> da = DirAccess::open(temp_dir);
+		if (da.is_valid()) {
+			da->erase_contents_recursive();
+		}
+		DirAccess::remove_absolute(temp_dir);
+	}
+}
+
 void EditorFileSystem::_find_group_files(EditorFileSystemDirectory *efd, HashMap<String, Vector<String>> &group_files, HashSet<String> &groups_to_reimport) {
 	int fc = efd->files.size();
 	const EditorFileSystemDirectory::FileInfo *const *files = efd->files.ptr();
@@ -2266,27 +2431,37 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	int from = 0;
 	for (int i = 0; i < reimport_files.size(); i++) {
 		if (groups_to_reimport.has(reimport_files[i].path)) {
+			from = i + 1;
 			continue;
 		}
 
 		if (use_multiple_threads && reimport_files[i].threaded) {
-			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer) {
+			// Files with the same import order don't depend on each other, so all the threaded ones
+			// are imported in one batch, even when they use different importers. The batch also ends
+			// before a skipped group file, so the files gathered so far are not dropped.
+			if (i + 1 == reimport_files.size() || !reimport_files[i + 1].threaded || reimport_files[i + 1].order != reimport_files[from].order || groups_to_reimport.has(reimport_files[i + 1].path)) {
 				if (from - i == 0) {
 					// Single file, do not use threads.
 					pr.step(reimport_files[i].path.get_file(), i);
 					_reimport_file(reimport_files[i].path);
 				} else {
-					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
-					ERR_CONTINUE(!importer.is_valid());
-
-					importer->import_threaded_begin();
+					Vector<Ref<ResourceImporter>> importers;
+					for (int j = from; j <= i; j++) {
+						if (j == from || reimport_files[j].importer != reimport_files[j - 1].importer) {
+							Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[j].importer);
+							if (importer.is_valid()) {
+								importer->import_threaded_begin();
+								importers.push_back(importer);
+							}
+						}
+					}
 
 					ImportThreadData tdata;
 					tdata.max_index = from;
 					tdata.reimport_from = from;
 					tdata.reimport_files = reimport_files.ptr();
 
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, i - from + 1, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, i - from + 1, -1, false, importers.size() == 1 ? vformat(TTR("Import resources of type: %s"), reimport_files[from].importer) : TTR("Import resources"));
 					int current_index = from - 1;
 					do {
 						if (current_index < tdata.max_index) {
@@ -2298,7 +2473,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
-					importer->import_threaded_end();
+					for (const Ref<ResourceImporter> &importer : importers) {
+						importer->import_threaded_end();
+					}
 				}
 
 				from = i + 1;
@@ -2307,6 +2484,7 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 		} else {
 			pr.step(reimport_files[i].path.get_file(), i);
 			_reimport_file(reimport_files[i].path);
+			from = i + 1;
 		}
 	}
 
@@ -2580,6 +2758,7 @@ void EditorFileSystem::remove_import_format_support_query(Ref<EditorFileSystemIm
 EditorFileSystem::EditorFileSystem() {
 	ResourceLoader::import = _resource_import;
 	reimport_on_missing_imported_files = GLOBAL_GET("editor/import/reimport_missing_imported_files");
+	import_cache_path = GLOBAL_GET("editor/import/cache_path");
 	singleton = this;
 	filesystem = memnew(EditorFileSystemDirectory); //like, empty
 	filesystem->parent = nullptr;
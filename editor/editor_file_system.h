@@ -32,6 +32,7 @@
 #define EDITOR_FILE_SYSTEM_H
 
 #include "core/io/dir_access.h"
+#include "core/io/resource_importer.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
@@ -221,6 +222,16 @@ class EditorFileSystem : public Node {
 
 	void _scan_fs_changes(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress);
 
+	// Imported files found by _scan_fs_changes(), checked for reimport all at once on the thread pool.
+	struct ReimportCheck {
+		EditorFileSystemDirectory *dir = nullptr;
+		int file_index = 0;
+		bool reimport = false;
+	};
+	LocalVector<ReimportCheck> reimport_checks;
+	void _check_reimports(uint32_t p_from, uint32_t p_to);
+	void _scan_fs_changes_and_check_reimports(const ScanProgress &p_progress);
+
 	void _delete_internal_files(String p_file);
 
 	HashSet<String> textfile_extensions;
@@ -249,6 +260,12 @@ class EditorFileSystem : public Node {
 
 	bool reimport_on_missing_imported_files;
 
+	// Content-addressed cache of import results, see "editor/import/cache_path".
+	String import_cache_path;
+	String _get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params, ResourceUID::ID p_uid) const;
+	bool _load_from_import_cache(const String &p_key, const String &p_base_path, List<String> *r_import_variants, List<String> *r_gen_files, Variant *r_metadata) const;
+	void _store_in_import_cache(const String &p_key, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_import_variants, const List<String> &p_gen_files, const Variant &p_metadata) const;
+
 	Vector<String> _get_dependencies(const String &p_path);
 
 	struct ImportFile {
@@ -257,7 +274,14 @@ class EditorFileSystem : public Node {
 		bool threaded = false;
 		int order = 0;
 		bool operator<(const ImportFile &p_if) const {
-			return order == p_if.order ? (importer < p_if.importer) : (order < p_if.order);
+			// Keep the files that can be imported in threads together within each import order, so they form a single batch.
+			if (order != p_if.order) {
+				return order < p_if.order;
+			}
+			if (threaded != p_if.threaded) {
+				return threaded;
+			}
+			return importer < p_if.importer;
 		}
 	};
 
@@ -32,6 +32,7 @@
 
 #include "core/error/error_macros.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/object/script_language.h"
 #include "editor/editor_node.h"
 #include "editor/editor_settings.h"
@@ -1094,6 +1095,56 @@ Node *ResourceImporterScene::_post_fix_animations(Node *p_node, Node *p_root, co
 	return p_node;
 }
 
+void ResourceImporterScene::_gather_decomposition_tasks(Node *p_node, Node *p_root, const Dictionary &p_node_data, LocalVector<DecompositionTask> &r_tasks) {
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_gather_decomposition_tasks(p_node->get_child(i), p_root, p_node_data, r_tasks);
+	}
+
+	ImporterMeshInstance3D *mi = Object::cast_to<ImporterMeshInstance3D>(p_node);
+	if (!mi || mi->get_mesh().is_null()) {
+		return;
+	}
+
+	String import_id = p_node->get_meta("import_id", "PATH:" + p_root->get_path_to(p_node));
+
+	Dictionary node_settings;
+	if (p_node_data.has(import_id)) {
+		node_settings = p_node_data[import_id];
+	}
+	node_settings = node_settings.duplicate(true);
+
+	List<ImportOption> iopts;
+	get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH_3D_NODE, &iopts);
+	for (const ImportOption &E : iopts) {
+		if (!node_settings.has(E.option.name)) {
+			node_settings[E.option.name] = E.default_value;
+		}
+	}
+
+	if (!bool(node_settings.get("generate/physics", false)) || (ShapeType)node_settings.get("physics/shape_type", SHAPE_TYPE_DECOMPOSE_CONVEX).operator int() != SHAPE_TYPE_DECOMPOSE_CONVEX) {
+		return;
+	}
+
+	Ref<ImporterMesh> m = mi->get_mesh();
+	for (const DecompositionTask &task : r_tasks) {
+		if (task.mesh == m && task.settings.recursive_equal(node_settings, 1)) {
+			return;
+		}
+	}
+
+	DecompositionTask task;
+	task.mesh = m;
+	task.settings = node_settings;
+	r_tasks.push_back(task);
+}
+
+void ResourceImporterScene::_process_decomposition_task(uint32_t p_index, DecompositionTask *p_tasks) {
+	// The result lands in the ImporterMesh decomposition cache, where _post_fix_node() picks it up
+	// as long as post-import plugins leave the mesh and its settings untouched.
+	DecompositionTask &task = p_tasks[p_index];
+	get_collision_shapes(task.mesh, task.settings, 1.0);
+}
+
 Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps, float p_applied_root_scale) {
 	// children first
 	for (int i = 0; i < p_node->get_child_count(); i++) {
@@ -2002,141 +2053,169 @@ Array ResourceImporterScene::_get_skinned_pose_transforms(ImporterMeshInstance3D
 	return skin_pose_transform_array;
 }
 
-void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+void ResourceImporterScene::_pre_process_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches, HashMap<ImporterMesh *, String> &r_save_paths, LocalVector<MeshProcessTask> &r_tasks) {
 	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
-	if (src_mesh_node) {
-		//is mesh
-		MeshInstance3D *mesh_node = memnew(MeshInstance3D);
-		mesh_node->set_name(src_mesh_node->get_name());
-		mesh_node->set_transform(src_mesh_node->get_transform());
-		mesh_node->set_skin(src_mesh_node->get_skin());
-		mesh_node->set_skeleton_path(src_mesh_node->get_skeleton_path());
-		if (src_mesh_node->get_mesh().is_valid()) {
-			Ref<ArrayMesh> mesh;
-			if (!src_mesh_node->get_mesh()->has_mesh()) {
-				//do mesh processing
-
-				bool generate_lods = p_generate_lods;
-				float split_angle = 25.0f;
-				float merge_angle = 60.0f;
-				bool create_shadow_meshes = p_create_shadow_meshes;
-				bool bake_lightmaps = p_light_bake_mode == LIGHT_BAKE_STATIC_LIGHTMAPS;
-				String save_to_file;
-
-				String mesh_id = src_mesh_node->get_mesh()->get_meta("import_id", src_mesh_node->get_mesh()->get_name());
-
-				if (!mesh_id.is_empty() && p_mesh_data.has(mesh_id)) {
-					Dictionary mesh_settings = p_mesh_data[mesh_id];
-					{
-						//fill node settings for this node with default values
-						List<ImportOption> iopts;
-						get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH, &iopts);
-						for (const ImportOption &E : iopts) {
-							if (!mesh_settings.has(E.option.name)) {
-								mesh_settings[E.option.name] = E.default_value;
-							}
-						}
-					}
-
-					if (mesh_settings.has("generate/shadow_meshes")) {
-						int shadow_meshes = mesh_settings["generate/shadow_meshes"];
-						if (shadow_meshes == MESH_OVERRIDE_ENABLE) {
-							create_shadow_meshes = true;
-						} else if (shadow_meshes == MESH_OVERRIDE_DISABLE) {
-							create_shadow_meshes = false;
-						}
+	// Meshes shared by several instances are only processed for the first one, like they are converted once.
+	if (src_mesh_node && src_mesh_node->get_mesh().is_valid() && !src_mesh_node->get_mesh()->has_mesh() && !r_save_paths.has(src_mesh_node->get_mesh().ptr())) {
+		//do mesh processing
+
+		bool generate_lods = p_generate_lods;
+		float split_angle = 25.0f;
+		float merge_angle = 60.0f;
+		bool create_shadow_meshes = p_create_shadow_meshes;
+		bool bake_lightmaps = p_light_bake_mode == LIGHT_BAKE_STATIC_LIGHTMAPS;
+		String save_to_file;
+
+		String mesh_id = src_mesh_node->get_mesh()->get_meta("import_id", src_mesh_node->get_mesh()->get_name());
+
+		if (!mesh_id.is_empty() && p_mesh_data.has(mesh_id)) {
+			Dictionary mesh_settings = p_mesh_data[mesh_id];
+			{
+				//fill node settings for this node with default values
+				List<ImportOption> iopts;
+				get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH, &iopts);
+				for (const ImportOption &E : iopts) {
+					if (!mesh_settings.has(E.option.name)) {
+						mesh_settings[E.option.name] = E.default_value;
 					}
+				}
+			}
 
-					if (mesh_settings.has("generate/lightmap_uv")) {
-						int lightmap_uv = mesh_settings["generate/lightmap_uv"];
-						if (lightmap_uv == MESH_OVERRIDE_ENABLE) {
-							bake_lightmaps = true;
-						} else if (lightmap_uv == MESH_OVERRIDE_DISABLE) {
-							bake_lightmaps = false;
-						}
-					}
+			if (mesh_settings.has("generate/shadow_meshes")) {
+				int shadow_meshes = mesh_settings["generate/shadow_meshes"];
+				if (shadow_meshes == MESH_OVERRIDE_ENABLE) {
+					create_shadow_meshes = true;
+				} else if (shadow_meshes == MESH_OVERRIDE_DISABLE) {
+					create_shadow_meshes = false;
+				}
+			}
 
-					if (mesh_settings.has("generate/lods")) {
-						int lods = mesh_settings["generate/lods"];
-						if (lods == MESH_OVERRIDE_ENABLE) {
-							generate_lods = true;
-						} else if (lods == MESH_OVERRIDE_DISABLE) {
-							generate_lods = false;
-						}
-					}
+			if (mesh_settings.has("generate/lightmap_uv")) {
+				int lightmap_uv = mesh_settings["generate/lightmap_uv"];
+				if (lightmap_uv == MESH_OVERRIDE_ENABLE) {
+					bake_lightmaps = true;
+				} else if (lightmap_uv == MESH_OVERRIDE_DISABLE) {
+					bake_lightmaps = false;
+				}
+			}
 
-					if (mesh_settings.has("lods/normal_split_angle")) {
-						split_angle = mesh_settings["lods/normal_split_angle"];
-					}
+			if (mesh_settings.has("generate/lods")) {
+				int lods = mesh_settings["generate/lods"];
+				if (lods == MESH_OVERRIDE_ENABLE) {
+					generate_lods = true;
+				} else if (lods == MESH_OVERRIDE_DISABLE) {
+					generate_lods = false;
+				}
+			}
 
-					if (mesh_settings.has("lods/normal_merge_angle")) {
-						merge_angle = mesh_settings["lods/normal_merge_angle"];
-					}
+			if (mesh_settings.has("lods/normal_split_angle")) {
+				split_angle = mesh_settings["lods/normal_split_angle"];
+			}
 
-					if (mesh_settings.has("save_to_file/enabled") && bool(mesh_settings["save_to_file/enabled"]) && mesh_settings.has("save_to_file/path")) {
-						save_to_file = mesh_settings["save_to_file/path"];
-						if (!save_to_file.is_resource_file()) {
-							save_to_file = "";
-						}
-					}
+			if (mesh_settings.has("lods/normal_merge_angle")) {
+				merge_angle = mesh_settings["lods/normal_merge_angle"];
+			}
 
-					for (int i = 0; i < post_importer_plugins.size(); i++) {
-						post_importer_plugins.write[i]->internal_process(EditorScenePostImportPlugin::INTERNAL_IMPORT_CATEGORY_MESH, nullptr, src_mesh_node, src_mesh_node->get_mesh(), mesh_settings);
-					}
+			if (mesh_settings.has("save_to_file/enabled") && bool(mesh_settings["save_to_file/enabled"]) && mesh_settings.has("save_to_file/path")) {
+				save_to_file = mesh_settings["save_to_file/path"];
+				if (!save_to_file.is_resource_file()) {
+					save_to_file = "";
 				}
+			}
 
-				if (bake_lightmaps) {
-					Transform3D xf;
-					Node3D *n = src_mesh_node;
-					while (n) {
-						xf = n->get_transform() * xf;
-						n = n->get_parent_node_3d();
-					}
+			for (int i = 0; i < post_importer_plugins.size(); i++) {
+				post_importer_plugins.write[i]->internal_process(EditorScenePostImportPlugin::INTERNAL_IMPORT_CATEGORY_MESH, nullptr, src_mesh_node, src_mesh_node->get_mesh(), mesh_settings);
+			}
+		}
 
-					Vector<uint8_t> lightmap_cache;
-					src_mesh_node->get_mesh()->lightmap_unwrap_cached(xf, p_lightmap_texel_size, p_src_lightmap_cache, lightmap_cache);
+		if (bake_lightmaps) {
+			Transform3D xf;
+			Node3D *n = src_mesh_node;
+			while (n) {
+				xf = n->get_transform() * xf;
+				n = n->get_parent_node_3d();
+			}
 
-					if (!lightmap_cache.is_empty()) {
-						if (r_lightmap_caches.is_empty()) {
-							r_lightmap_caches.push_back(lightmap_cache);
-						} else {
-							String new_md5 = String::md5(lightmap_cache.ptr()); // MD5 is stored at the beginning of the cache data
+			Vector<uint8_t> lightmap_cache;
+			src_mesh_node->get_mesh()->lightmap_unwrap_cached(xf, p_lightmap_texel_size, p_src_lightmap_cache, lightmap_cache);
 
-							for (int i = 0; i < r_lightmap_caches.size(); i++) {
-								String md5 = String::md5(r_lightmap_caches[i].ptr());
-								if (new_md5 < md5) {
-									r_lightmap_caches.insert(i, lightmap_cache);
-									break;
-								}
+			if (!lightmap_cache.is_empty()) {
+				if (r_lightmap_caches.is_empty()) {
+					r_lightmap_caches.push_back(lightmap_cache);
+				} else {
+					String new_md5 = String::md5(lightmap_cache.ptr()); // MD5 is stored at the beginning of the cache data
 
-								if (new_md5 == md5) {
-									break;
-								}
-							}
+					for (int i = 0; i < r_lightmap_caches.size(); i++) {
+						String md5 = String::md5(r_lightmap_caches[i].ptr());
+						if (new_md5 < md5) {
+							r_lightmap_caches.insert(i, lightmap_cache);
+							break;
+						}
+
+						if (new_md5 == md5) {
+							break;
 						}
 					}
 				}
+			}
+		}
 
-				if (generate_lods) {
-					Array skin_pose_transform_array = _get_skinned_pose_transforms(src_mesh_node);
-					src_mesh_node->get_mesh()->generate_lods(merge_angle, split_angle, skin_pose_transform_array);
-				}
+		r_save_paths.insert(src_mesh_node->get_mesh().ptr(), save_to_file);
 
-				if (create_shadow_meshes) {
-					src_mesh_node->get_mesh()->create_shadow_mesh();
-				}
+		if (generate_lods || create_shadow_meshes) {
+			MeshProcessTask task;
+			task.mesh = src_mesh_node->get_mesh();
+			task.generate_lods = generate_lods;
+			task.split_angle = split_angle;
+			task.merge_angle = merge_angle;
+			if (generate_lods) {
+				task.skin_pose_transform_array = _get_skinned_pose_transforms(src_mesh_node);
+			}
+			task.create_shadow_mesh = create_shadow_meshes;
+			r_tasks.push_back(task);
+		}
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_pre_process_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches, r_save_paths, r_tasks);
+	}
+}
+
+void ResourceImporterScene::_process_mesh_task(uint32_t p_index, MeshProcessTask *p_tasks) {
+	// Only touches its own ImporterMesh, so tasks for different meshes can run concurrently.
+	MeshProcessTask &task = p_tasks[p_index];
+	if (task.generate_lods) {
+		task.mesh->generate_lods(task.merge_angle, task.split_angle, task.skin_pose_transform_array);
+	}
+	if (task.create_shadow_mesh) {
+		task.mesh->create_shadow_mesh();
+	}
+}
 
-				if (!save_to_file.is_empty()) {
-					Ref<Mesh> existing = ResourceCache::get_ref(save_to_file);
+void ResourceImporterScene::_generate_meshes(Node *p_node, const HashMap<ImporterMesh *, String> &p_save_paths, LightBakeMode p_light_bake_mode) {
+	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
+	if (src_mesh_node) {
+		//is mesh
+		MeshInstance3D *mesh_node = memnew(MeshInstance3D);
+		mesh_node->set_name(src_mesh_node->get_name());
+		mesh_node->set_transform(src_mesh_node->get_transform());
+		mesh_node->set_skin(src_mesh_node->get_skin());
+		mesh_node->set_skeleton_path(src_mesh_node->get_skeleton_path());
+		if (src_mesh_node->get_mesh().is_valid()) {
+			Ref<ArrayMesh> mesh;
+			if (!src_mesh_node->get_mesh()->has_mesh()) {
+				const String *save_to_file = p_save_paths.getptr(src_mesh_node->get_mesh().ptr());
+				if (save_to_file && !save_to_file->is_empty()) {
+					Ref<Mesh> existing = ResourceCache::get_ref(*save_to_file);
 					if (existing.is_valid()) {
 						//if somehow an existing one is useful, create
 						existing->reset_state();
 					}
 					mesh = src_mesh_node->get_mesh()->get_mesh(existing);
 
-					ResourceSaver::save(mesh, save_to_file); //override
+					ResourceSaver::save(mesh, *save_to_file); //override
 
-					mesh->set_path(save_to_file, true); //takeover existing, if needed
+					mesh->set_path(*save_to_file, true); //takeover existing, if needed
 
 				} else {
 					mesh = src_mesh_node->get_mesh()->get_mesh();
@@ -2181,7 +2260,7 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_m
 	}
 
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
+		_generate_meshes(p_node->get_child(i), p_save_paths, p_light_bake_mode);
 	}
 }
 
@@ -2496,6 +2575,16 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 		fps = (float)p_options[SNAME("animation/fps")];
 	}
 	_pre_fix_animations(scene, scene, node_data, animation_data, fps);
+
+	// Convex decomposition is by far the slowest part of generating colliders, so run it for all meshes
+	// at once before the (serial) node pass.
+	LocalVector<DecompositionTask> decomposition_tasks;
+	_gather_decomposition_tasks(scene, scene, node_data, decomposition_tasks);
+	if (decomposition_tasks.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceImporterScene::_process_decomposition_task, decomposition_tasks.ptr(), decomposition_tasks.size(), -1, true, SNAME("ImportSceneDecomposition"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	_post_fix_node(scene, scene, collision_map, occluder_arrays, scanned_meshes, node_data, material_data, animation_data, fps, apply_root ? root_scale : 1.0);
 	_post_fix_animations(scene, scene, node_data, animation_data, fps);
 
@@ -2562,7 +2651,17 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	if (subresources.has("meshes")) {
 		mesh_data = subresources["meshes"];
 	}
-	_generate_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
+	HashMap<ImporterMesh *, String> mesh_save_paths;
+	LocalVector<MeshProcessTask> mesh_tasks;
+	_pre_process_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches, mesh_save_paths, mesh_tasks);
+
+	// LOD and shadow mesh generation dominate the import time of large scenes, and each mesh is independent.
+	if (!mesh_tasks.is_empty()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceImporterScene::_process_mesh_task, mesh_tasks.ptr(), mesh_tasks.size(), -1, true, SNAME("ImportSceneMeshes"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	_generate_meshes(scene, mesh_save_paths, LightBakeMode(light_bake_mode));
 
 	if (mesh_lightmap_caches.size()) {
 		Ref<FileAccess> f = FileAccess::open(p_source_file + ".unwrap_cache", FileAccess::WRITE);
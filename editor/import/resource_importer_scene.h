@@ -213,11 +213,30 @@ class ResourceImporterScene : public ResourceImporter {
 		SHAPE_TYPE_CAPSULE,
 	};
 
+	struct MeshProcessTask {
+		Ref<ImporterMesh> mesh;
+		bool generate_lods = false;
+		float split_angle = 25.0f;
+		float merge_angle = 60.0f;
+		Array skin_pose_transform_array;
+		bool create_shadow_mesh = false;
+	};
+
 	Array _get_skinned_pose_transforms(ImporterMeshInstance3D *p_src_mesh_node);
 	void _replace_owner(Node *p_node, Node *p_scene, Node *p_new_owner);
-	void _generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
+	void _pre_process_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches, HashMap<ImporterMesh *, String> &r_save_paths, LocalVector<MeshProcessTask> &r_tasks);
+	void _process_mesh_task(uint32_t p_index, MeshProcessTask *p_tasks);
+	void _generate_meshes(Node *p_node, const HashMap<ImporterMesh *, String> &p_save_paths, LightBakeMode p_light_bake_mode);
 	void _add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes);
 
+	struct DecompositionTask {
+		Ref<ImporterMesh> mesh;
+		Dictionary settings;
+	};
+
+	void _gather_decomposition_tasks(Node *p_node, Node *p_root, const Dictionary &p_node_data, LocalVector<DecompositionTask> &r_tasks);
+	void _process_decomposition_task(uint32_t p_index, DecompositionTask *p_tasks);
+
 	enum AnimationImportTracks {
 		ANIMATION_IMPORT_TRACKS_IF_PRESENT,
 		ANIMATION_IMPORT_TRACKS_IF_PRESENT_FOR_ALL,
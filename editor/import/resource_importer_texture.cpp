@@ -735,6 +735,13 @@ String ResourceImporterTexture::get_import_settings_string() const {
 	return s;
 }
 
+bool ResourceImporterTexture::can_cache_import_result(const HashMap<StringName, Variant> &p_options) const {
+	// Editor icons depend on the editor scale and theme of the machine importing them.
+	bool use_editor_scale = p_options.has("editor/scale_with_editor_scale") && p_options["editor/scale_with_editor_scale"];
+	bool convert_editor_colors = p_options.has("editor/convert_colors_with_editor_theme") && p_options["editor/convert_colors_with_editor_theme"];
+	return !use_editor_scale && !convert_editor_colors;
+}
+
 bool ResourceImporterTexture::are_import_settings_valid(const String &p_path) const {
 	Dictionary meta = ResourceFormatImporter::get_singleton()->get_resource_metadata(p_path);
 
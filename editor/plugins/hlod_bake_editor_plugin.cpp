@@ -0,0 +1,233 @@
+/**************************************************************************/
+/*  hlod_bake_editor_plugin.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hlod_bake_editor_plugin.h"
+
+#include "editor/editor_node.h"
+#include "editor/editor_string_names.h"
+#include "editor/editor_undo_redo_manager.h"
+#include "editor/plugins/node_3d_editor_plugin.h"
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/gui/box_container.h"
+#include "scene/gui/button.h"
+#include "scene/gui/dialogs.h"
+#include "scene/gui/spin_box.h"
+#include "scene/resources/importer_mesh.h"
+#include "scene/resources/surface_tool.h"
+
+void HLODBakeEditorPlugin::_find_instances(Node *p_node, Node *p_owner, LocalVector<MeshInstance3D *> &r_instances) const {
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node *child = p_node->get_child(i);
+		_find_instances(child, p_owner, r_instances);
+
+		MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(child);
+		if (!mi || mi->get_owner() != p_owner || !mi->is_visible_in_tree()) {
+			continue;
+		}
+		if (mi->get_mesh().is_null() || mi->get_skin().is_valid()) {
+			continue;
+		}
+		if (!mi->get_visibility_parent().is_empty() || mi->get_visibility_range_begin() > 0.0 || mi->get_visibility_range_end() > 0.0) {
+			continue; // Already part of a hand-made HLOD setup, leave it alone.
+		}
+		r_instances.push_back(mi);
+	}
+}
+
+void HLODBakeEditorPlugin::_bake() {
+	ERR_FAIL_NULL(root);
+
+	Node *owner = root->get_tree()->get_edited_scene_root();
+	Node *instance_owner = root == owner ? root : root->get_owner();
+
+	LocalVector<MeshInstance3D *> instances;
+	_find_instances(root, instance_owner, instances);
+
+	// Group instances by the grid cell their center falls in.
+	const real_t cell_size = cluster_size->get_value();
+	const Transform3D root_inv = root->get_global_transform().affine_inverse();
+	HashMap<Vector3i, LocalVector<MeshInstance3D *>> clusters;
+	for (MeshInstance3D *mi : instances) {
+		const Vector3 center = root_inv.xform(mi->get_global_transform().xform(mi->get_aabb().get_center()));
+		clusters[Vector3i((center / cell_size).floor())].push_back(mi);
+	}
+
+	EditorUndoRedoManager *ur = EditorUndoRedoManager::get_singleton();
+	ur->create_action(TTR("Bake HLOD"));
+
+	int proxy_count = 0;
+	int name_index = 0;
+	for (const KeyValue<Vector3i, LocalVector<MeshInstance3D *>> &E : clusters) {
+		if (E.value.size() < 2) {
+			continue; // Nothing to merge.
+		}
+
+		// One surface per material, so a cluster costs as many draws as it has distinct materials.
+		Vector<Ref<Material>> materials;
+		Vector<Ref<SurfaceTool>> tools;
+		for (MeshInstance3D *mi : E.value) {
+			const Ref<Mesh> mesh = mi->get_mesh();
+			const Transform3D xform = root_inv * mi->get_global_transform();
+			for (int i = 0; i < mesh->get_surface_count(); i++) {
+				if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES || mesh->surface_get_array_index_len(i) == 0) {
+					continue; // Can't be merged with indexed triangle surfaces.
+				}
+				if (mesh->surface_get_format(i) & (Mesh::ARRAY_FORMAT_BONES | Mesh::ARRAY_FORMAT_WEIGHTS)) {
+					continue;
+				}
+
+				const Ref<Material> material = mi->get_active_material(i);
+				int idx = materials.find(material);
+				if (idx == -1) {
+					idx = materials.size();
+					materials.push_back(material);
+					Ref<SurfaceTool> st;
+					st.instantiate();
+					tools.push_back(st);
+				}
+				tools.write[idx]->append_from(mesh, i, xform);
+			}
+		}
+
+		if (tools.is_empty()) {
+			continue;
+		}
+
+		Ref<ImporterMesh> importer_mesh;
+		importer_mesh.instantiate();
+		for (int i = 0; i < tools.size(); i++) {
+			importer_mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, tools[i]->commit_to_arrays(), Array(), Dictionary(), materials[i]);
+		}
+		// Simplified LODs let the proxy shrink further as it gets farther away.
+		importer_mesh->generate_lods(25, 60, Array());
+
+		// The name must be known now, as the source instances reference the proxy by path.
+		String proxy_name;
+		do {
+			proxy_name = vformat("HLOD%d", name_index++);
+		} while (root->has_node(NodePath(proxy_name)));
+
+		MeshInstance3D *proxy = memnew(MeshInstance3D);
+		proxy->set_name(proxy_name);
+		proxy->set_mesh(importer_mesh->get_mesh());
+		proxy->set_visibility_range_begin(switch_distance->get_value());
+		proxy->set_visibility_range_begin_margin(switch_margin->get_value());
+		proxy_count++;
+
+		ur->add_do_method(root, "add_child", proxy);
+		ur->add_do_method(proxy, "set_owner", owner);
+		ur->add_do_method(Node3DEditor::get_singleton(), SNAME("_request_gizmo"), proxy);
+		ur->add_do_reference(proxy);
+		ur->add_undo_method(root, "remove_child", proxy);
+
+		for (MeshInstance3D *mi : E.value) {
+			const NodePath proxy_path = NodePath(String(mi->get_path_to(root)) + "/" + proxy_name);
+			ur->add_do_method(mi, "set_visibility_parent", proxy_path);
+			ur->add_undo_method(mi, "set_visibility_parent", mi->get_visibility_parent());
+		}
+	}
+
+	if (proxy_count == 0) {
+		ur->commit_action(false);
+		err_dialog->set_text(TTR("No cluster with at least two static MeshInstance3Ds was found. Try increasing the cluster size."));
+		err_dialog->popup_centered();
+		return;
+	}
+
+	ur->commit_action();
+}
+
+void HLODBakeEditorPlugin::edit(Object *p_object) {
+	root = Object::cast_to<Node3D>(p_object);
+}
+
+bool HLODBakeEditorPlugin::handles(Object *p_object) const {
+	// Only plain Node3Ds, which is what static geometry is usually grouped under.
+	return p_object->get_class_name() == SNAME("Node3D");
+}
+
+void HLODBakeEditorPlugin::make_visible(bool p_visible) {
+	if (p_visible) {
+		bake->show();
+	} else {
+		bake->hide();
+		root = nullptr;
+	}
+}
+
+HLODBakeEditorPlugin::HLODBakeEditorPlugin() {
+	bake = memnew(Button);
+	bake->set_theme_type_variation("FlatButton");
+	bake->set_icon(EditorNode::get_singleton()->get_editor_theme()->get_icon(SNAME("Bake"), EditorStringName(EditorIcons)));
+	bake->set_text(TTR("Bake HLOD..."));
+	bake->set_tooltip_text(TTR("Merges nearby static MeshInstance3D children into cluster meshes that replace them at a distance, reducing draw calls."));
+	bake->hide();
+	add_control_to_container(CONTAINER_SPATIAL_EDITOR_MENU, bake);
+
+	bake_dialog = memnew(ConfirmationDialog);
+	bake_dialog->set_title(TTR("Bake HLOD"));
+	bake_dialog->set_ok_button_text(TTR("Bake"));
+	bake->add_child(bake_dialog);
+	bake->connect("pressed", callable_mp((Window *)bake_dialog, &Window::popup_centered).bind(Size2i()));
+	bake_dialog->connect("confirmed", callable_mp(this, &HLODBakeEditorPlugin::_bake));
+
+	VBoxContainer *vbc = memnew(VBoxContainer);
+	bake_dialog->add_child(vbc);
+
+	cluster_size = memnew(SpinBox);
+	cluster_size->set_min(1);
+	cluster_size->set_max(4096);
+	cluster_size->set_step(0.01);
+	cluster_size->set_value(64);
+	cluster_size->set_suffix("m");
+	cluster_size->set_allow_greater(true);
+	vbc->add_margin_child(TTR("Cluster Size:"), cluster_size);
+
+	switch_distance = memnew(SpinBox);
+	switch_distance->set_min(0.01);
+	switch_distance->set_max(16384);
+	switch_distance->set_step(0.01);
+	switch_distance->set_value(200);
+	switch_distance->set_suffix("m");
+	switch_distance->set_allow_greater(true);
+	vbc->add_margin_child(TTR("Switch Distance:"), switch_distance);
+
+	switch_margin = memnew(SpinBox);
+	switch_margin->set_min(0);
+	switch_margin->set_max(1024);
+	switch_margin->set_step(0.01);
+	switch_margin->set_value(10);
+	switch_margin->set_suffix("m");
+	switch_margin->set_allow_greater(true);
+	vbc->add_margin_child(TTR("Switch Margin:"), switch_margin);
+
+	err_dialog = memnew(AcceptDialog);
+	bake->add_child(err_dialog);
+}
@@ -0,0 +1,74 @@
+/**************************************************************************/
+/*  hlod_bake_editor_plugin.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef HLOD_BAKE_EDITOR_PLUGIN_H
+#define HLOD_BAKE_EDITOR_PLUGIN_H
+
+#include "editor/editor_plugin.h"
+#include "scene/3d/node_3d.h"
+
+class AcceptDialog;
+class Button;
+class ConfirmationDialog;
+class MeshInstance3D;
+class SpinBox;
+
+// Bakes hierarchical LOD proxies for the static meshes below a Node3D: nearby
+// MeshInstance3Ds are grouped in clusters, each cluster is merged in a single mesh
+// (one surface per material, with automatic LODs) and the source instances use it
+// as their visibility parent, so the whole cluster draws as one instance from afar.
+class HLODBakeEditorPlugin : public EditorPlugin {
+	GDCLASS(HLODBakeEditorPlugin, EditorPlugin);
+
+	Node3D *root = nullptr;
+
+	Button *bake = nullptr;
+
+	ConfirmationDialog *bake_dialog = nullptr;
+	SpinBox *cluster_size = nullptr;
+	SpinBox *switch_distance = nullptr;
+	SpinBox *switch_margin = nullptr;
+
+	AcceptDialog *err_dialog = nullptr;
+
+	void _find_instances(Node *p_node, Node *p_owner, LocalVector<MeshInstance3D *> &r_instances) const;
+	void _bake();
+
+public:
+	virtual String get_name() const override { return "HLODBake"; }
+	bool has_main_screen() const override { return false; }
+	virtual void edit(Object *p_object) override;
+	virtual bool handles(Object *p_object) const override;
+	virtual void make_visible(bool p_visible) override;
+
+	HLODBakeEditorPlugin();
+};
+
+#endif // HLOD_BAKE_EDITOR_PLUGIN_H
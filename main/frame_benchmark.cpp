@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*  frame_benchmark.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_benchmark.h"
+
+#include "core/config/engine.h"
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/memory.h"
+#include "core/os/os.h"
+#include "core/version.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "servers/rendering_server.h"
+
+static const char *metric_names[FrameBenchmark::METRIC_MAX] = {
+	"frame_msec",
+	"process_msec",
+	"physics_msec",
+	"render_cpu_msec",
+	"render_gpu_msec",
+	"draw_calls",
+	"objects",
+	"primitives",
+	"static_memory_bytes",
+	"video_memory_bytes",
+};
+
+bool FrameBenchmark::record_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_usec) {
+	frames_seen++;
+
+	SceneTree *tree = SceneTree::get_singleton();
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID viewport = tree && tree->get_root() ? tree->get_root()->get_viewport_rid() : RID();
+	if (!measuring_viewport && viewport.is_valid()) {
+		rs->viewport_set_measure_render_time(viewport, true);
+		measuring_viewport = true;
+	}
+
+	if (frames_seen <= warmup_frame_count) {
+		return false;
+	}
+
+	double render_cpu_msec = rs->get_frame_setup_time_cpu();
+	double render_gpu_msec = 0.0;
+	if (viewport.is_valid()) {
+		render_cpu_msec += rs->viewport_get_measured_render_time_cpu(viewport);
+		render_gpu_msec = rs->viewport_get_measured_render_time_gpu(viewport);
+	}
+
+	samples[METRIC_FRAME_TIME].push_back(p_frame_usec / 1000.0);
+	samples[METRIC_PROCESS_TIME].push_back(p_process_usec / 1000.0);
+	samples[METRIC_PHYSICS_TIME].push_back(p_physics_usec / 1000.0);
+	samples[METRIC_RENDER_CPU_TIME].push_back(render_cpu_msec);
+	samples[METRIC_RENDER_GPU_TIME].push_back(render_gpu_msec);
+	samples[METRIC_DRAW_CALLS].push_back(rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME));
+	samples[METRIC_OBJECTS].push_back(rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME));
+	samples[METRIC_PRIMITIVES].push_back(rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_PRIMITIVES_IN_FRAME));
+	samples[METRIC_STATIC_MEMORY].push_back(Memory::get_mem_usage());
+	samples[METRIC_VIDEO_MEMORY].push_back(rs->get_rendering_info(RS::RENDERING_INFO_VIDEO_MEM_USED));
+
+	return samples[METRIC_FRAME_TIME].size() >= frame_count;
+}
+
+Dictionary FrameBenchmark::_get_stats(LocalVector<double> &p_samples) {
+	Dictionary stats;
+	if (p_samples.is_empty()) {
+		return stats;
+	}
+
+	p_samples.sort();
+	double total = 0.0;
+	for (const double sample : p_samples) {
+		total += sample;
+	}
+
+	// Nearest-rank percentiles.
+	const uint32_t count = p_samples.size();
+	auto percentile = [&](double p_percent) {
+		uint32_t rank = (uint32_t)Math::ceil(p_percent / 100.0 * count);
+		return p_samples[CLAMP(rank, 1u, count) - 1];
+	};
+
+	stats["min"] = p_samples[0];
+	stats["max"] = p_samples[count - 1];
+	stats["avg"] = total / count;
+	stats["p50"] = percentile(50);
+	stats["p95"] = percentile(95);
+	stats["p99"] = percentile(99);
+	return stats;
+}
+
+Dictionary FrameBenchmark::get_report() {
+	Dictionary report;
+	report["scene"] = scene_path;
+	report["engine_version"] = VERSION_FULL_BUILD;
+	report["frames"] = samples[METRIC_FRAME_TIME].size();
+	report["warmup_frames"] = warmup_frame_count;
+	report["physics_ticks_per_second"] = Engine::get_singleton()->get_physics_ticks_per_second();
+	report["peak_static_memory_bytes"] = Memory::get_mem_max_usage();
+	for (int i = 0; i < METRIC_MAX; i++) {
+		report[metric_names[i]] = _get_stats(samples[i]);
+	}
+	return report;
+}
+
+Error FrameBenchmark::save_report() {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot write benchmark report to: " + output_path);
+	f->store_string(JSON::stringify(get_report(), "\t"));
+	print_line(vformat("Benchmark report for %d frames of %s saved to: %s", samples[METRIC_FRAME_TIME].size(), scene_path, output_path));
+	return OK;
+}
+
+FrameBenchmark::FrameBenchmark(const String &p_scene_path, uint32_t p_frame_count, uint32_t p_warmup_frame_count, const String &p_output_path) {
+	scene_path = p_scene_path;
+	frame_count = MAX(1u, p_frame_count);
+	warmup_frame_count = p_warmup_frame_count;
+	output_path = p_output_path;
+	for (int i = 0; i < METRIC_MAX; i++) {
+		samples[i].reserve(frame_count);
+	}
+}
@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*  frame_benchmark.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_BENCHMARK_H
+#define FRAME_BENCHMARK_H
+
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/dictionary.h"
+
+// Records per-frame timings and rendering statistics while running a scene for a fixed number of frames
+// (--benchmark-scene), then writes percentiles to a JSON report so CI can compare runs.
+class FrameBenchmark {
+public:
+	enum Metric {
+		METRIC_FRAME_TIME,
+		METRIC_PROCESS_TIME,
+		METRIC_PHYSICS_TIME,
+		METRIC_RENDER_CPU_TIME,
+		METRIC_RENDER_GPU_TIME,
+		METRIC_DRAW_CALLS,
+		METRIC_OBJECTS,
+		METRIC_PRIMITIVES,
+		METRIC_STATIC_MEMORY,
+		METRIC_VIDEO_MEMORY,
+		METRIC_MAX
+	};
+
+private:
+	String scene_path;
+	String output_path;
+	uint32_t frame_count = 0;
+	uint32_t warmup_frame_count = 0;
+
+	uint32_t frames_seen = 0;
+	bool measuring_viewport = false;
+	LocalVector<double> samples[METRIC_MAX];
+
+	static Dictionary _get_stats(LocalVector<double> &p_samples);
+
+public:
+	const String &get_scene_path() const { return scene_path; }
+
+	// Called at the end of every main loop iteration. Returns true once all measured frames were recorded.
+	bool record_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_usec);
+
+	Dictionary get_report();
+	Error save_report();
+
+	FrameBenchmark(const String &p_scene_path, uint32_t p_frame_count, uint32_t p_warmup_frame_count, const String &p_output_path);
+};
+
+#endif // FRAME_BENCHMARK_H
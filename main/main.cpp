@@ -35,6 +35,7 @@
 #include "core/core_string_names.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -54,6 +55,7 @@
 #include "core/version.h"
 #include "drivers/register_driver_types.h"
 #include "main/app_icon.gen.h"
+#include "main/frame_benchmark.h"
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
 #include "main/splash.gen.h"
@@ -193,6 +195,8 @@ static bool single_threaded_scene = false;
 static DisplayServer::WindowMode window_mode = DisplayServer::WINDOW_MODE_WINDOWED;
 static DisplayServer::ScreenOrientation window_orientation = DisplayServer::SCREEN_LANDSCAPE;
 static DisplayServer::VSyncMode window_vsync_mode = DisplayServer::VSYNC_ENABLED;
+static bool low_latency_mode = false;
+static uint64_t last_present_latency_usec = 0;
 static uint32_t window_flags = 0;
 static Size2i window_size = Size2i(1152, 648);
 
@@ -223,6 +227,12 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static String trace_file_path;
+static String benchmark_scene_path;
+static uint32_t benchmark_frames = 1000;
+static uint32_t benchmark_warmup_frames = 120;
+static String benchmark_output_path = "benchmark_report.json";
+static FrameBenchmark *frame_benchmark = nullptr;
 #ifdef TOOLS_ENABLED
 static bool dump_gdextension_interface = false;
 static bool dump_extension_api = false;
@@ -450,6 +460,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --text-driver <driver>            Text driver (Fonts, BiDi, shaping).\n");
 	OS::get_singleton()->print("  --tablet-driver <driver>          Pen tablet input driver.\n");
 	OS::get_singleton()->print("  --headless                        Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script.\n");
+	OS::get_singleton()->print("  --server-profile                  Enable headless mode, and skip visual instance, particle, and visual animation updates, as well as audio mixing. Useful for dedicated servers.\n");
 	OS::get_singleton()->print("  --write-movie <file>              Writes a video to the specified path (usually with .avi or .png extension).\n");
 	OS::get_singleton()->print("                                    --fixed-fps is forced when enabled, but it can be used to change movie FPS.\n");
 	OS::get_singleton()->print("                                    --disable-vsync can speed up movie writing but makes interaction more difficult.\n");
@@ -498,6 +509,13 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --fixed-fps <fps>                 Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	OS::get_singleton()->print("  --delta-smoothing <enable>        Enable or disable frame delta smoothing ['enable', 'disable'].\n");
 	OS::get_singleton()->print("  --print-fps                       Print the frames per second to the stdout.\n");
+	OS::get_singleton()->print("  --trace <file>                    Record a timeline of engine zones on all threads to a Chrome/Perfetto JSON trace file.\n");
+	OS::get_singleton()->print("  --benchmark                       Benchmark the run time and print it to console.\n");
+	OS::get_singleton()->print("  --benchmark-file <path>           Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n");
+	OS::get_singleton()->print("  --benchmark-scene <path>          Run a scene with a fixed timestep and write frame time percentiles, rendering statistics and memory usage to a JSON report.\n");
+	OS::get_singleton()->print("  --frames <count>                  Number of frames measured by --benchmark-scene (default: 1000).\n");
+	OS::get_singleton()->print("  --warmup-frames <count>           Number of frames run by --benchmark-scene before measuring (default: 120).\n");
+	OS::get_singleton()->print("  --output <path>                   Path of the --benchmark-scene report (default: benchmark_report.json).\n");
 	OS::get_singleton()->print("\n");
 
 	OS::get_singleton()->print("Standalone tools:\n");
@@ -526,8 +544,6 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --dump-extension-api              Generate JSON dump of the Godot API for GDExtension bindings named 'extension_api.json' in the current folder.\n");
 	OS::get_singleton()->print("  --dump-extension-api-with-docs    Generate JSON dump of the Godot API like the previous option, but including documentation.\n");
 	OS::get_singleton()->print("  --validate-extension-api <path>   Validate an extension API file dumped (with one of the two previous options) from a previous version of the engine to ensure API compatibility. If incompatibilities or errors are detected, the return code will be non zero.\n");
-	OS::get_singleton()->print("  --benchmark                       Benchmark the run time and print it to console.\n");
-	OS::get_singleton()->print("  --benchmark-file <path>           Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n");
 #ifdef TESTS_ENABLED
 	OS::get_singleton()->print("  --test [--help]                   Run unit tests. Use --test --help for more information.\n");
 #endif
@@ -1163,6 +1179,12 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			audio_driver = NULL_AUDIO_DRIVER;
 			display_driver = NULL_DISPLAY_DRIVER;
 
+		} else if (I->get() == "--server-profile") { // headless, and skip work that only affects rendering/audio output.
+
+			audio_driver = NULL_AUDIO_DRIVER;
+			display_driver = NULL_DISPLAY_DRIVER;
+			Engine::get_singleton()->set_server_profile_enabled(true);
+
 		} else if (I->get() == "--profiling") { // enable profiling
 
 			use_debug_profiler = true;
@@ -1509,6 +1531,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (I->get() == "--print-fps") {
 			print_fps = true;
+		} else if (I->get() == "--trace") {
+			if (I->next()) {
+				trace_file_path = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing trace file argument, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--profile-gpu") {
 			profile_gpu = true;
 		} else if (I->get() == "--disable-crash-handler") {
@@ -1546,6 +1576,43 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				OS::get_singleton()->print("Missing <path> argument for --benchmark-file <path>.\n");
 				goto error;
 			}
+		} else if (I->get() == "--benchmark-scene") {
+			if (I->next()) {
+				benchmark_scene_path = I->next()->get();
+				// Run with a fixed timestep as fast as possible, so that every run simulates the same frames.
+				if (fixed_fps == -1) {
+					fixed_fps = 60;
+				}
+				disable_vsync = true;
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --benchmark-scene <path>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--frames") {
+			if (I->next()) {
+				benchmark_frames = I->next()->get().to_int();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <count> argument for --frames <count>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--warmup-frames") {
+			if (I->next()) {
+				benchmark_warmup_frames = I->next()->get().to_int();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <count> argument for --warmup-frames <count>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--output") {
+			if (I->next()) {
+				benchmark_output_path = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --output <path>.\n");
+				goto error;
+			}
 #if defined(TOOLS_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED) && !defined(GDSCRIPT_NO_LSP)
 		} else if (I->get() == "--lsp-port") {
 			if (I->next()) {
@@ -1629,6 +1696,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	if (editor) {
 		Engine::get_singleton()->set_editor_hint(true);
 		Engine::get_singleton()->set_extension_reloading_enabled(true);
+		Engine::get_singleton()->set_server_profile_enabled(false);
 	}
 #endif
 
@@ -2078,6 +2146,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		if (disable_vsync) {
 			window_vsync_mode = DisplayServer::VSyncMode::VSYNC_DISABLED;
 		}
+		low_latency_mode = GLOBAL_DEF("display/window/vsync/low_latency_mode", false);
 	}
 	Engine::get_singleton()->set_physics_ticks_per_second(GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "physics/common/physics_ticks_per_second", PROPERTY_HINT_RANGE, "1,1000,1"), 60));
 	Engine::get_singleton()->set_max_physics_steps_per_frame(GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "physics/common/max_physics_steps_per_frame", PROPERTY_HINT_RANGE, "1,100,1"), 8));
@@ -2090,6 +2159,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GLOBAL_DEF("debug/settings/stdout/print_fps", false);
 	GLOBAL_DEF("debug/settings/stdout/print_gpu_profile", false);
 	GLOBAL_DEF("debug/settings/stdout/verbose_stdout", false);
+	GLOBAL_DEF("debug/settings/performance/statsd_server", "");
+	GLOBAL_DEF("debug/settings/performance/statsd_prefix", "godot");
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/settings/performance/statsd_interval", PROPERTY_HINT_RANGE, "0.1,60,0.1,or_greater,suffix:s"), 10.0);
 
 	if (!OS::get_singleton()->_verbose_stdout) { // Not manually overridden.
 		OS::get_singleton()->_verbose_stdout = GLOBAL_GET("debug/settings/stdout/verbose_stdout");
@@ -2262,9 +2334,11 @@ Error Main::setup2() {
 	physics_server_3d_manager = memnew(PhysicsServer3DManager);
 	physics_server_2d_manager = memnew(PhysicsServer2DManager);
 
+	OS::get_singleton()->benchmark_begin_measure("register_server_types");
 	register_server_types();
 	initialize_modules(MODULE_INITIALIZATION_LEVEL_SERVERS);
 	GDExtensionManager::get_singleton()->initialize_extensions(GDExtension::INITIALIZATION_LEVEL_SERVERS);
+	OS::get_singleton()->benchmark_end_measure("register_server_types");
 
 #ifdef TOOLS_ENABLED
 	if (editor || project_manager || cmdline_tool) {
@@ -2429,9 +2503,11 @@ Error Main::setup2() {
 
 	/* Initialize Rendering Server */
 
+	OS::get_singleton()->benchmark_begin_measure("rendering_server");
 	rendering_server = memnew(RenderingServerDefault(OS::get_singleton()->get_render_thread_mode() == OS::RENDER_SEPARATE_THREAD));
 
 	rendering_server->init();
+	OS::get_singleton()->benchmark_end_measure("rendering_server");
 	//rendering_server->call_set_use_vsync(OS::get_singleton()->_use_vsync);
 	rendering_server->set_render_loop_enabled(!disable_render_loop);
 
@@ -2458,6 +2534,7 @@ Error Main::setup2() {
 
 	/* Initialize Audio Driver */
 
+	OS::get_singleton()->benchmark_begin_measure("audio_server");
 	AudioDriverManager::initialize(audio_driver_idx);
 
 	print_line(" "); //add a blank line for readability
@@ -2466,6 +2543,7 @@ Error Main::setup2() {
 
 	audio_server = memnew(AudioServer);
 	audio_server->init();
+	OS::get_singleton()->benchmark_end_measure("audio_server");
 
 	// also init our xr_server from here
 	xr_server = memnew(XRServer);
@@ -2584,6 +2662,7 @@ Error Main::setup2() {
 
 	MAIN_PRINT("Main: Load Translations and Remaps");
 
+	OS::get_singleton()->benchmark_begin_measure("translations");
 	translation_server->setup(); //register translations, load them, etc.
 	if (!locale.is_empty()) {
 		translation_server->set_locale(locale);
@@ -2592,9 +2671,12 @@ Error Main::setup2() {
 	ResourceLoader::load_translation_remaps(); //load remaps for resources
 
 	ResourceLoader::load_path_remaps();
+	OS::get_singleton()->benchmark_end_measure("translations");
 
 	MAIN_PRINT("Main: Load TextServer");
 
+	OS::get_singleton()->benchmark_begin_measure("text_server");
+
 	/* Enum text drivers */
 	GLOBAL_DEF_RST("internationalization/rendering/text_driver", "");
 	String text_driver_options;
@@ -2652,6 +2734,7 @@ Error Main::setup2() {
 	} else {
 		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "TextServer: Unable to create TextServer interface.");
 	}
+	OS::get_singleton()->benchmark_end_measure("text_server");
 
 	OS::get_singleton()->benchmark_end_measure("servers");
 
@@ -2663,6 +2746,7 @@ Error Main::setup2() {
 	// Default theme will be initialized later, after modules and ScriptServer are ready.
 	initialize_theme_db();
 
+	OS::get_singleton()->benchmark_begin_measure("register_scene_types");
 	register_scene_types();
 	register_driver_types();
 
@@ -2670,6 +2754,7 @@ Error Main::setup2() {
 
 	initialize_modules(MODULE_INITIALIZATION_LEVEL_SCENE);
 	GDExtensionManager::get_singleton()->initialize_extensions(GDExtension::INITIALIZATION_LEVEL_SCENE);
+	OS::get_singleton()->benchmark_end_measure("register_scene_types");
 
 #ifdef TOOLS_ENABLED
 	ClassDB::set_current_api(ClassDB::API_EDITOR);
@@ -2702,14 +2787,22 @@ Error Main::setup2() {
 
 	MAIN_PRINT("Main: Load Physics");
 
+	OS::get_singleton()->benchmark_begin_measure("physics_server");
 	initialize_physics();
+	OS::get_singleton()->benchmark_end_measure("physics_server");
+	OS::get_singleton()->benchmark_begin_measure("navigation_server");
 	initialize_navigation_server();
+	OS::get_singleton()->benchmark_end_measure("navigation_server");
 	register_server_singletons();
 
 	// This loads global classes, so it must happen before custom loaders and savers are registered
+	OS::get_singleton()->benchmark_begin_measure("script_languages");
 	ScriptServer::init_languages();
+	OS::get_singleton()->benchmark_end_measure("script_languages");
 
+	OS::get_singleton()->benchmark_begin_measure("default_theme");
 	theme_db->initialize_theme();
+	OS::get_singleton()->benchmark_end_measure("default_theme");
 	audio_server->load_default_bus_layout();
 
 #if defined(MODULE_MONO_ENABLED) && defined(TOOLS_ENABLED)
@@ -2758,6 +2851,10 @@ static MainTimerSync main_timer_sync;
 bool Main::start() {
 	ERR_FAIL_COND_V(!_start_success, false);
 
+	if (!trace_file_path.is_empty()) {
+		EngineTracer::start_file_capture(trace_file_path);
+	}
+
 	bool has_icon = false;
 	String positional_arg;
 	String game_path;
@@ -3004,6 +3101,11 @@ bool Main::start() {
 
 #endif // TOOLS_ENABLED
 
+	if (!benchmark_scene_path.is_empty() && !editor && !project_manager) {
+		game_path = benchmark_scene_path;
+		frame_benchmark = memnew(FrameBenchmark(benchmark_scene_path, benchmark_frames, benchmark_warmup_frames, benchmark_output_path));
+	}
+
 	if (script.is_empty() && game_path.is_empty() && String(GLOBAL_GET("application/run/main_scene")) != "") {
 		game_path = GLOBAL_GET("application/run/main_scene");
 	}
@@ -3516,6 +3618,8 @@ bool Main::iteration() {
 
 	iterating++;
 
+	ENGINE_TRACE_ZONE("Main::iteration");
+
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -3566,11 +3670,15 @@ bool Main::iteration() {
 
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
 
-		PhysicsServer3D::get_singleton()->sync();
-		PhysicsServer3D::get_singleton()->flush_queries();
+		{
+			MEMORY_TAG_SCOPE(TAG_PHYSICS);
 
-		PhysicsServer2D::get_singleton()->sync();
-		PhysicsServer2D::get_singleton()->flush_queries();
+			PhysicsServer3D::get_singleton()->sync();
+			PhysicsServer3D::get_singleton()->flush_queries();
+
+			PhysicsServer2D::get_singleton()->sync();
+			PhysicsServer2D::get_singleton()->flush_queries();
+		}
 
 		if (OS::get_singleton()->get_main_loop()->physics_process(physics_step * time_scale)) {
 			PhysicsServer3D::get_singleton()->end_sync();
@@ -3582,18 +3690,25 @@ bool Main::iteration() {
 
 		uint64_t navigation_begin = OS::get_singleton()->get_ticks_usec();
 
-		NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		{
+			MEMORY_TAG_SCOPE(TAG_NAVIGATION);
+			NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		}
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
 
 		message_queue->flush();
 
-		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+		{
+			MEMORY_TAG_SCOPE(TAG_PHYSICS);
+
+			PhysicsServer3D::get_singleton()->end_sync();
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
 
-		PhysicsServer2D::get_singleton()->end_sync();
-		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer2D::get_singleton()->end_sync();
+			PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		}
 
 		message_queue->flush();
 
@@ -3645,6 +3760,8 @@ bool Main::iteration() {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
 	}
 
+	performance->process_frame(USEC_TO_SEC(process_ticks), USEC_TO_SEC(physics_process_ticks), USEC_TO_SEC(navigation_process_ticks));
+
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
@@ -3656,7 +3773,11 @@ bool Main::iteration() {
 					print_line(vformat("Editor FPS: %d (%s mspf)", frames, rtos(1000.0 / frames).pad_decimals(2)));
 				}
 			} else if (print_fps || GLOBAL_GET("debug/settings/stdout/print_fps")) {
-				print_line(vformat("Project FPS: %d (%s mspf)", frames, rtos(1000.0 / frames).pad_decimals(2)));
+				if (last_present_latency_usec > 0) {
+					print_line(vformat("Project FPS: %d (%s mspf, %s ms present latency)", frames, rtos(1000.0 / frames).pad_decimals(2), rtos(last_present_latency_usec / 1000.0).pad_decimals(2)));
+				} else {
+					print_line(vformat("Project FPS: %d (%s mspf)", frames, rtos(1000.0 / frames).pad_decimals(2)));
+				}
 			}
 		} else {
 			hide_print_fps_attempts--;
@@ -3685,6 +3806,17 @@ bool Main::iteration() {
 		movie_writer->add_frame();
 	}
 
+	if (frame_benchmark && frame_benchmark->record_frame(frame_time, process_ticks, physics_process_ticks)) {
+		if (frame_benchmark->save_report() != OK) {
+			OS::get_singleton()->set_exit_code(EXIT_FAILURE);
+		}
+		memdelete(frame_benchmark);
+		frame_benchmark = nullptr;
+		exit = true;
+	}
+
+	EngineTracer::flush_file_capture();
+
 	if ((quit_after > 0) && (Engine::get_singleton()->_process_frames >= quit_after)) {
 		exit = true;
 	}
@@ -3693,6 +3825,19 @@ bool Main::iteration() {
 		return exit;
 	}
 
+	if (low_latency_mode && window_vsync_mode != DisplayServer::VSYNC_DISABLED) {
+		// Wait for the frame to be displayed, then delay the start of the next one so it is
+		// done just in time for the following refresh instead of queuing up behind it.
+		const uint64_t frame_work_usec = OS::get_singleton()->get_ticks_usec() - ticks;
+		last_present_latency_usec = RenderingServer::get_singleton()->wait_for_frame_present(100000);
+		if (last_present_latency_usec > 0) {
+			const uint64_t delay_usec = main_timer_sync.get_low_latency_frame_delay(OS::get_singleton()->get_ticks_usec(), frame_work_usec);
+			if (delay_usec > 0) {
+				OS::get_singleton()->delay_usec(delay_usec);
+			}
+		}
+	}
+
 	OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw());
 
 #ifdef TOOLS_ENABLED
@@ -3739,6 +3884,13 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	EngineTracer::stop_file_capture();
+
+	if (frame_benchmark) {
+		memdelete(frame_benchmark); // Quit before all frames were measured, no report.
+		frame_benchmark = nullptr;
+	}
+
 	ResourceLoader::clear_thread_load_tasks();
 
 	ResourceLoader::remove_custom_loaders();
@@ -295,6 +295,44 @@ int64_t MainTimerSync::DeltaSmoother::smooth_delta(int64_t p_delta) {
 
 /////////////////////////////////////
 
+int64_t MainTimerSync::LatencyPacer::get_frame_start_delay(int64_t p_present_time, int64_t p_frame_work) {
+	const int64_t interval = p_present_time - _last_present_time;
+	_last_present_time = p_present_time;
+
+	// Ignore long intervals (first frame, window hidden, loading) rather than treating them as missed refreshes.
+	if (interval <= 0 || interval > 1000000) {
+		_delay = 0;
+		return 0;
+	}
+
+	_measured_refresh_interval = MIN(_measured_refresh_interval, interval);
+	if (++_measurement_frames >= MEASURE_REFRESH_OVER_NUM_FRAMES || _refresh_interval == 0) {
+		// Restart the measurement regularly so refresh rate changes are followed.
+		_refresh_interval = _measured_refresh_interval;
+		_measured_refresh_interval = INT64_MAX;
+		_measurement_frames = 0;
+	}
+
+	if (interval > _refresh_interval * 3 / 2) {
+		// The frame missed its refresh: back off quickly and remember where it happened.
+		_missed_delay = _delay;
+		_delay = _delay * 3 / 4;
+	} else {
+		// Probe later starts, slowly when getting close to the delay that missed last time.
+		const int64_t step = _delay + 500 < _missed_delay ? 250 : 10;
+		_delay += step;
+		if (_missed_delay < INT64_MAX) {
+			_missed_delay += 1; // Re-probe eventually, conditions may have improved.
+		}
+	}
+
+	// Never wait past the point where the frame can no longer be produced in time.
+	_delay = CLAMP(_delay, (int64_t)0, MAX((int64_t)0, _refresh_interval - p_frame_work - SAFETY_MARGIN));
+	return _delay;
+}
+
+/////////////////////////////////////
+
 // returns the fraction of p_physics_step required for the timer to overshoot
 // before advance_core considers changing the physics_steps return from
 // the typical values as defined by typical_physics_steps
@@ -523,3 +561,7 @@ MainFrameTime MainTimerSync::advance(double p_physics_step, int p_physics_ticks_
 
 	return advance_checked(p_physics_step, p_physics_ticks_per_second, cpu_process_step);
 }
+
+uint64_t MainTimerSync::get_low_latency_frame_delay(uint64_t p_present_ticks_usec, uint64_t p_frame_work_usec) {
+	return _latency_pacer.get_frame_start_delay(p_present_ticks_usec, p_frame_work_usec);
+}
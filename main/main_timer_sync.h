@@ -105,6 +105,32 @@ class MainTimerSync {
 
 	} _delta_smoother;
 
+	// Low latency mode: starts frames as late as possible after the previous frame
+	// reached the display, while still making it to the next refresh.
+	class LatencyPacer {
+	public:
+		// pass the time the last frame was displayed and the time the frame took to produce,
+		// returns how long to wait before starting the next frame
+		int64_t get_frame_start_delay(int64_t p_present_time, int64_t p_frame_work);
+
+		int64_t get_delay() const { return _delay; }
+
+	private:
+		// measure the refresh interval as the shortest interval between presents over this many frames
+		static const int MEASURE_REFRESH_OVER_NUM_FRAMES = 120;
+		// always keep this much time spare before the refresh
+		static const int64_t SAFETY_MARGIN = 1000;
+
+		int64_t _last_present_time = 0;
+		int64_t _refresh_interval = 0;
+		int64_t _measured_refresh_interval = INT64_MAX;
+		int32_t _measurement_frames = 0;
+
+		// current delay, and the delay at which the last refresh was missed
+		int64_t _delay = 0;
+		int64_t _missed_delay = INT64_MAX;
+	} _latency_pacer;
+
 	// wall clock time measured on the main thread
 	uint64_t last_cpu_ticks_usec = 0;
 	uint64_t current_cpu_ticks_usec = 0;
@@ -160,6 +186,9 @@ public:
 
 	// advance one frame, return timesteps to take
 	MainFrameTime advance(double p_physics_step, int p_physics_ticks_per_second);
+
+	// pass the time the last frame was displayed in low latency mode, returns how long to wait before starting the next frame
+	uint64_t get_low_latency_frame_delay(uint64_t p_present_ticks_usec, uint64_t p_frame_work_usec);
 };
 
 #endif // MAIN_TIMER_SYNC_H
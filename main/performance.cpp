@@ -30,6 +30,8 @@
 
 #include "performance.h"
 
+#include "core/config/project_settings.h"
+#include "core/io/ip.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
@@ -51,6 +53,18 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_custom_monitor", "id"), &Performance::get_custom_monitor);
 	ClassDB::bind_method(D_METHOD("get_monitor_modification_time"), &Performance::get_monitor_modification_time);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
+	ClassDB::bind_method(D_METHOD("set_object_allocation_tracking_enabled", "enabled"), &Performance::set_object_allocation_tracking_enabled);
+	ClassDB::bind_method(D_METHOD("is_object_allocation_tracking_enabled"), &Performance::is_object_allocation_tracking_enabled);
+	ClassDB::bind_method(D_METHOD("get_object_count_by_class"), &Performance::get_object_count_by_class);
+	ClassDB::bind_method(D_METHOD("get_object_allocation_sites", "class"), &Performance::get_object_allocation_sites, DEFVAL(StringName()));
+	ClassDB::bind_method(D_METHOD("set_monitor_history_size", "id", "frames"), &Performance::set_monitor_history_size);
+	ClassDB::bind_method(D_METHOD("get_monitor_history_size", "id"), &Performance::get_monitor_history_size);
+	ClassDB::bind_method(D_METHOD("get_monitor_percentile", "id", "percentile"), &Performance::get_monitor_percentile);
+	ClassDB::bind_method(D_METHOD("set_monitor_budget", "id", "limit", "percentile"), &Performance::set_monitor_budget, DEFVAL(99.0));
+	ClassDB::bind_method(D_METHOD("get_monitor_budget", "id"), &Performance::get_monitor_budget);
+	ClassDB::bind_method(D_METHOD("get_metrics_as_statsd", "prefix"), &Performance::get_metrics_as_statsd, DEFVAL("godot"));
+
+	ADD_SIGNAL(MethodInfo("monitor_budget_exceeded", PropertyInfo(Variant::STRING_NAME, "id"), PropertyInfo(Variant::FLOAT, "value"), PropertyInfo(Variant::FLOAT, "limit")));
 
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
@@ -85,6 +99,19 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_SYNC_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_AVOIDANCE_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_EXPANDED_POLYGONS);
+	BIND_ENUM_CONSTANT(AUDIO_MIX_TIME);
+	BIND_ENUM_CONSTANT(AUDIO_ACTIVE_VOICES);
+	BIND_ENUM_CONSTANT(AUDIO_VIRTUAL_VOICES);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_NAVIGATION);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_TEXT);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCE_LOADING);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -133,6 +160,19 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"navigation/edges_merged",
 		"navigation/edges_connected",
 		"navigation/edges_free",
+		"navigation/sync",
+		"navigation/avoidance",
+		"navigation/path_queries",
+		"navigation/path_query_time",
+		"navigation/path_query_expanded_polygons",
+		"audio/mix_time",
+		"audio/active_voices",
+		"audio/virtual_voices",
+		"memory/physics",
+		"memory/navigation",
+		"memory/script",
+		"memory/text",
+		"memory/resource_loading",
 
 	};
 
@@ -207,6 +247,32 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case NAVIGATION_SYNC_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_SYNC_TIME_USEC));
+		case NAVIGATION_AVOIDANCE_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_AVOIDANCE_TIME_USEC));
+		case NAVIGATION_PATH_QUERY_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT);
+		case NAVIGATION_PATH_QUERY_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_TIME_USEC));
+		case NAVIGATION_PATH_QUERY_EXPANDED_POLYGONS:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_EXPANDED_POLYGON_AVERAGE);
+		case AUDIO_MIX_TIME:
+			return USEC_TO_SEC(AudioServer::get_singleton()->get_mix_step_time_usec());
+		case AUDIO_ACTIVE_VOICES:
+			return AudioServer::get_singleton()->get_active_voice_count();
+		case AUDIO_VIRTUAL_VOICES:
+			return AudioServer::get_singleton()->get_virtual_voice_count();
+		case MEMORY_PHYSICS:
+			return Memory::get_mem_usage_for_tag(Memory::TAG_PHYSICS);
+		case MEMORY_NAVIGATION:
+			return Memory::get_mem_usage_for_tag(Memory::TAG_NAVIGATION);
+		case MEMORY_SCRIPT:
+			return Memory::get_mem_usage_for_tag(Memory::TAG_SCRIPT);
+		case MEMORY_TEXT:
+			return Memory::get_mem_usage_for_tag(Memory::TAG_TEXT);
+		case MEMORY_RESOURCE_LOADING:
+			return Memory::get_mem_usage_for_tag(Memory::TAG_RESOURCE_LOADING);
 
 		default: {
 		}
@@ -252,6 +318,19 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -313,6 +392,248 @@ uint64_t Performance::get_monitor_modification_time() {
 	return _monitor_modification_time;
 }
 
+void Performance::set_object_allocation_tracking_enabled(bool p_enabled) {
+	ObjectDB::set_allocation_tracking_enabled(p_enabled);
+}
+
+bool Performance::is_object_allocation_tracking_enabled() const {
+	return ObjectDB::is_allocation_tracking_enabled();
+}
+
+Dictionary Performance::get_object_count_by_class() const {
+	HashMap<StringName, int> counts;
+	ObjectDB::get_class_counts(counts);
+
+	Dictionary ret;
+	for (const KeyValue<StringName, int> &E : counts) {
+		ret[E.key] = E.value;
+	}
+	return ret;
+}
+
+Dictionary Performance::get_object_allocation_sites(const StringName &p_class) const {
+	LocalVector<ObjectDB::AllocationInfo> allocations;
+	ObjectDB::get_allocations(allocations);
+
+	Dictionary ret;
+	for (const ObjectDB::AllocationInfo &info : allocations) {
+		if (p_class != StringName() && info.class_name != p_class) {
+			continue;
+		}
+		const String site = info.site.is_empty() ? String("<native>") : info.site;
+		ret[site] = int(ret.get(site, 0)) + 1;
+	}
+	return ret;
+}
+
+void Performance::MonitorHistory::add_sample(double p_value) {
+	samples[next_sample] = p_value;
+	next_sample = (next_sample + 1) % samples.size();
+	sample_count = MIN(sample_count + 1, samples.size());
+}
+
+double Performance::MonitorHistory::get_percentile(double p_percentile) const {
+	if (sample_count == 0) {
+		return 0.0;
+	}
+	LocalVector<double> sorted;
+	sorted.resize(sample_count);
+	for (uint32_t i = 0; i < sample_count; i++) {
+		sorted[i] = samples[i];
+	}
+	sorted.sort();
+	uint32_t index = uint32_t(CLAMP(Math::ceil(p_percentile / 100.0 * sample_count) - 1.0, 0.0, double(sample_count - 1)));
+	return sorted[index];
+}
+
+bool Performance::_get_monitor_sample(const StringName &p_id, double &r_value) {
+	if (_monitor_ids.is_empty()) {
+		for (int i = 0; i < MONITOR_MAX; i++) {
+			_monitor_ids.insert(get_monitor_name(Monitor(i)), i);
+		}
+	}
+
+	HashMap<StringName, int>::Iterator E = _monitor_ids.find(p_id);
+	if (E) {
+		// The time monitors only report the worst frame of the last second, sample the frame itself instead.
+		switch (E->value) {
+			case TIME_PROCESS:
+				r_value = _frame_process_time;
+				break;
+			case TIME_PHYSICS_PROCESS:
+				r_value = _frame_physics_process_time;
+				break;
+			case TIME_NAVIGATION_PROCESS:
+				r_value = _frame_navigation_process_time;
+				break;
+			default:
+				r_value = get_monitor(Monitor(E->value));
+		}
+		return true;
+	}
+
+	if (!_monitor_map.has(p_id)) {
+		return false;
+	}
+	bool error;
+	String error_message;
+	Variant value = _monitor_map[p_id].call(error, error_message);
+	if (error || (value.get_type() != Variant::INT && value.get_type() != Variant::FLOAT)) {
+		return false;
+	}
+	r_value = value;
+	return true;
+}
+
+void Performance::set_monitor_history_size(const StringName &p_id, int p_frames) {
+	ERR_FAIL_COND(p_frames < 0);
+	if (p_frames == 0) {
+		_monitor_histories.erase(p_id);
+		return;
+	}
+	MonitorHistory &history = _monitor_histories[p_id];
+	if (history.samples.size() != uint32_t(p_frames)) {
+		history.samples.resize(p_frames);
+		history.next_sample = 0;
+		history.sample_count = 0;
+	}
+}
+
+int Performance::get_monitor_history_size(const StringName &p_id) const {
+	HashMap<StringName, MonitorHistory>::ConstIterator E = _monitor_histories.find(p_id);
+	return E ? int(E->value.samples.size()) : 0;
+}
+
+double Performance::get_monitor_percentile(const StringName &p_id, double p_percentile) const {
+	ERR_FAIL_COND_V(p_percentile < 0.0 || p_percentile > 100.0, 0.0);
+	HashMap<StringName, MonitorHistory>::ConstIterator E = _monitor_histories.find(p_id);
+	ERR_FAIL_COND_V_MSG(!E, 0.0, "No history is kept for monitor '" + String(p_id) + "', call set_monitor_history_size() first.");
+	return E->value.get_percentile(p_percentile);
+}
+
+void Performance::set_monitor_budget(const StringName &p_id, double p_limit, double p_percentile) {
+	ERR_FAIL_COND(p_percentile < 0.0 || p_percentile > 100.0);
+	if (p_limit <= 0.0) {
+		if (_monitor_histories.has(p_id)) {
+			_monitor_histories[p_id].budget = 0.0;
+		}
+		return;
+	}
+	if (!_monitor_histories.has(p_id)) {
+		set_monitor_history_size(p_id, 300);
+	}
+	MonitorHistory &history = _monitor_histories[p_id];
+	history.budget = p_limit;
+	history.budget_percentile = p_percentile;
+	history.over_budget = false;
+}
+
+double Performance::get_monitor_budget(const StringName &p_id) const {
+	HashMap<StringName, MonitorHistory>::ConstIterator E = _monitor_histories.find(p_id);
+	return E ? E->value.budget : 0.0;
+}
+
+void Performance::_check_budgets() {
+	for (KeyValue<StringName, MonitorHistory> &E : _monitor_histories) {
+		MonitorHistory &history = E.value;
+		if (history.budget <= 0.0) {
+			continue;
+		}
+		const double value = history.get_percentile(history.budget_percentile);
+		const bool over_budget = value > history.budget;
+		if (over_budget && !history.over_budget) {
+			// Only alert when crossing the budget, not every check it stays over.
+			WARN_PRINT(vformat("Performance monitor '%s' is over budget: p%s is %s, budget is %s.", E.key, rtos(history.budget_percentile), rtos(value), rtos(history.budget)));
+			emit_signal(SNAME("monitor_budget_exceeded"), E.key, value, history.budget);
+		}
+		history.over_budget = over_budget;
+	}
+}
+
+String Performance::get_metrics_as_statsd(const String &p_prefix) {
+	String metrics;
+	const String prefix = p_prefix.is_empty() ? String() : p_prefix + ".";
+	for (int i = 0; i < MONITOR_MAX; i++) {
+		metrics += vformat("%s%s:%s|g\n", prefix, get_monitor_name(Monitor(i)).replace("/", "."), rtos(get_monitor(Monitor(i))));
+	}
+	for (const KeyValue<StringName, MonitorCall> &E : _monitor_map) {
+		double value;
+		if (_get_monitor_sample(E.key, value)) {
+			metrics += vformat("%s%s:%s|g\n", prefix, String(E.key).replace("/", "."), rtos(value));
+		}
+	}
+	for (const KeyValue<StringName, MonitorHistory> &E : _monitor_histories) {
+		const String name = prefix + String(E.key).replace("/", ".");
+		metrics += vformat("%s.p50:%s|g\n", name, rtos(E.value.get_percentile(50.0)));
+		metrics += vformat("%s.p95:%s|g\n", name, rtos(E.value.get_percentile(95.0)));
+		metrics += vformat("%s.p99:%s|g\n", name, rtos(E.value.get_percentile(99.0)));
+	}
+	return metrics;
+}
+
+void Performance::_send_statsd() {
+	// Keep datagrams below the common 1432 bytes limit, splitting at line boundaries.
+	const Vector<String> lines = get_metrics_as_statsd(_statsd_prefix).split("\n", false);
+	String packet;
+	for (const String &line : lines) {
+		if (!packet.is_empty() && packet.length() + line.length() + 1 > 1432) {
+			CharString utf8 = packet.utf8();
+			_statsd_peer->put_packet((const uint8_t *)utf8.get_data(), utf8.length());
+			packet = String();
+		}
+		packet += line + "\n";
+	}
+	if (!packet.is_empty()) {
+		CharString utf8 = packet.utf8();
+		_statsd_peer->put_packet((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+}
+
+void Performance::process_frame(double p_process_time, double p_physics_process_time, double p_navigation_process_time) {
+	_frame_process_time = p_process_time;
+	_frame_physics_process_time = p_physics_process_time;
+	_frame_navigation_process_time = p_navigation_process_time;
+
+	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+
+	if (!_monitor_histories.is_empty()) {
+		for (KeyValue<StringName, MonitorHistory> &E : _monitor_histories) {
+			double value;
+			if (_get_monitor_sample(E.key, value)) {
+				E.value.add_sample(value);
+			}
+		}
+		if (ticks - _last_budget_check >= 1000000) {
+			_last_budget_check = ticks;
+			_check_budgets();
+		}
+	}
+
+	if (unlikely(!_statsd_initialized)) {
+		_statsd_initialized = true;
+		const String server = GLOBAL_GET("debug/settings/performance/statsd_server");
+		if (!server.is_empty()) {
+			const String host = server.get_slice(":", 0);
+			const int port = server.get_slice_count(":") > 1 ? server.get_slice(":", 1).to_int() : 8125;
+			const IPAddress address = host.is_valid_ip_address() ? IPAddress(host) : IP::get_singleton()->resolve_hostname(host);
+			if (address.is_valid()) {
+				_statsd_peer.instantiate();
+				_statsd_peer->connect_to_host(address, port);
+				_statsd_prefix = GLOBAL_GET("debug/settings/performance/statsd_prefix");
+				_statsd_interval_usec = uint64_t(double(GLOBAL_GET("debug/settings/performance/statsd_interval")) * 1000000.0);
+				_last_statsd_send = ticks;
+			} else {
+				ERR_PRINT("Can't resolve StatsD server address: " + server + ".");
+			}
+		}
+	}
+
+	if (_statsd_peer.is_valid() && ticks - _last_statsd_send >= _statsd_interval_usec) {
+		_last_statsd_send = ticks;
+		_send_statsd();
+	}
+}
+
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
@@ -31,8 +31,10 @@
 #ifndef PERFORMANCE_H
 #define PERFORMANCE_H
 
+#include "core/io/packet_peer_udp.h"
 #include "core/object/class_db.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 #define PERF_WARN_OFFLINE_FUNCTION
 #define PERF_WARN_PROCESS_SYNC
@@ -65,6 +67,36 @@ class Performance : public Object {
 	HashMap<StringName, MonitorCall> _monitor_map;
 	uint64_t _monitor_modification_time;
 
+	// Rolling window of per-frame values of a monitor, with an optional budget on one of its percentiles.
+	struct MonitorHistory {
+		LocalVector<double> samples;
+		uint32_t next_sample = 0;
+		uint32_t sample_count = 0;
+		double budget = 0.0;
+		double budget_percentile = 99.0;
+		bool over_budget = false;
+
+		void add_sample(double p_value);
+		double get_percentile(double p_percentile) const;
+	};
+
+	HashMap<StringName, MonitorHistory> _monitor_histories;
+	HashMap<StringName, int> _monitor_ids;
+	double _frame_process_time = 0.0;
+	double _frame_physics_process_time = 0.0;
+	double _frame_navigation_process_time = 0.0;
+	uint64_t _last_budget_check = 0;
+
+	bool _statsd_initialized = false;
+	Ref<PacketPeerUDP> _statsd_peer;
+	String _statsd_prefix;
+	uint64_t _statsd_interval_usec = 0;
+	uint64_t _last_statsd_send = 0;
+
+	bool _get_monitor_sample(const StringName &p_id, double &r_value);
+	void _check_budgets();
+	void _send_statsd();
+
 public:
 	enum Monitor {
 		TIME_FPS,
@@ -100,6 +132,19 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		NAVIGATION_SYNC_TIME,
+		NAVIGATION_AVOIDANCE_TIME,
+		NAVIGATION_PATH_QUERY_COUNT,
+		NAVIGATION_PATH_QUERY_TIME,
+		NAVIGATION_PATH_QUERY_EXPANDED_POLYGONS,
+		AUDIO_MIX_TIME,
+		AUDIO_ACTIVE_VOICES,
+		AUDIO_VIRTUAL_VOICES,
+		MEMORY_PHYSICS,
+		MEMORY_NAVIGATION,
+		MEMORY_SCRIPT,
+		MEMORY_TEXT,
+		MEMORY_RESOURCE_LOADING,
 		MONITOR_MAX
 	};
 
@@ -126,6 +171,21 @@ public:
 
 	uint64_t get_monitor_modification_time();
 
+	void set_object_allocation_tracking_enabled(bool p_enabled);
+	bool is_object_allocation_tracking_enabled() const;
+	Dictionary get_object_count_by_class() const;
+	Dictionary get_object_allocation_sites(const StringName &p_class) const;
+
+	void set_monitor_history_size(const StringName &p_id, int p_frames);
+	int get_monitor_history_size(const StringName &p_id) const;
+	double get_monitor_percentile(const StringName &p_id, double p_percentile) const;
+	void set_monitor_budget(const StringName &p_id, double p_limit, double p_percentile = 99.0);
+	double get_monitor_budget(const StringName &p_id) const;
+
+	String get_metrics_as_statsd(const String &p_prefix = "godot");
+
+	void process_frame(double p_process_time, double p_physics_process_time, double p_navigation_process_time);
+
 	static Performance *get_singleton() { return singleton; }
 
 	Performance();
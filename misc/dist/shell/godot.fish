@@ -97,6 +97,11 @@ complete -c godot -l disable-render-loop -d "Disable render loop so rendering on
 complete -c godot -l disable-crash-handler -d "Disable crash handler when supported by the platform code"
 complete -c godot -l fixed-fps -d "Force a fixed number of frames per second (this setting disables real-time synchronization)" -x
 complete -c godot -l print-fps -d "Print the frames per second to the stdout"
+complete -c godot -l trace -d "Record a timeline of engine zones to a Chrome/Perfetto JSON trace file" -r
+complete -c godot -l benchmark-scene -d "Run a scene with a fixed timestep and write a JSON performance report" -r
+complete -c godot -l frames -d "Number of frames measured by --benchmark-scene" -x
+complete -c godot -l warmup-frames -d "Number of frames run by --benchmark-scene before measuring" -x
+complete -c godot -l output -d "Path of the --benchmark-scene report" -r
 
 # Standalone tools:
 complete -c godot -s s -l script -d "Run a script" -r
@@ -30,6 +30,7 @@
 
 #include "image_compress_astcenc.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
@@ -114,8 +115,11 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 
 	// Context allocation.
 
+	// astcenc splits the work of a single image between all the threads calling astcenc_compress_image().
+	// On a pool thread (images imported in parallel), the calls would run one after another, so a single
+	// thread is used and the context doesn't allocate working memory for the others.
 	astcenc_context *context;
-	const unsigned int thread_count = 1; // Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
+	const unsigned int thread_count = WorkerThreadPool::get_singleton()->is_pool_thread() ? 1 : MAX(1, WorkerThreadPool::get_singleton()->get_thread_count());
 	status = astcenc_context_alloc(&config, thread_count, &context);
 	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
 			vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
@@ -156,7 +160,21 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 			ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
 		};
 
-		status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		LocalVector<astcenc_error> thread_status;
+		thread_status.resize(thread_count);
+		WorkerThreadPool::get_singleton()->parallel_for(
+				thread_count, 1, [&](uint32_t p_from, uint32_t p_to) {
+					for (uint32_t j = p_from; j < p_to; j++) {
+						thread_status[j] = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, j);
+					}
+				},
+				"astcenc Compress");
+		status = ASTCENC_SUCCESS;
+		for (astcenc_error thread_error : thread_status) {
+			if (thread_error != ASTCENC_SUCCESS) {
+				status = thread_error;
+			}
+		}
 
 		ERR_BREAK_MSG(status != ASTCENC_SUCCESS,
 				vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
@@ -37,6 +37,9 @@
 #include "servers/camera_server.h"
 
 class CameraMacOS : public CameraServer {
+protected:
+	virtual void _enumerate_feeds() override { update_feeds(); }
+
 public:
 	CameraMacOS();
 
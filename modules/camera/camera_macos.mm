@@ -348,8 +348,7 @@ void CameraMacOS::update_feeds() {
 };
 
 CameraMacOS::CameraMacOS() {
-	// Find available cameras we have at this time
-	update_feeds();
+	// Available cameras are found on the first feed query, see _enumerate_feeds().
 
 	// should only have one of these....
 	device_notifications = [[MyDeviceNotifications alloc] initForServer:this];
@@ -87,8 +87,7 @@ void CameraWindows::add_active_cameras() {
 }
 
 CameraWindows::CameraWindows() {
-	// Find cameras active right now
-	add_active_cameras();
+	// Cameras active right now are found on the first feed query, see _enumerate_feeds().
 
 	// need to add something that will react to devices being connected/removed...
 };
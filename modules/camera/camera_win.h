@@ -38,6 +38,9 @@ class CameraWindows : public CameraServer {
 private:
 	void add_active_cameras();
 
+protected:
+	virtual void _enumerate_feeds() override { add_active_cameras(); }
+
 public:
 	CameraWindows();
 	~CameraWindows() {}
@@ -149,12 +149,18 @@ float CSGShape3D::get_snap() const {
 }
 
 void CSGShape3D::_make_dirty(bool p_parent_removing) {
+	primitive_dirty = true;
+	_make_result_dirty(p_parent_removing);
+}
+
+void CSGShape3D::_make_result_dirty(bool p_parent_removing) {
+	// Only the merged result changes, this shape's own brush is kept.
 	if ((p_parent_removing || is_root_shape()) && !dirty) {
 		call_deferred(SNAME("_update_shape")); // Must be deferred; otherwise, is_root_shape() will use the previous parent
 	}
 
 	if (!is_root_shape()) {
-		parent_shape->_make_dirty();
+		parent_shape->_make_result_dirty();
 	} else if (!dirty) {
 		call_deferred(SNAME("_update_shape"));
 	}
@@ -164,12 +170,21 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 
 CSGBrush *CSGShape3D::_get_brush() {
 	if (dirty) {
-		if (brush) {
+		if (brush && brush != primitive_brush) {
 			memdelete(brush);
 		}
 		brush = nullptr;
 
-		CSGBrush *n = _build_brush();
+		if (primitive_dirty) {
+			if (primitive_brush) {
+				memdelete(primitive_brush);
+			}
+			primitive_brush = _build_brush();
+			primitive_dirty = false;
+		}
+
+		// Merging creates new brushes, so the primitive one is left untouched.
+		CSGBrush *n = primitive_brush;
 
 		for (int i = 0; i < get_child_count(); i++) {
 			CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
@@ -207,7 +222,9 @@ CSGBrush *CSGShape3D::_get_brush() {
 						bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
 						break;
 				}
-				memdelete(n);
+				if (n != primitive_brush) {
+					memdelete(n);
+				}
 				memdelete(nn2);
 				n = nn;
 			}
@@ -571,7 +588,7 @@ void CSGShape3D::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			if (!is_root_shape() && last_visible != is_visible()) {
 				// Update this node's parent only if its own visibility has changed, not the visibility of parent nodes
-				parent_shape->_make_dirty();
+				parent_shape->_make_result_dirty();
 			}
 			last_visible = is_visible();
 		} break;
@@ -579,7 +596,7 @@ void CSGShape3D::_notification(int p_what) {
 		case NOTIFICATION_LOCAL_TRANSFORM_CHANGED: {
 			if (!is_root_shape()) {
 				// Update this node's parent only if its own transformation has changed, not the transformation of parent nodes
-				parent_shape->_make_dirty();
+				parent_shape->_make_result_dirty();
 			}
 		} break;
 
@@ -712,9 +729,13 @@ CSGShape3D::CSGShape3D() {
 }
 
 CSGShape3D::~CSGShape3D() {
-	if (brush) {
+	if (brush && brush != primitive_brush) {
 		memdelete(brush);
-		brush = nullptr;
+	}
+	brush = nullptr;
+	if (primitive_brush) {
+		memdelete(primitive_brush);
+		primitive_brush = nullptr;
 	}
 }
 
@@ -55,10 +55,13 @@ private:
 	CSGShape3D *parent_shape = nullptr;
 
 	CSGBrush *brush = nullptr;
+	// This shape's own brush, kept so changes to children don't rebuild it. `brush` points to it when there are no children to merge.
+	CSGBrush *primitive_brush = nullptr;
 
 	AABB node_aabb;
 
 	bool dirty = false;
+	bool primitive_dirty = true;
 	bool last_visible = false;
 	float snap = 0.001;
 
@@ -118,6 +121,7 @@ protected:
 	void _notification(int p_what);
 	virtual CSGBrush *_build_brush() = 0;
 	void _make_dirty(bool p_parent_removing = false);
+	void _make_result_dirty(bool p_parent_removing = false);
 
 	static void _bind_methods();
 
@@ -114,6 +114,7 @@ Ref<ENetPacketPeer> ENetConnection::connect_to_host(const String &p_address, int
 		return nullptr;
 	}
 	out = Ref<ENetPacketPeer>(memnew(ENetPacketPeer(peer)));
+	out->host_mutex = host_mutex;
 	peers.push_back(out);
 	return out;
 }
@@ -123,6 +124,7 @@ ENetConnection::EventType ENetConnection::_parse_event(const ENetEvent &p_event,
 		case ENET_EVENT_TYPE_CONNECT: {
 			if (p_event.peer->data == nullptr) {
 				Ref<ENetPacketPeer> pp = memnew(ENetPacketPeer(p_event.peer));
+				pp->host_mutex = host_mutex;
 				peers.push_back(pp);
 			}
 			r_event.peer = Ref<ENetPacketPeer>((ENetPacketPeer *)p_event.peer->data);
@@ -266,6 +268,7 @@ void ENetConnection::get_peers(List<Ref<ENetPacketPeer>> &r_peers) {
 
 TypedArray<ENetPacketPeer> ENetConnection::_get_peers() {
 	ERR_FAIL_NULL_V_MSG(host, Array(), "The ENetConnection instance isn't currently active.");
+	ENetPacketPeer::HostLock lock(host_mutex);
 	TypedArray<ENetPacketPeer> out;
 	for (const Ref<ENetPacketPeer> &I : peers) {
 		out.push_back(I);
@@ -292,6 +295,14 @@ void ENetConnection::refuse_new_connections(bool p_refuse) {
 #endif
 }
 
+void ENetConnection::set_host_mutex(Mutex *p_mutex) {
+	// The peers' script-facing methods lock this while the host is serviced on another thread.
+	host_mutex = p_mutex;
+	for (Ref<ENetPacketPeer> &I : peers) {
+		I->host_mutex = p_mutex;
+	}
+}
+
 Error ENetConnection::dtls_client_setup(const String &p_hostname, const Ref<TLSOptions> &p_options) {
 #ifdef GODOT_ENET
 	ERR_FAIL_NULL_V_MSG(host, ERR_UNCONFIGURED, "The ENetConnection instance isn't currently active.");
@@ -81,6 +81,7 @@ protected:
 private:
 	ENetHost *host = nullptr;
 	List<Ref<ENetPacketPeer>> peers;
+	Mutex *host_mutex = nullptr;
 
 	EventType _parse_event(const ENetEvent &p_event, Event &r_event);
 	Error _create(ENetAddress *p_address, int p_max_peers, int p_max_channels, int p_in_bandwidth, int p_out_bandwidth);
@@ -132,6 +133,7 @@ public:
 	Error dtls_server_setup(const Ref<TLSOptions> &p_options);
 	Error dtls_client_setup(const String &p_hostname, const Ref<TLSOptions> &p_options);
 	void refuse_new_connections(bool p_refuse);
+	void set_host_mutex(Mutex *p_mutex);
 
 	ENetConnection() {}
 	~ENetConnection();
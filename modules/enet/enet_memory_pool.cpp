@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  enet_memory_pool.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "enet_memory_pool.h"
+
+#include "core/os/memory.h"
+
+ENetMemoryPool::SizeClass ENetMemoryPool::size_classes[SIZE_CLASS_COUNT];
+bool ENetMemoryPool::enabled = false;
+
+void *ENetMemoryPool::alloc(size_t p_size) {
+	uint8_t size_class = UNPOOLED;
+	if (enabled && p_size <= (1 << MAX_BLOCK_SHIFT)) {
+		size_class = 0;
+		while (p_size > (size_t(1) << (MIN_BLOCK_SHIFT + size_class))) {
+			size_class++;
+		}
+		SizeClass &sc = size_classes[size_class];
+		sc.lock.lock();
+		FreeBlock *block = sc.free_list;
+		if (block) {
+			sc.free_list = block->next;
+			sc.free_count--;
+		}
+		sc.lock.unlock();
+		if (block) {
+			uint8_t *mem = (uint8_t *)block;
+			mem[0] = size_class;
+			return mem + HEADER_SIZE;
+		}
+		p_size = size_t(1) << (MIN_BLOCK_SHIFT + size_class);
+	}
+	uint8_t *mem = (uint8_t *)Memory::alloc_static(p_size + HEADER_SIZE);
+	ERR_FAIL_NULL_V(mem, nullptr);
+	mem[0] = size_class;
+	return mem + HEADER_SIZE;
+}
+
+void ENetMemoryPool::free(void *p_ptr) {
+	if (!p_ptr) {
+		return;
+	}
+	uint8_t *mem = (uint8_t *)p_ptr - HEADER_SIZE;
+	const uint8_t size_class = mem[0];
+	if (size_class != UNPOOLED && enabled) {
+		SizeClass &sc = size_classes[size_class];
+		sc.lock.lock();
+		if (sc.free_count < MAX_FREE_BLOCKS) {
+			FreeBlock *block = (FreeBlock *)mem;
+			block->next = sc.free_list;
+			sc.free_list = block;
+			sc.free_count++;
+			mem = nullptr;
+		}
+		sc.lock.unlock();
+	}
+	if (mem) {
+		Memory::free_static(mem);
+	}
+}
+
+void ENetMemoryPool::initialize() {
+	enabled = true;
+}
+
+void ENetMemoryPool::finalize() {
+	// Blocks still in use are released directly when freed.
+	enabled = false;
+	for (int i = 0; i < SIZE_CLASS_COUNT; i++) {
+		SizeClass &sc = size_classes[i];
+		sc.lock.lock();
+		FreeBlock *block = sc.free_list;
+		sc.free_list = nullptr;
+		sc.free_count = 0;
+		sc.lock.unlock();
+		while (block) {
+			FreeBlock *next = block->next;
+			Memory::free_static(block);
+			block = next;
+		}
+	}
+}
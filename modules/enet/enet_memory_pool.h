@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*  enet_memory_pool.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ENET_MEMORY_POOL_H
+#define ENET_MEMORY_POOL_H
+
+#include "core/os/spin_lock.h"
+#include "core/typedefs.h"
+
+// Recycles the small blocks ENet allocates for every packet and protocol command
+// (packets and their data, incoming/outgoing commands, acknowledgements), so that
+// high packet rates don't hit the system allocator for each of them.
+class ENetMemoryPool {
+	enum {
+		MIN_BLOCK_SHIFT = 6, // 64 bytes.
+		MAX_BLOCK_SHIFT = 12, // 4096 bytes, i.e. ENET_PROTOCOL_MAXIMUM_MTU.
+		SIZE_CLASS_COUNT = MAX_BLOCK_SHIFT - MIN_BLOCK_SHIFT + 1,
+		MAX_FREE_BLOCKS = 256, // Per size class, blocks beyond this are released.
+		HEADER_SIZE = 16, // Stores the size class, keeps the returned memory aligned.
+		UNPOOLED = 0xFF,
+	};
+
+	struct FreeBlock {
+		FreeBlock *next = nullptr;
+	};
+
+	struct SizeClass {
+		SpinLock lock;
+		FreeBlock *free_list = nullptr;
+		uint32_t free_count = 0;
+	};
+
+	static SizeClass size_classes[SIZE_CLASS_COUNT];
+	static bool enabled;
+
+public:
+	static void *alloc(size_t p_size);
+	static void free(void *p_ptr);
+
+	static void initialize();
+	static void finalize();
+};
+
+#endif // ENET_MEMORY_POOL_H
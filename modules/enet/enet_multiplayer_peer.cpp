@@ -30,6 +30,7 @@
 
 #include "enet_multiplayer_peer.h"
 
+#include "core/debugger/engine_debugger.h"
 #include "core/io/ip.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
@@ -75,6 +76,9 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	if (use_service_thread) {
+		_start_service_thread();
+	}
 	return OK;
 }
 
@@ -106,6 +110,9 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	if (use_service_thread) {
+		_start_service_thread();
+	}
 
 	return OK;
 }
@@ -149,11 +156,14 @@ void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event
 
 void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	HashSet<int> to_drop;
-	for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
-		if (E.value->is_active()) {
-			continue;
+	{
+		MutexLock lock(host_mutex);
+		for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
+			if (E.value->is_active()) {
+				continue;
+			}
+			to_drop.insert(E.key);
 		}
-		to_drop.insert(E.key);
 	}
 	for (const int &P : to_drop) {
 		peers.erase(P);
@@ -165,6 +175,135 @@ void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	}
 }
 
+void ENetMultiplayerPeer::_service_thread_func(void *p_userdata) {
+	ENetMultiplayerPeer *peer = (ENetMultiplayerPeer *)p_userdata;
+	while (!peer->service_thread_exit.is_set()) {
+		{
+			MutexLock lock(peer->host_mutex);
+			ENetConnection::Event event;
+			ENetConnection::EventType ret = peer->service_host->service(0, event);
+			while (ret != ENetConnection::EVENT_NONE) {
+				ServiceEvent service_event;
+				service_event.type = ret;
+				service_event.event = event;
+				{
+					MutexLock events_lock(peer->service_events_mutex);
+					peer->service_events.push_back(service_event);
+				}
+				if (ret == ENetConnection::EVENT_ERROR) {
+					break;
+				}
+				event = ENetConnection::Event();
+				if (peer->service_host->check_events(ret, event) <= 0) {
+					break;
+				}
+			}
+		}
+		OS::get_singleton()->delay_usec(SERVICE_THREAD_INTERVAL_USEC);
+	}
+}
+
+void ENetMultiplayerPeer::_start_service_thread() {
+	ERR_FAIL_COND(service_thread.is_started());
+	service_host = hosts[0];
+	service_host->set_host_mutex(&host_mutex);
+	service_thread_exit.clear();
+	service_thread.start(_service_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_service_thread() {
+	if (!service_thread.is_started()) {
+		return;
+	}
+	service_thread_exit.set();
+	service_thread.wait_to_finish();
+	service_host->set_host_mutex(nullptr);
+	service_host.unref();
+	for (ServiceEvent &E : service_events) {
+		if (E.type == ENetConnection::EVENT_RECEIVE) {
+			_destroy_unused(E.event.packet);
+		}
+	}
+	service_events.clear();
+}
+
+void ENetMultiplayerPeer::_handle_client_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event) {
+	if (p_type == ENetConnection::EVENT_CONNECT) {
+		connection_status = CONNECTION_CONNECTED;
+		emit_signal(SNAME("peer_connected"), 1);
+	} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+		if (connection_status == CONNECTION_CONNECTED) {
+			// Client just disconnected from server.
+			emit_signal(SNAME("peer_disconnected"), 1);
+		}
+		close();
+	} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+		_store_packet(1, p_event);
+	} else if (p_type != ENetConnection::EVENT_NONE) {
+		close(); // Error.
+	}
+}
+
+void ENetMultiplayerPeer::_handle_server_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event) {
+	if (p_type == ENetConnection::EVENT_CONNECT) {
+		if (is_refusing_new_connections()) {
+			MutexLock lock(host_mutex);
+			p_event.peer->reset();
+			return;
+		}
+		// Client joined with invalid ID, probably trying to exploit us.
+		if (p_event.data < 2 || peers.has((int)p_event.data)) {
+			MutexLock lock(host_mutex);
+			p_event.peer->reset();
+			return;
+		}
+		int id = p_event.data;
+		p_event.peer->set_meta(SNAME("_net_id"), id);
+		peers[id] = p_event.peer;
+		emit_signal(SNAME("peer_connected"), id);
+	} else if (p_type == ENetConnection::EVENT_DISCONNECT) {
+		int id = p_event.peer->get_meta(SNAME("_net_id"));
+		if (!peers.has(id)) {
+			// Never fully connected.
+			return;
+		}
+		emit_signal(SNAME("peer_disconnected"), id);
+		peers.erase(id);
+	} else if (p_type == ENetConnection::EVENT_RECEIVE) {
+		int32_t source = p_event.peer->get_meta(SNAME("_net_id"));
+		_store_packet(source, p_event);
+	} else if (p_type != ENetConnection::EVENT_NONE) {
+		close(); // Error
+	}
+}
+
+#ifdef DEBUG_ENABLED
+void ENetMultiplayerPeer::_profile_peers() {
+	if (!EngineDebugger::is_profiling("multiplayer:peers")) {
+		return;
+	}
+	uint64_t now = OS::get_singleton()->get_ticks_msec();
+	if (now - last_profile_msec < 100) {
+		return;
+	}
+	last_profile_msec = now;
+	MutexLock lock(host_mutex);
+	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
+		if (!E.value->is_active()) {
+			continue;
+		}
+		// ENet's packet loss is the share of reliable packets which had to be resent.
+		Array values;
+		values.push_back("transport");
+		values.push_back(E.key);
+		values.push_back(int(E.value->get_statistic(ENetPacketPeer::PEER_ROUND_TRIP_TIME)));
+		values.push_back(int(E.value->get_statistic(ENetPacketPeer::PEER_ROUND_TRIP_TIME_VARIANCE)));
+		values.push_back(E.value->get_statistic(ENetPacketPeer::PEER_PACKET_LOSS) / ENET_PEER_PACKET_LOSS_SCALE);
+		EngineDebugger::profiler_add_frame_data("multiplayer:peers", values);
+	}
+}
+#endif
+
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
@@ -172,63 +311,53 @@ void ENetMultiplayerPeer::poll() {
 
 	_disconnect_inactive_peers();
 
+#ifdef DEBUG_ENABLED
+	_profile_peers();
+#endif
+
+	if (active_mode == MODE_CLIENT && !peers.has(1)) {
+		close();
+		return;
+	}
+
+	if (service_thread.is_started()) {
+		LocalVector<ServiceEvent> events;
+		{
+			MutexLock lock(service_events_mutex);
+			SWAP(events, service_events);
+		}
+		for (ServiceEvent &E : events) {
+			if (!_is_active()) {
+				// Closed while handling a previous event.
+				if (E.type == ENetConnection::EVENT_RECEIVE) {
+					_destroy_unused(E.event.packet);
+				}
+				continue;
+			}
+			if (active_mode == MODE_CLIENT) {
+				_handle_client_event(E.type, E.event);
+			} else {
+				_handle_server_event(E.type, E.event);
+			}
+		}
+		return;
+	}
+
 	switch (active_mode) {
 		case MODE_CLIENT: {
-			if (!peers.has(1)) {
-				close();
-				return;
-			}
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					connection_status = CONNECTION_CONNECTED;
-					emit_signal(SNAME("peer_connected"), 1);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					if (connection_status == CONNECTION_CONNECTED) {
-						// Client just disconnected from server.
-						emit_signal(SNAME("peer_disconnected"), 1);
-					}
-					close();
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					_store_packet(1, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error.
-				}
+				_handle_client_event(ret, event);
+				event = ENetConnection::Event();
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_SERVER: {
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					if (is_refusing_new_connections()) {
-						event.peer->reset();
-						continue;
-					}
-					// Client joined with invalid ID, probably trying to exploit us.
-					if (event.data < 2 || peers.has((int)event.data)) {
-						event.peer->reset();
-						continue;
-					}
-					int id = event.data;
-					event.peer->set_meta(SNAME("_net_id"), id);
-					peers[id] = event.peer;
-					emit_signal(SNAME("peer_connected"), id);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					int id = event.peer->get_meta(SNAME("_net_id"));
-					if (!peers.has(id)) {
-						// Never fully connected.
-						continue;
-					}
-					emit_signal(SNAME("peer_disconnected"), id);
-					peers.erase(id);
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					int32_t source = event.peer->get_meta(SNAME("_net_id"));
-					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error
-				}
+				_handle_server_event(ret, event);
+				event = ENetConnection::Event();
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_MESH: {
@@ -272,12 +401,15 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
-	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
-	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
-		hosts[0]->flush();
-	} else {
-		ERR_FAIL_COND(!hosts.has(p_peer));
-		hosts[p_peer]->flush();
+	{
+		MutexLock lock(host_mutex);
+		peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
+		if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
+			hosts[0]->flush();
+		} else {
+			ERR_FAIL_COND(!hosts.has(p_peer));
+			hosts[p_peer]->flush();
+		}
 	}
 	if (p_force) {
 		peers.erase(p_peer);
@@ -296,6 +428,8 @@ void ENetMultiplayerPeer::close() {
 		return;
 	}
 
+	_stop_service_thread();
+
 	_pop_current_packet();
 
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
@@ -370,6 +504,8 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	MutexLock lock(host_mutex);
+
 	if (is_server()) {
 		if (target_peer == 0) {
 			hosts[0]->broadcast(channel, packet);
@@ -443,6 +579,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(host_mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -451,6 +588,15 @@ void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 	MultiplayerPeer::set_refuse_new_connections(p_enabled);
 }
 
+void ENetMultiplayerPeer::set_use_service_thread(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The service thread can only be enabled or disabled while the multiplayer instance isn't active.");
+	use_service_thread = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_using_service_thread() const {
+	return use_service_thread;
+}
+
 Ref<ENetConnection> ENetMultiplayerPeer::get_host() const {
 	ERR_FAIL_COND_V(!_is_active(), nullptr);
 	ERR_FAIL_COND_V(active_mode == MODE_MESH, nullptr);
@@ -476,11 +622,14 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_mesh", "unique_id"), &ENetMultiplayerPeer::create_mesh);
 	ClassDB::bind_method(D_METHOD("add_mesh_peer", "peer_id", "host"), &ENetMultiplayerPeer::add_mesh_peer);
 	ClassDB::bind_method(D_METHOD("set_bind_ip", "ip"), &ENetMultiplayerPeer::set_bind_ip);
+	ClassDB::bind_method(D_METHOD("set_use_service_thread", "enabled"), &ENetMultiplayerPeer::set_use_service_thread);
+	ClassDB::bind_method(D_METHOD("is_using_service_thread"), &ENetMultiplayerPeer::is_using_service_thread);
 
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_service_thread"), "set_use_service_thread", "is_using_service_thread");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
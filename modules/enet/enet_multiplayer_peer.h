@@ -34,6 +34,10 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -53,6 +57,10 @@ private:
 		SYSCH_MAX = 2
 	};
 
+	enum {
+		SERVICE_THREAD_INTERVAL_USEC = 1000,
+	};
+
 	enum Mode {
 		MODE_NONE,
 		MODE_SERVER,
@@ -82,10 +90,35 @@ private:
 
 	Packet current_packet;
 
+	// With use_service_thread, the host is serviced (receive, decompression, DTLS) on
+	// its own thread, and the resulting events are only handled in poll().
+	struct ServiceEvent {
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+	};
+
+	bool use_service_thread = false;
+	Thread service_thread;
+	SafeFlag service_thread_exit;
+	Ref<ENetConnection> service_host;
+	Mutex host_mutex; // Guards the ENet host and peers while the service thread runs.
+	Mutex service_events_mutex;
+	LocalVector<ServiceEvent> service_events;
+
+	static void _service_thread_func(void *p_userdata);
+	void _start_service_thread();
+	void _stop_service_thread();
+	void _handle_client_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event);
+	void _handle_server_event(ENetConnection::EventType p_type, ENetConnection::Event &p_event);
+
 	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
 	void _destroy_unused(ENetPacket *p_packet);
+#ifdef DEBUG_ENABLED
+	uint64_t last_profile_msec = 0;
+	void _profile_peers();
+#endif
 	_FORCE_INLINE_ bool _is_active() const { return active_mode != MODE_NONE; }
 
 	IPAddress bind_ip;
@@ -126,6 +159,9 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_use_service_thread(bool p_enabled);
+	bool is_using_service_thread() const;
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
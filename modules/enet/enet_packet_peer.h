@@ -32,6 +32,7 @@
 #define ENET_PACKET_PEER_H
 
 #include "core/io/packet_peer.h"
+#include "core/os/mutex.h"
 
 #include <enet/enet.h>
 
@@ -43,6 +44,24 @@ private:
 	List<ENetPacket *> packet_queue;
 	ENetPacket *last_packet = nullptr;
 
+	// Set by ENetConnection while ENetMultiplayerPeer services the host on its own thread.
+	Mutex *host_mutex = nullptr;
+
+	struct HostLock {
+		Mutex *mutex = nullptr;
+		HostLock(Mutex *p_mutex) :
+				mutex(p_mutex) {
+			if (mutex) {
+				mutex->lock();
+			}
+		}
+		~HostLock() {
+			if (mutex) {
+				mutex->unlock();
+			}
+		}
+	};
+
 	static void _bind_methods();
 	Error _send(int p_channel, PackedByteArray p_packet, int p_flags);
 
@@ -31,6 +31,7 @@
 #include "register_types.h"
 
 #include "enet_connection.h"
+#include "enet_memory_pool.h"
 #include "enet_multiplayer_peer.h"
 #include "enet_packet_peer.h"
 
@@ -38,12 +39,22 @@
 
 static bool enet_ok = false;
 
+static void *ENET_CALLBACK _enet_pool_alloc(size_t p_size) {
+	return ENetMemoryPool::alloc(p_size);
+}
+
+static void ENET_CALLBACK _enet_pool_free(void *p_ptr) {
+	ENetMemoryPool::free(p_ptr);
+}
+
 void initialize_enet_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
 
-	if (enet_initialize() != 0) {
+	ENetMemoryPool::initialize();
+	ENetCallbacks callbacks = { &_enet_pool_alloc, &_enet_pool_free, nullptr };
+	if (enet_initialize_with_callbacks(ENET_VERSION, &callbacks) != 0) {
 		ERR_PRINT("ENet initialization failure");
 	} else {
 		enet_ok = true;
@@ -62,4 +73,5 @@ void uninitialize_enet_module(ModuleInitializationLevel p_level) {
 	if (enet_ok) {
 		enet_deinitialize();
 	}
+	ENetMemoryPool::finalize();
 }
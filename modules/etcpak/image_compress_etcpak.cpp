@@ -30,6 +30,7 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
@@ -219,19 +220,29 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 			// Override the src_mip_read pointer to our temporary Vector.
 			src_mip_read = padded_src.ptr();
 		}
-		if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
-			CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2) {
-			CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
-			CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
-			CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
-			CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else {
-			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-		}
+
+		// Blocks are encoded independently, so rows of blocks can be compressed in parallel.
+		// Formats with alpha use 128-bit blocks, the others 64-bit ones.
+		const uint32_t blocks_per_row = mip_w / 4;
+		const uint32_t block_words = (target_format == Image::FORMAT_ETC2_RGBA8 || target_format == Image::FORMAT_ETC2_RA_AS_RG || target_format == Image::FORMAT_DXT5 || target_format == Image::FORMAT_DXT5_RA_AS_RG) ? 2 : 1;
+		WorkerThreadPool::get_singleton()->parallel_for(
+				blocks / blocks_per_row, 16, [&](uint32_t p_from, uint32_t p_to) {
+					const uint32_t *src = src_mip_read + p_from * 4 * mip_w;
+					uint64_t *dst = dest_mip_write + p_from * blocks_per_row * block_words;
+					const uint32_t row_blocks = (p_to - p_from) * blocks_per_row;
+					if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
+						CompressEtc1RgbDither(src, dst, row_blocks, mip_w);
+					} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2) {
+						CompressEtc2Rgb(src, dst, row_blocks, mip_w, true);
+					} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
+						CompressEtc2Rgba(src, dst, row_blocks, mip_w, true);
+					} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
+						CompressDxt1Dither(src, dst, row_blocks, mip_w);
+					} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
+						CompressDxt5(src, dst, row_blocks, mip_w);
+					}
+				},
+				"etcpak Compress");
 	}
 
 	// Replace original image with compressed one.
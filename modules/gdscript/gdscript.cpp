@@ -728,36 +728,46 @@ Error GDScript::reload(bool p_keep_state) {
 		}
 	}
 
-	bool can_run = ScriptServer::is_scripting_enabled() || is_tool();
-
 #ifdef TOOLS_ENABLED
+	bool can_run = ScriptServer::is_scripting_enabled() || is_tool();
 	if (p_keep_state && can_run && is_valid()) {
 		_save_old_static_data();
 	}
 #endif
 
 	valid = false;
+	if (preparsed_parser) {
+		GDScriptParser *parser = preparsed_parser;
+		preparsed_parser = nullptr;
+		return _reload_parsed(*parser, preparsed_error, p_keep_state);
+	}
+
 	GDScriptParser parser;
 	Error err = parser.parse(source, path, false);
+	return _reload_parsed(parser, err, p_keep_state);
+}
+
+Error GDScript::_reload_parsed(GDScriptParser &p_parser, Error p_parse_error, bool p_keep_state) {
+	Error err = p_parse_error;
 	if (err) {
 		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), p_parser.get_errors().front()->get().line, "Parser Error: " + p_parser.get_errors().front()->get().message);
 		}
 		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), p_parser.get_errors().front()->get().line, ("Parse Error: " + p_parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
 		reloading = false;
 		return ERR_PARSE_ERROR;
 	}
 
-	GDScriptAnalyzer analyzer(&parser);
+	GDScriptAnalyzer analyzer(&p_parser);
 	err = analyzer.analyze();
 
 	if (err) {
 		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), p_parser.get_errors().front()->get().line, "Parser Error: " + p_parser.get_errors().front()->get().message);
 		}
 
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
+		const List<GDScriptParser::ParserError>::Element *e = p_parser.get_errors().front();
 		while (e != nullptr) {
 			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
 			e = e->next();
@@ -766,10 +776,10 @@ Error GDScript::reload(bool p_keep_state) {
 		return ERR_PARSE_ERROR;
 	}
 
-	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
+	bool can_run = ScriptServer::is_scripting_enabled() || p_parser.is_tool();
 
 	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
+	err = compiler.compile(&p_parser, this, p_keep_state);
 
 	if (err) {
 		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
@@ -788,11 +798,11 @@ Error GDScript::reload(bool p_keep_state) {
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
-	GDScriptDocGen::generate_docs(this, parser.get_tree());
+	GDScriptDocGen::generate_docs(this, p_parser.get_tree());
 #endif
 
 #ifdef DEBUG_ENABLED
-	for (const GDScriptWarning &warning : parser.get_warnings()) {
+	for (const GDScriptWarning &warning : p_parser.get_warnings()) {
 		if (EngineDebugger::is_active()) {
 			Vector<ScriptLanguage::StackInfo> si;
 			EngineDebugger::get_script_debugger()->send_error("", get_script_path(), warning.start_line, warning.get_name(), warning.get_message(), false, ERR_HANDLER_WARNING, si);
@@ -1906,17 +1916,21 @@ void GDScriptInstance::notification(int p_notification, bool p_reversed) {
 	Variant value = p_notification;
 	const Variant *args[1] = { &value };
 
-	List<GDScript *> pl;
-	GDScript *sptr = script.ptr();
-	while (sptr) {
-		if (p_reversed) {
-			pl.push_back(sptr);
-		} else {
-			pl.push_front(sptr);
-		}
-		sptr = sptr->_base;
-	}
-	for (GDScript *sc : pl) {
+	// This runs for every notification sent to every scripted object (including processing ones),
+	// so gather the inheritance chain on the stack instead of allocating a list each time.
+	uint32_t script_count = 0;
+	for (GDScript *sptr = script.ptr(); sptr; sptr = sptr->_base) {
+		script_count++;
+	}
+	GDScript **scripts = (GDScript **)alloca(sizeof(GDScript *) * script_count);
+	uint32_t script_index = 0;
+	for (GDScript *sptr = script.ptr(); sptr; sptr = sptr->_base) {
+		// Base scripts get notified first, unless reversed.
+		scripts[p_reversed ? script_index : script_count - 1 - script_index] = sptr;
+		script_index++;
+	}
+	for (uint32_t i = 0; i < script_count; i++) {
+		GDScript *sc = scripts[i];
 		HashMap<StringName, GDScriptFunction *>::Iterator E = sc->member_functions.find(GDScriptLanguage::get_singleton()->strings._notification);
 		if (E) {
 			Callable::CallError err;
@@ -2607,6 +2621,19 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+Mutex GDScriptLanguage::call_stacks_mutex;
+LocalVector<GDScriptLanguage::CallStack *> GDScriptLanguage::call_stacks;
+
+void GDScriptLanguage::_register_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	p_call_stack->thread_id = Thread::get_caller_id();
+	call_stacks.push_back(p_call_stack);
+}
+
+void GDScriptLanguage::_unregister_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	call_stacks.erase(p_call_stack);
+}
 
 GDScriptLanguage::GDScriptLanguage() {
 	calls = 0;
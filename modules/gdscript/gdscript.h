@@ -41,6 +41,8 @@
 #include "core/object/script_language.h"
 #include "core/templates/rb_set.h"
 
+class GDScriptParser;
+
 class GDScriptNativeClass : public RefCounted {
 	GDCLASS(GDScriptNativeClass, RefCounted);
 
@@ -89,6 +91,7 @@ class GDScript : public Script {
 	friend class GDScriptLambdaCallable;
 	friend class GDScriptLambdaSelfCallable;
 	friend class GDScriptLanguage;
+	friend class GDScriptCache;
 	friend struct GDScriptUtilityFunctionsDefinitions;
 
 	Ref<GDScriptNativeClass> native;
@@ -164,6 +167,11 @@ class GDScript : public Script {
 
 	Error _static_init();
 
+	// Parsed ahead of reload() together with other scripts, see GDScriptCache::finish_compiling().
+	GDScriptParser *preparsed_parser = nullptr;
+	Error preparsed_error = OK;
+	Error _reload_parsed(GDScriptParser &p_parser, Error p_parse_error, bool p_keep_state);
+
 	int subclass_count = 0;
 	RBSet<Object *> instances;
 	bool destructing = false;
@@ -403,9 +411,11 @@ class GDScriptLanguage : public ScriptLanguage {
 	struct CallStack {
 		CallLevel *levels = nullptr;
 		int stack_pos = 0;
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
 
 		void free() {
 			if (levels) {
+				_unregister_call_stack(this);
 				memdelete(levels);
 				levels = nullptr;
 			}
@@ -418,6 +428,13 @@ class GDScriptLanguage : public ScriptLanguage {
 	static thread_local CallStack _call_stack;
 	int _debug_max_call_stack = 0;
 
+	// The call stacks of all threads that ran GDScript, so the sampling profiler can inspect them.
+	static Mutex call_stacks_mutex;
+	static LocalVector<CallStack *> call_stacks;
+	static void _register_call_stack(CallStack *p_call_stack);
+	static void _unregister_call_stack(CallStack *p_call_stack);
+	friend class GDScriptSamplingProfiler;
+
 	void _add_global(const StringName &p_name, const Variant &p_value);
 
 	friend class GDScriptInstance;
@@ -444,6 +461,7 @@ public:
 	_FORCE_INLINE_ void enter_function(GDScriptInstance *p_instance, GDScriptFunction *p_function, Variant *p_stack, int *p_ip, int *p_line) {
 		if (unlikely(_call_stack.levels == nullptr)) {
 			_call_stack.levels = memnew_arr(CallLevel, _debug_max_call_stack + 1);
+			_register_call_stack(&_call_stack);
 		}
 
 		if (EngineDebugger::get_script_debugger()->get_lines_left() > 0 && EngineDebugger::get_script_debugger()->get_depth() >= 0) {
@@ -120,6 +120,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	RBMap<GDScriptUtilityFunctions::FunctionPtr, int> gds_utilities_map;
 	RBMap<MethodBind *, int> method_bind_map;
 	RBMap<GDScriptFunction *, int> lambdas_map;
+	int property_cache_count = 0;
 
 #if DEBUG_ENABLED
 	// Keep method and property names for pointer and validated operations.
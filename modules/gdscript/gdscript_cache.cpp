@@ -36,9 +36,14 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/vector.h"
 #include "scene/resources/packed_scene.h"
 
+#ifdef DEBUG_ENABLED
+#include "servers/text_server.h"
+#endif
+
 bool GDScriptParserRef::is_valid() const {
 	return parser != nullptr;
 }
@@ -69,7 +74,11 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 		switch (status) {
 			case EMPTY:
 				status = PARSED;
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
+				if (source.is_empty()) {
+					source = GDScriptCache::get_source_code(path);
+				}
+				result = parser->parse(source, path, false);
+				source = String(); // The parser keeps its own copy.
 				break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
@@ -192,7 +201,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 	singleton->full_gdscript_cache.erase(p_path);
 }
 
-Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
+Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner, const String &p_source) {
 	MutexLock lock(singleton->mutex);
 	Ref<GDScriptParserRef> ref;
 	if (!p_owner.is_empty()) {
@@ -213,6 +222,7 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 		ref.instantiate();
 		ref->parser = parser;
 		ref->path = p_path;
+		ref->source = p_source;
 		singleton->parser_map[p_path] = ref.ptr();
 	}
 	r_error = ref->raise_status(p_status);
@@ -260,7 +270,8 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
-	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
+	// Hand over the source that was just loaded, so it isn't read and decoded a second time.
+	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error, String(), script->get_source_code());
 	if (r_error == OK) {
 		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
 	}
@@ -335,6 +346,10 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 
 	HashSet<String> depends = singleton->dependencies[p_owner];
 
+	// Compilation has to follow dependency order, but parsing doesn't.
+	PreparsedScripts preparsed;
+	_preparse_scripts(depends, preparsed);
+
 	Error err = OK;
 	for (const String &E : depends) {
 		Error this_err = OK;
@@ -346,11 +361,75 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 		}
 	}
 
+	_clear_preparsed_scripts(preparsed);
+
 	singleton->dependencies.erase(p_owner);
 
 	return err;
 }
 
+void GDScriptCache::_preparse_script(uint32_t p_index, PreparsedScripts *p_preparsed) {
+	const Ref<GDScript> &scr = p_preparsed->scripts[p_index];
+	p_preparsed->errors[p_index] = p_preparsed->parsers[p_index]->parse(scr->source, scr->path, false);
+}
+
+void GDScriptCache::_preparse_scripts(const HashSet<String> &p_paths, PreparsedScripts &r_preparsed) {
+	// Waiting on a group task from a pool thread could starve the pool, so only do this from the main thread.
+	if (!Thread::is_main_thread() || WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return;
+	}
+
+	for (const String &E : p_paths) {
+		if (singleton->full_gdscript_cache.has(E)) {
+			continue;
+		}
+		Ref<GDScript> *scr = singleton->shallow_gdscript_cache.getptr(E);
+		if (!scr || (*scr)->reloading || (*scr)->preparsed_parser || (*scr)->source.is_empty()) {
+			continue;
+		}
+		r_preparsed.scripts.push_back(*scr);
+	}
+
+	if (r_preparsed.scripts.size() < 2) {
+		r_preparsed.scripts.clear();
+		return;
+	}
+
+	// Constructing parsers and the first lookups of some static tables aren't thread-safe, do them here.
+	r_preparsed.parsers.resize(r_preparsed.scripts.size());
+	r_preparsed.errors.resize(r_preparsed.scripts.size());
+	for (uint32_t i = 0; i < r_preparsed.parsers.size(); i++) {
+		r_preparsed.parsers[i] = memnew(GDScriptParser);
+	}
+	GDScriptParser::get_builtin_type(StringName());
+#ifdef DEBUG_ENABLED
+	if (TS->has_feature(TextServer::FEATURE_UNICODE_SECURITY)) {
+		TS->spoof_check("_");
+	}
+#endif
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(singleton, &GDScriptCache::_preparse_script, &r_preparsed, r_preparsed.scripts.size(), -1, true, SNAME("GDScriptPreparse"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (uint32_t i = 0; i < r_preparsed.scripts.size(); i++) {
+		r_preparsed.scripts[i]->preparsed_parser = r_preparsed.parsers[i];
+		r_preparsed.scripts[i]->preparsed_error = r_preparsed.errors[i];
+	}
+}
+
+void GDScriptCache::_clear_preparsed_scripts(PreparsedScripts &p_preparsed) {
+	for (uint32_t i = 0; i < p_preparsed.scripts.size(); i++) {
+		// Left over if the script was already compiled as a dependency of another one.
+		if (p_preparsed.scripts[i]->preparsed_parser == p_preparsed.parsers[i]) {
+			p_preparsed.scripts[i]->preparsed_parser = nullptr;
+		}
+		memdelete(p_preparsed.parsers[i]);
+	}
+	p_preparsed.scripts.clear();
+	p_preparsed.parsers.clear();
+	p_preparsed.errors.clear();
+}
+
 void GDScriptCache::add_static_script(Ref<GDScript> p_script) {
 	ERR_FAIL_COND_MSG(p_script.is_null(), "Trying to cache empty script as static.");
 	ERR_FAIL_COND_MSG(!p_script->is_valid(), "Trying to cache non-compiled script as static.");
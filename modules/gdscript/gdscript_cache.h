@@ -37,6 +37,7 @@
 #include "core/os/mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/packed_scene.h"
 
 class GDScriptAnalyzer;
@@ -58,6 +59,7 @@ private:
 	Status status = EMPTY;
 	Error result = OK;
 	String path;
+	String source; // Set when the source was already loaded, so parsing doesn't read it again.
 	bool cleared = false;
 
 	friend class GDScriptCache;
@@ -94,10 +96,21 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	// Scripts whose sources are parsed in parallel before being compiled one after the other.
+	struct PreparsedScripts {
+		LocalVector<Ref<GDScript>> scripts;
+		LocalVector<GDScriptParser *> parsers;
+		LocalVector<Error> errors;
+	};
+
+	void _preparse_script(uint32_t p_index, PreparsedScripts *p_preparsed);
+	static void _preparse_scripts(const HashSet<String> &p_paths, PreparsedScripts &r_preparsed);
+	static void _clear_preparsed_scripts(PreparsedScripts &p_preparsed);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
-	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String(), const String &p_source = String());
 	static String get_source_code(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String(), bool p_update_from_disk = false);
@@ -37,6 +37,7 @@
 #include "core/object/script_language.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -389,9 +390,50 @@ private:
 	int _stack_size = 0;
 	int _instruction_args_size = 0;
 
+	// Inline cache of the setter or getter method binds used by a named property access
+	// site on engine objects, keyed on the receiver's class. Slots are filled at most once,
+	// so they can be read without locking while other threads run the same function.
+	struct PropertyCache {
+		enum {
+			MAX_SLOTS = 4,
+		};
+		struct Slot {
+			SafeFlag ready;
+			const StringName *class_name = nullptr;
+			MethodBind *method = nullptr; // Null if this class can't use the cached call.
+		};
+		Slot slots[MAX_SLOTS];
+		SafeNumeric<uint32_t> used;
+
+		_FORCE_INLINE_ const Slot *find(const StringName *p_class_name) const {
+			for (int i = 0; i < MAX_SLOTS; i++) {
+				if (!slots[i].ready.is_set()) {
+					return nullptr;
+				}
+				if (slots[i].class_name == p_class_name) {
+					return &slots[i];
+				}
+			}
+			return nullptr;
+		}
+
+		void add(const StringName *p_class_name, MethodBind *p_method) {
+			if (used.get() >= MAX_SLOTS) {
+				return; // Polymorphic beyond what we cache, keep using the regular path.
+			}
+			uint32_t index = used.postincrement();
+			if (index >= MAX_SLOTS) {
+				return;
+			}
+			slots[index].class_name = p_class_name;
+			slots[index].method = p_method;
+			slots[index].ready.set();
+		}
+	};
+
 	SelfList<GDScriptFunction> function_list{ this };
 	mutable Variant nil;
-	HashMap<int, Variant::Type> temporary_slots;
+	LocalVector<Pair<int, Variant::Type>> temporary_slots; // Stack index and type of typed temporaries, initialized on every call.
 	List<StackDebug> stack_debug;
 
 	Vector<int> code;
@@ -411,6 +453,7 @@ private:
 	Vector<GDScriptUtilityFunctions::FunctionPtr> gds_utilities;
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
+	LocalVector<PropertyCache> property_caches;
 
 	int _code_size = 0;
 	int _default_arg_count = 0;
@@ -429,6 +472,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _property_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -447,6 +491,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	PropertyCache *_property_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "gdscript.h"
+
+#include "core/debugger/engine_debugger.h"
+#include "core/os/os.h"
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_userdata);
+	while (profiler->running.is_set()) {
+		profiler->_take_sample();
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+	}
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	if (!language) {
+		return;
+	}
+
+	LocalVector<String> stacks;
+	{
+		// Functions unregister themselves under the language mutex when freed, so holding it keeps the
+		// functions referenced by live frames valid. The owning threads keep running meanwhile; a frame
+		// pushed or popped while reading only makes this one sample slightly off.
+		MutexLock language_lock(language->mutex);
+		MutexLock lock(GDScriptLanguage::call_stacks_mutex);
+		for (const GDScriptLanguage::CallStack *call_stack : GDScriptLanguage::call_stacks) {
+			int depth = MIN(call_stack->stack_pos, language->_debug_max_call_stack);
+			if (depth <= 0) {
+				continue;
+			}
+
+			String stack;
+			for (int i = 0; i < depth; i++) {
+				const GDScriptLanguage::CallLevel &level = call_stack->levels[i];
+				if (!level.function) {
+					continue;
+				}
+				if (!stack.is_empty()) {
+					stack += ";";
+				}
+				const GDScript *script = level.function->get_script();
+				stack += vformat("%s:%d %s", script ? script->get_script_path() : String("<unknown>"), level.line ? *level.line : 0, level.function->get_name());
+			}
+			if (!stack.is_empty()) {
+				stacks.push_back(vformat("thread %d;", (uint64_t)call_stack->thread_id) + stack);
+			}
+		}
+	}
+
+	if (stacks.is_empty()) {
+		return;
+	}
+
+	MutexLock lock(samples_mutex);
+	for (const String &stack : stacks) {
+		HashMap<String, uint64_t>::Iterator E = samples.find(stack);
+		if (E) {
+			E->value++;
+		} else {
+			samples.insert(stack, 1);
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::start(uint64_t p_interval_usec) {
+	if (running.is_set()) {
+		return;
+	}
+	interval_usec = MAX<uint64_t>(p_interval_usec, 100);
+	running.set();
+	thread.start(_thread_func, this);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!running.is_set()) {
+		return;
+	}
+	running.clear();
+	thread.wait_to_finish();
+}
+
+HashMap<String, uint64_t> GDScriptSamplingProfiler::take_samples() {
+	MutexLock lock(samples_mutex);
+	HashMap<String, uint64_t> taken = samples;
+	samples.clear();
+	return taken;
+}
+
+String GDScriptSamplingProfiler::take_folded_stacks() {
+	String folded;
+	for (const KeyValue<String, uint64_t> &E : take_samples()) {
+		folded += vformat("%s %d\n", E.key, E.value);
+	}
+	return folded;
+}
+
+void GDScriptSamplingProfiler::toggle(bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		take_samples();
+		start(p_opts.size() > 0 ? uint64_t(p_opts[0]) : 1000);
+	} else {
+		stop();
+	}
+}
+
+void GDScriptSamplingProfiler::tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+	uint64_t pt = OS::get_singleton()->get_ticks_msec();
+	if (pt - last_send_time < 1000) {
+		return;
+	}
+	last_send_time = pt;
+
+	HashMap<String, uint64_t> taken = take_samples();
+	if (taken.is_empty()) {
+		return;
+	}
+
+	Array arr;
+	for (const KeyValue<String, uint64_t> &E : taken) {
+		arr.push_back(E.key);
+		arr.push_back(E.value);
+	}
+	EngineDebugger::get_singleton()->send_message("gdscript_sampler:samples", arr);
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	stop();
+}
+
+#endif // DEBUG_ENABLED
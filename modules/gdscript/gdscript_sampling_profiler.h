@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#ifdef DEBUG_ENABLED
+
+#include "core/debugger/engine_profiler.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/safe_refcount.h"
+
+// Periodically captures the GDScript call stacks of all threads from a background thread, instead of
+// timing every call like the instrumenting "scripts" profiler does. Script threads only pay for the call
+// stack bookkeeping debug builds already do.
+//
+// Samples are aggregated in the "folded stacks" format used by flame graph tools: one line per distinct
+// stack, frames ordered from the root to the leaf as "path:line function", separated by ';'.
+// Bound to the remote debugger as the "gdscript_sampler" profiler; its option is the sampling interval in
+// microseconds. While enabled, it sends "gdscript_sampler:samples" messages as flat [stack, count, ...] arrays.
+class GDScriptSamplingProfiler : public EngineProfiler {
+	Thread thread;
+	SafeFlag running;
+	uint64_t interval_usec = 1000;
+
+	Mutex samples_mutex;
+	HashMap<String, uint64_t> samples;
+	uint64_t last_send_time = 0;
+
+	static void _thread_func(void *p_userdata);
+	void _take_sample();
+
+public:
+	void start(uint64_t p_interval_usec = 1000);
+	void stop();
+	bool is_running() const { return running.is_set(); }
+
+	// Returns and clears the samples aggregated so far.
+	HashMap<String, uint64_t> take_samples();
+	String take_folded_stacks();
+
+	virtual void toggle(bool p_enable, const Array &p_opts) override;
+	virtual void add(const Array &p_data) override {}
+	virtual void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
+
+	~GDScriptSamplingProfiler();
+};
+
+#endif // DEBUG_ENABLED
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
@@ -423,6 +423,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	r_err.error = Callable::CallError::CALL_OK;
 
+	MEMORY_TAG_SCOPE(TAG_SCRIPT);
+
 	static thread_local int call_depth = 0;
 	if (unlikely(++call_depth > MAX_CALL_DEPTH)) {
 		call_depth--;
@@ -536,8 +538,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			instruction_args = nullptr;
 		}
 
-		for (const KeyValue<int, Variant::Type> &E : temporary_slots) {
-			type_init_function_table[E.value](&stack[E.key]);
+		for (const Pair<int, Variant::Type> &E : temporary_slots) {
+			type_init_function_table[E.second](&stack[E.first]);
 		}
 	}
 
@@ -1042,7 +1044,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1053,7 +1055,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				const StringName *index = &_global_names_ptr[indexname];
 
 				bool valid;
+#ifdef TOOLS_ENABLED
+				// Object::set() also marks the object as edited, which the cache would skip.
 				dst->set_named(*index, *value, valid);
+#else
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _property_caches_count);
+				PropertyCache *cache = &_property_caches_ptr[cache_index];
+
+				MethodBind *setter = nullptr;
+				Object *base_obj = dst->get_type() == Variant::OBJECT ? dst->get_validated_object() : nullptr;
+				if (base_obj && !base_obj->get_script_instance()) {
+					const StringName *class_name = &base_obj->get_class_name();
+					const PropertyCache::Slot *slot = cache->find(class_name);
+					if (slot) {
+						setter = slot->method;
+					} else {
+						cache->add(class_name, ClassDB::get_property_setter_method(*class_name, *index));
+					}
+				}
+
+				if (setter) {
+					const Variant *args[1] = { value };
+					Callable::CallError ce;
+					setter->call(base_obj, args, 1, ce);
+					valid = ce.error == Callable::CallError::CALL_OK;
+				} else {
+					dst->set_named(*index, *value, valid);
+				}
+#endif
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1070,7 +1100,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1090,7 +1120,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1100,6 +1130,34 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _property_caches_count);
+				PropertyCache *cache = &_property_caches_ptr[cache_index];
+
+				// Plain engine objects always resolve a property to the same getter, so skip the lookup.
+				MethodBind *getter = nullptr;
+				Object *base_obj = src->get_type() == Variant::OBJECT ? src->get_validated_object() : nullptr;
+				if (base_obj && !base_obj->get_script_instance()) {
+					const StringName *class_name = &base_obj->get_class_name();
+					const PropertyCache::Slot *slot = cache->find(class_name);
+					if (slot) {
+						getter = slot->method;
+					} else {
+						cache->add(class_name, ClassDB::get_property_getter_method(*class_name, *index));
+					}
+				}
+
+				if (getter) {
+					Callable::CallError ce;
+					Variant ret = getter->call(base_obj, nullptr, 0, ce);
+					if (ce.error == Callable::CallError::CALL_OK) {
+						*dst = ret;
+						ip += 5;
+						DISPATCH_OPCODE;
+					}
+					// Call errors are raised before the getter runs, so let the regular path report it.
+				}
+
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
@@ -1115,7 +1173,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
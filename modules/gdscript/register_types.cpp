@@ -33,6 +33,7 @@
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
 #include "gdscript_cache.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_utility_functions.h"
 
@@ -122,6 +123,10 @@ static void _editor_init() {
 
 #endif // TOOLS_ENABLED
 
+#ifdef DEBUG_ENABLED
+static Ref<GDScriptSamplingProfiler> gdscript_sampling_profiler;
+#endif
+
 void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
 		GDREGISTER_CLASS(GDScript);
@@ -138,6 +143,11 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 		gdscript_cache = memnew(GDScriptCache);
 
 		GDScriptUtilityFunctions::register_functions();
+
+#ifdef DEBUG_ENABLED
+		gdscript_sampling_profiler.instantiate();
+		gdscript_sampling_profiler->bind("gdscript_sampler");
+#endif
 	}
 
 #ifdef TOOLS_ENABLED
@@ -152,6 +162,10 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
+#ifdef DEBUG_ENABLED
+		gdscript_sampling_profiler.unref();
+#endif
+
 		ScriptServer::unregister_language(script_language_gd);
 
 		if (gdscript_cache) {
@@ -0,0 +1,31 @@
+# Untyped property access sites cache the resolved getter and setter per class,
+# so they must keep working when the receiver's class changes between calls.
+
+class Scripted:
+	extends RefCounted
+	var name := "scripted"
+
+func get_name_of(object):
+	return object.name
+
+func set_name_of(object, value):
+	object.name = value
+
+func test():
+	var objects := [Node.new(), Node2D.new(), Node3D.new(), Control.new(), Timer.new(), Scripted.new()]
+	for i in 3:
+		for object in objects:
+			set_name_of(object, "%s_%d" % [object.get_class(), i])
+			print(get_name_of(object))
+
+	var timer := Timer.new()
+	for i in 2:
+		print(timer.get("wait_time"))
+		var untyped = timer
+		untyped.wait_time = 2.0 + i
+		print(untyped.wait_time)
+	timer.free()
+
+	for object in objects:
+		if object is Node:
+			object.free()
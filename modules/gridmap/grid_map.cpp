@@ -42,6 +42,17 @@
 #include "servers/navigation_server_3d.h"
 #include "servers/rendering_server.h"
 
+// Neighbors across the faces of a cell when merging meshes, bit i of MergeCell::covered_faces is set when
+// the neighbor at _merge_face_dirs[i] is occupied.
+static const Vector3i _merge_face_dirs[6] = {
+	Vector3i(1, 0, 0),
+	Vector3i(-1, 0, 0),
+	Vector3i(0, 1, 0),
+	Vector3i(0, -1, 0),
+	Vector3i(0, 0, 1),
+	Vector3i(0, 0, -1),
+};
+
 bool GridMap::_set(const StringName &p_name, const Variant &p_value) {
 	String name = p_name;
 
@@ -236,6 +247,15 @@ bool GridMap::is_baking_navigation() {
 	return bake_navigation;
 }
 
+void GridMap::set_merge_meshes(bool p_enable) {
+	merge_meshes = p_enable;
+	_recreate_octant_data();
+}
+
+bool GridMap::is_merging_meshes() const {
+	return merge_meshes;
+}
+
 void GridMap::set_navigation_map(RID p_navigation_map) {
 	map_override = p_navigation_map;
 	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
@@ -353,6 +373,9 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 			g.cells.erase(key);
 			g.dirty = true;
 			cell_map.erase(key);
+			if (merge_meshes && !recreating_octants) {
+				_octant_mark_neighbors_dirty(p_position);
+			}
 			_queue_octants_dirty();
 		}
 		return;
@@ -399,6 +422,9 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 	c.item = p_item;
 	c.rot = p_rot;
 
+	if (merge_meshes && !recreating_octants && !cell_map.has(key)) {
+		_octant_mark_neighbors_dirty(p_position);
+	}
 	cell_map[key] = c;
 }
 
@@ -541,6 +567,10 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	for (int i = 0; i < g.multimesh_instances.size(); i++) {
 		RS::get_singleton()->instance_set_transform(g.multimesh_instances[i].instance, get_global_transform());
 	}
+
+	if (g.merged_instance.is_valid()) {
+		RS::get_singleton()->instance_set_transform(g.merged_instance, get_global_transform());
+	}
 }
 
 bool GridMap::_octant_update(const OctantKey &p_key) {
@@ -550,6 +580,11 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		return false;
 	}
 
+	if (g.merge_task) {
+		// The merged mesh for the previous state is still being built, the octant is updated again once it's applied.
+		return false;
+	}
+
 	//erase body shapes
 	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
 
@@ -595,6 +630,13 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 
 	HashMap<int, List<Pair<Transform3D, IndexKey>>> multimesh_items;
 
+	// When merging, the cells are combined into one mesh per material on a worker thread instead of multimeshes.
+	MergeTask *merge_task = nullptr;
+	if (merge_meshes && baked_meshes.size() == 0 && mesh_library.is_valid()) {
+		merge_task = memnew(MergeTask);
+		merge_task->cell_size = cell_size;
+	}
+
 	for (const IndexKey &E : g.cells) {
 		ERR_CONTINUE(!cell_map.has(E));
 		const Cell &c = cell_map[E];
@@ -611,7 +653,25 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		xform.basis = _ortho_bases[c.rot];
 		xform.set_origin(cellpos * cell_size + ofs);
 		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
-		if (baked_meshes.size() == 0) {
+
+		// Cells surrounded on all sides can't be seen or reached, they get neither geometry nor collision.
+		uint8_t covered_faces = merge_task ? _get_covered_faces(E) : 0;
+		bool enclosed = covered_faces == 0x3F;
+
+		if (merge_task) {
+			if (!enclosed && mesh_library->get_item_mesh(c.item).is_valid()) {
+				if (!merge_task->item_surfaces.has(c.item)) {
+					merge_task->item_surfaces[c.item] = _get_merge_item_surfaces(c.item);
+				}
+
+				MergeCell mc;
+				mc.item = c.item;
+				mc.xform = xform * mesh_library->get_item_mesh_transform(c.item);
+				mc.center = xform.origin;
+				mc.covered_faces = covered_faces;
+				merge_task->cells.push_back(mc);
+			}
+		} else if (baked_meshes.size() == 0) {
 			if (mesh_library->get_item_mesh(c.item).is_valid()) {
 				if (!multimesh_items.has(c.item)) {
 					multimesh_items[c.item] = List<Pair<Transform3D, IndexKey>>();
@@ -624,7 +684,7 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 			}
 		}
 
-		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
+		Vector<MeshLibrary::ShapeData> shapes = enclosed ? Vector<MeshLibrary::ShapeData>() : mesh_library->get_item_shapes(c.item);
 		// add the item's shape at given xform to octant's static_body
 		for (int i = 0; i < shapes.size(); i++) {
 			// add the item's shape
@@ -685,8 +745,20 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	}
 #endif // DEBUG_ENABLED
 
+	if (merge_task) {
+		// The previous merged mesh stays visible until the new one replaces it.
+		g.merge_task = merge_task;
+		merge_task->task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &GridMap::_octant_merge_thread, merge_task, false, SNAME("GridMapMergeOctant"));
+		set_process_internal(true);
+	} else if (g.merged_instance.is_valid()) {
+		RS::get_singleton()->free(g.merged_instance);
+		RS::get_singleton()->free(g.merged_mesh);
+		g.merged_instance = RID();
+		g.merged_mesh = RID();
+	}
+
 	//update multimeshes, only if not baked
-	if (baked_meshes.size() == 0) {
+	if (!merge_task && baked_meshes.size() == 0) {
 		for (const KeyValue<int, List<Pair<Transform3D, IndexKey>>> &E : multimesh_items) {
 			Octant::MultimeshInstance mmi;
 
@@ -741,6 +813,236 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	return false;
 }
 
+const Vector<GridMap::MergeItemSurface> &GridMap::_get_merge_item_surfaces(int p_item) {
+	Vector<MergeItemSurface> *surfaces = merge_item_surfaces.getptr(p_item);
+	if (surfaces) {
+		return *surfaces;
+	}
+
+	// Arrays are read back once per item, so worker threads never need to access the mesh.
+	Vector<MergeItemSurface> item_surfaces;
+	Ref<Mesh> mesh = mesh_library->get_item_mesh(p_item);
+	for (int i = 0; i < mesh->get_surface_count(); i++) {
+		if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+		MergeItemSurface surface;
+		surface.material = mesh->surface_get_material(i);
+		surface.arrays = mesh->surface_get_arrays(i);
+		item_surfaces.push_back(surface);
+	}
+	return merge_item_surfaces.insert(p_item, item_surfaces)->value;
+}
+
+uint8_t GridMap::_get_covered_faces(const IndexKey &p_key) const {
+	uint8_t covered = 0;
+	for (int i = 0; i < 6; i++) {
+		const Cell *neighbor = cell_map.getptr(IndexKey(Vector3i(p_key) + _merge_face_dirs[i]));
+		if (neighbor && mesh_library->has_item(neighbor->item)) {
+			covered |= 1 << i;
+		}
+	}
+	return covered;
+}
+
+void GridMap::_octant_mark_neighbors_dirty(const Vector3i &p_position) {
+	// Faces between cells are removed when merging, so neighbors in other octants change as well.
+	for (int i = 0; i < 6; i++) {
+		const Vector3i neighbor = p_position + _merge_face_dirs[i];
+		if (!cell_map.has(neighbor)) {
+			continue;
+		}
+		OctantKey ok;
+		ok.x = neighbor.x / octant_size;
+		ok.y = neighbor.y / octant_size;
+		ok.z = neighbor.z / octant_size;
+		Octant **g = octant_map.getptr(ok);
+		if (g) {
+			(*g)->dirty = true;
+		}
+	}
+}
+
+void GridMap::_octant_merge_thread(MergeTask *p_task) {
+	struct MergeBuffer {
+		RID material;
+		uint32_t format = 0;
+		LocalVector<Vector3> vertices;
+		LocalVector<Vector3> normals;
+		LocalVector<float> tangents;
+		LocalVector<Color> colors;
+		LocalVector<Vector2> uvs;
+		LocalVector<Vector2> uv2s;
+		LocalVector<int> indices;
+	};
+
+	LocalVector<MergeBuffer> buffers;
+	LocalVector<int> remap;
+	const Vector3 half_size = p_task->cell_size * 0.5;
+	const Vector3 epsilon = p_task->cell_size * 0.001;
+
+	for (const MergeCell &cell : p_task->cells) {
+		const Vector<MergeItemSurface> *surfaces = p_task->item_surfaces.getptr(cell.item);
+		if (!surfaces) {
+			continue;
+		}
+
+		for (const MergeItemSurface &surface : *surfaces) {
+			const PackedVector3Array vertices = surface.arrays[RS::ARRAY_VERTEX];
+			const PackedVector3Array normals = surface.arrays[RS::ARRAY_NORMAL];
+			const PackedFloat32Array tangents = surface.arrays[RS::ARRAY_TANGENT];
+			const PackedColorArray colors = surface.arrays[RS::ARRAY_COLOR];
+			const PackedVector2Array uvs = surface.arrays[RS::ARRAY_TEX_UV];
+			const PackedVector2Array uv2s = surface.arrays[RS::ARRAY_TEX_UV2];
+			const PackedInt32Array indices = surface.arrays[RS::ARRAY_INDEX];
+			const int vertex_count = vertices.size();
+			if (vertex_count == 0) {
+				continue;
+			}
+
+			uint32_t format = RS::ARRAY_FORMAT_VERTEX;
+			format |= normals.size() == vertex_count ? RS::ARRAY_FORMAT_NORMAL : 0;
+			format |= tangents.size() == vertex_count * 4 ? RS::ARRAY_FORMAT_TANGENT : 0;
+			format |= colors.size() == vertex_count ? RS::ARRAY_FORMAT_COLOR : 0;
+			format |= uvs.size() == vertex_count ? RS::ARRAY_FORMAT_TEX_UV : 0;
+			format |= uv2s.size() == vertex_count ? RS::ARRAY_FORMAT_TEX_UV2 : 0;
+
+			const RID material = surface.material.is_valid() ? surface.material->get_rid() : RID();
+			MergeBuffer *buffer = nullptr;
+			for (MergeBuffer &B : buffers) {
+				if (B.material == material && B.format == format) {
+					buffer = &B;
+					break;
+				}
+			}
+			if (!buffer) {
+				buffers.push_back(MergeBuffer());
+				buffer = &buffers[buffers.size() - 1];
+				buffer->material = material;
+				buffer->format = format;
+			}
+
+			remap.resize(vertex_count);
+			for (int i = 0; i < vertex_count; i++) {
+				remap[i] = -1;
+			}
+
+			const int index_count = indices.size() ? indices.size() : vertex_count;
+			for (int i = 0; i + 2 < index_count; i += 3) {
+				int tri[3];
+				Vector3 points[3];
+				for (int j = 0; j < 3; j++) {
+					tri[j] = indices.size() ? indices[i + j] : i + j;
+					ERR_FAIL_INDEX(tri[j], vertex_count);
+					points[j] = cell.xform.xform(vertices[tri[j]]);
+				}
+
+				// Drop triangles lying on a face of the cell that is covered by the neighbor across it.
+				bool hidden = false;
+				for (int face = 0; face < 6 && !hidden; face++) {
+					if (!(cell.covered_faces & (1 << face))) {
+						continue;
+					}
+					const int axis = face / 2;
+					const real_t plane = cell.center[axis] + (face % 2 ? -half_size[axis] : half_size[axis]);
+					hidden = Math::abs(points[0][axis] - plane) <= epsilon[axis] && Math::abs(points[1][axis] - plane) <= epsilon[axis] && Math::abs(points[2][axis] - plane) <= epsilon[axis];
+				}
+				if (hidden) {
+					continue;
+				}
+
+				for (int j = 0; j < 3; j++) {
+					const int src = tri[j];
+					if (remap[src] == -1) {
+						remap[src] = buffer->vertices.size();
+						buffer->vertices.push_back(points[j]);
+						if (format & RS::ARRAY_FORMAT_NORMAL) {
+							buffer->normals.push_back(cell.xform.basis.xform(normals[src]).normalized());
+						}
+						if (format & RS::ARRAY_FORMAT_TANGENT) {
+							const Vector3 tangent = cell.xform.basis.xform(Vector3(tangents[src * 4 + 0], tangents[src * 4 + 1], tangents[src * 4 + 2])).normalized();
+							buffer->tangents.push_back(tangent.x);
+							buffer->tangents.push_back(tangent.y);
+							buffer->tangents.push_back(tangent.z);
+							buffer->tangents.push_back(tangents[src * 4 + 3]);
+						}
+						if (format & RS::ARRAY_FORMAT_COLOR) {
+							buffer->colors.push_back(colors[src]);
+						}
+						if (format & RS::ARRAY_FORMAT_TEX_UV) {
+							buffer->uvs.push_back(uvs[src]);
+						}
+						if (format & RS::ARRAY_FORMAT_TEX_UV2) {
+							buffer->uv2s.push_back(uv2s[src]);
+						}
+					}
+					buffer->indices.push_back(remap[src]);
+				}
+			}
+		}
+	}
+
+	for (const MergeBuffer &B : buffers) {
+		if (B.indices.is_empty()) {
+			continue;
+		}
+		Array arrays;
+		arrays.resize(RS::ARRAY_MAX);
+		arrays[RS::ARRAY_VERTEX] = Vector<Vector3>(B.vertices);
+		if (B.format & RS::ARRAY_FORMAT_NORMAL) {
+			arrays[RS::ARRAY_NORMAL] = Vector<Vector3>(B.normals);
+		}
+		if (B.format & RS::ARRAY_FORMAT_TANGENT) {
+			arrays[RS::ARRAY_TANGENT] = Vector<float>(B.tangents);
+		}
+		if (B.format & RS::ARRAY_FORMAT_COLOR) {
+			arrays[RS::ARRAY_COLOR] = Vector<Color>(B.colors);
+		}
+		if (B.format & RS::ARRAY_FORMAT_TEX_UV) {
+			arrays[RS::ARRAY_TEX_UV] = Vector<Vector2>(B.uvs);
+		}
+		if (B.format & RS::ARRAY_FORMAT_TEX_UV2) {
+			arrays[RS::ARRAY_TEX_UV2] = Vector<Vector2>(B.uv2s);
+		}
+		arrays[RS::ARRAY_INDEX] = Vector<int>(B.indices);
+		p_task->materials.push_back(B.material);
+		p_task->surfaces.push_back(arrays);
+	}
+}
+
+void GridMap::_octant_apply_merged_mesh(Octant &p_octant) {
+	MergeTask *task = p_octant.merge_task;
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task->task_id);
+
+	RID mesh = RS::get_singleton()->mesh_create();
+	for (uint32_t i = 0; i < task->surfaces.size(); i++) {
+		RS::get_singleton()->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, task->surfaces[i]);
+		RS::get_singleton()->mesh_surface_set_material(mesh, i, task->materials[i]);
+	}
+
+	if (p_octant.merged_instance.is_null()) {
+		p_octant.merged_instance = RS::get_singleton()->instance_create();
+		RS::get_singleton()->instance_attach_object_instance_id(p_octant.merged_instance, get_instance_id());
+		if (is_inside_world()) {
+			RS::get_singleton()->instance_set_scenario(p_octant.merged_instance, get_world_3d()->get_scenario());
+			RS::get_singleton()->instance_set_transform(p_octant.merged_instance, get_global_transform());
+		}
+		if (is_inside_tree()) {
+			RS::get_singleton()->instance_set_visible(p_octant.merged_instance, is_visible_in_tree());
+		}
+	}
+
+	// Swapping the base replaces the whole octant at once.
+	RS::get_singleton()->instance_set_base(p_octant.merged_instance, mesh);
+	if (p_octant.merged_mesh.is_valid()) {
+		RS::get_singleton()->free(p_octant.merged_mesh);
+	}
+	p_octant.merged_mesh = mesh;
+
+	memdelete(task);
+	p_octant.merge_task = nullptr;
+}
+
 void GridMap::_update_physics_bodies_collision_properties() {
 	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
 		PhysicsServer3D::get_singleton()->body_set_collision_layer(E.value->static_body, collision_layer);
@@ -765,6 +1067,11 @@ void GridMap::_octant_enter_world(const OctantKey &p_key) {
 		RS::get_singleton()->instance_set_transform(g.multimesh_instances[i].instance, get_global_transform());
 	}
 
+	if (g.merged_instance.is_valid()) {
+		RS::get_singleton()->instance_set_scenario(g.merged_instance, get_world_3d()->get_scenario());
+		RS::get_singleton()->instance_set_transform(g.merged_instance, get_global_transform());
+	}
+
 	if (bake_navigation && mesh_library.is_valid()) {
 		for (KeyValue<IndexKey, Octant::NavigationCell> &F : g.navigation_cell_ids) {
 			if (cell_map.has(F.key) && F.value.region.is_valid() == false) {
@@ -819,6 +1126,10 @@ void GridMap::_octant_exit_world(const OctantKey &p_key) {
 		RS::get_singleton()->instance_set_scenario(g.multimesh_instances[i].instance, RID());
 	}
 
+	if (g.merged_instance.is_valid()) {
+		RS::get_singleton()->instance_set_scenario(g.merged_instance, RID());
+	}
+
 	for (KeyValue<IndexKey, Octant::NavigationCell> &F : g.navigation_cell_ids) {
 		if (F.value.region.is_valid()) {
 			NavigationServer3D::get_singleton()->free(F.value.region);
@@ -890,6 +1201,18 @@ void GridMap::_octant_clean_up(const OctantKey &p_key) {
 		RS::get_singleton()->free(g.multimesh_instances[i].multimesh);
 	}
 	g.multimesh_instances.clear();
+
+	if (g.merge_task) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(g.merge_task->task_id);
+		memdelete(g.merge_task);
+		g.merge_task = nullptr;
+	}
+	if (g.merged_instance.is_valid()) {
+		RS::get_singleton()->free(g.merged_instance);
+		RS::get_singleton()->free(g.merged_mesh);
+		g.merged_instance = RID();
+		g.merged_mesh = RID();
+	}
 }
 
 void GridMap::_notification(int p_what) {
@@ -949,6 +1272,27 @@ void GridMap::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			_update_visibility();
 		} break;
+
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			bool pending = false;
+			for (KeyValue<OctantKey, Octant *> &E : octant_map) {
+				Octant &g = *E.value;
+				if (!g.merge_task) {
+					continue;
+				}
+				if (!WorkerThreadPool::get_singleton()->is_task_completed(g.merge_task->task_id)) {
+					pending = true;
+					continue;
+				}
+				_octant_apply_merged_mesh(g);
+				if (g.dirty) {
+					_queue_octants_dirty();
+				}
+			}
+			if (!pending) {
+				set_process_internal(false);
+			}
+		} break;
 	}
 }
 
@@ -963,6 +1307,9 @@ void GridMap::_update_visibility() {
 			const Octant::MultimeshInstance &mi = octant->multimesh_instances[i];
 			RS::get_singleton()->instance_set_visible(mi.instance, is_visible_in_tree());
 		}
+		if (octant->merged_instance.is_valid()) {
+			RS::get_singleton()->instance_set_visible(octant->merged_instance, is_visible_in_tree());
+		}
 	}
 
 	for (int i = 0; i < baked_meshes.size(); i++) {
@@ -981,6 +1328,7 @@ void GridMap::_queue_octants_dirty() {
 
 void GridMap::_recreate_octant_data() {
 	recreating_octants = true;
+	merge_item_surfaces.clear();
 	HashMap<IndexKey, Cell, IndexKey> cell_copy = cell_map;
 	_clear_internal();
 	for (const KeyValue<IndexKey, Cell> &E : cell_copy) {
@@ -1104,6 +1452,9 @@ void GridMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_bake_mesh_instance", "idx"), &GridMap::get_bake_mesh_instance);
 
 	ClassDB::bind_method(D_METHOD("clear_baked_meshes"), &GridMap::clear_baked_meshes);
+	ClassDB::bind_method(D_METHOD("set_merge_meshes", "enable"), &GridMap::set_merge_meshes);
+	ClassDB::bind_method(D_METHOD("is_merging_meshes"), &GridMap::is_merging_meshes);
+
 	ClassDB::bind_method(D_METHOD("make_baked_meshes", "gen_lightmap_uv", "lightmap_uv_texel_size"), &GridMap::make_baked_meshes, DEFVAL(false), DEFVAL(0.1));
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "mesh_library", PROPERTY_HINT_RESOURCE_TYPE, "MeshLibrary"), "set_mesh_library", "get_mesh_library");
@@ -1121,6 +1472,8 @@ void GridMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "collision_priority"), "set_collision_priority", "get_collision_priority");
 	ADD_GROUP("Navigation", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bake_navigation"), "set_bake_navigation", "is_baking_navigation");
+	ADD_GROUP("Rendering", "");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "merge_meshes"), "set_merge_meshes", "is_merging_meshes");
 
 	BIND_CONSTANT(INVALID_CELL_ITEM);
 
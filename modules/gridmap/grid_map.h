@@ -31,6 +31,7 @@
 #ifndef GRID_MAP_H
 #define GRID_MAP_H
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/mesh_library.h"
 #include "scene/resources/multimesh.h"
@@ -90,6 +91,32 @@ class GridMap : public Node3D {
 		uint32_t cell = 0;
 	};
 
+	/**
+	 * @brief Input and output of building the merged mesh of an Octant on a worker thread (see merge_meshes).
+	 */
+	struct MergeItemSurface {
+		Ref<Material> material;
+		Array arrays;
+	};
+
+	struct MergeCell {
+		int item = 0;
+		Transform3D xform;
+		Vector3 center;
+		uint8_t covered_faces = 0; // One bit per occupied neighbor, in the order of _merge_face_dirs.
+	};
+
+	struct MergeTask {
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		Vector3 cell_size;
+		LocalVector<MergeCell> cells;
+		HashMap<int, Vector<MergeItemSurface>> item_surfaces;
+
+		// One surface per material and vertex format.
+		LocalVector<RID> materials;
+		LocalVector<Array> surfaces;
+	};
+
 	/**
 	 * @brief An Octant is a prism containing Cells, and possibly belonging to an Area.
 	 * A GridMap can have multiple Octants.
@@ -115,6 +142,9 @@ class GridMap : public Node3D {
 		};
 
 		Vector<MultimeshInstance> multimesh_instances;
+		RID merged_mesh;
+		RID merged_instance;
+		MergeTask *merge_task = nullptr;
 		HashSet<IndexKey> cells;
 		RID collision_debug;
 		RID collision_debug_instance;
@@ -154,6 +184,7 @@ class GridMap : public Node3D {
 	real_t collision_priority = 1.0;
 	Ref<PhysicsMaterial> physics_material;
 	bool bake_navigation = false;
+	bool merge_meshes = false;
 	RID map_override;
 	uint32_t navigation_layers = 1;
 
@@ -193,6 +224,13 @@ class GridMap : public Node3D {
 	bool _octant_update(const OctantKey &p_key);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
+
+	HashMap<int, Vector<MergeItemSurface>> merge_item_surfaces;
+	const Vector<MergeItemSurface> &_get_merge_item_surfaces(int p_item);
+	uint8_t _get_covered_faces(const IndexKey &p_key) const;
+	void _octant_mark_neighbors_dirty(const Vector3i &p_position);
+	void _octant_merge_thread(MergeTask *p_task);
+	void _octant_apply_merged_mesh(Octant &p_octant);
 #ifdef DEBUG_ENABLED
 	void _update_octant_navigation_debug_edge_connections_mesh(const OctantKey &p_key);
 	void _navigation_map_changed(RID p_map);
@@ -255,6 +293,9 @@ public:
 	void set_bake_navigation(bool p_bake_navigation);
 	bool is_baking_navigation();
 
+	void set_merge_meshes(bool p_enable);
+	bool is_merging_meshes() const;
+
 	void set_navigation_map(RID p_navigation_map);
 	RID get_navigation_map() const;
 
@@ -937,8 +937,10 @@ LightmapperRD::BakeError LightmapperRD::_denoise(RenderingDevice *p_rd, Ref<RDSh
 
 	// We denoise in fixed size regions and synchronize execution to avoid GPU timeouts.
 	// We use a region with 1/4 the amount of pixels if we're denoising SH lightmaps, as
-	// all four of them are denoised in the shader in one dispatch.
-	const int max_region_size = p_bake_sh ? 512 : 1024;
+	// all four of them are denoised in the shader in one dispatch. Slower GPUs can lower
+	// the region size used for baking, which then also applies here.
+	const int bake_region_size = nearest_power_of_2_templated(int(GLOBAL_GET("rendering/lightmapping/bake_performance/region_size")));
+	const int max_region_size = MIN(p_bake_sh ? 512 : 1024, bake_region_size * (p_bake_sh ? 1 : 2));
 	int x_regions = (p_atlas_size.width - 1) / max_region_size + 1;
 	int y_regions = (p_atlas_size.height - 1) / max_region_size + 1;
 	for (int s = 0; s < p_atlas_slices; s++) {
@@ -1636,7 +1638,15 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 							int total = (atlas_slices * x_regions * y_regions * ray_iterations);
 							int percent = count * 100 / total;
 							float p = float(count) / total * 0.1;
-							p_step_function(0.6 + p, vformat(RTR("Integrate indirect lighting %d%%"), percent), p_bake_userdata, false);
+							if (p_step_function(0.6 + p, vformat(RTR("Integrate indirect lighting %d%%"), percent), p_bake_userdata, false)) {
+								// Every dispatch is synchronized, so the bake can be stopped cleanly between them.
+								FREE_TEXTURES
+								FREE_BUFFERS
+								FREE_RASTER_RESOURCES
+								FREE_COMPUTE_RESOURCES
+								memdelete(rd);
+								return BAKE_ERROR_USER_ABORTED;
+							}
 						}
 					}
 				}
@@ -1720,7 +1730,15 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 			if (p_step_function) {
 				int percent = i * 100 / ray_iterations;
 				float p = float(i) / ray_iterations * 0.1;
-				p_step_function(0.7 + p, vformat(RTR("Integrating light probes %d%%"), percent), p_bake_userdata, false);
+				if (p_step_function(0.7 + p, vformat(RTR("Integrating light probes %d%%"), percent), p_bake_userdata, false)) {
+					rd->free(light_probe_buffer);
+					FREE_TEXTURES
+					FREE_BUFFERS
+					FREE_RASTER_RESOURCES
+					FREE_COMPUTE_RESOURCES
+					memdelete(rd);
+					return BAKE_ERROR_USER_ABORTED;
+				}
 			}
 		}
 	}
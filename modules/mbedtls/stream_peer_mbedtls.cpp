@@ -33,6 +33,9 @@
 #include "core/io/file_access.h"
 #include "core/io/stream_peer_tcp.h"
 
+Mutex StreamPeerMbedTLS::session_cache_mutex;
+HashMap<String, mbedtls_ssl_session *> StreamPeerMbedTLS::session_cache;
+
 int StreamPeerMbedTLS::bio_send(void *ctx, const unsigned char *buf, size_t len) {
 	if (buf == nullptr || len == 0) {
 		return 0;
@@ -76,9 +79,46 @@ int StreamPeerMbedTLS::bio_recv(void *ctx, unsigned char *buf, size_t len) {
 void StreamPeerMbedTLS::_cleanup() {
 	tls_ctx->clear();
 	base = Ref<StreamPeer>();
+	session_key = String();
 	status = STATUS_DISCONNECTED;
 }
 
+void StreamPeerMbedTLS::_clear_session_cache() {
+	MutexLock lock(session_cache_mutex);
+	for (KeyValue<String, mbedtls_ssl_session *> &E : session_cache) {
+		mbedtls_ssl_session_free(E.value);
+		memdelete(E.value);
+	}
+	session_cache.clear();
+}
+
+void StreamPeerMbedTLS::_store_session() {
+	mbedtls_ssl_session *session = memnew(mbedtls_ssl_session);
+	mbedtls_ssl_session_init(session);
+	if (mbedtls_ssl_get_session(tls_ctx->get_context(), session) != 0) {
+		mbedtls_ssl_session_free(session);
+		memdelete(session);
+		return;
+	}
+
+	MutexLock lock(session_cache_mutex);
+	HashMap<String, mbedtls_ssl_session *>::Iterator E = session_cache.find(session_key);
+	if (E) {
+		mbedtls_ssl_session_free(E->value);
+		memdelete(E->value);
+		E->value = session;
+		return;
+	}
+	if (session_cache.size() >= MAX_CACHED_SESSIONS) {
+		// Evict the oldest entry.
+		HashMap<String, mbedtls_ssl_session *>::Iterator oldest = session_cache.begin();
+		mbedtls_ssl_session_free(oldest->value);
+		memdelete(oldest->value);
+		session_cache.remove(oldest);
+	}
+	session_cache.insert(session_key, session);
+}
+
 Error StreamPeerMbedTLS::_do_handshake() {
 	int ret = mbedtls_ssl_handshake(tls_ctx->get_context());
 	if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
@@ -94,15 +134,33 @@ Error StreamPeerMbedTLS::_do_handshake() {
 	}
 
 	status = STATUS_CONNECTED;
+	if (!session_key.is_empty()) {
+		_store_session();
+	}
 	return OK;
 }
 
 Error StreamPeerMbedTLS::connect_to_stream(Ref<StreamPeer> p_base, const String &p_common_name, Ref<TLSOptions> p_options) {
 	ERR_FAIL_COND_V(p_base.is_null(), ERR_INVALID_PARAMETER);
 
-	Error err = tls_ctx->init_client(MBEDTLS_SSL_TRANSPORT_STREAM, p_common_name, p_options.is_valid() ? p_options : TLSOptions::client());
+	Ref<TLSOptions> options = p_options.is_valid() ? p_options : TLSOptions::client();
+	Error err = tls_ctx->init_client(MBEDTLS_SSL_TRANSPORT_STREAM, p_common_name, options);
 	ERR_FAIL_COND_V(err != OK, err);
 
+	session_key = String();
+	if (options->get_verify_mode() == TLSOptions::TLS_VERIFY_FULL) {
+		String cn = options->get_common_name();
+		Ref<X509Certificate> cas = options->get_trusted_ca_chain();
+		session_key = (cn.is_empty() ? p_common_name : cn) + "|" + (cas.is_valid() ? itos(cas->get_instance_id()) : String());
+
+		MutexLock lock(session_cache_mutex);
+		HashMap<String, mbedtls_ssl_session *>::ConstIterator E = session_cache.find(session_key);
+		if (E) {
+			// Falls back to a full handshake if the server doesn't accept it.
+			mbedtls_ssl_set_session(tls_ctx->get_context(), E->value);
+		}
+	}
+
 	base = p_base;
 	mbedtls_ssl_set_bio(tls_ctx->get_context(), this, bio_send, bio_recv, nullptr);
 
@@ -305,4 +363,5 @@ void StreamPeerMbedTLS::initialize_tls() {
 
 void StreamPeerMbedTLS::finalize_tls() {
 	_create = nullptr;
+	_clear_session_cache();
 }
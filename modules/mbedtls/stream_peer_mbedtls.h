@@ -34,6 +34,8 @@
 #include "tls_context_mbedtls.h"
 
 #include "core/io/stream_peer_tls.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 
 class StreamPeerMbedTLS : public StreamPeerTLS {
 private:
@@ -42,6 +44,16 @@ private:
 
 	Ref<StreamPeer> base;
 
+	// Client sessions are kept per host (and trusted CAs) to resume them on the next connection,
+	// skipping the full handshake. Only fully verified sessions are cached.
+	static const int MAX_CACHED_SESSIONS = 64;
+	static Mutex session_cache_mutex;
+	static HashMap<String, mbedtls_ssl_session *> session_cache;
+	String session_key;
+
+	static void _clear_session_cache();
+	void _store_session();
+
 	static StreamPeerTLS *_create_func();
 
 	static int bio_recv(void *ctx, unsigned char *buf, size_t len);
@@ -75,7 +75,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 					}
 				}
 				loop_fade_remaining = 0;
-				seek(mp3_stream->loop_offset);
+				_seek_mp3(mp3_stream->loop_offset);
 				loops++;
 			}
 		}
@@ -83,7 +83,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (mp3_stream->loop) {
-				seek(mp3_stream->loop_offset);
+				_seek_mp3(mp3_stream->loop_offset);
 				loops++;
 			} else {
 				frames_mixed_this_step = p_frames - todo;
@@ -104,6 +104,7 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
+	MutexLock decoder_lock(decoder_mutex);
 	active = true;
 	seek(p_from_pos);
 	loops = 0;
@@ -111,7 +112,9 @@ void AudioStreamPlaybackMP3::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	MutexLock decoder_lock(decoder_mutex);
 	active = false;
+	_clear_decode_ahead();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
@@ -123,10 +126,17 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
-	return double(frames_mixed) / mp3_stream->sample_rate;
+	int64_t frames_played = MAX(0, int64_t(frames_mixed) - _get_decode_ahead_frames());
+	return double(frames_played) / mp3_stream->sample_rate;
 }
 
 void AudioStreamPlaybackMP3::seek(double p_time) {
+	MutexLock decoder_lock(decoder_mutex);
+	_clear_decode_ahead();
+	_seek_mp3(p_time);
+}
+
+void AudioStreamPlaybackMP3::_seek_mp3(double p_time) {
 	if (!active) {
 		return;
 	}
@@ -144,6 +154,7 @@ void AudioStreamPlaybackMP3::tag_used_streams() {
 }
 
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	_finish_decode_ahead();
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
@@ -172,6 +183,8 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
 
+	mp3s->_set_decode_ahead(AudioServer::get_singleton()->is_decode_ahead_enabled());
+
 	return mp3s;
 }
 
@@ -56,6 +56,8 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 
 	Ref<AudioStreamMP3> mp3_stream;
 
+	void _seek_mp3(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
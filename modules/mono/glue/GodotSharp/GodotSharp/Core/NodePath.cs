@@ -1,4 +1,6 @@
 using System;
+using System.Collections.Concurrent;
+using System.Threading;
 using Godot.NativeInterop;
 
 namespace Godot
@@ -45,6 +47,16 @@ namespace Godot
 
         private WeakReference<IDisposable> _weakReferenceToSelf;
 
+        // Implicit conversions are mostly done from literals, so a bounded cache covers them
+        // while strings built at runtime can't make it grow indefinitely.
+        private const int ImplicitConversionCacheCapacity = 1024;
+        private static readonly ConcurrentDictionary<string, NodePath> _implicitConversionCache = new();
+        private static int _implicitConversionCacheCount;
+
+        // Set on the instances returned by implicit conversions. They share the native value
+        // of a cached instance, which is only ever disposed on shutdown.
+        private readonly NodePath _owner;
+
         ~NodePath()
         {
             Dispose(false);
@@ -61,6 +73,9 @@ namespace Godot
 
         public void Dispose(bool disposing)
         {
+            if (_owner != null)
+                return;
+
             // Always dispose `NativeValue` even if disposing is true
             NativeValue.DangerousSelfRef.Dispose();
 
@@ -76,6 +91,13 @@ namespace Godot
             _weakReferenceToSelf = DisposablesTracker.RegisterDisposable(this);
         }
 
+        private NodePath(NodePath owner)
+        {
+            NativeValue = owner.NativeValue;
+            _owner = owner;
+            GC.SuppressFinalize(this);
+        }
+
         // Explicit name to make it very clear
         internal static NodePath CreateTakingOwnershipOfDisposableValue(godot_node_path nativeValueToOwn)
             => new NodePath(nativeValueToOwn);
@@ -128,8 +150,41 @@ namespace Godot
         /// <summary>
         /// Converts a string to a <see cref="NodePath"/>.
         /// </summary>
+        /// <remarks>
+        /// Conversions of the same string share a cached native value, so passing string literals
+        /// to engine methods on hot paths doesn't create a new native <see cref="NodePath"/> every call.
+        /// Disposing the returned instance doesn't affect the other conversions.
+        /// </remarks>
         /// <param name="from">The string to convert.</param>
-        public static implicit operator NodePath(string from) => new NodePath(from);
+        public static implicit operator NodePath(string from)
+        {
+            if (string.IsNullOrEmpty(from))
+                return new NodePath(from);
+
+            if (!_implicitConversionCache.TryGetValue(from, out NodePath cached))
+            {
+                if (_implicitConversionCacheCount >= ImplicitConversionCacheCapacity)
+                    return new NodePath(from);
+
+                var value = new NodePath(from);
+                if (_implicitConversionCache.TryAdd(from, value))
+                {
+                    Interlocked.Increment(ref _implicitConversionCacheCount);
+                    cached = value;
+                }
+                else
+                {
+                    value.Dispose();
+                    cached = _implicitConversionCache[from];
+                }
+            }
+
+            // The cached instances are never handed out, so they are only disposed on shutdown.
+            if (cached.IsEmpty)
+                return new NodePath(from);
+
+            return new NodePath(cached);
+        }
 
         /// <summary>
         /// Converts this <see cref="NodePath"/> to a string.
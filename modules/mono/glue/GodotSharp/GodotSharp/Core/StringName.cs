@@ -1,4 +1,6 @@
 using System;
+using System.Collections.Concurrent;
+using System.Threading;
 using Godot.NativeInterop;
 
 namespace Godot
@@ -16,6 +18,16 @@ namespace Godot
 
         private WeakReference<IDisposable> _weakReferenceToSelf;
 
+        // Implicit conversions are mostly done from literals, so a bounded cache covers them
+        // while strings built at runtime can't make it grow indefinitely.
+        private const int ImplicitConversionCacheCapacity = 1024;
+        private static readonly ConcurrentDictionary<string, StringName> _implicitConversionCache = new();
+        private static int _implicitConversionCacheCount;
+
+        // Set on the instances returned by implicit conversions. They share the native value
+        // of a cached instance, which is only ever disposed on shutdown.
+        private readonly StringName _owner;
+
         ~StringName()
         {
             Dispose(false);
@@ -32,6 +44,9 @@ namespace Godot
 
         public void Dispose(bool disposing)
         {
+            if (_owner != null)
+                return;
+
             // Always dispose `NativeValue` even if disposing is true
             NativeValue.DangerousSelfRef.Dispose();
 
@@ -47,6 +62,13 @@ namespace Godot
             _weakReferenceToSelf = DisposablesTracker.RegisterDisposable(this);
         }
 
+        private StringName(StringName owner)
+        {
+            NativeValue = owner.NativeValue;
+            _owner = owner;
+            GC.SuppressFinalize(this);
+        }
+
         // Explicit name to make it very clear
         internal static StringName CreateTakingOwnershipOfDisposableValue(godot_string_name nativeValueToOwn)
             => new StringName(nativeValueToOwn);
@@ -74,8 +96,41 @@ namespace Godot
         /// <summary>
         /// Converts a string to a <see cref="StringName"/>.
         /// </summary>
+        /// <remarks>
+        /// Conversions of the same string share a cached native value, so passing string literals
+        /// to engine methods on hot paths doesn't create a new native <see cref="StringName"/> every call.
+        /// Disposing the returned instance doesn't affect the other conversions.
+        /// </remarks>
         /// <param name="from">The string to convert.</param>
-        public static implicit operator StringName(string from) => new StringName(from);
+        public static implicit operator StringName(string from)
+        {
+            if (string.IsNullOrEmpty(from))
+                return new StringName(from);
+
+            if (!_implicitConversionCache.TryGetValue(from, out StringName cached))
+            {
+                if (_implicitConversionCacheCount >= ImplicitConversionCacheCapacity)
+                    return new StringName(from);
+
+                var value = new StringName(from);
+                if (_implicitConversionCache.TryAdd(from, value))
+                {
+                    Interlocked.Increment(ref _implicitConversionCacheCount);
+                    cached = value;
+                }
+                else
+                {
+                    value.Dispose();
+                    cached = _implicitConversionCache[from];
+                }
+            }
+
+            // The cached instances are never handed out, so they are only disposed on shutdown.
+            if (cached.IsEmpty)
+                return new StringName(from);
+
+            return new StringName(cached);
+        }
 
         /// <summary>
         /// Converts a <see cref="StringName"/> to a string.
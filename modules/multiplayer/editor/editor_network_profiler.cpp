@@ -85,6 +85,7 @@ void EditorNetworkProfiler::_refresh() {
 	dirty = false;
 	refresh_rpc_data();
 	refresh_replication_data();
+	refresh_peer_data();
 }
 
 void EditorNetworkProfiler::refresh_rpc_data() {
@@ -149,8 +150,45 @@ void EditorNetworkProfiler::refresh_replication_data() {
 			node->set_metadata(2, "");
 		}
 
-		node->set_text(3, vformat("%d - %d", E.value.incoming_syncs, E.value.outgoing_syncs));
+		if (E.value.outgoing_drops) {
+			node->set_text(3, vformat(TTR("%d - %d (%d dropped)"), E.value.incoming_syncs, E.value.outgoing_syncs, E.value.outgoing_drops));
+			node->set_tooltip_text(3, TTR("States bigger than the MTU are not sent."));
+		} else {
+			node->set_text(3, vformat("%d - %d", E.value.incoming_syncs, E.value.outgoing_syncs));
+		}
 		node->set_text(4, vformat("%d - %d", E.value.incoming_size, E.value.outgoing_size));
+
+		// Outgoing size of each property, to find what is worth quantizing or syncing less often.
+		const HashMap<String, SyncPropertyInfo> *props = property_data.getptr(E.key);
+		if (!props) {
+			continue;
+		}
+		for (const KeyValue<String, SyncPropertyInfo> &P : *props) {
+			TreeItem *prop = replication_display->create_item(node);
+			prop->set_text(0, P.key);
+			prop->set_tooltip_text(0, P.key);
+			prop->set_text(3, vformat("- %d", P.value.outgoing_syncs));
+			prop->set_text(4, vformat("- %d", P.value.outgoing_size));
+		}
+	}
+}
+
+void EditorNetworkProfiler::refresh_peer_data() {
+	peers_display->clear();
+
+	TreeItem *root = peers_display->create_item();
+	int cols = peers_display->get_columns();
+
+	for (const PeerInfo &info : peer_data) {
+		TreeItem *peer = peers_display->create_item(root);
+		for (int j = 0; j < cols; ++j) {
+			peer->set_text_alignment(j, j > 0 ? HORIZONTAL_ALIGNMENT_RIGHT : HORIZONTAL_ALIGNMENT_LEFT);
+		}
+		peer->set_text(0, itos(info.peer));
+		peer->set_text(1, vformat(TTR("%d (%s/s)"), info.incoming_packets, String::humanize_size(info.incoming_size)));
+		peer->set_text(2, vformat(TTR("%d (%s/s)"), info.outgoing_packets, String::humanize_size(info.outgoing_size)));
+		peer->set_text(3, info.rtt < 0 ? "-" : vformat(TTR("%d ms (± %d)"), info.rtt, info.rtt_variance));
+		peer->set_text(4, info.packet_loss < 0 ? "-" : vformat("%.1f%%", info.packet_loss * 100));
 	}
 }
 
@@ -185,11 +223,14 @@ void EditorNetworkProfiler::_activate_pressed() {
 void EditorNetworkProfiler::_clear_pressed() {
 	rpc_data.clear();
 	sync_data.clear();
+	property_data.clear();
+	peer_data.clear();
 	node_data.clear();
 	missing_node_data.clear();
 	set_bandwidth(0, 0);
 	refresh_rpc_data();
 	refresh_replication_data();
+	refresh_peer_data();
 }
 
 void EditorNetworkProfiler::_replication_button_clicked(TreeItem *p_item, int p_column, int p_idx, MouseButton p_button) {
@@ -225,6 +266,7 @@ void EditorNetworkProfiler::add_sync_frame_data(const SyncInfo &p_frame) {
 	} else {
 		sync_data[p_frame.synchronizer].incoming_syncs += p_frame.incoming_syncs;
 		sync_data[p_frame.synchronizer].outgoing_syncs += p_frame.outgoing_syncs;
+		sync_data[p_frame.synchronizer].outgoing_drops += p_frame.outgoing_drops;
 	}
 	SyncInfo &info = sync_data[p_frame.synchronizer];
 	if (info.incoming_syncs) {
@@ -235,6 +277,25 @@ void EditorNetworkProfiler::add_sync_frame_data(const SyncInfo &p_frame) {
 	}
 }
 
+void EditorNetworkProfiler::add_property_frame_data(const SyncPropertyInfo &p_frame) {
+	dirty = true;
+	HashMap<String, SyncPropertyInfo> &props = property_data[p_frame.synchronizer];
+	SyncPropertyInfo *info = props.getptr(p_frame.property);
+	if (!info) {
+		info = &props.insert(p_frame.property, p_frame)->value;
+	} else {
+		info->outgoing_syncs += p_frame.outgoing_syncs;
+	}
+	if (p_frame.outgoing_syncs) {
+		info->outgoing_size = p_frame.outgoing_size / p_frame.outgoing_syncs;
+	}
+}
+
+void EditorNetworkProfiler::set_peer_data(const Vector<PeerInfo> &p_peers) {
+	dirty = true;
+	peer_data = p_peers;
+}
+
 void EditorNetworkProfiler::set_bandwidth(int p_incoming, int p_outgoing) {
 	incoming_bandwidth_text->set_text(vformat(TTR("%s/s"), String::humanize_size(p_incoming)));
 	outgoing_bandwidth_text->set_text(vformat(TTR("%s/s"), String::humanize_size(p_outgoing)));
@@ -299,8 +360,13 @@ EditorNetworkProfiler::EditorNetworkProfiler() {
 	// Set initial texts in the incoming/outgoing bandwidth labels
 	set_bandwidth(0, 0);
 
+	VSplitContainer *vsc = memnew(VSplitContainer);
+	add_child(vsc);
+	vsc->set_v_size_flags(SIZE_EXPAND_FILL);
+	vsc->set_h_size_flags(SIZE_EXPAND_FILL);
+
 	HSplitContainer *sc = memnew(HSplitContainer);
-	add_child(sc);
+	vsc->add_child(sc);
 	sc->set_v_size_flags(SIZE_EXPAND_FILL);
 	sc->set_h_size_flags(SIZE_EXPAND_FILL);
 	sc->set_split_offset(100 * EDSCALE);
@@ -360,6 +426,37 @@ EditorNetworkProfiler::EditorNetworkProfiler() {
 	replication_display->connect("button_clicked", callable_mp(this, &EditorNetworkProfiler::_replication_button_clicked));
 	sc->add_child(replication_display);
 
+	// Peers
+	peers_display = memnew(Tree);
+	peers_display->set_custom_minimum_size(Size2(320, 80) * EDSCALE);
+	peers_display->set_v_size_flags(SIZE_EXPAND_FILL);
+	peers_display->set_h_size_flags(SIZE_EXPAND_FILL);
+	peers_display->set_hide_folding(true);
+	peers_display->set_hide_root(true);
+	peers_display->set_columns(5);
+	peers_display->set_column_titles_visible(true);
+	peers_display->set_column_title(0, TTR("Peer"));
+	peers_display->set_column_expand(0, true);
+	peers_display->set_column_clip_content(0, true);
+	peers_display->set_column_custom_minimum_width(0, 60 * EDSCALE);
+	peers_display->set_column_title(1, TTR("Incoming Packets"));
+	peers_display->set_column_expand(1, false);
+	peers_display->set_column_clip_content(1, true);
+	peers_display->set_column_custom_minimum_width(1, 140 * EDSCALE);
+	peers_display->set_column_title(2, TTR("Outgoing Packets"));
+	peers_display->set_column_expand(2, false);
+	peers_display->set_column_clip_content(2, true);
+	peers_display->set_column_custom_minimum_width(2, 140 * EDSCALE);
+	peers_display->set_column_title(3, TTR("Round Trip Time"));
+	peers_display->set_column_expand(3, false);
+	peers_display->set_column_clip_content(3, true);
+	peers_display->set_column_custom_minimum_width(3, 120 * EDSCALE);
+	peers_display->set_column_title(4, TTR("Packet Loss"));
+	peers_display->set_column_expand(4, false);
+	peers_display->set_column_clip_content(4, true);
+	peers_display->set_column_custom_minimum_width(4, 100 * EDSCALE);
+	vsc->add_child(peers_display);
+
 	refresh_timer = memnew(Timer);
 	refresh_timer->set_wait_time(0.5);
 	refresh_timer->connect("timeout", callable_mp(this, &EditorNetworkProfiler::_refresh));
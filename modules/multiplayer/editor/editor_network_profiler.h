@@ -59,6 +59,8 @@ public:
 private:
 	using RPCNodeInfo = MultiplayerDebugger::RPCNodeInfo;
 	using SyncInfo = MultiplayerDebugger::SyncInfo;
+	using SyncPropertyInfo = MultiplayerDebugger::SyncPropertyInfo;
+	using PeerInfo = MultiplayerDebugger::PeerInfo;
 
 	bool dirty = false;
 	Timer *refresh_timer = nullptr;
@@ -68,9 +70,12 @@ private:
 	LineEdit *incoming_bandwidth_text = nullptr;
 	LineEdit *outgoing_bandwidth_text = nullptr;
 	Tree *replication_display = nullptr;
+	Tree *peers_display = nullptr;
 
 	HashMap<ObjectID, RPCNodeInfo> rpc_data;
 	HashMap<ObjectID, SyncInfo> sync_data;
+	HashMap<ObjectID, HashMap<String, SyncPropertyInfo>> property_data;
+	Vector<PeerInfo> peer_data;
 	HashMap<ObjectID, NodeInfo> node_data;
 	HashSet<ObjectID> missing_node_data;
 
@@ -104,11 +109,14 @@ protected:
 public:
 	void refresh_rpc_data();
 	void refresh_replication_data();
+	void refresh_peer_data();
 
 	Array pop_missing_node_data();
 	void add_node_data(const NodeInfo &p_info);
 	void add_rpc_frame_data(const RPCNodeInfo &p_frame);
 	void add_sync_frame_data(const SyncInfo &p_frame);
+	void add_property_frame_data(const SyncPropertyInfo &p_frame);
+	void set_peer_data(const Vector<PeerInfo> &p_peers);
 	void set_bandwidth(int p_incoming, int p_outgoing);
 	bool is_profiling();
 
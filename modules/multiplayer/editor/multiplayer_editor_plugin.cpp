@@ -71,6 +71,18 @@ bool MultiplayerEditorDebugger::capture(const String &p_message, const Array &p_
 			get_session(p_session)->send_message("multiplayer:cache", missing);
 		}
 		return true;
+	} else if (p_message == "multiplayer:properties") {
+		MultiplayerDebugger::SyncPropertyFrame frame;
+		frame.deserialize(p_data);
+		for (int i = 0; i < frame.infos.size(); i++) {
+			profiler->add_property_frame_data(frame.infos[i]);
+		}
+		return true;
+	} else if (p_message == "multiplayer:peers") {
+		MultiplayerDebugger::PeerFrame frame;
+		frame.deserialize(p_data);
+		profiler->set_peer_data(frame.infos);
+		return true;
 	} else if (p_message == "multiplayer:cache") {
 		ERR_FAIL_COND_V(p_data.size() % 3, false);
 		for (int i = 0; i < p_data.size(); i += 3) {
@@ -95,6 +107,7 @@ void MultiplayerEditorDebugger::_profiler_activate(bool p_enable, int p_session_
 	session->toggle_profiler("multiplayer:bandwidth", p_enable);
 	session->toggle_profiler("multiplayer:rpc", p_enable);
 	session->toggle_profiler("multiplayer:replication", p_enable);
+	session->toggle_profiler("multiplayer:peers", p_enable);
 }
 
 void MultiplayerEditorDebugger::setup_session(int p_session_id) {
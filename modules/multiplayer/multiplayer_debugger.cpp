@@ -34,6 +34,7 @@
 #include "scene_replication_config.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 List<Ref<EngineProfiler>> multiplayer_profilers;
@@ -54,6 +55,11 @@ void MultiplayerDebugger::initialize() {
 	replication_profiler->bind("multiplayer:replication");
 	multiplayer_profilers.push_back(replication_profiler);
 
+	Ref<PeerProfiler> peer_profiler;
+	peer_profiler.instantiate();
+	peer_profiler->bind("multiplayer:peers");
+	multiplayer_profilers.push_back(peer_profiler);
+
 	EngineDebugger::register_message_capture("multiplayer", EngineDebugger::Capture(nullptr, &_capture));
 }
 
@@ -255,10 +261,11 @@ void MultiplayerDebugger::SyncInfo::write_to_array(Array &r_arr) const {
 	r_arr.push_back(incoming_size);
 	r_arr.push_back(outgoing_syncs);
 	r_arr.push_back(outgoing_size);
+	r_arr.push_back(outgoing_drops);
 }
 
 bool MultiplayerDebugger::SyncInfo::read_from_array(const Array &p_arr, int p_offset) {
-	ERR_FAIL_COND_V(p_arr.size() - p_offset < 7, false);
+	ERR_FAIL_COND_V(p_arr.size() - p_offset < 8, false);
 	synchronizer = int64_t(p_arr[p_offset]);
 	config = int64_t(p_arr[p_offset + 1]);
 	root_node = int64_t(p_arr[p_offset + 2]);
@@ -266,12 +273,13 @@ bool MultiplayerDebugger::SyncInfo::read_from_array(const Array &p_arr, int p_of
 	incoming_size = p_arr[p_offset + 4];
 	outgoing_syncs = p_arr[p_offset + 5];
 	outgoing_size = p_arr[p_offset + 6];
+	outgoing_drops = p_arr[p_offset + 7];
 	return true;
 }
 
 Array MultiplayerDebugger::ReplicationFrame::serialize() {
 	Array arr;
-	arr.push_back(infos.size() * 7);
+	arr.push_back(infos.size() * 8);
 	for (const KeyValue<ObjectID, SyncInfo> &E : infos) {
 		E.value.write_to_array(arr);
 	}
@@ -281,41 +289,89 @@ Array MultiplayerDebugger::ReplicationFrame::serialize() {
 bool MultiplayerDebugger::ReplicationFrame::deserialize(const Array &p_arr) {
 	ERR_FAIL_COND_V(p_arr.size() < 1, false);
 	uint32_t size = p_arr[0];
-	ERR_FAIL_COND_V(size % 7, false);
+	ERR_FAIL_COND_V(size % 8, false);
 	ERR_FAIL_COND_V((uint32_t)p_arr.size() != size + 1, false);
 	int idx = 1;
-	for (uint32_t i = 0; i < size / 7; i++) {
+	for (uint32_t i = 0; i < size / 8; i++) {
 		SyncInfo info;
 		if (!info.read_from_array(p_arr, idx)) {
 			return false;
 		}
 		infos[info.synchronizer] = info;
-		idx += 7;
+		idx += 8;
+	}
+	return true;
+}
+
+Array MultiplayerDebugger::SyncPropertyFrame::serialize() {
+	Array arr;
+	arr.push_back(infos.size() * 4);
+	for (int i = 0; i < infos.size(); ++i) {
+		arr.push_back(infos[i].synchronizer);
+		arr.push_back(infos[i].property);
+		arr.push_back(infos[i].outgoing_syncs);
+		arr.push_back(infos[i].outgoing_size);
+	}
+	return arr;
+}
+
+bool MultiplayerDebugger::SyncPropertyFrame::deserialize(const Array &p_arr) {
+	ERR_FAIL_COND_V(p_arr.size() < 1, false);
+	uint32_t size = p_arr[0];
+	ERR_FAIL_COND_V(size % 4, false);
+	ERR_FAIL_COND_V((uint32_t)p_arr.size() != size + 1, false);
+	infos.resize(size / 4);
+	int idx = 1;
+	for (uint32_t i = 0; i < size / 4; i++) {
+		infos.write[i].synchronizer = int64_t(p_arr[idx]);
+		infos.write[i].property = p_arr[idx + 1];
+		infos.write[i].outgoing_syncs = p_arr[idx + 2];
+		infos.write[i].outgoing_size = p_arr[idx + 3];
+		idx += 4;
 	}
 	return true;
 }
 
 void MultiplayerDebugger::ReplicationProfiler::toggle(bool p_enable, const Array &p_opts) {
 	sync_data.clear();
+	property_data.clear();
 }
 
 void MultiplayerDebugger::ReplicationProfiler::add(const Array &p_data) {
-	ERR_FAIL_COND(p_data.size() != 3);
+	ERR_FAIL_COND(p_data.size() < 3);
 	const String what = p_data[0];
 	const ObjectID id = p_data[1];
 	const uint64_t size = p_data[2];
+	if (what == "prop_out") {
+		// Per-property breakdown of the outgoing states, only the encoded size of each value.
+		ERR_FAIL_COND(p_data.size() != 4);
+		const String prop = p_data[3];
+		HashMap<String, SyncPropertyInfo> &props = property_data[id];
+		SyncPropertyInfo *info = props.getptr(prop);
+		if (!info) {
+			info = &props.insert(prop, SyncPropertyInfo())->value;
+			info->synchronizer = id;
+			info->property = prop;
+		}
+		info->outgoing_syncs++;
+		info->outgoing_size += size;
+		return;
+	}
+	ERR_FAIL_COND(p_data.size() != 3);
 	MultiplayerSynchronizer *sync = Object::cast_to<MultiplayerSynchronizer>(ObjectDB::get_instance(id));
 	ERR_FAIL_NULL(sync);
 	if (!sync_data.has(id)) {
 		sync_data[id] = SyncInfo(sync);
 	}
 	SyncInfo &info = sync_data[id];
-	if (what == "sync_in") {
+	if (what == "sync_in" || what == "delta_in") {
 		info.incoming_syncs++;
 		info.incoming_size += size;
-	} else if (what == "sync_out") {
+	} else if (what == "sync_out" || what == "delta_out") {
 		info.outgoing_syncs++;
 		info.outgoing_size += size;
+	} else if (what == "sync_drop" || what == "delta_drop") {
+		info.outgoing_drops++;
 	}
 }
 
@@ -329,5 +385,113 @@ void MultiplayerDebugger::ReplicationProfiler::tick(double p_frame_time, double
 		}
 		sync_data.clear();
 		EngineDebugger::get_singleton()->send_message("multiplayer:syncs", frame.serialize());
+
+		if (property_data.size()) {
+			SyncPropertyFrame prop_frame;
+			for (const KeyValue<ObjectID, HashMap<String, SyncPropertyInfo>> &E : property_data) {
+				for (const KeyValue<String, SyncPropertyInfo> &P : E.value) {
+					prop_frame.infos.push_back(P.value);
+				}
+			}
+			property_data.clear();
+			EngineDebugger::get_singleton()->send_message("multiplayer:properties", prop_frame.serialize());
+		}
+	}
+}
+
+// PeerProfiler
+
+Array MultiplayerDebugger::PeerFrame::serialize() {
+	Array arr;
+	arr.push_back(infos.size() * 8);
+	for (int i = 0; i < infos.size(); ++i) {
+		arr.push_back(infos[i].peer);
+		arr.push_back(infos[i].incoming_packets);
+		arr.push_back(infos[i].incoming_size);
+		arr.push_back(infos[i].outgoing_packets);
+		arr.push_back(infos[i].outgoing_size);
+		arr.push_back(infos[i].rtt);
+		arr.push_back(infos[i].rtt_variance);
+		arr.push_back(infos[i].packet_loss);
+	}
+	return arr;
+}
+
+bool MultiplayerDebugger::PeerFrame::deserialize(const Array &p_arr) {
+	ERR_FAIL_COND_V(p_arr.size() < 1, false);
+	uint32_t size = p_arr[0];
+	ERR_FAIL_COND_V(size % 8, false);
+	ERR_FAIL_COND_V((uint32_t)p_arr.size() != size + 1, false);
+	infos.resize(size / 8);
+	int idx = 1;
+	for (uint32_t i = 0; i < size / 8; i++) {
+		infos.write[i].peer = p_arr[idx];
+		infos.write[i].incoming_packets = p_arr[idx + 1];
+		infos.write[i].incoming_size = p_arr[idx + 2];
+		infos.write[i].outgoing_packets = p_arr[idx + 3];
+		infos.write[i].outgoing_size = p_arr[idx + 4];
+		infos.write[i].rtt = p_arr[idx + 5];
+		infos.write[i].rtt_variance = p_arr[idx + 6];
+		infos.write[i].packet_loss = p_arr[idx + 7];
+		idx += 8;
+	}
+	return true;
+}
+
+void MultiplayerDebugger::PeerProfiler::toggle(bool p_enable, const Array &p_opts) {
+	peer_data.clear();
+	active_peers.clear();
+	last_profile_time = OS::get_singleton()->get_ticks_msec();
+}
+
+void MultiplayerDebugger::PeerProfiler::add(const Array &p_data) {
+	ERR_FAIL_COND(p_data.size() < 3);
+	const String what = p_data[0];
+	const int peer = p_data[1];
+	PeerInfo &info = peer_data[peer];
+	info.peer = peer;
+	active_peers.insert(peer);
+	if (what == "in") {
+		info.incoming_packets++;
+		info.incoming_size += int(p_data[2]);
+	} else if (what == "out") {
+		info.outgoing_packets++;
+		info.outgoing_size += int(p_data[2]);
+	} else if (what == "transport") {
+		// Reported by the multiplayer peer implementation (e.g. ENet), kept until updated.
+		ERR_FAIL_COND(p_data.size() != 5);
+		info.rtt = p_data[2];
+		info.rtt_variance = p_data[3];
+		info.packet_loss = p_data[4];
+	}
+}
+
+void MultiplayerDebugger::PeerProfiler::tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+	uint64_t pt = OS::get_singleton()->get_ticks_msec();
+	uint64_t elapsed = pt - last_profile_time;
+	if (elapsed > 500) {
+		last_profile_time = pt;
+		PeerFrame frame;
+		LocalVector<int> to_remove;
+		for (KeyValue<int, PeerInfo> &E : peer_data) {
+			if (!active_peers.has(E.key)) {
+				to_remove.push_back(E.key); // Disconnected.
+				continue;
+			}
+			PeerInfo info = E.value;
+			info.incoming_size = int64_t(info.incoming_size) * 1000 / elapsed;
+			info.outgoing_size = int64_t(info.outgoing_size) * 1000 / elapsed;
+			frame.infos.push_back(info);
+			// Counters restart with each frame, transport statistics are kept.
+			E.value.incoming_packets = 0;
+			E.value.incoming_size = 0;
+			E.value.outgoing_packets = 0;
+			E.value.outgoing_size = 0;
+		}
+		for (const int &peer : to_remove) {
+			peer_data.erase(peer);
+		}
+		active_peers.clear();
+		EngineDebugger::get_singleton()->send_message("multiplayer:peers", frame.serialize());
 	}
 }
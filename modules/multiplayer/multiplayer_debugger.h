@@ -33,6 +33,7 @@
 
 #include "core/debugger/engine_profiler.h"
 #include "core/os/os.h"
+#include "core/templates/hash_set.h"
 
 class MultiplayerSynchronizer;
 
@@ -62,6 +63,7 @@ public:
 		int incoming_size = 0;
 		int outgoing_syncs = 0;
 		int outgoing_size = 0;
+		int outgoing_drops = 0; // States too big for the MTU.
 
 		void write_to_array(Array &r_arr) const;
 		bool read_from_array(const Array &p_arr, int p_offset);
@@ -77,6 +79,39 @@ public:
 		bool deserialize(const Array &p_arr);
 	};
 
+	struct SyncPropertyInfo {
+		ObjectID synchronizer;
+		String property;
+		int outgoing_syncs = 0;
+		int outgoing_size = 0;
+	};
+
+	struct SyncPropertyFrame {
+		Vector<SyncPropertyInfo> infos;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
+	struct PeerInfo {
+		int peer = 0;
+		int incoming_packets = 0;
+		int incoming_size = 0; // Bytes per second.
+		int outgoing_packets = 0;
+		int outgoing_size = 0; // Bytes per second.
+		// Transport statistics, -1 when the multiplayer peer doesn't report them.
+		int rtt = -1;
+		int rtt_variance = -1;
+		float packet_loss = -1;
+	};
+
+	struct PeerFrame {
+		Vector<PeerInfo> infos;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
 private:
 	class BandwidthProfiler : public EngineProfiler {
 	protected:
@@ -115,6 +150,19 @@ private:
 	class ReplicationProfiler : public EngineProfiler {
 	private:
 		HashMap<ObjectID, SyncInfo> sync_data;
+		HashMap<ObjectID, HashMap<String, SyncPropertyInfo>> property_data;
+		uint64_t last_profile_time = 0;
+
+	public:
+		void toggle(bool p_enable, const Array &p_opts);
+		void add(const Array &p_data);
+		void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time);
+	};
+
+	class PeerProfiler : public EngineProfiler {
+	private:
+		HashMap<int, PeerInfo> peer_data;
+		HashSet<int> active_peers; // Peers with data since the last frame, the others are dropped.
 		uint64_t last_profile_time = 0;
 
 	public:
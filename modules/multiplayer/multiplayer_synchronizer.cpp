@@ -31,8 +31,13 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/multiplayer_api.h"
 
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif
+
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
 	if (p_path.get_name_count() == 0) {
 		return p_obj;
@@ -153,7 +158,7 @@ PackedStringArray MultiplayerSynchronizer::get_configuration_warnings() const {
 	return warnings;
 }
 
-Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs) {
+Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, SceneReplicationConfig *p_quantize_config) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	r_variant.resize(p_properties.size());
 	r_variant_ptrs.resize(r_variant.size());
@@ -163,19 +168,29 @@ Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Obj
 		const Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
 		r_variant.write[i] = obj->get_indexed(prop.get_subnames(), &valid);
-		r_variant_ptrs.write[i] = &r_variant[i];
 		ERR_FAIL_COND_V_MSG(!valid, ERR_INVALID_DATA, vformat("Property '%s' not found.", prop));
+		if (p_quantize_config) {
+			r_variant.write[i] = p_quantize_config->quantize_property(prop, r_variant[i]);
+		}
+		r_variant_ptrs.write[i] = &r_variant[i];
 		i++;
 	}
 	return OK;
 }
 
-Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state) {
+Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, SceneReplicationConfig *p_quantize_config) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	int i = 0;
 	for (const NodePath &prop : p_properties) {
 		Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
+		if (p_quantize_config && p_quantize_config->is_property_quantized(prop)) {
+			// The packed value doesn't carry its type, the property's current one is used.
+			Variant::Type type = obj->get_indexed(prop.get_subnames()).get_type();
+			obj->set_indexed(prop.get_subnames(), p_quantize_config->dequantize_property(prop, p_state[i], type));
+			i += 1;
+			continue;
+		}
 		obj->set_indexed(prop.get_subnames(), p_state[i]);
 		i += 1;
 	}
@@ -204,9 +219,46 @@ bool MultiplayerSynchronizer::is_visible_to(int p_peer) {
 			}
 		}
 	}
+	if (visibility_range > 0 && !peers_in_range.has(p_peer)) {
+		return false;
+	}
 	return peer_visibility.has(0) || peer_visibility.has(p_peer);
 }
 
+void MultiplayerSynchronizer::set_visibility_range(real_t p_range) {
+	ERR_FAIL_COND(p_range < 0);
+	if (visibility_range == p_range) {
+		return;
+	}
+	visibility_range = p_range;
+	if (p_range == 0) {
+		peers_in_range.clear();
+	}
+	update_visibility(0);
+}
+
+real_t MultiplayerSynchronizer::get_visibility_range() const {
+	return visibility_range;
+}
+
+bool MultiplayerSynchronizer::get_root_position(Vector3 &r_position) {
+	Node *node = get_root_node();
+#ifndef _3D_DISABLED
+	Node3D *node_3d = Object::cast_to<Node3D>(node);
+	if (node_3d) {
+		r_position = node_3d->get_global_position();
+		return true;
+	}
+#endif
+	Node2D *node_2d = Object::cast_to<Node2D>(node);
+	if (node_2d) {
+		Vector2 pos = node_2d->get_global_position();
+		r_position = Vector3(pos.x, pos.y, 0);
+		return true;
+	}
+	return false;
+}
+
 void MultiplayerSynchronizer::add_visibility_filter(Callable p_callback) {
 	visibility_filters.insert(p_callback);
 	_update_process();
@@ -265,6 +317,8 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_visibility_filter", "filter"), &MultiplayerSynchronizer::add_visibility_filter);
 	ClassDB::bind_method(D_METHOD("remove_visibility_filter", "filter"), &MultiplayerSynchronizer::remove_visibility_filter);
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
+	ClassDB::bind_method(D_METHOD("set_visibility_range", "range"), &MultiplayerSynchronizer::set_visibility_range);
+	ClassDB::bind_method(D_METHOD("get_visibility_range"), &MultiplayerSynchronizer::get_visibility_range);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
@@ -273,6 +327,7 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "visibility_range", PROPERTY_HINT_RANGE, "0,1000,0.1,or_greater,suffix:m"), "set_visibility_range", "get_visibility_range");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -395,6 +450,13 @@ Error MultiplayerSynchronizer::_watch_changes(uint64_t p_usec) {
 			w.value = v.duplicate(true);
 			w.last_change_usec = p_usec;
 		} else if (!w.value.hash_compare(v)) {
+			if (replication_config->is_property_quantized(prop)) {
+				// Changes that the quantization would drop are not worth a delta.
+				Variant old_packed = replication_config->quantize_property(prop, w.value);
+				if (old_packed.hash_compare(replication_config->quantize_property(prop, v))) {
+					continue;
+				}
+			}
 			w.value = v.duplicate(true);
 			w.last_change_usec = p_usec;
 		}
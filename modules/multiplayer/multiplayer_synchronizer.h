@@ -59,6 +59,8 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	real_t visibility_range = 0;
+	HashSet<int> peers_in_range; // Updated by the replication interface.
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
 
@@ -79,8 +81,8 @@ protected:
 	void _notification(int p_what);
 
 public:
-	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs);
-	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state);
+	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, SceneReplicationConfig *p_quantize_config = nullptr);
+	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, SceneReplicationConfig *p_quantize_config = nullptr);
 
 	void reset();
 	Node *get_root_node();
@@ -117,6 +119,12 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_visibility_range(real_t p_range);
+	real_t get_visibility_range() const;
+	bool get_root_position(Vector3 &r_position);
+	const HashSet<int> &get_peers_in_range() const { return peers_in_range; }
+	void set_peers_in_range(const HashSet<int> &p_peers) { peers_in_range = p_peers; }
+
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
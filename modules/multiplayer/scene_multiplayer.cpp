@@ -49,6 +49,16 @@ _FORCE_INLINE_ void SceneMultiplayer::_profile_bandwidth(const String &p_what, i
 		EngineDebugger::profiler_add_frame_data("multiplayer:bandwidth", values);
 	}
 }
+
+_FORCE_INLINE_ void SceneMultiplayer::_profile_peer(const String &p_what, int p_peer, int p_value) {
+	if (EngineDebugger::is_profiling("multiplayer:peers")) {
+		Array values;
+		values.push_back(p_what);
+		values.push_back(p_peer);
+		values.push_back(p_value);
+		EngineDebugger::profiler_add_frame_data("multiplayer:peers", values);
+	}
+}
 #endif
 
 void SceneMultiplayer::_update_status() {
@@ -72,6 +82,11 @@ Error SceneMultiplayer::poll() {
 		return OK;
 	}
 
+	if (last_connection_status == MultiplayerPeer::CONNECTION_CONNECTED) {
+		// Send the RPCs batched since the last poll, so they go out with this peer poll.
+		rpc->flush_batches();
+	}
+
 	multiplayer_peer->poll();
 
 	_update_status();
@@ -93,6 +108,7 @@ Error SceneMultiplayer::poll() {
 
 #ifdef DEBUG_ENABLED
 		_profile_bandwidth("in", len);
+		_profile_peer("in", sender, len);
 #endif
 
 		if (pending_peers.has(sender)) {
@@ -179,6 +195,7 @@ void SceneMultiplayer::clear() {
 	pending_peers.clear();
 	connected_peers.clear();
 	packet_cache.clear();
+	rpc->clear_batches();
 	replicator->on_reset();
 	cache->clear();
 	relay_buffer->clear();
@@ -275,11 +292,17 @@ Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_pa
 		relay_buffer->put_data(p_packet, p_packet_len);
 		multiplayer_peer->set_target_peer(1);
 		const Vector<uint8_t> data = relay_buffer->get_data_array();
+#ifdef DEBUG_ENABLED
+		_profile_peer("out", 1, relay_buffer->get_position());
+#endif
 		return _send(data.ptr(), relay_buffer->get_position());
 	}
 	if (p_to > 0) {
 		ERR_FAIL_COND_V(!connected_peers.has(p_to), ERR_BUG);
 		multiplayer_peer->set_target_peer(p_to);
+#ifdef DEBUG_ENABLED
+		_profile_peer("out", p_to, p_packet_len);
+#endif
 		return _send(p_packet, p_packet_len);
 	} else {
 		for (const int &pid : connected_peers) {
@@ -287,6 +310,9 @@ Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_pa
 				continue;
 			}
 			multiplayer_peer->set_target_peer(pid);
+#ifdef DEBUG_ENABLED
+			_profile_peer("out", pid, p_packet_len);
+#endif
 			_send(p_packet, p_packet_len);
 		}
 		return OK;
@@ -633,6 +659,50 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_peer_interest_position(int p_peer, const Vector3 &p_position) {
+	replicator->set_peer_interest_position(p_peer, p_position);
+}
+
+void SceneMultiplayer::clear_peer_interest_position(int p_peer) {
+	replicator->clear_peer_interest_position(p_peer);
+}
+
+void SceneMultiplayer::set_interest_cell_size(real_t p_size) {
+	replicator->set_interest_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_interest_cell_size() const {
+	return replicator->get_interest_cell_size();
+}
+
+void SceneMultiplayer::set_rpc_batching_enabled(bool p_enabled) {
+	rpc->set_batching_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_rpc_batching_enabled() const {
+	return rpc->is_batching_enabled();
+}
+
+void SceneMultiplayer::set_rpc_flush_unreliable(bool p_enabled) {
+	rpc->set_flush_unreliable(p_enabled);
+}
+
+bool SceneMultiplayer::is_rpc_flushing_unreliable() const {
+	return rpc->is_flushing_unreliable();
+}
+
+void SceneMultiplayer::set_max_rpc_batch_packet_size(int p_size) {
+	rpc->set_max_batch_packet_size(p_size);
+}
+
+int SceneMultiplayer::get_max_rpc_batch_packet_size() const {
+	return rpc->get_max_batch_packet_size();
+}
+
+void SceneMultiplayer::flush_rpcs() {
+	rpc->flush_batches();
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -661,6 +731,17 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("set_peer_interest_position", "peer", "position"), &SceneMultiplayer::set_peer_interest_position);
+	ClassDB::bind_method(D_METHOD("clear_peer_interest_position", "peer"), &SceneMultiplayer::clear_peer_interest_position);
+	ClassDB::bind_method(D_METHOD("get_interest_cell_size"), &SceneMultiplayer::get_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_interest_cell_size", "size"), &SceneMultiplayer::set_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_rpc_batching_enabled", "enabled"), &SceneMultiplayer::set_rpc_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_rpc_batching_enabled"), &SceneMultiplayer::is_rpc_batching_enabled);
+	ClassDB::bind_method(D_METHOD("set_rpc_flush_unreliable", "enabled"), &SceneMultiplayer::set_rpc_flush_unreliable);
+	ClassDB::bind_method(D_METHOD("is_rpc_flushing_unreliable"), &SceneMultiplayer::is_rpc_flushing_unreliable);
+	ClassDB::bind_method(D_METHOD("get_max_rpc_batch_packet_size"), &SceneMultiplayer::get_max_rpc_batch_packet_size);
+	ClassDB::bind_method(D_METHOD("set_max_rpc_batch_packet_size", "size"), &SceneMultiplayer::set_max_rpc_batch_packet_size);
+	ClassDB::bind_method(D_METHOD("flush_rpcs"), &SceneMultiplayer::flush_rpcs);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -670,6 +751,10 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_batching"), "set_rpc_batching_enabled", "is_rpc_batching_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_flush_unreliable"), "set_rpc_flush_unreliable", "is_rpc_flushing_unreliable");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_rpc_batch_packet_size"), "set_max_rpc_batch_packet_size", "get_max_rpc_batch_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_cell_size", PROPERTY_HINT_RANGE, "1,1000,0.1,or_greater,suffix:m"), "set_interest_cell_size", "get_interest_cell_size");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
@@ -130,6 +130,7 @@ private:
 
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_bandwidth(const String &p_what, int p_value);
+	_FORCE_INLINE_ void _profile_peer(const String &p_what, int p_peer, int p_value);
 	_FORCE_INLINE_ Error _send(const uint8_t *p_packet, int p_packet_len); // Also profiles.
 #else
 	_FORCE_INLINE_ Error _send(const uint8_t *p_packet, int p_packet_len) {
@@ -201,6 +202,19 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest_position(int p_peer, const Vector3 &p_position);
+	void clear_peer_interest_position(int p_peer);
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_rpc_batching_enabled(bool p_enabled);
+	bool is_rpc_batching_enabled() const;
+	void set_rpc_flush_unreliable(bool p_enabled);
+	bool is_rpc_flushing_unreliable() const;
+	void set_max_rpc_batch_packet_size(int p_size);
+	int get_max_rpc_batch_packet_size() const;
+	void flush_rpcs();
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
@@ -55,6 +55,14 @@ bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_val
 			ERR_FAIL_COND_V(mode < REPLICATION_MODE_NEVER || mode > REPLICATION_MODE_ON_CHANGE, false);
 			property_set_replication_mode(prop.name, mode);
 			return true;
+		} else if (what == "quantize_bits") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
+			property_set_quantize_bits(prop.name, p_value);
+			return true;
+		} else if (what == "quantize_range") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::VECTOR2, false);
+			property_set_quantize_range(prop.name, p_value);
+			return true;
 		}
 		ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 		if (what == "spawn") {
@@ -90,6 +98,12 @@ bool SceneReplicationConfig::_get(const StringName &p_name, Variant &r_ret) cons
 		} else if (what == "replication_mode") {
 			r_ret = prop.mode;
 			return true;
+		} else if (what == "quantize_bits") {
+			r_ret = prop.quantize_bits;
+			return true;
+		} else if (what == "quantize_range") {
+			r_ret = prop.quantize_range;
+			return true;
 		}
 	}
 	return false;
@@ -100,6 +114,10 @@ void SceneReplicationConfig::_get_property_list(List<PropertyInfo> *p_list) cons
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/spawn", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/replication_mode", PROPERTY_HINT_ENUM, "Never,Always,On Change", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		if (properties[i].quantize_bits) {
+			p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/quantize_bits", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+			p_list->push_back(PropertyInfo(Variant::VECTOR2, "properties/" + itos(i) + "/quantize_range", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		}
 	}
 }
 
@@ -216,6 +234,176 @@ void SceneReplicationConfig::property_set_replication_mode(const NodePath &p_pat
 	dirty = true;
 }
 
+int SceneReplicationConfig::property_get_quantize_bits(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0);
+	return E->get().quantize_bits;
+}
+
+void SceneReplicationConfig::property_set_quantize_bits(const NodePath &p_path, int p_bits) {
+	ERR_FAIL_COND_MSG(p_bits < 0 || p_bits > 16, "Quantization bits must be between 1 and 16, or 0 to disable it.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().quantize_bits == p_bits) {
+		return;
+	}
+	E->get().quantize_bits = p_bits;
+	dirty = true;
+	notify_property_list_changed();
+}
+
+Vector2 SceneReplicationConfig::property_get_quantize_range(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, Vector2());
+	return E->get().quantize_range;
+}
+
+void SceneReplicationConfig::property_set_quantize_range(const NodePath &p_path, const Vector2 &p_range) {
+	ERR_FAIL_COND_MSG(p_range.x >= p_range.y, "Quantization range minimum must be lower than its maximum.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	E->get().quantize_range = p_range;
+}
+
+bool SceneReplicationConfig::is_property_quantized(const NodePath &p_path) {
+	if (dirty) {
+		_update();
+	}
+	return quantized_props.has(p_path);
+}
+
+uint64_t SceneReplicationConfig::_quantize_component(real_t p_value, const Vector2 &p_range, int p_bits) {
+	const uint64_t steps = (1ULL << p_bits) - 1;
+	real_t unit = (CLAMP(p_value, p_range.x, p_range.y) - p_range.x) / (p_range.y - p_range.x);
+	return (uint64_t)Math::round(unit * steps);
+}
+
+real_t SceneReplicationConfig::_dequantize_component(uint64_t p_packed, const Vector2 &p_range, int p_bits) {
+	const uint64_t steps = (1ULL << p_bits) - 1;
+	return p_range.x + (p_range.y - p_range.x) * (real_t(p_packed & steps) / steps);
+}
+
+Variant SceneReplicationConfig::quantize_property(const NodePath &p_path, const Variant &p_value) {
+	if (dirty) {
+		_update();
+	}
+	const ReplicationProperty *const *E = quantized_props.getptr(p_path);
+	if (!E) {
+		return p_value;
+	}
+	const int bits = (*E)->quantize_bits;
+	const Vector2 &range = (*E)->quantize_range;
+	uint64_t packed = 0;
+	switch (p_value.get_type()) {
+		case Variant::FLOAT: {
+			packed = _quantize_component(p_value, range, bits);
+		} break;
+		case Variant::VECTOR2: {
+			Vector2 v = p_value;
+			for (int i = 0; i < 2; i++) {
+				packed |= _quantize_component(v[i], range, bits) << (i * bits);
+			}
+		} break;
+		case Variant::VECTOR3: {
+			Vector3 v = p_value;
+			for (int i = 0; i < 3; i++) {
+				packed |= _quantize_component(v[i], range, bits) << (i * bits);
+			}
+		} break;
+		case Variant::VECTOR4: {
+			Vector4 v = p_value;
+			for (int i = 0; i < 4; i++) {
+				packed |= _quantize_component(v[i], range, bits) << (i * bits);
+			}
+		} break;
+		case Variant::QUATERNION: {
+			// Smallest three: the largest component is dropped (its index takes 2 bits), and
+			// rebuilt from the unit length. The others are within +/- 1/sqrt(2).
+			Quaternion q = Quaternion(p_value).normalized();
+			int largest = 0;
+			for (int i = 1; i < 4; i++) {
+				if (Math::abs(q[i]) > Math::abs(q[largest])) {
+					largest = i;
+				}
+			}
+			if (q[largest] < 0) {
+				q = -q;
+			}
+			const Vector2 q_range = Vector2(-Math_SQRT12, Math_SQRT12);
+			packed = largest;
+			int shift = 2;
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					packed |= _quantize_component(q[i], q_range, bits) << shift;
+					shift += bits;
+				}
+			}
+		} break;
+		default: {
+			return p_value; // Not a type that can be quantized, sent as is.
+		}
+	}
+	return (int64_t)packed;
+}
+
+Variant SceneReplicationConfig::dequantize_property(const NodePath &p_path, const Variant &p_packed, Variant::Type p_type) {
+	if (dirty) {
+		_update();
+	}
+	const ReplicationProperty *const *E = quantized_props.getptr(p_path);
+	if (!E || p_packed.get_type() != Variant::INT) {
+		return p_packed;
+	}
+	const int bits = (*E)->quantize_bits;
+	const Vector2 &range = (*E)->quantize_range;
+	const uint64_t packed = (uint64_t)p_packed.operator int64_t();
+	switch (p_type) {
+		case Variant::FLOAT: {
+			return _dequantize_component(packed, range, bits);
+		}
+		case Variant::VECTOR2: {
+			Vector2 v;
+			for (int i = 0; i < 2; i++) {
+				v[i] = _dequantize_component(packed >> (i * bits), range, bits);
+			}
+			return v;
+		}
+		case Variant::VECTOR3: {
+			Vector3 v;
+			for (int i = 0; i < 3; i++) {
+				v[i] = _dequantize_component(packed >> (i * bits), range, bits);
+			}
+			return v;
+		}
+		case Variant::VECTOR4: {
+			Vector4 v;
+			for (int i = 0; i < 4; i++) {
+				v[i] = _dequantize_component(packed >> (i * bits), range, bits);
+			}
+			return v;
+		}
+		case Variant::QUATERNION: {
+			const Vector2 q_range = Vector2(-Math_SQRT12, Math_SQRT12);
+			const int largest = packed & 3;
+			Quaternion q;
+			real_t sum = 0;
+			int shift = 2;
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					q[i] = _dequantize_component(packed >> shift, q_range, bits);
+					sum += q[i] * q[i];
+					shift += bits;
+				}
+			}
+			q[largest] = Math::sqrt(MAX((real_t)0, 1 - sum));
+			return q.normalized();
+		}
+		default: {
+			return p_packed;
+		}
+	}
+}
+
 void SceneReplicationConfig::_update() {
 	if (!dirty) {
 		return;
@@ -224,7 +412,11 @@ void SceneReplicationConfig::_update() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	quantized_props.clear();
 	for (const ReplicationProperty &prop : properties) {
+		if (prop.quantize_bits) {
+			quantized_props[prop.name] = &prop;
+		}
 		if (prop.spawn) {
 			spawn_props.push_back(prop.name);
 		}
@@ -272,6 +464,10 @@ void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("property_set_spawn", "path", "enabled"), &SceneReplicationConfig::property_set_spawn);
 	ClassDB::bind_method(D_METHOD("property_get_replication_mode", "path"), &SceneReplicationConfig::property_get_replication_mode);
 	ClassDB::bind_method(D_METHOD("property_set_replication_mode", "path", "mode"), &SceneReplicationConfig::property_set_replication_mode);
+	ClassDB::bind_method(D_METHOD("property_get_quantize_bits", "path"), &SceneReplicationConfig::property_get_quantize_bits);
+	ClassDB::bind_method(D_METHOD("property_set_quantize_bits", "path", "bits"), &SceneReplicationConfig::property_set_quantize_bits);
+	ClassDB::bind_method(D_METHOD("property_get_quantize_range", "path"), &SceneReplicationConfig::property_get_quantize_range);
+	ClassDB::bind_method(D_METHOD("property_set_quantize_range", "path", "range"), &SceneReplicationConfig::property_set_quantize_range);
 
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_NEVER);
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_ALWAYS);
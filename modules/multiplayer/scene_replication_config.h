@@ -51,6 +51,8 @@ private:
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		int quantize_bits = 0;
+		Vector2 quantize_range = Vector2(-1, 1);
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -67,9 +69,12 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	HashMap<NodePath, const ReplicationProperty *> quantized_props;
 	bool dirty = false;
 
 	void _update();
+	static uint64_t _quantize_component(real_t p_value, const Vector2 &p_range, int p_bits);
+	static real_t _dequantize_component(uint64_t p_packed, const Vector2 &p_range, int p_bits);
 
 protected:
 	static void _bind_methods();
@@ -98,6 +103,18 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	int property_get_quantize_bits(const NodePath &p_path);
+	void property_set_quantize_bits(const NodePath &p_path, int p_bits);
+
+	Vector2 property_get_quantize_range(const NodePath &p_path);
+	void property_set_quantize_range(const NodePath &p_path, const Vector2 &p_range);
+
+	// Synced values of quantized properties are packed in a single integer, which
+	// MultiplayerAPI then encodes in as few bytes as possible.
+	bool is_property_quantized(const NodePath &p_path);
+	Variant quantize_property(const NodePath &p_path, const Variant &p_value);
+	Variant dequantize_property(const NodePath &p_path, const Variant &p_packed, Variant::Type p_type);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
@@ -51,6 +51,26 @@ _FORCE_INLINE_ void SceneReplicationInterface::_profile_node_data(const String &
 		EngineDebugger::profiler_add_frame_data("multiplayer:replication", values);
 	}
 }
+
+void SceneReplicationInterface::_profile_properties(ObjectID p_id, const List<NodePath> &p_props, const Variant *const *p_vars) {
+	if (!EngineDebugger::is_profiling("multiplayer:replication")) {
+		return;
+	}
+	// Encodes each value on its own, so this ignores the (small) per-state overhead.
+	int i = 0;
+	for (const NodePath &prop : p_props) {
+		int size = 0;
+		if (MultiplayerAPI::encode_and_compress_variant(*p_vars[i], nullptr, size, false) == OK) {
+			Array values;
+			values.push_back("prop_out");
+			values.push_back(p_id);
+			values.push_back(size);
+			values.push_back(String(prop));
+			EngineDebugger::profiler_add_frame_data("multiplayer:replication", values);
+		}
+		i++;
+	}
+}
 #endif
 
 SceneReplicationInterface::TrackedNode &SceneReplicationInterface::_track(const ObjectID &p_id) {
@@ -142,6 +162,8 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	_update_interest();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
@@ -155,6 +177,83 @@ void SceneReplicationInterface::on_network_process() {
 	}
 }
 
+void SceneReplicationInterface::_update_interest() {
+	// Synchronizers with a visibility range are bucketed in a grid, so each peer only
+	// checks the ones in the cells its range can reach.
+	LocalVector<InterestEntry> entries;
+	HashMap<Vector3i, LocalVector<uint32_t>> grid;
+	real_t max_range = 0;
+	for (const ObjectID &oid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
+		if (!sync || sync->get_visibility_range() <= 0 || !_has_authority(sync)) {
+			continue;
+		}
+		InterestEntry entry;
+		if (!sync->get_root_position(entry.position)) {
+			continue;
+		}
+		entry.sync = sync;
+		grid[Vector3i((entry.position / interest_cell_size).floor())].push_back(entries.size());
+		entries.push_back(entry);
+		max_range = MAX(max_range, sync->get_visibility_range());
+	}
+	if (entries.is_empty()) {
+		return;
+	}
+
+	const int cell_reach = (int)Math::ceil(max_range / interest_cell_size);
+	const int64_t cells_to_check = int64_t(cell_reach * 2 + 1) * (cell_reach * 2 + 1) * (cell_reach * 2 + 1);
+	for (const KeyValue<int, PeerInfo> &E : peers_info) {
+		if (!E.value.has_interest_position) {
+			continue;
+		}
+		const Vector3 &peer_pos = E.value.interest_position;
+		if (cells_to_check >= int64_t(grid.size())) {
+			// The range covers most cells anyway, walking the entries is cheaper.
+			for (InterestEntry &entry : entries) {
+				if (entry.position.distance_squared_to(peer_pos) <= entry.sync->get_visibility_range() * entry.sync->get_visibility_range()) {
+					entry.peers.insert(E.key);
+				}
+			}
+			continue;
+		}
+		const Vector3i center = Vector3i((peer_pos / interest_cell_size).floor());
+		for (int x = -cell_reach; x <= cell_reach; x++) {
+			for (int y = -cell_reach; y <= cell_reach; y++) {
+				for (int z = -cell_reach; z <= cell_reach; z++) {
+					const LocalVector<uint32_t> *cell = grid.getptr(center + Vector3i(x, y, z));
+					if (!cell) {
+						continue;
+					}
+					for (uint32_t idx : *cell) {
+						InterestEntry &entry = entries[idx];
+						if (entry.position.distance_squared_to(peer_pos) <= entry.sync->get_visibility_range() * entry.sync->get_visibility_range()) {
+							entry.peers.insert(E.key);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Only the peers that entered or left the range need their visibility updated.
+	for (InterestEntry &entry : entries) {
+		const HashSet<int> old_peers = entry.sync->get_peers_in_range();
+		entry.sync->set_peers_in_range(entry.peers);
+		const ObjectID sid = entry.sync->get_instance_id();
+		for (int peer : old_peers) {
+			if (!entry.peers.has(peer) && peers_info.has(peer)) {
+				_visibility_changed(peer, sid);
+			}
+		}
+		for (int peer : entry.peers) {
+			if (!old_peers.has(peer)) {
+				_visibility_changed(peer, sid);
+			}
+		}
+	}
+}
+
 Error SceneReplicationInterface::on_spawn(Object *p_obj, Variant p_config) {
 	Node *node = Object::cast_to<Node>(p_obj);
 	ERR_FAIL_COND_V(!node || p_config.get_type() != Variant::OBJECT, ERR_INVALID_PARAMETER);
@@ -727,6 +826,15 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			continue; // Nothing to update.
 		}
 
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		List<NodePath> delta_props = sync->get_delta_properties(indexes);
+		const List<NodePath>::Element *P = delta_props.front();
+		for (Variant &v : delta) {
+			ERR_BREAK(!P);
+			v = config->quantize_property(P->get(), v);
+			P = P->next();
+		}
+
 		Vector<const Variant *> varp;
 		varp.resize(delta.size());
 		const Variant **vptr = varp.ptrw();
@@ -739,7 +847,12 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
 
-		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
+		if (size > delta_mtu) {
+#ifdef DEBUG_ENABLED
+			_profile_node_data("delta_drop", oid, size);
+#endif
+			ERR_CONTINUE_MSG(true, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
+		}
 
 		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
 			// Send what we got, and reset write.
@@ -755,6 +868,7 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 		}
 #ifdef DEBUG_ENABLED
 		_profile_node_data("delta_out", oid, size);
+		_profile_properties(oid, delta_props, vptr);
 #endif
 		peers_info[p_peer].last_watch_usecs[oid] = p_usec;
 	}
@@ -788,7 +902,7 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
 		ERR_FAIL_COND_V(err != OK, err);
 		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		err = MultiplayerSynchronizer::set_state(props, node, vars, sync->get_replication_config_ptr());
 		ERR_FAIL_COND_V(err != OK, err);
 		ofs += size;
 		sync->emit_signal(SNAME("delta_synchronized"));
@@ -825,12 +939,17 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
 		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
+		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp, sync->get_replication_config_ptr());
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
 		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
 		// TODO Handle single state above MTU.
-		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (size > sync_mtu) {
+#ifdef DEBUG_ENABLED
+			_profile_node_data("sync_drop", oid, size);
+#endif
+			ERR_CONTINUE_MSG(true, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		}
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
@@ -844,6 +963,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 		}
 #ifdef DEBUG_ENABLED
 		_profile_node_data("sync_out", oid, size);
+		_profile_properties(oid, props, varp.ptr());
 #endif
 	}
 	if (ofs > 3) {
@@ -889,7 +1009,7 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		int consumed;
 		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
 		ERR_FAIL_COND_V(err, err);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		err = MultiplayerSynchronizer::set_state(props, node, vars, sync->get_replication_config_ptr());
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
 		sync->emit_signal(SNAME("synchronized"));
@@ -917,3 +1037,24 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_peer_interest_position(int p_peer, const Vector3 &p_position) {
+	ERR_FAIL_COND(!peers_info.has(p_peer));
+	PeerInfo &info = peers_info[p_peer];
+	info.has_interest_position = true;
+	info.interest_position = p_position;
+}
+
+void SceneReplicationInterface::clear_peer_interest_position(int p_peer) {
+	ERR_FAIL_COND(!peers_info.has(p_peer));
+	peers_info[p_peer].has_interest_position = false;
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Interest cell size must be greater than zero.");
+	interest_cell_size = p_size;
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_cell_size;
+}
@@ -67,6 +67,14 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+		bool has_interest_position = false;
+		Vector3 interest_position;
+	};
+
+	struct InterestEntry {
+		MultiplayerSynchronizer *sync = nullptr;
+		Vector3 position;
+		HashSet<int> peers;
 	};
 
 	// Replication state.
@@ -92,6 +100,7 @@ private:
 	PackedByteArray packet_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
+	real_t interest_cell_size = 64;
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
@@ -111,6 +120,7 @@ private:
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
+	void _update_interest();
 
 	template <class T>
 	static T *get_id_as(const ObjectID &p_id) {
@@ -119,6 +129,7 @@ private:
 
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_node_data(const String &p_what, ObjectID p_id, int p_size);
+	void _profile_properties(ObjectID p_id, const List<NodePath> &p_props, const Variant *const *p_vars);
 #endif
 
 public:
@@ -146,6 +157,11 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest_position(int p_peer, const Vector3 &p_position);
+	void clear_peer_interest_position(int p_peer);
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -43,6 +43,8 @@
 // - `NetworkNodeIdCompression` in the next 2 bits.
 // - `NetworkNameIdCompression` in the next 1 bit.
 // - `byte_only_or_no_args` in the next 1 bit.
+// When `NetworkNodeIdCompression` is `NETWORK_NODE_ID_BATCH`, the packet instead contains multiple
+// RPC packets, each prefixed by its size (1 byte, or 2 bytes when the MSB of the first one is set).
 #define NODE_ID_COMPRESSION_SHIFT SceneMultiplayer::CMD_FLAG_0_SHIFT
 #define NAME_ID_COMPRESSION_SHIFT SceneMultiplayer::CMD_FLAG_2_SHIFT
 #define BYTE_ONLY_OR_NO_ARGS_SHIFT SceneMultiplayer::CMD_FLAG_3_SHIFT
@@ -164,6 +166,27 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 	int node_id_compression = (p_packet[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT;
 	int name_id_compression = (p_packet[0] & NAME_ID_COMPRESSION_FLAG) >> NAME_ID_COMPRESSION_SHIFT;
 
+	if (node_id_compression == NETWORK_NODE_ID_BATCH) {
+		// Multiple RPCs coalesced in a single packet, each prefixed by its size.
+		int ofs = 1;
+		while (ofs < p_packet_len) {
+			int size = p_packet[ofs];
+			ofs += 1;
+			if (size & 0x80) {
+				ERR_FAIL_COND_MSG(ofs >= p_packet_len, "Invalid packet received. Size too small.");
+				size = ((size & 0x7F) << 8) | p_packet[ofs];
+				ofs += 1;
+			}
+			ERR_FAIL_COND_MSG(size < 1 || ofs + size > p_packet_len, "Invalid packet received. Size too small.");
+			const uint8_t *sub_packet = p_packet + ofs;
+			ERR_FAIL_COND_MSG((sub_packet[0] & SceneMultiplayer::CMD_MASK) != SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL, "Invalid packet received. Batched packets must be RPCs.");
+			ERR_FAIL_COND_MSG(((sub_packet[0] & NODE_ID_COMPRESSION_FLAG) >> NODE_ID_COMPRESSION_SHIFT) == NETWORK_NODE_ID_BATCH, "Invalid packet received. Nested RPC batches are not allowed.");
+			process_rpc(p_from, sub_packet, size);
+			ofs += size;
+		}
+		return;
+	}
+
 	switch (node_id_compression) {
 		case NETWORK_NODE_ID_COMPRESSION_8:
 			packet_min_size += 1;
@@ -423,13 +446,9 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 	// We can now set the meta
 	packet_cache.write[0] = command_type + (node_id_compression << NODE_ID_COMPRESSION_SHIFT) + (name_id_compression << NAME_ID_COMPRESSION_SHIFT) + (byte_only_or_no_args ? BYTE_ONLY_OR_NO_ARGS_FLAG : 0);
 
-	// Take chance and set transfer mode, since all send methods will use it.
-	peer->set_transfer_channel(p_config.channel);
-	peer->set_transfer_mode(p_config.transfer_mode);
-
 	if (has_all_peers) {
 		for (const int P : targets) {
-			multiplayer->send_command(P, packet_cache.ptr(), ofs);
+			_send_rpc_packet(P, p_config, packet_cache.ptr(), ofs);
 		}
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
@@ -449,16 +468,132 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 			if (confirmed) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc_id, &(packet_cache.write[1]));
-				multiplayer->send_command(P, packet_cache.ptr(), ofs);
+				_send_rpc_packet(P, p_config, packet_cache.ptr(), ofs);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				multiplayer->send_command(P, packet_cache.ptr(), ofs + path_len);
+				_send_rpc_packet(P, p_config, packet_cache.ptr(), ofs + path_len);
 			}
 		}
 	}
 }
 
+void SceneRPCInterface::_send_rpc_packet(int p_to, const RPCConfig &p_config, const uint8_t *p_packet, int p_packet_len) {
+	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+	const bool batched = batching && !(flush_unreliable && p_config.transfer_mode == MultiplayerPeer::TRANSFER_MODE_UNRELIABLE);
+	const uint64_t key = uint32_t(p_to) | (uint64_t(p_config.transfer_mode) << 32) | (uint64_t(p_config.channel) << 34);
+	if (!batched || p_packet_len > BATCH_MAX_RPC_SIZE) {
+		if (batched && batches.has(key)) {
+			// Preserve ordering with the RPCs already queued on this channel.
+			_flush_batch(batches[key]);
+		}
+		peer->set_transfer_channel(p_config.channel);
+		peer->set_transfer_mode(p_config.transfer_mode);
+		multiplayer->send_command(p_to, p_packet, p_packet_len);
+		return;
+	}
+
+	RPCBatch *batch = batches.getptr(key);
+	if (!batch) {
+		batch = &batches.insert(key, RPCBatch())->value;
+		batch->peer = p_to;
+		batch->transfer_mode = p_config.transfer_mode;
+		batch->channel = p_config.channel;
+	}
+	const int size_len = p_packet_len < 0x80 ? 1 : 2;
+	if (batch->count && int(batch->data.size()) + size_len + p_packet_len > batch_mtu) {
+		_flush_batch(*batch);
+	}
+	if (batch->data.is_empty()) {
+		batch->data.push_back(SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL | (NETWORK_NODE_ID_BATCH << NODE_ID_COMPRESSION_SHIFT));
+	}
+	const uint32_t ofs = batch->data.size();
+	batch->data.resize(ofs + size_len + p_packet_len);
+	if (size_len == 1) {
+		batch->data[ofs] = p_packet_len;
+	} else {
+		batch->data[ofs] = 0x80 | (p_packet_len >> 8);
+		batch->data[ofs + 1] = p_packet_len & 0xFF;
+	}
+	memcpy(&batch->data[ofs + size_len], p_packet, p_packet_len);
+	if (batch->count == 0) {
+		batch->first_ofs = ofs + size_len;
+	}
+	batch->count++;
+}
+
+void SceneRPCInterface::_flush_batch(RPCBatch &p_batch) {
+	if (p_batch.count == 0) {
+		return;
+	}
+	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+	peer->set_transfer_channel(p_batch.channel);
+	peer->set_transfer_mode(p_batch.transfer_mode);
+	if (p_batch.count == 1) {
+		// No need for the batch header when there is a single RPC.
+		multiplayer->send_command(p_batch.peer, &p_batch.data[p_batch.first_ofs], p_batch.data.size() - p_batch.first_ofs);
+	} else {
+		multiplayer->send_command(p_batch.peer, p_batch.data.ptr(), p_batch.data.size());
+	}
+	p_batch.count = 0;
+	p_batch.data.clear();
+}
+
+void SceneRPCInterface::flush_batches() {
+	if (batches.is_empty()) {
+		return;
+	}
+	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+	if (peer.is_null() || peer->get_connection_status() != MultiplayerPeer::CONNECTION_CONNECTED) {
+		clear_batches();
+		return;
+	}
+	const HashSet<int> connected = multiplayer->get_connected_peers();
+	LocalVector<uint64_t> to_erase;
+	for (KeyValue<uint64_t, RPCBatch> &E : batches) {
+		if (!connected.has(E.value.peer)) {
+			to_erase.push_back(E.key);
+			continue;
+		}
+		_flush_batch(E.value);
+	}
+	for (const uint64_t &key : to_erase) {
+		batches.erase(key);
+	}
+}
+
+void SceneRPCInterface::clear_batches() {
+	batches.clear();
+}
+
+void SceneRPCInterface::set_batching_enabled(bool p_enabled) {
+	if (batching && !p_enabled) {
+		flush_batches();
+	}
+	batching = p_enabled;
+}
+
+bool SceneRPCInterface::is_batching_enabled() const {
+	return batching;
+}
+
+void SceneRPCInterface::set_flush_unreliable(bool p_enabled) {
+	flush_unreliable = p_enabled;
+}
+
+bool SceneRPCInterface::is_flushing_unreliable() const {
+	return flush_unreliable;
+}
+
+void SceneRPCInterface::set_max_batch_packet_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 128, "RPC batch maximum packet size must be at least 128 bytes.");
+	batch_mtu = p_size;
+}
+
+int SceneRPCInterface::get_max_batch_packet_size() const {
+	return batch_mtu;
+}
+
 Error SceneRPCInterface::rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) {
 	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
 	ERR_FAIL_COND_V_MSG(!peer.is_valid(), ERR_UNCONFIGURED, "Trying to call an RPC while no multiplayer peer is active.");
@@ -32,6 +32,7 @@
 #define SCENE_RPC_INTERFACE_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/multiplayer_api.h"
 
 class SceneMultiplayer;
@@ -71,6 +72,7 @@ private:
 		NETWORK_NODE_ID_COMPRESSION_8 = 0,
 		NETWORK_NODE_ID_COMPRESSION_16,
 		NETWORK_NODE_ID_COMPRESSION_32,
+		NETWORK_NODE_ID_BATCH, // Not a node ID, the packet contains multiple RPCs.
 	};
 
 	enum NetworkNameIdCompression {
@@ -82,10 +84,29 @@ private:
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	SceneReplicationInterface *multiplayer_replicator = nullptr;
 
+	enum {
+		// Sub-packet sizes are encoded in 1 byte (up to 127), or 2 bytes (up to 32767).
+		BATCH_MAX_RPC_SIZE = 0x7FFF,
+	};
+
+	struct RPCBatch {
+		int peer = 0;
+		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		int channel = 0;
+		int count = 0;
+		int first_ofs = 0;
+		LocalVector<uint8_t> data;
+	};
+
 	Vector<uint8_t> packet_cache;
 
 	HashMap<ObjectID, RPCConfigCache> rpc_cache;
 
+	bool batching = false;
+	bool flush_unreliable = false;
+	int batch_mtu = 1350;
+	HashMap<uint64_t, RPCBatch> batches;
+
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_node_data(const String &p_what, ObjectID p_id, int p_size);
 #endif
@@ -94,6 +115,8 @@ protected:
 	void _process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
 
 	void _send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, const RPCConfig &p_config, const StringName &p_name, const Variant **p_arg, int p_argcount);
+	void _send_rpc_packet(int p_to, const RPCConfig &p_config, const uint8_t *p_packet, int p_packet_len);
+	void _flush_batch(RPCBatch &p_batch);
 	Node *_process_get_node(int p_from, const uint8_t *p_packet, uint32_t p_node_target, int p_packet_len);
 
 	void _parse_rpc_config(const Variant &p_config, bool p_for_node, RPCConfigCache &r_cache);
@@ -104,6 +127,16 @@ public:
 	void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len);
 	String get_rpc_md5(const Object *p_obj);
 
+	void flush_batches();
+	void clear_batches();
+
+	void set_batching_enabled(bool p_enabled);
+	bool is_batching_enabled() const;
+	void set_flush_unreliable(bool p_enabled);
+	bool is_flushing_unreliable() const;
+	void set_max_batch_packet_size(int p_size);
+	int get_max_batch_packet_size() const;
+
 	SceneRPCInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache, SceneReplicationInterface *p_replicator) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
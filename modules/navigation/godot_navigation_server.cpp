@@ -34,6 +34,7 @@
 #include "nav_mesh_generator_3d.h"
 #endif // _3D_DISABLED
 
+#include "core/debugger/engine_debugger.h"
 #include "core/os/mutex.h"
 
 using namespace NavigationUtilities;
@@ -257,6 +258,13 @@ RID GodotNavigationServer::map_get_closest_point_owner(RID p_map, const Vector3
 	return map->get_closest_point_owner(p_point);
 }
 
+Vector<Vector3> GodotNavigationServer::map_get_flow_field_targets(RID p_map, const Vector3 &p_target, const Vector<Vector3> &p_positions, uint32_t p_navigation_layers) const {
+	const NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Vector<Vector3>());
+
+	return map->get_flow_field_targets(p_target, p_positions, p_navigation_layers);
+}
+
 TypedArray<RID> GodotNavigationServer::map_get_links(RID p_map) const {
 	TypedArray<RID> link_rids;
 	const NavMap *map = map_owner.get_or_null(p_map);
@@ -1081,6 +1089,7 @@ void GodotNavigationServer::map_force_update(RID p_map) {
 	NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
 
+	_dispatch_path_query_batches();
 	flush_queries();
 
 	map->sync();
@@ -1095,6 +1104,8 @@ void GodotNavigationServer::sync() {
 }
 
 void GodotNavigationServer::process(real_t p_delta_time) {
+	// Finish the asynchronous path queries before anything can modify the maps.
+	_dispatch_path_query_batches();
 	flush_queries();
 
 	if (!active) {
@@ -1109,6 +1120,11 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 	int _new_pm_edge_merge_count = 0;
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
+	uint64_t _new_pm_sync_usec = 0;
+	uint64_t _new_pm_avoidance_usec = 0;
+	int _new_pm_path_query_count = 0;
+	uint64_t _new_pm_path_query_usec = 0;
+	uint64_t _new_pm_path_query_expanded_polygon_count = 0;
 
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
@@ -1126,6 +1142,11 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 		_new_pm_edge_merge_count += active_maps[i]->get_pm_edge_merge_count();
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
+		_new_pm_sync_usec += active_maps[i]->get_pm_sync_usec();
+		_new_pm_avoidance_usec += active_maps[i]->get_pm_avoidance_usec();
+		_new_pm_path_query_count += active_maps[i]->get_pm_path_query_count();
+		_new_pm_path_query_usec += active_maps[i]->get_pm_path_query_usec();
+		_new_pm_path_query_expanded_polygon_count += active_maps[i]->get_pm_path_query_expanded_polygon_count();
 
 		// Emit a signal if a map changed.
 		const uint32_t new_map_update_id = active_maps[i]->get_map_update_id();
@@ -1143,6 +1164,36 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+	pm_sync_usec = _new_pm_sync_usec;
+	pm_avoidance_usec = _new_pm_avoidance_usec;
+	pm_path_query_count = _new_pm_path_query_count;
+	pm_path_query_usec = _new_pm_path_query_usec;
+	pm_path_query_expanded_polygon_average = _new_pm_path_query_count > 0 ? _new_pm_path_query_expanded_polygon_count / _new_pm_path_query_count : 0;
+
+#ifdef DEBUG_ENABLED
+	if (EngineDebugger::is_profiling("servers")) {
+		// One entry per map and phase, so the cost of each map shows up in the profiler.
+		for (const NavMap *map : active_maps) {
+			const String map_name = itos(map->get_self().get_id());
+
+			Array values;
+			values.resize(3);
+			values[0] = "navigation";
+
+			values[1] = "map_" + map_name + "_sync";
+			values[2] = USEC_TO_SEC(map->get_pm_sync_usec());
+			EngineDebugger::profiler_add_frame_data("servers", values);
+
+			values[1] = "map_" + map_name + "_avoidance";
+			values[2] = USEC_TO_SEC(map->get_pm_avoidance_usec());
+			EngineDebugger::profiler_add_frame_data("servers", values);
+
+			values[1] = "map_" + map_name + "_path_queries";
+			values[2] = USEC_TO_SEC(map->get_pm_path_query_usec());
+			EngineDebugger::profiler_add_frame_data("servers", values);
+		}
+	}
+#endif
 }
 
 void GodotNavigationServer::init() {
@@ -1152,6 +1203,7 @@ void GodotNavigationServer::init() {
 }
 
 void GodotNavigationServer::finish() {
+	_dispatch_path_query_batches();
 	flush_queries();
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
@@ -1163,10 +1215,76 @@ void GodotNavigationServer::finish() {
 }
 
 PathQueryResult GodotNavigationServer::_query_path(const PathQueryParameters &p_parameters) const {
-	PathQueryResult r_query_result;
-
 	const NavMap *map = map_owner.get_or_null(p_parameters.map);
-	ERR_FAIL_NULL_V(map, r_query_result);
+	ERR_FAIL_NULL_V(map, PathQueryResult());
+
+	return _query_map_path(map, p_parameters);
+}
+
+void GodotNavigationServer::query_path_batch_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_query_parameters.size() != p_query_results.size(), "The amount of query parameters and query results must match.");
+
+	PathQueryBatch *batch = memnew(PathQueryBatch);
+	batch->maps.resize(p_query_parameters.size());
+	batch->parameters.resize(p_query_parameters.size());
+	batch->results.resize(p_query_parameters.size());
+	batch->query_results = p_query_results;
+	batch->callback = p_callback;
+
+	for (int i = 0; i < p_query_parameters.size(); i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		batch->maps[i] = nullptr;
+		ERR_CONTINUE_MSG(query_parameters.is_null(), "Invalid path query parameters.");
+		batch->parameters[i] = query_parameters->get_parameters();
+		// The maps are resolved here, as the RID owner can't be read while other threads create RIDs.
+		batch->maps[i] = map_owner.get_or_null(batch->parameters[i].map);
+		ERR_CONTINUE_MSG(batch->maps[i] == nullptr, "Invalid navigation map in path query parameters.");
+	}
+
+	batch->group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer::_query_path_batch_element, batch, batch->parameters.size(), -1, false, SNAME("NavigationServer3DPathQueries"));
+
+	MutexLock lock(path_query_batches_mutex);
+	path_query_batches.push_back(batch);
+}
+
+void GodotNavigationServer::_query_path_batch_element(uint32_t p_index, PathQueryBatch *p_batch) {
+	if (p_batch->maps[p_index]) {
+		p_batch->results[p_index] = _query_map_path(p_batch->maps[p_index], p_batch->parameters[p_index]);
+	}
+}
+
+void GodotNavigationServer::_dispatch_path_query_batches() {
+	LocalVector<PathQueryBatch *> batches;
+	{
+		MutexLock lock(path_query_batches_mutex);
+		SWAP(batches, path_query_batches);
+	}
+
+	for (PathQueryBatch *batch : batches) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_task);
+
+		for (uint32_t i = 0; i < batch->results.size(); i++) {
+			Ref<NavigationPathQueryResult3D> query_result = batch->query_results[i];
+			if (query_result.is_null()) {
+				continue;
+			}
+			query_result->set_path(batch->results[i].path);
+			query_result->set_path_types(batch->results[i].path_types);
+			query_result->set_path_rids(batch->results[i].path_rids);
+			query_result->set_path_owner_ids(batch->results[i].path_owner_ids);
+		}
+
+		if (batch->callback.is_valid()) {
+			batch->callback.call();
+		}
+
+		memdelete(batch);
+	}
+}
+
+PathQueryResult GodotNavigationServer::_query_map_path(const NavMap *p_map, const PathQueryParameters &p_parameters) const {
+	PathQueryResult r_query_result;
+	const NavMap *map = p_map;
 
 	// run the pathfinding
 
@@ -1231,6 +1349,21 @@ int GodotNavigationServer::get_process_info(ProcessInfo p_info) const {
 		case INFO_EDGE_FREE_COUNT: {
 			return pm_edge_free_count;
 		} break;
+		case INFO_SYNC_TIME_USEC: {
+			return pm_sync_usec;
+		} break;
+		case INFO_AVOIDANCE_TIME_USEC: {
+			return pm_avoidance_usec;
+		} break;
+		case INFO_PATH_QUERY_COUNT: {
+			return pm_path_query_count;
+		} break;
+		case INFO_PATH_QUERY_TIME_USEC: {
+			return pm_path_query_usec;
+		} break;
+		case INFO_PATH_QUERY_EXPANDED_POLYGON_AVERAGE: {
+			return pm_path_query_expanded_polygon_average;
+		} break;
 	}
 
 	return 0;
@@ -78,6 +78,19 @@ class GodotNavigationServer : public NavigationServer3D {
 	mutable RID_Owner<NavAgent> agent_owner;
 	mutable RID_Owner<NavObstacle> obstacle_owner;
 
+	/// Asynchronous path queries. They only read the maps, so they are completed
+	/// before the next sync and before any command is executed.
+	struct PathQueryBatch {
+		LocalVector<const NavMap *> maps;
+		LocalVector<NavigationUtilities::PathQueryParameters> parameters;
+		LocalVector<NavigationUtilities::PathQueryResult> results;
+		TypedArray<NavigationPathQueryResult3D> query_results;
+		Callable callback;
+		WorkerThreadPool::GroupID group_task = -1;
+	};
+	Mutex path_query_batches_mutex;
+	LocalVector<PathQueryBatch *> path_query_batches;
+
 	bool active = true;
 	LocalVector<NavMap *> active_maps;
 	LocalVector<uint32_t> active_maps_update_id;
@@ -95,6 +108,11 @@ class GodotNavigationServer : public NavigationServer3D {
 	int pm_edge_merge_count = 0;
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
+	uint64_t pm_sync_usec = 0;
+	uint64_t pm_avoidance_usec = 0;
+	int pm_path_query_count = 0;
+	uint64_t pm_path_query_usec = 0;
+	int pm_path_query_expanded_polygon_average = 0;
 
 public:
 	GodotNavigationServer();
@@ -132,6 +150,7 @@ public:
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const override;
 	virtual Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const override;
 	virtual RID map_get_closest_point_owner(RID p_map, const Vector3 &p_point) const override;
+	virtual Vector<Vector3> map_get_flow_field_targets(RID p_map, const Vector3 &p_target, const Vector<Vector3> &p_positions, uint32_t p_navigation_layers = 1) const override;
 
 	virtual TypedArray<RID> map_get_links(RID p_map) const override;
 	virtual TypedArray<RID> map_get_regions(RID p_map) const override;
@@ -247,10 +266,15 @@ public:
 	virtual void finish() override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void query_path_batch_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable()) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
+	NavigationUtilities::PathQueryResult _query_map_path(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters) const;
+	void _query_path_batch_element(uint32_t p_index, PathQueryBatch *p_batch);
+	void _dispatch_path_query_batches();
+
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
 };
@@ -259,6 +259,10 @@ Vector<Vector2> FORWARD_5_R_C(vector_v3_to_v2, map_get_path, RID, p_map, Vector2
 Vector2 FORWARD_2_R_C(v3_to_v2, map_get_closest_point, RID, p_map, const Vector2 &, p_point, rid_to_rid, v2_to_v3);
 RID FORWARD_2_C(map_get_closest_point_owner, RID, p_map, const Vector2 &, p_point, rid_to_rid, v2_to_v3);
 
+Vector<Vector2> GodotNavigationServer2D::map_get_flow_field_targets(RID p_map, const Vector2 &p_target, const Vector<Vector2> &p_positions, uint32_t p_navigation_layers) const {
+	return vector_v3_to_v2(NavigationServer3D::get_singleton()->map_get_flow_field_targets(p_map, v2_to_v3(p_target), vector_v2_to_v3(p_positions), p_navigation_layers));
+}
+
 RID FORWARD_0(region_create);
 
 void FORWARD_2(region_set_enabled, RID, p_region, bool, p_enabled, rid_to_rid, bool_to_bool);
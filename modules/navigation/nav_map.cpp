@@ -36,7 +36,10 @@
 #include "nav_region.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/templates/sort_array.h"
 
 #include <Obstacle2d.h>
 
@@ -115,8 +118,31 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
+// Adds a path query to the map statistics once it returns, whichever way it exits.
+struct NavMapPathQueryStatistics {
+	SafeNumeric<uint32_t> &query_count;
+	SafeNumeric<uint64_t> &query_usec;
+	SafeNumeric<uint64_t> &query_expanded_polygon_count;
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	uint32_t expanded_polygon_count = 0;
+
+	NavMapPathQueryStatistics(SafeNumeric<uint32_t> &p_query_count, SafeNumeric<uint64_t> &p_query_usec, SafeNumeric<uint64_t> &p_query_expanded_polygon_count) :
+			query_count(p_query_count),
+			query_usec(p_query_usec),
+			query_expanded_polygon_count(p_query_expanded_polygon_count) {}
+
+	~NavMapPathQueryStatistics() {
+		query_count.increment();
+		query_usec.add(OS::get_singleton()->get_ticks_usec() - begin_usec);
+		query_expanded_polygon_count.add(expanded_polygon_count);
+	}
+};
+
 Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const {
 	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector<Vector3>(), "NavigationServer map query failed because it was made before first map synchronization.");
+
+	NavMapPathQueryStatistics statistics(path_query_count, path_query_usec, path_query_expanded_polygon_count);
+
 	// Clear metadata outputs.
 	if (r_path_types) {
 		r_path_types->clear();
@@ -129,40 +155,12 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	}
 
 	// Find the start poly and the end poly on this map.
-	const gd::Polygon *begin_poly = nullptr;
-	const gd::Polygon *end_poly = nullptr;
+	// Only consider the polygons in regions with compatible layers.
 	Vector3 begin_point;
 	Vector3 end_point;
-	real_t begin_d = FLT_MAX;
+	const gd::Polygon *begin_poly = _get_closest_polygon(p_origin, true, p_navigation_layers, begin_point);
+	const gd::Polygon *end_poly = _get_closest_polygon(p_destination, true, p_navigation_layers, end_point);
 	real_t end_d = FLT_MAX;
-	// Find the initial poly and the end poly on this map.
-	for (const gd::Polygon &p : polygons) {
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
-
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-
-			Vector3 point = face.get_closest_point_to(p_origin);
-			real_t distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
-
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
-			}
-		}
-	}
 
 	// Check for trivial cases
 	if (!begin_poly || !end_poly) {
@@ -206,9 +204,16 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 	navigation_polys.push_back(begin_navigation_poly);
 
-	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
-	to_visit.push_back(0);
+	// Reachable navigation poly ID of each polygon already reached.
+	HashMap<const gd::Polygon *, uint32_t> navigation_poly_ids;
+	navigation_poly_ids.insert(begin_poly, 0);
+
+	// Heap of polygon IDs to visit, ordered by estimated cost.
+	// Entries are not removed when a polygon's travel cost decreases, a new one is pushed instead
+	// and the outdated one is skipped once it reaches the top of the heap.
+	LocalVector<gd::NavigationPolyToVisit> to_visit;
+	to_visit.push_back(gd::NavigationPolyToVisit(0, 0.0, begin_point.distance_to(end_point) * begin_poly->owner->get_travel_cost()));
+	SortArray<gd::NavigationPolyToVisit, gd::NavigationPolyToVisitComparator> to_visit_sorter;
 
 	// This is an implementation of the A* algorithm.
 	int least_cost_id = 0;
@@ -244,11 +249,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, pathway);
 				const real_t new_distance = (least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost) + poly_enter_cost + least_cost_poly.traveled_distance;
 
-				int64_t already_visited_polygon_index = navigation_polys.find(gd::NavigationPoly(connection.polygon));
+				const uint32_t *already_visited_polygon_id = navigation_poly_ids.getptr(connection.polygon);
 
-				if (already_visited_polygon_index != -1) {
+				if (already_visited_polygon_id) {
 					// Polygon already visited, check if we can reduce the travel cost.
-					gd::NavigationPoly &avp = navigation_polys[already_visited_polygon_index];
+					gd::NavigationPoly &avp = navigation_polys[*already_visited_polygon_id];
 					if (new_distance < avp.traveled_distance) {
 						avp.back_navigation_poly_id = least_cost_id;
 						avp.back_navigation_edge = connection.edge;
@@ -256,6 +261,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 						avp.back_navigation_edge_pathway_end = connection.pathway_end;
 						avp.traveled_distance = new_distance;
 						avp.entry = new_entry;
+
+						if (!avp.closed) {
+							to_visit.push_back(gd::NavigationPolyToVisit(avp.self_id, new_distance, new_distance + new_entry.distance_to(end_point) * avp.poly->owner->get_travel_cost()));
+							to_visit_sorter.push_heap(0, to_visit.size() - 1, 0, to_visit[to_visit.size() - 1], to_visit.ptr());
+						}
 					}
 				} else {
 					// Add the neighbor polygon to the reachable ones.
@@ -268,15 +278,27 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					new_navigation_poly.traveled_distance = new_distance;
 					new_navigation_poly.entry = new_entry;
 					navigation_polys.push_back(new_navigation_poly);
+					navigation_poly_ids.insert(connection.polygon, new_navigation_poly.self_id);
 
 					// Add the neighbor polygon to the polygons to visit.
-					to_visit.push_back(navigation_polys.size() - 1);
+					to_visit.push_back(gd::NavigationPolyToVisit(new_navigation_poly.self_id, new_distance, new_distance + new_entry.distance_to(end_point) * connection.polygon->owner->get_travel_cost()));
+					to_visit_sorter.push_heap(0, to_visit.size() - 1, 0, to_visit[to_visit.size() - 1], to_visit.ptr());
 				}
 			}
 		}
 
-		// Removes the least cost polygon from the list of polygons to visit so we can advance.
-		to_visit.erase(least_cost_id);
+		// Removes the least cost polygon from the polygons to visit so we can advance.
+		navigation_polys[least_cost_id].closed = true;
+		statistics.expanded_polygon_count++;
+		while (!to_visit.is_empty()) {
+			const gd::NavigationPolyToVisit &top = to_visit[0];
+			const gd::NavigationPoly &top_poly = navigation_polys[top.id];
+			if (!top_poly.closed && top.traveled_distance == top_poly.traveled_distance) {
+				break;
+			}
+			to_visit_sorter.pop_heap(0, to_visit.size(), to_visit.ptr());
+			to_visit.resize(to_visit.size() - 1);
+		}
 
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
 		if (to_visit.size() == 0) {
@@ -343,10 +365,13 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 			// Reset open and navigation_polys
 			gd::NavigationPoly np = navigation_polys[0];
+			np.closed = false;
 			navigation_polys.clear();
 			navigation_polys.push_back(np);
+			navigation_poly_ids.clear();
+			navigation_poly_ids.insert(np.poly, 0);
 			to_visit.clear();
-			to_visit.push_back(0);
+			to_visit.push_back(gd::NavigationPolyToVisit(0, np.traveled_distance, np.traveled_distance + np.entry.distance_to(end_point) * np.poly->owner->get_travel_cost()));
 			least_cost_id = 0;
 			prev_least_cost_id = -1;
 
@@ -355,20 +380,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			continue;
 		}
 
-		// Find the polygon with the minimum cost from the list of polygons to visit.
-		least_cost_id = -1;
-		real_t least_cost = FLT_MAX;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
-			real_t cost = np->traveled_distance;
-			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
-			if (cost < least_cost) {
-				least_cost_id = np->self_id;
-				least_cost = cost;
-			}
-		}
-
-		ERR_BREAK(least_cost_id == -1);
+		// The polygon with the minimum cost from the list of polygons to visit is at the top of the heap.
+		least_cost_id = to_visit[0].id;
 
 		// Stores the further reachable end polygon, in case our goal is not reachable.
 		if (is_reachable) {
@@ -641,26 +654,307 @@ RID NavMap::get_closest_point_owner(const Vector3 &p_point) const {
 	return cp.owner;
 }
 
+Vector<Vector3> NavMap::get_flow_field_targets(const Vector3 &p_target, const Vector<Vector3> &p_positions, uint32_t p_navigation_layers) const {
+	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector<Vector3>(), "NavigationServer map query failed because it was made before first map synchronization.");
+
+	Vector<Vector3> targets;
+	targets.resize(p_positions.size());
+	Vector3 *targets_ptrw = targets.ptrw();
+
+	MutexLock lock(flow_field_mutex);
+
+	if (!flow_field.valid || flow_field.map_update_id != map_update_id || flow_field.navigation_layers != p_navigation_layers || flow_field.target != p_target) {
+		_build_flow_field(p_target, p_navigation_layers);
+	}
+
+	for (int i = 0; i < p_positions.size(); i++) {
+		const Vector3 &position = p_positions[i];
+		targets_ptrw[i] = position;
+
+		Vector3 closest_point;
+		const gd::Polygon *poly = _get_closest_polygon(position, true, p_navigation_layers, closest_point);
+		if (!poly) {
+			continue;
+		}
+		uint32_t poly_index = _get_flow_field_polygon_index(poly);
+		if (flow_field.distances[poly_index] == FLT_MAX) {
+			continue; // The target can't be reached from here.
+		}
+		targets_ptrw[i] = flow_field.waypoints[poly_index];
+	}
+
+	return targets;
+}
+
+uint32_t NavMap::_get_flow_field_polygon_index(const gd::Polygon *p_polygon) const {
+	if (p_polygon >= polygons.ptr() && p_polygon < polygons.ptr() + polygons.size()) {
+		return p_polygon - polygons.ptr();
+	}
+	return polygons.size() + (p_polygon - link_polygons.ptr());
+}
+
+void NavMap::_build_flow_field(const Vector3 &p_target, uint32_t p_navigation_layers) const {
+	const uint32_t poly_count = polygons.size() + link_polygons.size();
+
+	flow_field.valid = true;
+	flow_field.target = p_target;
+	flow_field.navigation_layers = p_navigation_layers;
+	flow_field.map_update_id = map_update_id;
+	flow_field.distances.resize(poly_count);
+	flow_field.waypoints.resize(poly_count);
+	for (uint32_t i = 0; i < poly_count; i++) {
+		flow_field.distances[i] = FLT_MAX;
+	}
+
+	Vector3 target_point;
+	const gd::Polygon *target_poly = _get_closest_polygon(p_target, true, p_navigation_layers, target_point);
+	if (!target_poly) {
+		return;
+	}
+
+	// The field is computed backwards from the target, so each polygon needs the connections entering it.
+	struct IncomingConnection {
+		uint32_t from = 0;
+		Vector3 pathway_center;
+	};
+	LocalVector<uint32_t> incoming_offsets;
+	incoming_offsets.resize(poly_count + 1);
+	for (uint32_t i = 0; i <= poly_count; i++) {
+		incoming_offsets[i] = 0;
+	}
+	for (uint32_t i = 0; i < poly_count; i++) {
+		const gd::Polygon &poly = i < polygons.size() ? polygons[i] : link_polygons[i - polygons.size()];
+		for (const gd::Edge &edge : poly.edges) {
+			for (int connection_index = 0; connection_index < edge.connections.size(); connection_index++) {
+				incoming_offsets[_get_flow_field_polygon_index(edge.connections[connection_index].polygon) + 1]++;
+			}
+		}
+	}
+	for (uint32_t i = 0; i < poly_count; i++) {
+		incoming_offsets[i + 1] += incoming_offsets[i];
+	}
+	LocalVector<IncomingConnection> incoming;
+	incoming.resize(incoming_offsets[poly_count]);
+	LocalVector<uint32_t> incoming_fill;
+	incoming_fill.resize(poly_count);
+	for (uint32_t i = 0; i < poly_count; i++) {
+		incoming_fill[i] = incoming_offsets[i];
+	}
+	for (uint32_t i = 0; i < poly_count; i++) {
+		const gd::Polygon &poly = i < polygons.size() ? polygons[i] : link_polygons[i - polygons.size()];
+		for (const gd::Edge &edge : poly.edges) {
+			for (int connection_index = 0; connection_index < edge.connections.size(); connection_index++) {
+				const gd::Edge::Connection &connection = edge.connections[connection_index];
+				IncomingConnection &entry = incoming[incoming_fill[_get_flow_field_polygon_index(connection.polygon)]++];
+				entry.from = i;
+				entry.pathway_center = (connection.pathway_start + connection.pathway_end) * 0.5;
+			}
+		}
+	}
+
+	// Dijkstra from the target polygon. Each polygon leads to the center of the pathway
+	// into the neighbor with the lowest remaining cost to the target.
+	LocalVector<bool> closed;
+	closed.resize(poly_count);
+	for (uint32_t i = 0; i < poly_count; i++) {
+		closed[i] = false;
+	}
+
+	const uint32_t target_index = _get_flow_field_polygon_index(target_poly);
+	flow_field.distances[target_index] = 0.0;
+	flow_field.waypoints[target_index] = target_point;
+
+	LocalVector<gd::NavigationPolyToVisit> to_visit;
+	to_visit.push_back(gd::NavigationPolyToVisit(target_index, 0.0, 0.0));
+	SortArray<gd::NavigationPolyToVisit, gd::NavigationPolyToVisitComparator> to_visit_sorter;
+
+	while (!to_visit.is_empty()) {
+		const gd::NavigationPolyToVisit current = to_visit[0];
+		to_visit_sorter.pop_heap(0, to_visit.size(), to_visit.ptr());
+		to_visit.resize(to_visit.size() - 1);
+
+		if (closed[current.id] || current.traveled_distance != flow_field.distances[current.id]) {
+			continue; // Outdated entry.
+		}
+		closed[current.id] = true;
+
+		const gd::Polygon &current_poly = current.id < polygons.size() ? polygons[current.id] : link_polygons[current.id - polygons.size()];
+		for (uint32_t incoming_index = incoming_offsets[current.id]; incoming_index < incoming_offsets[current.id + 1]; incoming_index++) {
+			const IncomingConnection &connection = incoming[incoming_index];
+			if (closed[connection.from]) {
+				continue;
+			}
+
+			const gd::Polygon &from_poly = connection.from < polygons.size() ? polygons[connection.from] : link_polygons[connection.from - polygons.size()];
+			if ((p_navigation_layers & from_poly.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			real_t distance = current.traveled_distance + connection.pathway_center.distance_to(flow_field.waypoints[current.id]) * current_poly.owner->get_travel_cost();
+			if (from_poly.owner != current_poly.owner) {
+				distance += current_poly.owner->get_enter_cost();
+			}
+
+			if (distance < flow_field.distances[connection.from]) {
+				flow_field.distances[connection.from] = distance;
+				flow_field.waypoints[connection.from] = connection.pathway_center;
+				to_visit.push_back(gd::NavigationPolyToVisit(connection.from, distance, distance));
+				to_visit_sorter.push_heap(0, to_visit.size() - 1, 0, to_visit[to_visit.size() - 1], to_visit.ptr());
+			}
+		}
+	}
+}
+
 gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_point) const {
 	gd::ClosestPointQueryResult result;
+
+	const gd::Polygon *closest_poly = _get_closest_polygon(p_point, false, 0, result.point, &result.normal);
+	if (closest_poly) {
+		result.owner = closest_poly->owner->get_self();
+	}
+
+	return result;
+}
+
+struct NavPolygonCenterComparator {
+	const LocalVector<gd::Polygon> *polygons = nullptr;
+	Vector3::Axis axis = Vector3::AXIS_X;
+
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		return (*polygons)[p_a].center[axis] < (*polygons)[p_b].center[axis];
+	}
+};
+
+void NavMap::_build_polygon_bvh() {
+	polygon_bvh.clear();
+	polygon_bvh_ids.resize(polygons.size());
+	if (polygons.is_empty()) {
+		return;
+	}
+
+	LocalVector<AABB> polygon_aabbs;
+	polygon_aabbs.resize(polygons.size());
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		const gd::Polygon &p = polygons[i];
+		AABB aabb(p.points.is_empty() ? p.center : p.points[0].pos, Vector3());
+		for (uint32_t point_id = 1; point_id < p.points.size(); point_id++) {
+			aabb.expand_to(p.points[point_id].pos);
+		}
+		polygon_aabbs[i] = aabb;
+		polygon_bvh_ids[i] = i;
+	}
+
+	polygon_bvh.reserve(polygons.size() / POLYGON_BVH_LEAF_SIZE * 2 + 1);
+	polygon_bvh.resize(1);
+	_build_polygon_bvh_node(0, 0, polygons.size(), polygon_aabbs);
+}
+
+void NavMap::_build_polygon_bvh_node(uint32_t p_node, uint32_t p_from, uint32_t p_to, const LocalVector<AABB> &p_polygon_aabbs) {
+	AABB aabb = p_polygon_aabbs[polygon_bvh_ids[p_from]];
+	AABB centers(polygons[polygon_bvh_ids[p_from]].center, Vector3());
+	for (uint32_t i = p_from + 1; i < p_to; i++) {
+		aabb.merge_with(p_polygon_aabbs[polygon_bvh_ids[i]]);
+		centers.expand_to(polygons[polygon_bvh_ids[i]].center);
+	}
+	polygon_bvh[p_node].aabb = aabb;
+
+	if (p_to - p_from <= POLYGON_BVH_LEAF_SIZE) {
+		polygon_bvh[p_node].first = p_from;
+		polygon_bvh[p_node].count = p_to - p_from;
+		return;
+	}
+
+	// Split at the median of the polygon centers along their longest axis, so the tree stays balanced.
+	SortArray<uint32_t, NavPolygonCenterComparator> sorter;
+	sorter.compare.polygons = &polygons;
+	sorter.compare.axis = (Vector3::Axis)centers.get_longest_axis_index();
+	sorter.sort(polygon_bvh_ids.ptr() + p_from, p_to - p_from);
+
+	uint32_t first_child = polygon_bvh.size();
+	polygon_bvh.resize(first_child + 2);
+	polygon_bvh[p_node].first = first_child;
+	polygon_bvh[p_node].count = 0;
+
+	uint32_t middle = p_from + (p_to - p_from) / 2;
+	_build_polygon_bvh_node(first_child, p_from, middle, p_polygon_aabbs);
+	_build_polygon_bvh_node(first_child + 1, middle, p_to, p_polygon_aabbs);
+}
+
+static _FORCE_INLINE_ real_t _aabb_distance_squared_to(const AABB &p_aabb, const Vector3 &p_point) {
+	const Vector3 end = p_aabb.get_end();
+	real_t distance_squared = 0.0;
+	for (int i = 0; i < 3; i++) {
+		if (p_point[i] < p_aabb.position[i]) {
+			distance_squared += (p_aabb.position[i] - p_point[i]) * (p_aabb.position[i] - p_point[i]);
+		} else if (p_point[i] > end[i]) {
+			distance_squared += (p_point[i] - end[i]) * (p_point[i] - end[i]);
+		}
+	}
+	return distance_squared;
+}
+
+const gd::Polygon *NavMap::_get_closest_polygon(const Vector3 &p_point, bool p_use_navigation_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 *r_normal) const {
+	if (polygon_bvh.is_empty()) {
+		return nullptr;
+	}
+
+	const gd::Polygon *closest_poly = nullptr;
+	uint32_t closest_poly_index = UINT32_MAX;
 	real_t closest_point_ds = FLT_MAX;
 
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
+	// The tree is balanced, so its depth is bounded by the bit count of the polygon indices.
+	uint32_t stack[64];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const PolygonBVHNode &node = polygon_bvh[stack[--stack_size]];
+		// Nodes at the same distance are still visited, so ties resolve to the lowest polygon index,
+		// like going through all the polygons in order would.
+		if (_aabb_distance_squared_to(node.aabb, p_point) > closest_point_ds) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			// Visit the nearest child first to shrink the search distance faster.
+			real_t ds_first = _aabb_distance_squared_to(polygon_bvh[node.first].aabb, p_point);
+			real_t ds_second = _aabb_distance_squared_to(polygon_bvh[node.first + 1].aabb, p_point);
+			if (ds_first <= ds_second) {
+				stack[stack_size++] = node.first + 1;
+				stack[stack_size++] = node.first;
+			} else {
+				stack[stack_size++] = node.first;
+				stack[stack_size++] = node.first + 1;
+			}
+			continue;
+		}
+
+		for (uint32_t i = node.first; i < node.first + node.count; i++) {
+			uint32_t poly_index = polygon_bvh_ids[i];
+			const gd::Polygon &p = polygons[poly_index];
+			if (p_use_navigation_layers && (p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			// For each face check the distance to the point.
+			for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
+				const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				const Vector3 point = face.get_closest_point_to(p_point);
+				const real_t ds = point.distance_squared_to(p_point);
+				if (ds < closest_point_ds || (ds == closest_point_ds && poly_index < closest_poly_index)) {
+					closest_point_ds = ds;
+					closest_poly = &p;
+					closest_poly_index = poly_index;
+					r_closest_point = point;
+					if (r_normal) {
+						*r_normal = face.get_plane().normal;
+					}
+				}
 			}
 		}
 	}
 
-	return result;
+	return closest_poly;
 }
 
 void NavMap::add_region(NavRegion *p_region) {
@@ -770,6 +1064,9 @@ void NavMap::remove_agent_as_controlled(NavAgent *agent) {
 }
 
 void NavMap::sync() {
+	ENGINE_TRACE_ZONE("NavMap::sync");
+	const uint64_t sync_begin_usec = OS::get_singleton()->get_ticks_usec();
+
 	// Performance Monitor
 	int _new_pm_region_count = regions.size();
 	int _new_pm_agent_count = agents.size();
@@ -837,6 +1134,8 @@ void NavMap::sync() {
 
 		_new_pm_polygon_count = polygons.size();
 
+		_build_polygon_bvh();
+
 		// Group all edges per key.
 		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
 		for (gd::Polygon &poly : polygons) {
@@ -891,16 +1190,63 @@ void NavMap::sync() {
 		// connection, integration and path finding.
 		_new_pm_edge_free_count = free_edges.size();
 
+		// Two edges can only be connected if their bounds, grown by the connection margin, overlap.
+		// Find those candidates with a sweep along the X axis instead of testing every pair of free edges,
+		// then go through them in the free edge order so connections are added in the same order as before.
+		LocalVector<AABB> free_edge_aabbs;
+		LocalVector<uint32_t> free_edge_order;
+		free_edge_aabbs.resize(free_edges.size());
+		free_edge_order.resize(free_edges.size());
+		WorkerThreadPool::get_singleton()->parallel_for(
+				free_edges.size(), 1024, [&](uint32_t p_from, uint32_t p_to) {
+					for (uint32_t i = p_from; i < p_to; i++) {
+						const gd::Edge::Connection &free_edge = free_edges[i];
+						AABB edge_aabb(free_edge.polygon->points[free_edge.edge].pos, Vector3());
+						edge_aabb.expand_to(free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos);
+						free_edge_aabbs[i] = edge_aabb.grow(edge_connection_margin * 0.5);
+						free_edge_order[i] = i;
+					}
+				},
+				"NavMapFreeEdgeBounds");
+
+		struct FreeEdgeSweepComparator {
+			const LocalVector<AABB> *aabbs = nullptr;
+			_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+				return (*aabbs)[p_a].position.x < (*aabbs)[p_b].position.x;
+			}
+		};
+		FreeEdgeSweepComparator free_edge_comparator;
+		free_edge_comparator.aabbs = &free_edge_aabbs;
+		WorkerThreadPool::get_singleton()->parallel_sort(free_edge_order.ptr(), free_edge_order.size(), 4096, free_edge_comparator, "NavMapFreeEdgeSort");
+
+		LocalVector<LocalVector<uint32_t>> free_edge_candidates;
+		free_edge_candidates.resize(free_edges.size());
+		for (uint32_t sweep_i = 0; sweep_i < free_edge_order.size(); sweep_i++) {
+			const uint32_t i = free_edge_order[sweep_i];
+			const AABB &edge_aabb = free_edge_aabbs[i];
+			const real_t edge_end_x = edge_aabb.position.x + edge_aabb.size.x;
+			for (uint32_t sweep_j = sweep_i + 1; sweep_j < free_edge_order.size(); sweep_j++) {
+				const uint32_t j = free_edge_order[sweep_j];
+				if (free_edge_aabbs[j].position.x > edge_end_x) {
+					break;
+				}
+				if (free_edges[i].polygon->owner == free_edges[j].polygon->owner || !edge_aabb.intersects_inclusive(free_edge_aabbs[j])) {
+					continue;
+				}
+				free_edge_candidates[i].push_back(j);
+				free_edge_candidates[j].push_back(i);
+			}
+		}
+
 		for (int i = 0; i < free_edges.size(); i++) {
 			const gd::Edge::Connection &free_edge = free_edges[i];
 			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
 			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
 
-			for (int j = 0; j < free_edges.size(); j++) {
+			LocalVector<uint32_t> &candidates = free_edge_candidates[i];
+			candidates.sort();
+			for (const uint32_t j : candidates) {
 				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
-				}
 
 				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
 				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
@@ -1099,6 +1445,7 @@ void NavMap::sync() {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+	pm_sync_usec = OS::get_singleton()->get_ticks_usec() - sync_begin_usec;
 }
 
 void NavMap::_update_rvo_obstacles_tree_2d() {
@@ -1197,23 +1544,32 @@ void NavMap::_update_rvo_simulation() {
 void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent) {
 	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
 	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
 }
 
 void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
 	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-	(*(agent + index))->update();
 }
 
 void NavMap::step(real_t p_deltatime) {
+	const uint64_t step_begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	// Move the path queries made since the last step to the performance monitor values.
+	pm_path_query_count = path_query_count.get();
+	pm_path_query_usec = path_query_usec.get();
+	pm_path_query_expanded_polygon_count = path_query_expanded_polygon_count.get();
+	path_query_count.sub(pm_path_query_count);
+	path_query_usec.sub(pm_path_query_usec);
+	path_query_expanded_polygon_count.sub(pm_path_query_expanded_polygon_count);
+
 	deltatime = p_deltatime;
 
 	rvo_simulation_2d.setTimeStep(float(deltatime));
 	rvo_simulation_3d.setTimeStep(float(deltatime));
 
+	// The new velocities are all computed before any agent is moved, as computing them reads
+	// the position and velocity of the neighbors. This keeps the result independent of the
+	// order the agents are processed in, so the group tasks don't race on those values.
 	if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
@@ -1222,10 +1578,13 @@ void NavMap::step(real_t p_deltatime) {
 			for (NavAgent *agent : active_2d_avoidance_agents) {
 				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
 				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
 			}
 		}
+
+		for (NavAgent *agent : active_2d_avoidance_agents) {
+			agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+			agent->update();
+		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
@@ -1236,11 +1595,16 @@ void NavMap::step(real_t p_deltatime) {
 			for (NavAgent *agent : active_3d_avoidance_agents) {
 				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
 			}
 		}
+
+		for (NavAgent *agent : active_3d_avoidance_agents) {
+			agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+			agent->update();
+		}
 	}
+
+	pm_avoidance_usec = OS::get_singleton()->get_ticks_usec() - step_begin_usec;
 }
 
 void NavMap::dispatch_callbacks() {
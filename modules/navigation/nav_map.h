@@ -35,6 +35,7 @@
 #include "nav_utils.h"
 
 #include "core/math/math_defs.h"
+#include "core/os/mutex.h"
 #include "core/object/worker_thread_pool.h"
 
 #include <KdTree2d.h>
@@ -76,6 +77,33 @@ class NavMap : public NavRid {
 	/// Map polygons
 	LocalVector<gd::Polygon> polygons;
 
+	/// Bounding volume hierarchy over the map polygons, rebuilt with them.
+	/// Inner nodes have their two children stored next to each other starting at `first`,
+	/// leaves reference `count` polygon indices in `polygon_bvh_ids` starting at `first`.
+	enum {
+		POLYGON_BVH_LEAF_SIZE = 4,
+	};
+	struct PolygonBVHNode {
+		AABB aabb;
+		uint32_t first = 0;
+		uint32_t count = 0;
+	};
+	LocalVector<PolygonBVHNode> polygon_bvh;
+	LocalVector<uint32_t> polygon_bvh_ids;
+
+	/// Flow field toward the last requested target, kept until the target or the map changes.
+	/// Indices cover `polygons` followed by `link_polygons`.
+	struct FlowField {
+		bool valid = false;
+		Vector3 target;
+		uint32_t navigation_layers = 0;
+		uint32_t map_update_id = 0;
+		LocalVector<real_t> distances;
+		LocalVector<Vector3> waypoints;
+	};
+	mutable FlowField flow_field;
+	mutable Mutex flow_field_mutex;
+
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
 	RVO3D::RVOSimulator3D rvo_simulation_3d;
@@ -115,6 +143,17 @@ class NavMap : public NavRid {
 	int pm_edge_merge_count = 0;
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
+	uint64_t pm_sync_usec = 0;
+	uint64_t pm_avoidance_usec = 0;
+	int pm_path_query_count = 0;
+	uint64_t pm_path_query_usec = 0;
+	uint64_t pm_path_query_expanded_polygon_count = 0;
+
+	// Path queries can run on any thread, so their statistics are accumulated here
+	// and moved to the performance monitor values once per step.
+	mutable SafeNumeric<uint32_t> path_query_count;
+	mutable SafeNumeric<uint64_t> path_query_usec;
+	mutable SafeNumeric<uint64_t> path_query_expanded_polygon_count;
 
 public:
 	NavMap();
@@ -156,6 +195,7 @@ public:
 	Vector3 get_closest_point_normal(const Vector3 &p_point) const;
 	gd::ClosestPointQueryResult get_closest_point_info(const Vector3 &p_point) const;
 	RID get_closest_point_owner(const Vector3 &p_point) const;
+	Vector<Vector3> get_flow_field_targets(const Vector3 &p_target, const Vector<Vector3> &p_positions, uint32_t p_navigation_layers) const;
 
 	void add_region(NavRegion *p_region);
 	void remove_region(NavRegion *p_region);
@@ -203,6 +243,11 @@ public:
 	int get_pm_edge_merge_count() const { return pm_edge_merge_count; }
 	int get_pm_edge_connection_count() const { return pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return pm_edge_free_count; }
+	uint64_t get_pm_sync_usec() const { return pm_sync_usec; }
+	uint64_t get_pm_avoidance_usec() const { return pm_avoidance_usec; }
+	int get_pm_path_query_count() const { return pm_path_query_count; }
+	uint64_t get_pm_path_query_usec() const { return pm_path_query_usec; }
+	uint64_t get_pm_path_query_expanded_polygon_count() const { return pm_path_query_expanded_polygon_count; }
 
 private:
 	void compute_single_step(uint32_t index, NavAgent **agent);
@@ -210,6 +255,12 @@ private:
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
 
+	void _build_polygon_bvh();
+	void _build_polygon_bvh_node(uint32_t p_node, uint32_t p_from, uint32_t p_to, const LocalVector<AABB> &p_polygon_aabbs);
+	uint32_t _get_flow_field_polygon_index(const gd::Polygon *p_polygon) const;
+	void _build_flow_field(const Vector3 &p_target, uint32_t p_navigation_layers) const;
+	const gd::Polygon *_get_closest_polygon(const Vector3 &p_point, bool p_use_navigation_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 *r_normal = nullptr) const;
+
 	void clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
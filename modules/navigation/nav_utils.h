@@ -129,6 +129,8 @@ struct NavigationPoly {
 	Vector3 entry;
 	/// The distance to the destination.
 	real_t traveled_distance = 0.0;
+	/// Whether the neighbors of this poly have already been visited.
+	bool closed = false;
 
 	NavigationPoly() { poly = nullptr; }
 
@@ -144,6 +146,35 @@ struct NavigationPoly {
 	}
 };
 
+struct NavigationPolyToVisit {
+	uint32_t id = 0;
+	/// The traveled distance of the poly when this entry was added, to detect outdated entries.
+	real_t traveled_distance = 0.0;
+	/// The traveled distance plus the estimated distance to the destination.
+	real_t cost = 0.0;
+
+	NavigationPolyToVisit() {}
+
+	NavigationPolyToVisit(uint32_t p_id, real_t p_traveled_distance, real_t p_cost) :
+			id(p_id),
+			traveled_distance(p_traveled_distance),
+			cost(p_cost) {}
+};
+
+struct NavigationPolyToVisitComparator {
+	// Returns true when A should be visited after B, so the heap keeps the least cost poly on top.
+	// Equal costs are visited in the order the polys were reached.
+	_FORCE_INLINE_ bool operator()(const NavigationPolyToVisit &A, const NavigationPolyToVisit &B) const {
+		if (A.cost > B.cost) {
+			return true;
+		} else if (A.cost < B.cost) {
+			return false;
+		} else {
+			return A.id > B.id;
+		}
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
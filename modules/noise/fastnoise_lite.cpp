@@ -30,6 +30,8 @@
 
 #include "fastnoise_lite.h"
 
+#include "core/object/worker_thread_pool.h"
+
 _FastNoiseLite::FractalType FastNoiseLite::_convert_domain_warp_fractal_type_enum(DomainWarpFractalType p_domain_warp_fractal_type) {
 	_FastNoiseLite::FractalType type;
 	switch (p_domain_warp_fractal_type) {
@@ -336,6 +338,33 @@ real_t FastNoiseLite::get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const {
 	return _noise.GetNoise(p_x, p_y, p_z);
 }
 
+void FastNoiseLite::get_noise_grid(real_t *r_values, int p_width, int p_height, bool p_in_3d_space, int p_z) const {
+	// Sampling is const and has no shared state, so rows can be generated on several threads.
+	WorkerThreadPool::get_singleton()->parallel_for(
+			p_height, MAX(1, 16384 / p_width), [&](uint32_t p_from, uint32_t p_to) {
+				real_t *row = r_values + p_from * p_width;
+				for (uint32_t y = p_from; y < p_to; y++) {
+					for (int x = 0; x < p_width; x++) {
+						real_t px = x + offset.x;
+						real_t py = y + offset.y;
+						if (p_in_3d_space) {
+							real_t pz = p_z + offset.z;
+							if (domain_warp_enabled) {
+								_domain_warp_noise.DomainWarp(px, py, pz);
+							}
+							*row++ = _noise.GetNoise(px, py, pz);
+						} else {
+							if (domain_warp_enabled) {
+								_domain_warp_noise.DomainWarp(px, py);
+							}
+							*row++ = _noise.GetNoise(px, py);
+						}
+					}
+				}
+			},
+			"FastNoiseLite Grid");
+}
+
 void FastNoiseLite::_changed() {
 	emit_changed();
 }
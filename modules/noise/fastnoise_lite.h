@@ -215,6 +215,8 @@ public:
 	real_t get_noise_3dv(Vector3 p_v) const override;
 	real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const override;
 
+	void get_noise_grid(real_t *r_values, int p_width, int p_height, bool p_in_3d_space, int p_z = 0) const override;
+
 	void _changed();
 };
 
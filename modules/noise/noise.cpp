@@ -80,6 +80,14 @@ uint8_t Noise::_alpha_blend<uint8_t>(uint8_t p_bg, uint8_t p_fg, int p_alpha) co
 	return (uint8_t)((alpha * p_fg + inv_alpha * p_bg) >> 8);
 }
 
+void Noise::get_noise_grid(real_t *r_values, int p_width, int p_height, bool p_in_3d_space, int p_z) const {
+	for (int y = 0; y < p_height; y++) {
+		for (int x = 0; x < p_width; x++) {
+			*r_values++ = p_in_3d_space ? get_noise_3d(x, y, p_z) : get_noise_2d(x, y);
+		}
+	}
+}
+
 Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
@@ -93,22 +101,18 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 
 		real_t min_val = FLT_MAX;
 		real_t max_val = -FLT_MAX;
-		int idx = 0;
 		for (int d = 0; d < p_depth; d++) {
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					values[idx] = p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y);
-					if (values[idx] > max_val) {
-						max_val = values[idx];
-					}
-					if (values[idx] < min_val) {
-						min_val = values[idx];
-					}
-					idx++;
-				}
+			get_noise_grid(&values[d * p_width * p_height], p_width, p_height, p_in_3d_space, d);
+		}
+		for (const real_t value : values) {
+			if (value > max_val) {
+				max_val = value;
+			}
+			if (value < min_val) {
+				min_val = value;
 			}
 		}
-		idx = 0;
+		int idx = 0;
 		// Normalize values and write to texture.
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
@@ -138,6 +142,8 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 		}
 	} else {
 		// Without normalization, the expected range of the noise function is [-1, 1].
+		LocalVector<real_t> values;
+		values.resize(p_width * p_height);
 
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
@@ -145,11 +151,13 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 
 			uint8_t *wd8 = data.ptrw();
 
+			get_noise_grid(values.ptr(), p_width, p_height, p_in_3d_space, d);
+
 			uint8_t ivalue;
 			int idx = 0;
 			for (int y = 0; y < p_height; y++) {
 				for (int x = 0; x < p_width; x++) {
-					float value = (p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y));
+					float value = values[idx];
 					ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
 					wd8[idx] = p_invert ? (255 - ivalue) : ivalue;
 					idx++;
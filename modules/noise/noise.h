@@ -290,6 +290,11 @@ public:
 	virtual real_t get_noise_3dv(Vector3 p_v) const = 0;
 	virtual real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const = 0;
 
+	// Fills r_values with p_width * p_height samples taken at integer coordinates, row by row.
+	// In 3D space, the samples are taken on the p_z plane. Implementations may override it to avoid
+	// per-sample virtual calls or to spread the rows between threads.
+	virtual void get_noise_grid(real_t *r_values, int p_width, int p_height, bool p_in_3d_space, int p_z = 0) const;
+
 	Vector<Ref<Image>> _get_image(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual Ref<Image> get_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual TypedArray<Image> get_image_3d(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_normalize = true) const;
@@ -632,6 +632,31 @@ TEST_CASE("[FastNoiseLite] Generating seamless 2D images (11x11px) and compare t
 	}
 }
 
+TEST_CASE("[FastNoiseLite] Noise grid matches per-sample noise") {
+	FastNoiseLite noise;
+	noise.set_offset(Vector3(3.5, -2.0, 1.0));
+	noise.set_domain_warp_enabled(true);
+
+	const int width = 37;
+	const int height = 29;
+	LocalVector<real_t> values;
+	values.resize(width * height);
+
+	noise.get_noise_grid(values.ptr(), width, height, false);
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			CHECK(values[y * width + x] == noise.get_noise_2d(x, y));
+		}
+	}
+
+	noise.get_noise_grid(values.ptr(), width, height, true, 4);
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			CHECK(values[y * width + x] == noise.get_noise_3d(x, y, 4));
+		}
+	}
+}
+
 } //namespace TestFastNoiseLite
 
 #endif // TEST_FASTNOISE_LITE_H
@@ -1888,6 +1888,14 @@ RID OpenXRAPI::get_depth_texture() {
 	}
 }
 
+void OpenXRAPI::set_velocity_texture(RID p_velocity_texture) {
+	velocity_texture = p_velocity_texture;
+}
+
+RID OpenXRAPI::get_velocity_texture() {
+	return velocity_texture;
+}
+
 void OpenXRAPI::post_draw_viewport(RID p_render_target) {
 	if (!can_render()) {
 		return;
@@ -1947,6 +1955,16 @@ void OpenXRAPI::end_frame() {
 	for (uint32_t eye = 0; eye < view_count; eye++) {
 		projection_views[eye].fov = views[eye].fov;
 		projection_views[eye].pose = views[eye].pose;
+
+		// Let extensions chain per view data, such as the motion vectors and depth used for space warp.
+		void *next_pointer = nullptr;
+		if (submit_depth_buffer && OpenXRCompositionLayerDepthExtension::get_singleton()->is_available() && depth_views) {
+			next_pointer = &depth_views[eye];
+		}
+		for (OpenXRExtensionWrapper *wrapper : registered_extension_wrappers) {
+			next_pointer = wrapper->set_projection_views_and_get_next_pointer(eye, next_pointer);
+		}
+		projection_views[eye].next = next_pointer;
 	}
 
 	Vector<const XrCompositionLayerBaseHeader *> layers_list;
@@ -100,6 +100,7 @@ private:
 	XrViewConfigurationType view_configuration = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
 	XrReferenceSpaceType reference_space = XR_REFERENCE_SPACE_TYPE_STAGE;
 	bool submit_depth_buffer = false; // if set to true we submit depth buffers to OpenXR if a suitable extension is enabled.
+	RID velocity_texture; // set by extensions that submit motion vectors (e.g. for space warp), the renderer writes into it.
 
 	// blend mode
 	XrEnvironmentBlendMode environment_blend_mode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
@@ -359,6 +360,8 @@ public:
 	XrSwapchain get_color_swapchain();
 	RID get_color_texture();
 	RID get_depth_texture();
+	void set_velocity_texture(RID p_velocity_texture);
+	RID get_velocity_texture();
 	void post_draw_viewport(RID p_render_target);
 	void end_frame();
 
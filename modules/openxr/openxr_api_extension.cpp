@@ -48,6 +48,8 @@ void OpenXRAPIExtension::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_play_space"), &OpenXRAPIExtension::get_play_space);
 	ClassDB::bind_method(D_METHOD("get_next_frame_time"), &OpenXRAPIExtension::get_next_frame_time);
 	ClassDB::bind_method(D_METHOD("can_render"), &OpenXRAPIExtension::can_render);
+
+	ClassDB::bind_method(D_METHOD("set_velocity_texture", "velocity_texture"), &OpenXRAPIExtension::set_velocity_texture);
 }
 
 uint64_t OpenXRAPIExtension::get_instance() {
@@ -126,5 +128,10 @@ bool OpenXRAPIExtension::can_render() {
 	return OpenXRAPI::get_singleton()->can_render();
 }
 
+void OpenXRAPIExtension::set_velocity_texture(RID p_velocity_texture) {
+	ERR_FAIL_NULL(OpenXRAPI::get_singleton());
+	OpenXRAPI::get_singleton()->set_velocity_texture(p_velocity_texture);
+}
+
 OpenXRAPIExtension::OpenXRAPIExtension() {
 }
@@ -70,6 +70,8 @@ public:
 	int64_t get_next_frame_time();
 	bool can_render();
 
+	void set_velocity_texture(RID p_velocity_texture);
+
 	OpenXRAPIExtension();
 };
 
@@ -383,9 +383,7 @@ void RaycastOcclusionCull::Scenario::_transform_vertices_thread(uint32_t p_threa
 }
 
 void RaycastOcclusionCull::Scenario::_transform_vertices_range(const Vector3 *p_read, Vector3 *p_write, const Transform3D &p_xform, int p_from, int p_to) {
-	for (int i = p_from; i < p_to; i++) {
-		p_write[i] = p_xform.xform(p_read[i]);
-	}
+	p_xform.xform_array(p_read + p_from, p_write + p_from, p_to - p_from);
 }
 
 void RaycastOcclusionCull::Scenario::free() {
@@ -46,6 +46,59 @@ static void _regex_free(void *ptr, void *user) {
 	}
 }
 
+// Match context, JIT stack and match data are reused by all patterns matched on the same thread,
+// instead of being created and freed on every search.
+class RegExThreadCache {
+	pcre2_general_context_32 *gctx = nullptr;
+	pcre2_match_context_32 *mctx = nullptr;
+	pcre2_jit_stack_32 *jit_stack = nullptr;
+	pcre2_match_data_32 *match_data = nullptr;
+	uint32_t match_data_pairs = 0;
+
+public:
+	pcre2_match_context_32 *get_match_context() {
+		if (!mctx) {
+			gctx = pcre2_general_context_create_32(&_regex_malloc, &_regex_free, nullptr);
+			mctx = pcre2_match_context_create_32(gctx);
+			// Only used by patterns that were JIT compiled, the default 32 KiB stack is too small for some.
+			jit_stack = pcre2_jit_stack_create_32(32 * 1024, 512 * 1024, gctx);
+			if (jit_stack) {
+				pcre2_jit_stack_assign_32(mctx, nullptr, jit_stack);
+			}
+		}
+		return mctx;
+	}
+
+	pcre2_match_data_32 *get_match_data(uint32_t p_pairs) {
+		if (p_pairs > match_data_pairs) {
+			if (match_data) {
+				pcre2_match_data_free_32(match_data);
+			}
+			get_match_context();
+			match_data = pcre2_match_data_create_32(p_pairs, gctx);
+			match_data_pairs = p_pairs;
+		}
+		return match_data;
+	}
+
+	~RegExThreadCache() {
+		if (match_data) {
+			pcre2_match_data_free_32(match_data);
+		}
+		if (jit_stack) {
+			pcre2_jit_stack_free_32(jit_stack);
+		}
+		if (mctx) {
+			pcre2_match_context_free_32(mctx);
+		}
+		if (gctx) {
+			pcre2_general_context_free_32(gctx);
+		}
+	}
+};
+
+static thread_local RegExThreadCache regex_thread_cache;
+
 int RegExMatch::_find(const Variant &p_name) const {
 	if (p_name.is_num()) {
 		int i = (int)p_name;
@@ -173,6 +226,7 @@ void RegEx::clear() {
 		pcre2_code_free_32((pcre2_code_32 *)code);
 		code = nullptr;
 	}
+	ovector_pairs = 0;
 }
 
 Error RegEx::compile(const String &p_pattern) {
@@ -198,49 +252,57 @@ Error RegEx::compile(const String &p_pattern) {
 		ERR_PRINT(message.utf8());
 		return FAILED;
 	}
-	return OK;
-}
 
-Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
-	ERR_FAIL_COND_V(!is_valid(), nullptr);
-	ERR_FAIL_COND_V_MSG(p_offset < 0, nullptr, "RegEx search offset must be >= 0");
+	// Fails when PCRE2 was built without JIT support or the platform doesn't allow executable memory,
+	// in which case pcre2_match() keeps using the interpreter.
+	pcre2_jit_compile_32((pcre2_code_32 *)code, PCRE2_JIT_COMPLETE);
 
-	Ref<RegExMatch> result = memnew(RegExMatch);
+	uint32_t capture_count = 0;
+	_pattern_info(PCRE2_INFO_CAPTURECOUNT, &capture_count);
+	ovector_pairs = capture_count + 1;
+
+	return OK;
+}
 
+int RegEx::_match(const String &p_subject, int p_offset, int p_end) const {
 	int length = p_subject.length();
 	if (p_end >= 0 && p_end < length) {
 		length = p_end;
 	}
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_context_32 *mctx = regex_thread_cache.get_match_context();
+	pcre2_match_data_32 *match = regex_thread_cache.get_match_data(ovector_pairs);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	return pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+}
+
+const size_t *RegEx::_get_ovector() const {
+	return pcre2_get_ovector_pointer_32(regex_thread_cache.get_match_data(ovector_pairs));
+}
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), nullptr);
+	ERR_FAIL_COND_V_MSG(p_offset < 0, nullptr, "RegEx search offset must be >= 0");
 
-	if (res < 0) {
-		pcre2_match_data_free_32(match);
-		pcre2_match_context_free_32(mctx);
+	int res = _match(p_subject, p_offset, p_end);
 
+	if (res < 0) {
 		return nullptr;
 	}
 
-	uint32_t size = pcre2_get_ovector_count_32(match);
-	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+	Ref<RegExMatch> result = memnew(RegExMatch);
+
+	const PCRE2_SIZE *ovector = _get_ovector();
 
-	result->data.resize(size);
+	result->data.resize(ovector_pairs);
 
-	for (uint32_t i = 0; i < size; i++) {
+	for (uint32_t i = 0; i < ovector_pairs; i++) {
 		result->data.write[i].start = ovector[i * 2];
 		result->data.write[i].end = ovector[i * 2 + 1];
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	result->subject = p_subject;
 
 	uint32_t count;
@@ -284,6 +346,33 @@ TypedArray<RegExMatch> RegEx::search_all(const String &p_subject, int p_offset,
 	return result;
 }
 
+PackedInt32Array RegEx::search_all_offsets(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), PackedInt32Array());
+	ERR_FAIL_COND_V_MSG(p_offset < 0, PackedInt32Array(), "RegEx search offset must be >= 0");
+
+	PackedInt32Array result;
+	int last_end = -1;
+	int offset = p_offset;
+	while (_match(p_subject, offset, p_end) >= 0) {
+		const PCRE2_SIZE *ovector = _get_ovector();
+		int end = ovector[1];
+		if (last_end == end) {
+			break;
+		}
+
+		int base = result.size();
+		result.resize(base + ovector_pairs * 2);
+		int32_t *w = result.ptrw() + base;
+		for (uint32_t i = 0; i < ovector_pairs * 2; i++) {
+			w[i] = ovector[i];
+		}
+
+		last_end = end;
+		offset = end;
+	}
+	return result;
+}
+
 String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_all, int p_offset, int p_end) const {
 	ERR_FAIL_COND_V(!is_valid(), String());
 	ERR_FAIL_COND_V_MSG(p_offset < 0, String(), "RegEx sub offset must be >= 0");
@@ -309,14 +398,12 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 	}
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_context_32 *mctx = regex_thread_cache.get_match_context();
+	pcre2_match_data_32 *match = regex_thread_cache.get_match_data(ovector_pairs);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 	PCRE2_SPTR32 r = (PCRE2_SPTR32)p_replacement.get_data();
 	PCRE2_UCHAR32 *o = (PCRE2_UCHAR32 *)output.ptrw();
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
-
 	int res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 
 	if (res == PCRE2_ERROR_NOMEMORY) {
@@ -325,9 +412,6 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 		res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	if (res < 0) {
 		return String();
 	}
@@ -399,6 +483,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern"), &RegEx::compile);
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_offsets", "subject", "offset", "end"), &RegEx::search_all_offsets, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
@@ -74,9 +74,12 @@ class RegEx : public RefCounted {
 
 	void *general_ctx = nullptr;
 	void *code = nullptr;
+	uint32_t ovector_pairs = 0;
 	String pattern;
 
 	void _pattern_info(uint32_t what, void *where) const;
+	int _match(const String &p_subject, int p_offset, int p_end) const;
+	const size_t *_get_ovector() const;
 
 protected:
 	static void _bind_methods();
@@ -89,6 +92,7 @@ public:
 
 	Ref<RegExMatch> search(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	TypedArray<RegExMatch> search_all(const String &p_subject, int p_offset = 0, int p_end = -1) const;
+	PackedInt32Array search_all_offsets(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	String sub(const String &p_subject, const String &p_replacement, bool p_all = false, int p_offset = 0, int p_end = -1) const;
 
 	bool is_valid() const;
@@ -109,6 +109,32 @@ TEST_CASE("[RegEx] Searching") {
 	CHECK(re.search_all(s).size() == 0);
 }
 
+TEST_CASE("[RegEx] Searching offsets") {
+	const String s = "Searching";
+
+	RegEx re("([aeiou])([aeiou])?");
+	REQUIRE(re.is_valid());
+
+	const PackedInt32Array offsets = re.search_all_offsets(s);
+	TypedArray<RegExMatch> matches = re.search_all(s);
+	REQUIRE(offsets.size() == matches.size() * 6);
+	for (int i = 0; i < matches.size(); i++) {
+		const Ref<RegExMatch> match = matches[i];
+		for (int group = 0; group < 3; group++) {
+			CHECK(offsets[i * 6 + group * 2] == match->get_start(group));
+			CHECK(offsets[i * 6 + group * 2 + 1] == match->get_end(group));
+		}
+	}
+
+	CHECK(offsets[0] == 1);
+	CHECK(offsets[1] == 3);
+	CHECK(offsets[4] == 2);
+	CHECK(offsets[5] == 3);
+	CHECK(offsets[10] == -1);
+
+	CHECK(RegEx("\\d").search_all_offsets(s).is_empty());
+}
+
 TEST_CASE("[RegEx] Substitution") {
 	const String s1 = "Double all the vowels.";
 
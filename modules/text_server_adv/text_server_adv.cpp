@@ -391,6 +391,7 @@ void TextServerAdvanced::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
 		MutexLock ftlock(ft_mutex);
+		_shaped_text_cache_clear();
 
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
 		{
@@ -799,6 +800,68 @@ String TextServerAdvanced::_tag_to_name(int64_t p_tag) const {
 /* Font Glyph Rendering                                                  */
 /*************************************************************************/
 
+void TextServerAdvanced::_font_update_texture(const RID &p_font_rid, FontAdvanced *p_font_data, const Vector2i &p_size, ShelfPackTexture &r_tex) const {
+	if (!r_tex.dirty) {
+		return;
+	}
+
+	if (r_tex.texture.is_valid()) {
+		// The texture RID is already referenced by draw commands, defer the upload until the frame is drawn.
+		MutexLock lock(texture_updates_mutex);
+		if (!texture_updates_connected) {
+			RenderingServer::get_singleton()->connect("frame_pre_draw", callable_mp(const_cast<TextServerAdvanced *>(this), &TextServerAdvanced::_font_flush_texture_updates));
+			texture_updates_connected = true;
+		}
+		texture_updates[p_font_rid].insert(p_size);
+		return;
+	}
+
+	Ref<Image> img = Image::create_from_data(r_tex.texture_w, r_tex.texture_h, false, r_tex.format, r_tex.imgdata);
+	if (p_font_data->mipmaps) {
+		img->generate_mipmaps();
+	}
+	r_tex.texture = ImageTexture::create_from_image(img);
+	r_tex.dirty = false;
+}
+
+void TextServerAdvanced::_font_flush_texture_updates() {
+	HashMap<RID, HashSet<Vector2i>> updates;
+	{
+		MutexLock lock(texture_updates_mutex);
+		updates = texture_updates;
+		texture_updates.clear();
+	}
+
+	for (const KeyValue<RID, HashSet<Vector2i>> &E : updates) {
+		FontAdvanced *fd = _get_font_data(E.key);
+		if (!fd) {
+			continue; // Font was freed.
+		}
+
+		MutexLock lock(fd->mutex);
+		for (const Vector2i &size : E.value) {
+			HashMap<Vector2i, FontForSizeAdvanced *, VariantHasher, VariantComparator>::Iterator F = fd->cache.find(size);
+			if (!F) {
+				continue; // Size cache was cleared.
+			}
+
+			ShelfPackTexture *textures = F->value->textures.ptrw();
+			for (int i = 0; i < F->value->textures.size(); i++) {
+				ShelfPackTexture &tex = textures[i];
+				if (!tex.dirty || tex.texture.is_null()) {
+					continue;
+				}
+				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
+				if (fd->mipmaps) {
+					img->generate_mipmaps();
+				}
+				tex.texture->update(img);
+				tex.dirty = false;
+			}
+		}
+	}
+}
+
 _FORCE_INLINE_ TextServerAdvanced::FontTexturePosition TextServerAdvanced::find_texture_pos_for_glyph(FontForSizeAdvanced *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const {
 	FontTexturePosition ret;
 
@@ -1854,6 +1917,7 @@ RID TextServerAdvanced::_create_font_linked_variation(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteArray &p_data) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1865,6 +1929,7 @@ void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteA
 }
 
 void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t *p_data_ptr, int64_t p_data_size) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1876,6 +1941,7 @@ void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t
 }
 
 void TextServerAdvanced::_font_set_face_index(const RID &p_font_rid, int64_t p_face_index) {
+	_shaped_text_cache_clear();
 	ERR_FAIL_COND(p_face_index < 0);
 	ERR_FAIL_COND(p_face_index >= 0x7FFF);
 
@@ -1944,6 +2010,7 @@ int64_t TextServerAdvanced::_font_get_face_count(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_style(const RID &p_font_rid, BitField<FontStyle> p_style) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1964,6 +2031,7 @@ BitField<TextServer::FontStyle> TextServerAdvanced::_font_get_style(const RID &p
 }
 
 void TextServerAdvanced::_font_set_style_name(const RID &p_font_rid, const String &p_name) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1984,6 +2052,7 @@ String TextServerAdvanced::_font_get_style_name(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_weight(const RID &p_font_rid, int64_t p_weight) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2004,6 +2073,7 @@ int64_t TextServerAdvanced::_font_get_weight(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_stretch(const RID &p_font_rid, int64_t p_stretch) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2024,6 +2094,7 @@ int64_t TextServerAdvanced::_font_get_stretch(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_name(const RID &p_font_rid, const String &p_name) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2157,6 +2228,7 @@ Dictionary TextServerAdvanced::_font_get_ot_name_strings(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_antialiasing(const RID &p_font_rid, TextServer::FontAntialiasing p_antialiasing) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2200,6 +2272,7 @@ bool TextServerAdvanced::_font_get_generate_mipmaps(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_multichannel_signed_distance_field(const RID &p_font_rid, bool p_msdf) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2219,6 +2292,7 @@ bool TextServerAdvanced::_font_is_multichannel_signed_distance_field(const RID &
 }
 
 void TextServerAdvanced::_font_set_msdf_pixel_range(const RID &p_font_rid, int64_t p_msdf_pixel_range) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2238,6 +2312,7 @@ int64_t TextServerAdvanced::_font_get_msdf_pixel_range(const RID &p_font_rid) co
 }
 
 void TextServerAdvanced::_font_set_msdf_size(const RID &p_font_rid, int64_t p_msdf_size) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2257,6 +2332,7 @@ int64_t TextServerAdvanced::_font_get_msdf_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_fixed_size) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2273,6 +2349,7 @@ int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid, TextServer::FixedSizeScaleMode p_fixed_size_scale_mode) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2289,6 +2366,7 @@ TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mo
 }
 
 void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid, bool p_allow_system_fallback) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2305,6 +2383,7 @@ bool TextServerAdvanced::_font_is_allow_system_fallback(const RID &p_font_rid) c
 }
 
 void TextServerAdvanced::_font_set_force_autohinter(const RID &p_font_rid, bool p_force_autohinter) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2324,6 +2403,7 @@ bool TextServerAdvanced::_font_is_force_autohinter(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_hinting(const RID &p_font_rid, TextServer::Hinting p_hinting) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2343,6 +2423,7 @@ TextServer::Hinting TextServerAdvanced::_font_get_hinting(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, TextServer::SubpixelPositioning p_subpixel) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2359,6 +2440,7 @@ TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioni
 }
 
 void TextServerAdvanced::_font_set_embolden(const RID &p_font_rid, double p_strength) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2378,6 +2460,7 @@ double TextServerAdvanced::_font_get_embolden(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_spacing, int64_t p_value) {
+	_shaped_text_cache_clear();
 	ERR_FAIL_INDEX((int)p_spacing, 4);
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
@@ -2410,6 +2493,7 @@ int64_t TextServerAdvanced::_font_get_spacing(const RID &p_font_rid, SpacingType
 }
 
 void TextServerAdvanced::_font_set_transform(const RID &p_font_rid, const Transform2D &p_transform) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2429,6 +2513,7 @@ Transform2D TextServerAdvanced::_font_get_transform(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_variation_coordinates(const RID &p_font_rid, const Dictionary &p_variation_coordinates) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2448,6 +2533,7 @@ Dictionary TextServerAdvanced::_font_get_variation_coordinates(const RID &p_font
 }
 
 void TextServerAdvanced::_font_set_oversampling(const RID &p_font_rid, double p_oversampling) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2479,6 +2565,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_size_cache_list(const RID &p_
 }
 
 void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2491,6 +2578,7 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2503,6 +2591,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2536,6 +2625,7 @@ double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_siz
 }
 
 void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size, double p_descent) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2568,6 +2658,7 @@ double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_si
 }
 
 void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int64_t p_size, double p_underline_position) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2601,6 +2692,7 @@ double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, i
 }
 
 void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, int64_t p_size, double p_underline_thickness) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2634,6 +2726,7 @@ double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size, double p_scale) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2809,6 +2902,7 @@ PackedInt32Array TextServerAdvanced::_font_get_glyph_list(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2i &p_size) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2820,6 +2914,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2889,6 +2984,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_advance(const RID &p_font_rid, int64
 }
 
 void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3111,19 +3207,7 @@ RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_font_update_texture(p_font_rid, fd, size, fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx]);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_rid();
 		}
 	}
@@ -3157,19 +3241,7 @@ Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, co
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_font_update_texture(p_font_rid, fd, size, fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx]);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_size();
 		}
 	}
@@ -3250,6 +3322,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_kerning_list(const RID &p_fon
 }
 
 void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t p_size) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3261,6 +3334,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3272,6 +3346,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3551,19 +3626,7 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_font_update_texture(p_font_rid, fd, size, fd->cache[size]->textures.write[gl.texture_idx]);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -3655,19 +3718,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_font_update_texture(p_font_rid, fd, size, fd->cache[size]->textures.write[gl.texture_idx]);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -3724,6 +3775,7 @@ bool TextServerAdvanced::_font_is_language_supported(const RID &p_font_rid, cons
 }
 
 void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_rid, const String &p_language, bool p_supported) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3740,6 +3792,7 @@ bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_r
 }
 
 void TextServerAdvanced::_font_remove_language_support_override(const RID &p_font_rid, const String &p_language) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3774,6 +3827,7 @@ bool TextServerAdvanced::_font_is_script_supported(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid, const String &p_script, bool p_supported) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3790,6 +3844,7 @@ bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid
 }
 
 void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_rid, const String &p_script) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3810,6 +3865,7 @@ PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const R
 }
 
 void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_rid, const Dictionary &p_overrides) {
+	_shaped_text_cache_clear();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3852,6 +3908,7 @@ double TextServerAdvanced::_font_get_global_oversampling() const {
 }
 
 void TextServerAdvanced::_font_set_global_oversampling(double p_oversampling) {
+	_shaped_text_cache_clear();
 	_THREAD_SAFE_METHOD_
 	if (oversampling != p_oversampling) {
 		oversampling = p_oversampling;
@@ -3948,6 +4005,119 @@ void TextServerAdvanced::invalidate(TextServerAdvanced::ShapedTextDataAdvanced *
 	}
 }
 
+bool TextServerAdvanced::ShapedTextCacheKey::operator==(const ShapedTextCacheKey &p_key) const {
+	if (hash != p_key.hash || start != p_key.start || end != p_key.end || base_para_direction != p_key.base_para_direction || orientation != p_key.orientation || preserve_invalid != p_key.preserve_invalid || preserve_control != p_key.preserve_control) {
+		return false;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (extra_spacing[i] != p_key.extra_spacing[i]) {
+			return false;
+		}
+	}
+	if (text != p_key.text || locale != p_key.locale || bidi_override != p_key.bidi_override || spans.size() != p_key.spans.size()) {
+		return false;
+	}
+	for (int i = 0; i < spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &span = spans[i];
+		const ShapedTextDataAdvanced::Span &other = p_key.spans[i];
+		if (span.start != other.start || span.end != other.end || span.font_size != other.font_size || span.language != other.language || span.fonts != other.fonts || span.features != other.features) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TextServerAdvanced::ShapedTextCacheKey TextServerAdvanced::_shaped_text_cache_key(const ShapedTextDataAdvanced *p_sd) const {
+	ShapedTextCacheKey key;
+	key.text = p_sd->text;
+	key.spans = p_sd->spans;
+	key.bidi_override = p_sd->bidi_override;
+	key.locale = TranslationServer::get_singleton()->get_tool_locale();
+	key.start = p_sd->start;
+	key.end = p_sd->end;
+	key.base_para_direction = p_sd->base_para_direction;
+	key.orientation = p_sd->orientation;
+	key.preserve_invalid = p_sd->preserve_invalid;
+	key.preserve_control = p_sd->preserve_control;
+
+	uint32_t h = hash_murmur3_one_32(key.text.hash());
+	h = hash_murmur3_one_32(key.locale.hash(), h);
+	h = hash_murmur3_one_32(key.start, h);
+	h = hash_murmur3_one_32(key.end, h);
+	h = hash_murmur3_one_32(key.base_para_direction, h);
+	h = hash_murmur3_one_32(key.orientation, h);
+	h = hash_murmur3_one_32((key.preserve_invalid ? 1 : 0) | (key.preserve_control ? 2 : 0), h);
+	for (int i = 0; i < 4; i++) {
+		key.extra_spacing[i] = p_sd->extra_spacing[i];
+		h = hash_murmur3_one_32(key.extra_spacing[i], h);
+	}
+	for (const Vector3i &ov : key.bidi_override) {
+		h = hash_murmur3_one_32(ov.x, h);
+		h = hash_murmur3_one_32(ov.y, h);
+		h = hash_murmur3_one_32(ov.z, h);
+	}
+	for (const ShapedTextDataAdvanced::Span &span : key.spans) {
+		h = hash_murmur3_one_32(span.start, h);
+		h = hash_murmur3_one_32(span.end, h);
+		h = hash_murmur3_one_32(span.font_size, h);
+		h = hash_murmur3_one_32(span.fonts.hash(), h);
+		h = hash_murmur3_one_32(span.language.hash(), h);
+		h = hash_murmur3_one_32(span.features.hash(), h);
+	}
+	key.hash = hash_fmix32(h);
+
+	return key;
+}
+
+bool TextServerAdvanced::_shaped_text_cache_get(ShapedTextDataAdvanced *p_sd, const ShapedTextCacheKey &p_key) {
+	MutexLock lock(shaped_cache_mutex);
+
+	List<ShapedTextCacheData>::Element **E = shaped_cache_map.getptr(p_key);
+	if (!E) {
+		return false;
+	}
+	shaped_cache_list.move_to_front(*E);
+
+	const ShapedTextCacheData &data = (*E)->get();
+	p_sd->glyphs = data.glyphs;
+	p_sd->ascent = data.ascent;
+	p_sd->descent = data.descent;
+	p_sd->width = data.width;
+	p_sd->upos = data.upos;
+	p_sd->uthk = data.uthk;
+	return true;
+}
+
+void TextServerAdvanced::_shaped_text_cache_insert(const ShapedTextDataAdvanced *p_sd, const ShapedTextCacheKey &p_key) {
+	MutexLock lock(shaped_cache_mutex);
+
+	if (shaped_cache_map.has(p_key)) {
+		return;
+	}
+
+	ShapedTextCacheData data;
+	data.key = p_key;
+	data.glyphs = p_sd->glyphs;
+	data.ascent = p_sd->ascent;
+	data.descent = p_sd->descent;
+	data.width = p_sd->width;
+	data.upos = p_sd->upos;
+	data.uthk = p_sd->uthk;
+	shaped_cache_map[p_key] = shaped_cache_list.push_front(data);
+
+	while (shaped_cache_map.size() > shaped_cache_size) {
+		shaped_cache_map.erase(shaped_cache_list.back()->get().key);
+		shaped_cache_list.pop_back();
+	}
+}
+
+void TextServerAdvanced::_shaped_text_cache_clear() {
+	MutexLock lock(shaped_cache_mutex);
+
+	shaped_cache_map.clear();
+	shaped_cache_list.clear();
+}
+
 void TextServerAdvanced::full_copy(ShapedTextDataAdvanced *p_shaped) {
 	ShapedTextDataAdvanced *parent = shaped_owner.get_or_null(p_shaped->parent);
 
@@ -6000,11 +6170,6 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 	sd->utf16 = sd->text.utf16();
 	const UChar *data = sd->utf16.get_data();
 
-	// Create script iterator.
-	if (sd->script_iter == nullptr) {
-		sd->script_iter = memnew(ScriptIterator(sd->text, 0, sd->text.length()));
-	}
-
 	sd->base_para_direction = UBIDI_DEFAULT_LTR;
 	switch (sd->direction) {
 		case DIRECTION_LTR: {
@@ -6035,6 +6200,20 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		sd->bidi_override.push_back(Vector3i(sd->start, sd->end, DIRECTION_INHERITED));
 	}
 
+	// Reuse the glyphs of an identical string shaped earlier, embedded objects are positioned during shaping and are never cached.
+	bool use_cache = sd->objects.is_empty();
+	bool cached = false;
+	ShapedTextCacheKey cache_key;
+	if (use_cache) {
+		cache_key = _shaped_text_cache_key(sd);
+		cached = _shaped_text_cache_get(sd, cache_key);
+	}
+
+	// Create script iterator.
+	if (!cached && sd->script_iter == nullptr) {
+		sd->script_iter = memnew(ScriptIterator(sd->text, 0, sd->text.length()));
+	}
+
 	for (int ov = 0; ov < sd->bidi_override.size(); ov++) {
 		// Create BiDi iterator.
 		int start = _convert_pos_inv(sd, sd->bidi_override[ov].x - sd->start);
@@ -6077,6 +6256,11 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 		sd->bidi_iter.push_back(bidi_iter);
 
+		if (cached) {
+			// BiDi iterators are still required for line breaking and carets, only the shaping is skipped.
+			continue;
+		}
+
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
 		if (bidi_iter) {
@@ -6185,6 +6369,10 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
+	if (use_cache && !cached) {
+		_shaped_text_cache_insert(sd, cache_key);
+	}
+
 	_realign(sd);
 	sd->valid = true;
 	return sd->valid;
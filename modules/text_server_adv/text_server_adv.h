@@ -73,6 +73,7 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
@@ -84,6 +85,8 @@ using namespace godot;
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/list.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
@@ -362,6 +365,14 @@ class TextServerAdvanced : public TextServerExtension {
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
 
+	// Glyphs rasterized into an existing texture are uploaded once per frame, instead of re-uploading the whole texture for each new glyph.
+	mutable Mutex texture_updates_mutex;
+	mutable HashMap<RID, HashSet<Vector2i>> texture_updates;
+	mutable bool texture_updates_connected = false;
+
+	void _font_update_texture(const RID &p_font_rid, FontAdvanced *p_font_data, const Vector2i &p_size, ShelfPackTexture &r_tex) const;
+	void _font_flush_texture_updates();
+
 	_FORCE_INLINE_ Vector2i _get_size(const FontAdvanced *p_font_data, int p_size) const {
 		if (p_font_data->msdf) {
 			return Vector2i(p_font_data->msdf_source_size, 0);
@@ -545,6 +556,48 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable RID_PtrOwner<FontAdvanced> font_owner;
 	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
 
+	// Shaping results cache, shared by all the shaped texts with identical source data (e.g. the same string in many controls).
+	struct ShapedTextCacheKey {
+		String text;
+		Vector<ShapedTextDataAdvanced::Span> spans;
+		Vector<Vector3i> bidi_override;
+		String locale;
+		int start = 0;
+		int end = 0;
+		int base_para_direction = UBIDI_DEFAULT_LTR;
+		TextServer::Orientation orientation = ORIENTATION_HORIZONTAL;
+		bool preserve_invalid = true;
+		bool preserve_control = false;
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		uint32_t hash = 0;
+
+		bool operator==(const ShapedTextCacheKey &p_key) const;
+	};
+
+	struct ShapedTextCacheKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const ShapedTextCacheKey &p_key) { return p_key.hash; }
+	};
+
+	struct ShapedTextCacheData {
+		ShapedTextCacheKey key;
+		Vector<Glyph> glyphs; // Copy-on-write, only duplicated when a shaped text modifies its glyphs.
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+	};
+
+	uint32_t shaped_cache_size = 1024; // Maximum number of cached shaping results.
+	Mutex shaped_cache_mutex;
+	List<ShapedTextCacheData> shaped_cache_list; // Most recently used first.
+	HashMap<ShapedTextCacheKey, List<ShapedTextCacheData>::Element *, ShapedTextCacheKeyHasher> shaped_cache_map;
+
+	ShapedTextCacheKey _shaped_text_cache_key(const ShapedTextDataAdvanced *p_sd) const;
+	bool _shaped_text_cache_get(ShapedTextDataAdvanced *p_sd, const ShapedTextCacheKey &p_key);
+	void _shaped_text_cache_insert(const ShapedTextDataAdvanced *p_sd, const ShapedTextCacheKey &p_key);
+	void _shaped_text_cache_clear();
+
 	_FORCE_INLINE_ FontAdvanced *_get_font_data(const RID &p_font_rid) const {
 		RID rid = p_font_rid;
 		FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(rid);
@@ -115,7 +115,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 					loop_fade_remaining = 0;
 				}
 
-				seek(vorbis_stream->loop_offset);
+				_seek_vorbis(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 				continue;
@@ -128,7 +128,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (vorbis_stream->loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek_vorbis(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 
@@ -230,6 +230,7 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
+	MutexLock decoder_lock(decoder_mutex);
 	loop_fade_remaining = FADE_SIZE;
 	active = true;
 	seek(p_from_pos);
@@ -238,7 +239,9 @@ void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
+	MutexLock decoder_lock(decoder_mutex);
 	active = false;
+	_clear_decode_ahead();
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
@@ -250,7 +253,8 @@ int AudioStreamPlaybackOggVorbis::get_loop_count() const {
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
-	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+	int64_t frames_played = MAX(0, int64_t(frames_mixed) - _get_decode_ahead_frames());
+	return double(frames_played) / (double)vorbis_data->get_sampling_rate();
 }
 
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
@@ -258,6 +262,12 @@ void AudioStreamPlaybackOggVorbis::tag_used_streams() {
 }
 
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
+	MutexLock decoder_lock(decoder_mutex);
+	_clear_decode_ahead();
+	_seek_vorbis(p_time);
+}
+
+void AudioStreamPlaybackOggVorbis::_seek_vorbis(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -357,6 +367,7 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 }
 
 AudioStreamPlaybackOggVorbis::~AudioStreamPlaybackOggVorbis() {
+	_finish_decode_ahead();
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
@@ -383,6 +394,7 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->active = false;
 	ovs->loops = 0;
 	if (ovs->_alloc_vorbis()) {
+		ovs->_set_decode_ahead(AudioServer::get_singleton()->is_decode_ahead_enabled());
 		return ovs;
 	}
 	// Failed to allocate data structures.
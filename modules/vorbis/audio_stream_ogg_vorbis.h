@@ -75,6 +75,7 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 
 	int _mix_frames(AudioFrame *p_buffer, int p_frames);
 	int _mix_frames_vorbis(AudioFrame *p_buffer, int p_frames);
+	void _seek_vorbis(double p_time);
 
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
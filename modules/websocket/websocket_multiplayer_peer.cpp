@@ -47,6 +47,7 @@ Ref<WebSocketPeer> WebSocketMultiplayerPeer::_create_peer() {
 	peer->set_inbound_buffer_size(get_inbound_buffer_size());
 	peer->set_outbound_buffer_size(get_outbound_buffer_size());
 	peer->set_max_queued_packets(get_max_queued_packets());
+	peer->set_compression_enabled(is_compression_enabled());
 	return peer;
 }
 
@@ -96,6 +97,9 @@ void WebSocketMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_queued_packets", "max_queued_packets"), &WebSocketMultiplayerPeer::set_max_queued_packets);
 	ClassDB::bind_method(D_METHOD("get_max_queued_packets"), &WebSocketMultiplayerPeer::get_max_queued_packets);
 
+	ClassDB::bind_method(D_METHOD("set_compression_enabled", "enabled"), &WebSocketMultiplayerPeer::set_compression_enabled);
+	ClassDB::bind_method(D_METHOD("is_compression_enabled"), &WebSocketMultiplayerPeer::is_compression_enabled);
+
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_STRING_ARRAY, "supported_protocols"), "set_supported_protocols", "get_supported_protocols");
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_STRING_ARRAY, "handshake_headers"), "set_handshake_headers", "get_handshake_headers");
 
@@ -105,6 +109,8 @@ void WebSocketMultiplayerPeer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "handshake_timeout"), "set_handshake_timeout", "get_handshake_timeout");
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_queued_packets"), "set_max_queued_packets", "get_max_queued_packets");
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compression_enabled"), "set_compression_enabled", "is_compression_enabled");
 }
 
 //
@@ -278,11 +284,16 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	ERR_FAIL_COND(connection_status != CONNECTION_CONNECTED); // Bug.
 	ERR_FAIL_COND(tcp_server.is_null() || !tcp_server->is_listening()); // Bug.
 
-	// Accept new connections.
-	if (!is_refusing_new_connections() && tcp_server->is_connection_available()) {
+	const uint64_t now = OS::get_singleton()->get_ticks_msec();
+
+	// Accept new connections, draining the backlog so bursts don't take one frame each.
+	while (!is_refusing_new_connections() && tcp_server->is_connection_available()) {
 		PendingPeer peer;
-		peer.time = OS::get_singleton()->get_ticks_msec();
+		peer.time = now;
 		peer.tcp = tcp_server->take_connection();
+		if (peer.tcp.is_null()) {
+			break; // Accept failed, e.g. out of file descriptors.
+		}
 		peer.connection = peer.tcp;
 		pending_peers[generate_unique_id()] = peer;
 	}
@@ -293,7 +304,7 @@ void WebSocketMultiplayerPeer::_poll_server() {
 		PendingPeer &peer = E.value;
 		int id = E.key;
 
-		if (OS::get_singleton()->get_ticks_msec() - peer.time > handshake_timeout) {
+		if (now - peer.time > handshake_timeout) {
 			print_verbose(vformat("WebSocket handshake timed out after %.3f seconds.", handshake_timeout * 0.001));
 			to_remove.insert(id);
 			continue;
@@ -459,6 +470,14 @@ int WebSocketMultiplayerPeer::get_max_queued_packets() const {
 	return peer_config->get_max_queued_packets();
 }
 
+void WebSocketMultiplayerPeer::set_compression_enabled(bool p_enabled) {
+	peer_config->set_compression_enabled(p_enabled);
+}
+
+bool WebSocketMultiplayerPeer::is_compression_enabled() const {
+	return peer_config->is_compression_enabled();
+}
+
 float WebSocketMultiplayerPeer::get_handshake_timeout() const {
 	return handshake_timeout / 1000.0;
 }
@@ -138,6 +138,9 @@ public:
 	void set_max_queued_packets(int p_max_queued_packets);
 	int get_max_queued_packets() const;
 
+	void set_compression_enabled(bool p_enabled);
+	bool is_compression_enabled() const;
+
 	WebSocketMultiplayerPeer();
 	~WebSocketMultiplayerPeer();
 };
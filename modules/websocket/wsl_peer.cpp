@@ -34,6 +34,8 @@
 
 #include "core/io/stream_peer_tls.h"
 
+#include <zlib.h>
+
 CryptoCore::RandomGenerator *WSLPeer::_static_rng = nullptr;
 
 void WSLPeer::initialize() {
@@ -208,6 +210,15 @@ bool WSLPeer::_parse_client_request() {
 	} else if (supported_protocols.size() > 0) { // No protocol requested, but we need one
 		return false;
 	}
+	if (compression_enabled && headers.has("sec-websocket-extensions")) {
+		// Accept the first deflate offer we can honor, run uncompressed otherwise.
+		Vector<String> offers = headers["sec-websocket-extensions"].split(",");
+		for (int i = 0; i < offers.size(); i++) {
+			if (_parse_compression_offer(offers[i])) {
+				break;
+			}
+		}
+	}
 	return true;
 }
 
@@ -258,6 +269,9 @@ Error WSLPeer::_do_server_handshake() {
 				if (!selected_protocol.is_empty()) {
 					s += "Sec-WebSocket-Protocol: " + selected_protocol + "\r\n";
 				}
+				if (compression) {
+					s += "Sec-WebSocket-Extensions: " + _get_compression_response() + "\r\n";
+				}
 				for (int i = 0; i < handshake_headers.size(); i++) {
 					s += handshake_headers[i] + "\r\n";
 				}
@@ -294,6 +308,10 @@ Error WSLPeer::_do_server_handshake() {
 			// Response sent, initialize wslay context.
 			wslay_event_context_server_init(&wsl_ctx, &_wsl_callbacks, this);
 			wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
+			if (_init_compression() != OK) {
+				close(-1);
+				return FAILED;
+			}
 			in_buffer.resize(nearest_shift(inbound_buffer_size), max_queued_packets);
 			packet_buffer.resize(inbound_buffer_size);
 			ready_state = STATE_OPEN;
@@ -402,6 +420,10 @@ void WSLPeer::_do_client_handshake() {
 				}
 				wslay_event_context_client_init(&wsl_ctx, &_wsl_callbacks, this);
 				wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
+				if (_init_compression() != OK) {
+					close(-1);
+					return;
+				}
 				in_buffer.resize(nearest_shift(inbound_buffer_size), max_queued_packets);
 				packet_buffer.resize(inbound_buffer_size);
 				ready_state = STATE_OPEN;
@@ -467,6 +489,10 @@ bool WSLPeer::_verify_server_response() {
 			ERR_FAIL_V_MSG(false, "Received unrequested sub-protocol -> " + selected_protocol);
 		}
 	}
+	if (headers.has("sec-websocket-extensions")) {
+		ERR_FAIL_COND_V_MSG(!compression_enabled, false, "Received unrequested extension(s) -> " + headers["sec-websocket-extensions"]);
+		ERR_FAIL_COND_V_MSG(!_parse_compression_offer(headers["sec-websocket-extensions"]), false, "Received invalid or unsupported extension(s) -> " + headers["sec-websocket-extensions"]);
+	}
 	return true;
 }
 
@@ -543,6 +569,9 @@ Error WSLPeer::connect_to_url(const String &p_url, Ref<TLSOptions> p_options) {
 		}
 		request += "\r\n";
 	}
+	if (compression_enabled) {
+		request += "Sec-WebSocket-Extensions: permessage-deflate; client_max_window_bits\r\n";
+	}
 	for (int i = 0; i < handshake_headers.size(); i++) {
 		request += handshake_headers[i] + "\r\n";
 	}
@@ -631,7 +660,20 @@ void WSLPeer::_wsl_msg_recv_callback(wslay_event_context_ptr ctx, const struct w
 	if (op == WSLAY_TEXT_FRAME || op == WSLAY_BINARY_FRAME) {
 		// Message.
 		uint8_t is_string = arg->opcode == WSLAY_TEXT_FRAME ? 1 : 0;
-		peer->in_buffer.write_packet(arg->msg, arg->msg_length, &is_string);
+		if (arg->rsv & WSLAY_RSV1_BIT) {
+			int size = 0;
+			Error err = peer->_inflate(arg->msg, arg->msg_length, size);
+			if (err != OK) {
+				// Message too big (1009) or corrupted stream (1007), the close frame is sent on the next poll.
+				print_verbose("Websocket failed to inflate message: " + itos(err));
+				wslay_event_queue_close(ctx, err == ERR_OUT_OF_MEMORY ? 1009 : 1007, nullptr, 0);
+				peer->ready_state = STATE_CLOSING;
+				return;
+			}
+			peer->in_buffer.write_packet(peer->compression_buffer.ptr(), size, &is_string);
+		} else {
+			peer->in_buffer.write_packet(arg->msg, arg->msg_length, &is_string);
+		}
 	}
 	// Ping or pong.
 }
@@ -706,8 +748,20 @@ Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_
 	msg.msg = p_buffer;
 	msg.msg_length = p_buffer_size;
 
+	uint8_t rsv = WSLAY_RSV_NONE;
+	if (compression) {
+		// wslay copies the payload when queuing, so the scratch buffer can be reused right away.
+		if (_deflate(p_buffer, p_buffer_size) != OK) {
+			close(-1);
+			return FAILED;
+		}
+		msg.msg = compression_buffer.ptr();
+		msg.msg_length = compression_buffer.size();
+		rsv = WSLAY_RSV1_BIT;
+	}
+
 	// Queue & send message.
-	if (wslay_event_queue_msg(wsl_ctx, &msg) != 0 || wslay_event_send(wsl_ctx) != 0) {
+	if (wslay_event_queue_msg_ex(wsl_ctx, &msg, rsv) != 0 || wslay_event_send(wsl_ctx) != 0) {
 		close(-1);
 		return FAILED;
 	}
@@ -835,6 +889,176 @@ void WSLPeer::_clear() {
 	// Close code info.
 	close_code = -1;
 	close_reason.clear();
+
+	_clear_compression();
+}
+
+///
+/// Compression functions.
+///
+bool WSLPeer::_parse_compression_offer(const String &p_offer) {
+	Vector<String> params = p_offer.split(";");
+	if (params.is_empty() || params[0].strip_edges().to_lower() != "permessage-deflate") {
+		return false;
+	}
+
+	// Parameters are named from the point of view of who is compressing.
+	const String own = is_server ? "server_" : "client_";
+	const String other = is_server ? "client_" : "server_";
+	bool own_no_context_takeover = false;
+	bool other_no_context_takeover = false;
+	int window_bits = 15;
+	for (int i = 1; i < params.size(); i++) {
+		Vector<String> kv = params[i].split("=", true, 1);
+		String key = kv[0].strip_edges().to_lower();
+		String value = kv.size() > 1 ? kv[1].strip_edges().trim_prefix("\"").trim_suffix("\"") : String();
+		if (key == own + "no_context_takeover") {
+			own_no_context_takeover = true;
+		} else if (key == other + "no_context_takeover") {
+			other_no_context_takeover = true;
+		} else if (key == own + "max_window_bits") {
+			// zlib can't produce raw deflate streams with 256 bytes windows, decline those.
+			if (!value.is_valid_int() || value.to_int() < 9 || value.to_int() > 15) {
+				return false;
+			}
+			window_bits = value.to_int();
+		} else if (key == other + "max_window_bits") {
+			// We always inflate with the largest window, so any valid value is fine.
+			if (!value.is_empty() && (!value.is_valid_int() || value.to_int() < 8 || value.to_int() > 15)) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+	}
+
+	compression = true;
+	deflate_no_context_takeover = own_no_context_takeover;
+	inflate_no_context_takeover = other_no_context_takeover;
+	deflate_window_bits = window_bits;
+	return true;
+}
+
+String WSLPeer::_get_compression_response() const {
+	String s = "permessage-deflate";
+	if (deflate_no_context_takeover) {
+		s += "; server_no_context_takeover";
+	}
+	if (inflate_no_context_takeover) {
+		s += "; client_no_context_takeover";
+	}
+	if (deflate_window_bits != 15) {
+		s += "; server_max_window_bits=" + itos(deflate_window_bits);
+	}
+	return s;
+}
+
+Error WSLPeer::_init_compression() {
+	if (!compression) {
+		return OK;
+	}
+	ERR_FAIL_COND_V(deflate_stream || inflate_stream, ERR_ALREADY_IN_USE);
+
+	wslay_event_config_set_allowed_rsv_bits(wsl_ctx, WSLAY_RSV1_BIT);
+
+	deflate_stream = (z_stream *)memalloc(sizeof(z_stream));
+	memset(deflate_stream, 0, sizeof(z_stream));
+	inflate_stream = (z_stream *)memalloc(sizeof(z_stream));
+	memset(inflate_stream, 0, sizeof(z_stream));
+
+	// Negative window bits select raw deflate, without zlib headers.
+	if (deflateInit2(deflate_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -deflate_window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		memfree(deflate_stream);
+		deflate_stream = nullptr;
+		ERR_FAIL_V_MSG(FAILED, "Failed to initialize WebSocket deflate stream.");
+	}
+	if (inflateInit2(inflate_stream, -15) != Z_OK) {
+		memfree(inflate_stream);
+		inflate_stream = nullptr;
+		ERR_FAIL_V_MSG(FAILED, "Failed to initialize WebSocket inflate stream.");
+	}
+	return OK;
+}
+
+void WSLPeer::_clear_compression() {
+	if (deflate_stream) {
+		deflateEnd(deflate_stream);
+		memfree(deflate_stream);
+		deflate_stream = nullptr;
+	}
+	if (inflate_stream) {
+		inflateEnd(inflate_stream);
+		memfree(inflate_stream);
+		inflate_stream = nullptr;
+	}
+	compression = false;
+	deflate_no_context_takeover = false;
+	inflate_no_context_takeover = false;
+	deflate_window_bits = 15;
+	compression_buffer.reset();
+}
+
+Error WSLPeer::_deflate(const uint8_t *p_buffer, int p_buffer_size) {
+	ERR_FAIL_NULL_V(deflate_stream, ERR_UNCONFIGURED);
+	z_stream *strm = deflate_stream;
+
+	strm->next_in = (Bytef *)p_buffer;
+	strm->avail_in = p_buffer_size;
+	uint32_t total = 0;
+	compression_buffer.resize(deflateBound(strm, p_buffer_size) + 16);
+	do {
+		if (total == compression_buffer.size()) {
+			compression_buffer.resize(total * 2);
+		}
+		strm->next_out = compression_buffer.ptr() + total;
+		strm->avail_out = compression_buffer.size() - total;
+		int err = deflate(strm, Z_SYNC_FLUSH);
+		ERR_FAIL_COND_V(err != Z_OK && err != Z_BUF_ERROR, FAILED);
+		total = compression_buffer.size() - strm->avail_out;
+	} while (strm->avail_out == 0);
+
+	// The sync flush ends with an empty stored block (0x00 0x00 0xFF 0xFF), which is not sent.
+	ERR_FAIL_COND_V(total < 4, FAILED);
+	compression_buffer.resize(total - 4);
+
+	if (deflate_no_context_takeover) {
+		deflateReset(strm);
+	}
+	return OK;
+}
+
+Error WSLPeer::_inflate(const uint8_t *p_buffer, int p_buffer_size, int &r_size) {
+	ERR_FAIL_NULL_V(inflate_stream, ERR_UNCONFIGURED);
+	z_stream *strm = inflate_stream;
+	static const uint8_t tail[4] = { 0x00, 0x00, 0xFF, 0xFF };
+
+	// One extra byte, so filling the output buffer means the message is too big.
+	const uint32_t max_size = packet_buffer.size();
+	compression_buffer.resize(max_size + 1);
+	strm->next_out = compression_buffer.ptr();
+	strm->avail_out = compression_buffer.size();
+
+	strm->next_in = (Bytef *)p_buffer;
+	strm->avail_in = p_buffer_size;
+	int err = inflate(strm, Z_SYNC_FLUSH);
+	if ((err == Z_OK || err == Z_BUF_ERROR) && strm->avail_in == 0 && strm->avail_out > 0) {
+		strm->next_in = (Bytef *)tail;
+		strm->avail_in = sizeof(tail);
+		err = inflate(strm, Z_SYNC_FLUSH);
+	}
+	if (strm->avail_out == 0) {
+		return ERR_OUT_OF_MEMORY;
+	}
+	if ((err != Z_OK && err != Z_BUF_ERROR && err != Z_STREAM_END) || (err != Z_STREAM_END && strm->avail_in > 0)) {
+		return ERR_INVALID_DATA;
+	}
+
+	r_size = max_size + 1 - strm->avail_out;
+	// A final block ends the stream, the next message starts a new one.
+	if (inflate_no_context_takeover || err == Z_STREAM_END) {
+		inflateReset(strm);
+	}
+	return OK;
 }
 
 WSLPeer::WSLPeer() {
@@ -843,6 +1067,7 @@ WSLPeer::WSLPeer() {
 
 WSLPeer::~WSLPeer() {
 	close(-1);
+	_clear_compression();
 }
 
 #endif // WEB_ENABLED
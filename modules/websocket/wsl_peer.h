@@ -40,12 +40,15 @@
 #include "core/error/error_list.h"
 #include "core/io/packet_peer.h"
 #include "core/io/stream_peer_tcp.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/ring_buffer.h"
 
 #include <wslay/wslay.h>
 
 #define WSL_MAX_HEADER_SIZE 4096
 
+struct z_stream_s;
+
 class WSLPeer : public WebSocketPeer {
 private:
 	static CryptoCore::RandomGenerator *_static_rng;
@@ -109,6 +112,22 @@ private:
 	// Our packet info is just a boolean (is_string), using uint8_t for it.
 	PacketBuffer<uint8_t> in_buffer;
 
+	// Per-message deflate (RFC 7692), negotiated during the handshake.
+	bool compression = false;
+	bool deflate_no_context_takeover = false;
+	bool inflate_no_context_takeover = false;
+	int deflate_window_bits = 15;
+	z_stream_s *deflate_stream = nullptr;
+	z_stream_s *inflate_stream = nullptr;
+	LocalVector<uint8_t> compression_buffer;
+
+	bool _parse_compression_offer(const String &p_offer);
+	String _get_compression_response() const;
+	Error _init_compression();
+	void _clear_compression();
+	Error _deflate(const uint8_t *p_buffer, int p_buffer_size);
+	Error _inflate(const uint8_t *p_buffer, int p_buffer_size, int &r_size);
+
 	Error _send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode);
 
 	Error _do_server_handshake();
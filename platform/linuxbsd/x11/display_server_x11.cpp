@@ -58,6 +58,7 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 
 #undef CursorShape
@@ -3335,6 +3336,24 @@ void DisplayServerX11::_get_key_modifier_state(unsigned int p_x11_state, Ref<Inp
 	state->set_meta_pressed((p_x11_state & Mod4Mask));
 }
 
+uint64_t DisplayServerX11::_get_event_timestamp(unsigned long p_x11_time) const {
+	// X server timestamps are milliseconds of the server's monotonic clock, the same clock as the ticks when the
+	// server runs on this machine. Use the current time when the event doesn't look recent in that clock.
+	uint64_t now = OS::get_singleton()->get_ticks_usec();
+	if (p_x11_time == CurrentTime) {
+		return now;
+	}
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint32_t now_ms = uint32_t(uint64_t(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000);
+	uint64_t age = uint64_t(uint32_t(now_ms - uint32_t(p_x11_time))) * 1000;
+	if (age > 1000000 || age >= now) {
+		return now;
+	}
+	return now - age;
+}
+
 BitField<MouseButtonMask> DisplayServerX11::_get_mouse_button_state(MouseButton p_x11_button, int p_x11_type) {
 	MouseButtonMask mask = mouse_button_to_mask(p_x11_button);
 
@@ -3441,6 +3460,7 @@ void DisplayServerX11::_handle_key_event(WindowID p_window, XKeyEvent *p_event,
 				if (physical_keycode == Key::NONE && keycode == Key::NONE && tmp[i] == 0) {
 					continue;
 				}
+				k->set_timestamp(_get_event_timestamp(xkeyevent->time));
 
 				if (keycode == Key::NONE) {
 					keycode = (Key)physical_keycode;
@@ -3512,6 +3532,7 @@ void DisplayServerX11::_handle_key_event(WindowID p_window, XKeyEvent *p_event,
 					if (physical_keycode == Key::NONE && keycode == Key::NONE && tmp[i] == 0) {
 						continue;
 					}
+					k->set_timestamp(_get_event_timestamp(xkeyevent->time));
 
 					if (keycode == Key::NONE) {
 						keycode = (Key)physical_keycode;
@@ -3595,6 +3616,7 @@ void DisplayServerX11::_handle_key_event(WindowID p_window, XKeyEvent *p_event,
 	Ref<InputEventKey> k;
 	k.instantiate();
 	k->set_window_id(p_window);
+	k->set_timestamp(_get_event_timestamp(xkeyevent->time));
 
 	_get_key_modifier_state(xkeyevent->state, k);
 
@@ -4428,6 +4450,7 @@ void DisplayServerX11::process_events() {
 						Ref<InputEventScreenTouch> st;
 						st.instantiate();
 						st->set_window_id(window_id);
+						st->set_timestamp(_get_event_timestamp(event_data->time));
 						st->set_index(index);
 						st->set_position(pos);
 						st->set_pressed(is_begin);
@@ -4469,6 +4492,7 @@ void DisplayServerX11::process_events() {
 							Ref<InputEventScreenDrag> sd;
 							sd.instantiate();
 							sd->set_window_id(window_id);
+							sd->set_timestamp(_get_event_timestamp(event_data->time));
 							sd->set_index(index);
 							sd->set_position(pos);
 							sd->set_relative(pos - curr_pos_elem->value);
@@ -4698,6 +4722,7 @@ void DisplayServerX11::process_events() {
 				mb.instantiate();
 
 				mb->set_window_id(window_id);
+				mb->set_timestamp(_get_event_timestamp(event.xbutton.time));
 				_get_key_modifier_state(event.xbutton.state, mb);
 				mb->set_button_index((MouseButton)event.xbutton.button);
 				if (mb->get_button_index() == MouseButton::RIGHT) {
@@ -4880,6 +4905,7 @@ void DisplayServerX11::process_events() {
 				mm.instantiate();
 
 				mm->set_window_id(window_id);
+				mm->set_timestamp(_get_event_timestamp(event.xmotion.time));
 				if (xi.pressure_supported) {
 					mm->set_pressure(xi.pressure);
 				} else {
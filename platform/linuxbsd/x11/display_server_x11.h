@@ -291,6 +291,7 @@ class DisplayServerX11 : public DisplayServer {
 
 	BitField<MouseButtonMask> _get_mouse_button_state(MouseButton p_x11_button, int p_x11_type);
 	void _get_key_modifier_state(unsigned int p_x11_state, Ref<InputEventWithModifiers> state);
+	uint64_t _get_event_timestamp(unsigned long p_x11_time) const;
 	void _flush_mouse_motion();
 
 	MouseMode mouse_mode = MOUSE_MODE_VISIBLE;
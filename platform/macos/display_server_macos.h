@@ -73,6 +73,7 @@ public:
 		Key physical_keycode = Key::NONE;
 		Key key_label = Key::NONE;
 		uint32_t unicode = 0;
+		uint64_t timestamp = 0;
 	};
 
 	struct WindowData {
@@ -242,6 +243,7 @@ public:
 	void send_window_event(const WindowData &p_wd, WindowEvent p_event);
 	void release_pressed_events();
 	void get_key_modifier_state(unsigned int p_macos_state, Ref<InputEventWithModifiers> r_state) const;
+	uint64_t get_event_timestamp(double p_event_time) const;
 	void update_mouse_pos(WindowData &p_wd, NSPoint p_location_in_window);
 	void push_to_key_event_buffer(const KeyEvent &p_event);
 	void pop_last_key_event();
@@ -454,6 +454,7 @@ void DisplayServerMacOS::_process_key_events() {
 			k.instantiate();
 
 			k->set_window_id(ke.window_id);
+			k->set_timestamp(ke.timestamp);
 			get_key_modifier_state(ke.macos_state, k);
 			k->set_pressed(ke.pressed);
 			k->set_echo(ke.echo);
@@ -469,6 +470,7 @@ void DisplayServerMacOS::_process_key_events() {
 				k.instantiate();
 
 				k->set_window_id(ke.window_id);
+				k->set_timestamp(ke.timestamp);
 				get_key_modifier_state(ke.macos_state, k);
 				k->set_pressed(ke.pressed);
 				k->set_echo(ke.echo);
@@ -483,6 +485,7 @@ void DisplayServerMacOS::_process_key_events() {
 				k.instantiate();
 
 				k->set_window_id(ke.window_id);
+				k->set_timestamp(ke.timestamp);
 				get_key_modifier_state(ke.macos_state, k);
 				k->set_pressed(ke.pressed);
 				k->set_echo(ke.echo);
@@ -689,6 +692,7 @@ void DisplayServerMacOS::send_event(NSEvent *p_event) {
 
 			get_key_modifier_state([p_event modifierFlags], k);
 			k->set_window_id(DisplayServerMacOS::INVALID_WINDOW_ID);
+			k->set_timestamp(get_event_timestamp([p_event timestamp]));
 			k->set_pressed(true);
 			k->set_keycode(Key::PERIOD);
 			k->set_physical_keycode(Key::PERIOD);
@@ -723,6 +727,16 @@ void DisplayServerMacOS::get_key_modifier_state(unsigned int p_macos_state, Ref<
 	r_state->set_meta_pressed((p_macos_state & NSEventModifierFlagCommand));
 }
 
+uint64_t DisplayServerMacOS::get_event_timestamp(double p_event_time) const {
+	// NSEvent timestamps are seconds since system startup, the same clock as the process info uptime.
+	uint64_t now = OS::get_singleton()->get_ticks_usec();
+	double age = [[NSProcessInfo processInfo] systemUptime] - p_event_time;
+	if (age < 0.0 || age > 1.0 || uint64_t(age * 1000000.0) >= now) {
+		return now;
+	}
+	return now - uint64_t(age * 1000000.0);
+}
+
 void DisplayServerMacOS::update_mouse_pos(DisplayServerMacOS::WindowData &p_wd, NSPoint p_location_in_window) {
 	const NSRect content_rect = [p_wd.window_view frame];
 	const float scale = screen_get_max_scale();
@@ -377,6 +377,7 @@
 	Ref<InputEventMouseButton> mb;
 	mb.instantiate();
 	mb->set_window_id(window_id);
+	mb->set_timestamp(ds->get_event_timestamp([event timestamp]));
 	ds->update_mouse_pos(wd, [event locationInWindow]);
 	ds->get_key_modifier_state([event modifierFlags], mb);
 	mb->set_button_index(index);
@@ -432,6 +433,7 @@
 	mm.instantiate();
 
 	mm->set_window_id(window_id);
+	mm->set_timestamp(ds->get_event_timestamp([event timestamp]));
 	mm->set_button_mask(ds->mouse_get_button_state());
 	ds->update_mouse_pos(wd, mpos);
 	mm->set_position(wd.mouse_pos);
@@ -530,6 +532,7 @@
 	Ref<InputEventMagnifyGesture> ev;
 	ev.instantiate();
 	ev->set_window_id(window_id);
+	ev->set_timestamp(ds->get_event_timestamp([event timestamp]));
 	ds->get_key_modifier_state([event modifierFlags], ev);
 	ds->update_mouse_pos(wd, [event locationInWindow]);
 	ev->set_position(wd.mouse_pos);
@@ -582,6 +585,7 @@
 				DisplayServerMacOS::KeyEvent ke;
 
 				ke.window_id = window_id;
+				ke.timestamp = ds->get_event_timestamp([event timestamp]);
 				ke.macos_state = [event modifierFlags];
 				ke.pressed = true;
 				ke.echo = [event isARepeat];
@@ -597,6 +601,7 @@
 			DisplayServerMacOS::KeyEvent ke;
 
 			ke.window_id = window_id;
+			ke.timestamp = ds->get_event_timestamp([event timestamp]);
 			ke.macos_state = [event modifierFlags];
 			ke.pressed = true;
 			ke.echo = [event isARepeat];
@@ -626,6 +631,7 @@
 	DisplayServerMacOS::KeyEvent ke;
 
 	ke.window_id = window_id;
+	ke.timestamp = ds->get_event_timestamp([event timestamp]);
 	ke.echo = false;
 	ke.raw = true;
 
@@ -689,6 +695,7 @@
 		DisplayServerMacOS::KeyEvent ke;
 
 		ke.window_id = window_id;
+		ke.timestamp = ds->get_event_timestamp([event timestamp]);
 		ke.macos_state = [event modifierFlags];
 		ke.pressed = false;
 		ke.echo = [event isARepeat];
@@ -718,6 +725,7 @@
 	sc.instantiate();
 
 	sc->set_window_id(window_id);
+	sc->set_timestamp(ds->get_event_timestamp([event timestamp]));
 	ds->get_key_modifier_state([event modifierFlags], sc);
 	sc->set_button_index(button);
 	sc->set_factor(factor);
@@ -732,6 +740,7 @@
 
 	sc.instantiate();
 	sc->set_window_id(window_id);
+	sc->set_timestamp(ds->get_event_timestamp([event timestamp]));
 	sc->set_button_index(button);
 	sc->set_factor(factor);
 	sc->set_pressed(false);
@@ -756,6 +765,7 @@
 	pg.instantiate();
 
 	pg->set_window_id(window_id);
+	pg->set_timestamp(ds->get_event_timestamp([event timestamp]));
 	ds->get_key_modifier_state([event modifierFlags], pg);
 	pg->set_position(wd.mouse_pos);
 	pg->set_delta(Vector2(-dx, -dy));
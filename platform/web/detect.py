@@ -30,6 +30,8 @@ def get_opts():
 
     return [
         ("initial_memory", "Initial WASM memory (in MiB)", 32),
+        ("pthread_pool_size", "Number of Web Workers pre-spawned for threads at startup", 8),
+        BoolVariable("wasm_simd", "Use WebAssembly SIMD (requires browser support)", False),
         BoolVariable("use_assertions", "Use Emscripten runtime assertions", False),
         BoolVariable("use_ubsan", "Use Emscripten undefined behavior sanitizer (UBSAN)", False),
         BoolVariable("use_asan", "Use Emscripten address sanitizer (ASAN)", False),
@@ -199,11 +201,19 @@ def configure(env: "Environment"):
     if env["javascript_eval"]:
         env.Append(CPPDEFINES=["JAVASCRIPT_EVAL_ENABLED"])
 
+    if env["wasm_simd"]:
+        # Lets the compiler auto-vectorize loops. Among the bundled libraries, only meshoptimizer has
+        # explicit __wasm_simd128__ code paths.
+        env.Append(CCFLAGS=["-msimd128"])
+        env.Append(LINKFLAGS=["-msimd128"])
+
     # Thread support (via SharedArrayBuffer).
     env.Append(CPPDEFINES=["PTHREAD_NO_RENAME"])
     env.Append(CCFLAGS=["-s", "USE_PTHREADS=1"])
     env.Append(LINKFLAGS=["-s", "USE_PTHREADS=1"])
-    env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=8"])
+    env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=%s" % env["pthread_pool_size"]])
+    # Threads can't be started while the main thread is busy, so the engine must stay within the pre-spawned workers.
+    env.Append(CPPDEFINES=[("WEB_PTHREAD_POOL_SIZE", env["pthread_pool_size"])])
     env.Append(LINKFLAGS=["-s", "WASM_MEM_MAX=2048MB"])
 
     # Get version info for checks below.
@@ -132,6 +132,16 @@ int OS_Web::get_processor_count() const {
 	return godot_js_os_hw_concurrency_get();
 }
 
+int OS_Web::get_default_thread_pool_size() const {
+#ifdef WEB_PTHREAD_POOL_SIZE
+	// Keep a couple of the pre-spawned workers for the server and audio threads,
+	// the rest can run WorkerThreadPool tasks next to the main thread.
+	return CLAMP(get_processor_count() - 1, 1, MAX(WEB_PTHREAD_POOL_SIZE - 2, 1));
+#else
+	return 1;
+#endif
+}
+
 String OS_Web::get_unique_id() const {
 	ERR_FAIL_V_MSG("", "OS::get_unique_id() is not available on the Web platform.");
 }
@@ -2644,12 +2644,23 @@ void DisplayServerWindows::_touch_event(WindowID p_window, bool p_pressed, float
 	event.instantiate();
 	event->set_index(idx);
 	event->set_window_id(p_window);
+	event->set_timestamp(_get_message_timestamp());
 	event->set_pressed(p_pressed);
 	event->set_position(Vector2(p_x, p_y));
 
 	Input::get_singleton()->parse_input_event(event);
 }
 
+uint64_t DisplayServerWindows::_get_message_timestamp() const {
+	// GetMessageTime() is the tick count at which the message being processed was posted.
+	uint64_t now = OS::get_singleton()->get_ticks_usec();
+	uint64_t age = uint64_t(DWORD(GetTickCount() - (DWORD)GetMessageTime())) * 1000;
+	if (age > 1000000 || age >= now) {
+		return now;
+	}
+	return now - age;
+}
+
 void DisplayServerWindows::_drag_event(WindowID p_window, float p_x, float p_y, int idx) {
 	RBMap<int, Vector2>::Element *curr = touch_state.find(idx);
 	if (!curr) {
@@ -2663,6 +2674,7 @@ void DisplayServerWindows::_drag_event(WindowID p_window, float p_x, float p_y,
 	Ref<InputEventScreenDrag> event;
 	event.instantiate();
 	event->set_window_id(p_window);
+	event->set_timestamp(_get_message_timestamp());
 	event->set_index(idx);
 	event->set_position(Vector2(p_x, p_y));
 	event->set_relative(Vector2(p_x, p_y) - curr->get());
@@ -3129,6 +3141,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 				mm.instantiate();
 
 				mm->set_window_id(window_id);
+				mm->set_timestamp(_get_message_timestamp());
 				mm->set_ctrl_pressed(control_mem);
 				mm->set_shift_pressed(shift_mem);
 				mm->set_alt_pressed(alt_mem);
@@ -3227,6 +3240,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 					Ref<InputEventMouseMotion> mm;
 					mm.instantiate();
 					mm->set_window_id(window_id);
+					mm->set_timestamp(_get_message_timestamp());
 					mm->set_ctrl_pressed(GetKeyState(VK_CONTROL) < 0);
 					mm->set_shift_pressed(GetKeyState(VK_SHIFT) < 0);
 					mm->set_alt_pressed(alt_mem);
@@ -3362,6 +3376,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 			mm.instantiate();
 
 			mm->set_window_id(window_id);
+			mm->set_timestamp(_get_message_timestamp());
 			if (pen_info.penMask & PEN_MASK_PRESSURE) {
 				mm->set_pressure((float)pen_info.pressure / 1024);
 			} else {
@@ -3478,6 +3493,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 			Ref<InputEventMouseMotion> mm;
 			mm.instantiate();
 			mm->set_window_id(receiving_window_id);
+			mm->set_timestamp(_get_message_timestamp());
 			mm->set_ctrl_pressed((wParam & MK_CONTROL) != 0);
 			mm->set_shift_pressed((wParam & MK_SHIFT) != 0);
 			mm->set_alt_pressed(alt_mem);
@@ -3568,6 +3584,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 			Ref<InputEventMouseButton> mb;
 			mb.instantiate();
 			mb->set_window_id(window_id);
+			mb->set_timestamp(_get_message_timestamp());
 
 			switch (uMsg) {
 				case WM_LBUTTONDOWN: {
@@ -3715,6 +3732,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 				// Send release for mouse wheel.
 				Ref<InputEventMouseButton> mbd = mb->duplicate();
 				mbd->set_window_id(window_id);
+				mbd->set_timestamp(mb->get_timestamp());
 				last_button_state.clear_flag(mouse_button_to_mask(mbd->get_button_index()));
 				mbd->set_button_mask(last_button_state);
 				mbd->set_pressed(false);
@@ -3874,6 +3892,7 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 
 			ke.wParam = wParam;
 			ke.lParam = lParam;
+			ke.timestamp = _get_message_timestamp();
 			key_event_buffer[key_event_pos++] = ke;
 
 		} break;
@@ -4071,6 +4090,7 @@ void DisplayServerWindows::_process_key_events() {
 					}
 					Ref<InputEventKey> k;
 					k.instantiate();
+					k->set_timestamp(ke.timestamp);
 
 					Key keycode = KeyMappingWindows::get_keysym(MapVirtualKey((ke.lParam >> 16) & 0xFF, MAPVK_VSC_TO_VK));
 					Key key_label = keycode;
@@ -4121,6 +4141,7 @@ void DisplayServerWindows::_process_key_events() {
 				k.instantiate();
 
 				k->set_window_id(ke.window_id);
+				k->set_timestamp(ke.timestamp);
 				k->set_pressed(ke.uMsg == WM_KEYDOWN);
 
 				Key keycode = KeyMappingWindows::get_keysym(ke.wParam);
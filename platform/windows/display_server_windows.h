@@ -326,6 +326,7 @@ class DisplayServerWindows : public DisplayServer {
 		UINT uMsg;
 		WPARAM wParam;
 		LPARAM lParam;
+		uint64_t timestamp;
 	};
 
 	WindowID window_mouseover_id = INVALID_WINDOW_ID;
@@ -473,6 +474,7 @@ class DisplayServerWindows : public DisplayServer {
 
 	void _drag_event(WindowID p_window, float p_x, float p_y, int idx);
 	void _touch_event(WindowID p_window, bool p_pressed, float p_x, float p_y, int idx);
+	uint64_t _get_message_timestamp() const;
 
 	void _update_window_style(WindowID p_window, bool p_repaint = true);
 	void _update_window_mouse_passthrough(WindowID p_window);
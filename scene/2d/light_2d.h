@@ -41,6 +41,7 @@ public:
 		SHADOW_FILTER_NONE,
 		SHADOW_FILTER_PCF5,
 		SHADOW_FILTER_PCF13,
+		SHADOW_FILTER_SDF,
 		SHADOW_FILTER_MAX
 	};
 
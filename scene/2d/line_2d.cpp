@@ -77,12 +77,12 @@ bool Line2D::_edit_is_selected_on_click(const Point2 &p_point, double p_toleranc
 
 void Line2D::set_points(const Vector<Vector2> &p_points) {
 	_points = p_points;
-	queue_redraw();
+	_geometry_changed();
 }
 
 void Line2D::set_closed(bool p_closed) {
 	_closed = p_closed;
-	queue_redraw();
+	_geometry_changed();
 }
 
 bool Line2D::is_closed() const {
@@ -94,7 +94,7 @@ void Line2D::set_width(float p_width) {
 		p_width = 0.0;
 	}
 	_width = p_width;
-	queue_redraw();
+	_geometry_changed();
 }
 
 float Line2D::get_width() const {
@@ -112,7 +112,7 @@ void Line2D::set_curve(const Ref<Curve> &p_curve) {
 		_curve->connect_changed(callable_mp(this, &Line2D::_curve_changed));
 	}
 
-	queue_redraw();
+	_geometry_changed();
 }
 
 Ref<Curve> Line2D::get_curve() const {
@@ -126,7 +126,7 @@ Vector<Vector2> Line2D::get_points() const {
 void Line2D::set_point_position(int i, Vector2 p_pos) {
 	ERR_FAIL_INDEX(i, _points.size());
 	_points.set(i, p_pos);
-	queue_redraw();
+	_geometry_changed();
 }
 
 Vector2 Line2D::get_point_position(int i) const {
@@ -142,7 +142,7 @@ void Line2D::clear_points() {
 	int count = _points.size();
 	if (count > 0) {
 		_points.clear();
-		queue_redraw();
+		_geometry_changed();
 	}
 }
 
@@ -152,17 +152,17 @@ void Line2D::add_point(Vector2 p_pos, int p_atpos) {
 	} else {
 		_points.insert(p_atpos, p_pos);
 	}
-	queue_redraw();
+	_geometry_changed();
 }
 
 void Line2D::remove_point(int i) {
 	_points.remove_at(i);
-	queue_redraw();
+	_geometry_changed();
 }
 
 void Line2D::set_default_color(Color p_color) {
 	_default_color = p_color;
-	queue_redraw();
+	_geometry_changed();
 }
 
 Color Line2D::get_default_color() const {
@@ -180,7 +180,7 @@ void Line2D::set_gradient(const Ref<Gradient> &p_gradient) {
 		_gradient->connect_changed(callable_mp(this, &Line2D::_gradient_changed));
 	}
 
-	queue_redraw();
+	_geometry_changed();
 }
 
 Ref<Gradient> Line2D::get_gradient() const {
@@ -189,7 +189,7 @@ Ref<Gradient> Line2D::get_gradient() const {
 
 void Line2D::set_texture(const Ref<Texture2D> &p_texture) {
 	_texture = p_texture;
-	queue_redraw();
+	_geometry_changed();
 }
 
 Ref<Texture2D> Line2D::get_texture() const {
@@ -198,7 +198,7 @@ Ref<Texture2D> Line2D::get_texture() const {
 
 void Line2D::set_texture_mode(const LineTextureMode p_mode) {
 	_texture_mode = p_mode;
-	queue_redraw();
+	_geometry_changed();
 }
 
 Line2D::LineTextureMode Line2D::get_texture_mode() const {
@@ -207,7 +207,7 @@ Line2D::LineTextureMode Line2D::get_texture_mode() const {
 
 void Line2D::set_joint_mode(LineJointMode p_mode) {
 	_joint_mode = p_mode;
-	queue_redraw();
+	_geometry_changed();
 }
 
 Line2D::LineJointMode Line2D::get_joint_mode() const {
@@ -216,7 +216,7 @@ Line2D::LineJointMode Line2D::get_joint_mode() const {
 
 void Line2D::set_begin_cap_mode(LineCapMode p_mode) {
 	_begin_cap_mode = p_mode;
-	queue_redraw();
+	_geometry_changed();
 }
 
 Line2D::LineCapMode Line2D::get_begin_cap_mode() const {
@@ -225,7 +225,7 @@ Line2D::LineCapMode Line2D::get_begin_cap_mode() const {
 
 void Line2D::set_end_cap_mode(LineCapMode p_mode) {
 	_end_cap_mode = p_mode;
-	queue_redraw();
+	_geometry_changed();
 }
 
 Line2D::LineCapMode Line2D::get_end_cap_mode() const {
@@ -245,7 +245,7 @@ void Line2D::set_sharp_limit(float p_limit) {
 		p_limit = 0.f;
 	}
 	_sharp_limit = p_limit;
-	queue_redraw();
+	_geometry_changed();
 }
 
 float Line2D::get_sharp_limit() const {
@@ -254,7 +254,7 @@ float Line2D::get_sharp_limit() const {
 
 void Line2D::set_round_precision(int p_precision) {
 	_round_precision = MAX(1, p_precision);
-	queue_redraw();
+	_geometry_changed();
 }
 
 int Line2D::get_round_precision() const {
@@ -276,7 +276,25 @@ void Line2D::_draw() {
 		return;
 	}
 
-	// TODO Maybe have it as member rather than copying parameters and allocating memory?
+	RID texture_rid;
+	float tile_aspect = 1.f;
+	if (_texture.is_valid()) {
+		texture_rid = _texture->get_rid();
+		tile_aspect = _texture->get_size().aspect();
+	}
+
+	// Redraws that don't change any input (visibility, reparenting...) reuse the last geometry.
+	if (!_geometry_dirty && tile_aspect == _geometry_tile_aspect) {
+		RS::get_singleton()->canvas_item_add_triangle_array(
+				get_canvas_item(),
+				_geometry_indices,
+				_geometry_vertices,
+				_geometry_colors,
+				_geometry_uvs, Vector<int>(), Vector<float>(),
+				texture_rid);
+		return;
+	}
+
 	LineBuilder lb;
 	lb.points = _points;
 	lb.closed = _closed;
@@ -290,16 +308,17 @@ void Line2D::_draw() {
 	lb.sharp_limit = _sharp_limit;
 	lb.width = _width;
 	lb.curve = *_curve;
-
-	RID texture_rid;
-	if (_texture.is_valid()) {
-		texture_rid = _texture->get_rid();
-
-		lb.tile_aspect = _texture->get_size().aspect();
-	}
+	lb.tile_aspect = tile_aspect;
 
 	lb.build();
 
+	_geometry_vertices = lb.vertices;
+	_geometry_colors = lb.colors;
+	_geometry_uvs = lb.uvs;
+	_geometry_indices = lb.indices;
+	_geometry_tile_aspect = tile_aspect;
+	_geometry_dirty = false;
+
 	RS::get_singleton()->canvas_item_add_triangle_array(
 			get_canvas_item(),
 			lb.indices,
@@ -326,12 +345,17 @@ void Line2D::_draw() {
 	//	}
 }
 
-void Line2D::_gradient_changed() {
+void Line2D::_geometry_changed() {
+	_geometry_dirty = true;
 	queue_redraw();
 }
 
+void Line2D::_gradient_changed() {
+	_geometry_changed();
+}
+
 void Line2D::_curve_changed() {
-	queue_redraw();
+	_geometry_changed();
 }
 
 // static
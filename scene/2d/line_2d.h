@@ -122,6 +122,7 @@ protected:
 	static void _bind_methods();
 
 private:
+	void _geometry_changed();
 	void _gradient_changed();
 	void _curve_changed();
 
@@ -140,6 +141,13 @@ private:
 	float _sharp_limit = 2.f;
 	int _round_precision = 8;
 	bool _antialiased = false;
+
+	bool _geometry_dirty = true;
+	float _geometry_tile_aspect = 1.f;
+	Vector<Vector2> _geometry_vertices;
+	Vector<Color> _geometry_colors;
+	Vector<Vector2> _geometry_uvs;
+	Vector<int> _geometry_indices;
 };
 
 // Needed so we can bind functions
@@ -310,7 +310,10 @@ void Polygon2D::_notification(int p_what) {
 
 			Vector<int> index_array;
 
-			if (invert || polygons.size() == 0) {
+			if (points == triangulated_points && polygons == triangulated_polygons) {
+				// Triangulation only depends on these, reuse it for any other change.
+				index_array = triangulated_indices;
+			} else if (invert || polygons.size() == 0) {
 				index_array = Geometry2D::triangulate_polygon(points);
 			} else {
 				//draw individual polygons
@@ -344,10 +347,12 @@ void Polygon2D::_notification(int p_what) {
 				}
 			}
 
-			RS::get_singleton()->mesh_clear(mesh);
+			triangulated_points = points;
+			triangulated_polygons = polygons;
+			triangulated_indices = index_array;
 
+			Array arr;
 			if (index_array.size()) {
-				Array arr;
 				arr.resize(RS::ARRAY_MAX);
 				arr[RS::ARRAY_VERTEX] = points;
 				if (uvs.size() == points.size()) {
@@ -363,8 +368,18 @@ void Polygon2D::_notification(int p_what) {
 				}
 
 				arr[RS::ARRAY_INDEX] = index_array;
+			}
+
+			// Only upload the mesh again when its contents changed.
+			if (arr != mesh_arrays) {
+				RS::get_singleton()->mesh_clear(mesh);
+				if (!arr.is_empty()) {
+					RS::get_singleton()->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arr, Array(), Dictionary(), RS::ARRAY_FLAG_USE_2D_VERTICES);
+				}
+				mesh_arrays = arr;
+			}
 
-				RS::get_singleton()->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arr, Array(), Dictionary(), RS::ARRAY_FLAG_USE_2D_VERTICES);
+			if (!arr.is_empty()) {
 				RS::get_singleton()->canvas_item_add_mesh(get_canvas_item(), mesh, Transform2D(), Color(1, 1, 1), texture.is_valid() ? texture->get_rid() : RID());
 			}
 
@@ -73,6 +73,11 @@ class Polygon2D : public Node2D {
 	void _skeleton_bone_setup_changed();
 
 	RID mesh;
+	Array mesh_arrays;
+
+	Vector<Vector2> triangulated_points;
+	Array triangulated_polygons;
+	Vector<int> triangulated_indices;
 
 protected:
 	void _notification(int p_what);
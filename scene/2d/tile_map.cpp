@@ -664,8 +664,13 @@ void TileMapLayer::_physics_update() {
 		for (KeyValue<Vector2i, CellData> &kv : tile_map) {
 			_physics_clear_cell(kv.value);
 		}
+		for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+			_physics_clear_quadrant(**kv.value);
+		}
+		physics_quadrant_map.clear();
+		dirty_physics_quadrant_list.clear();
 	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE]) {
+		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE] || dirty.flags[DIRTY_FLAGS_TILE_MAP_PHYSICS_QUADRANT_SIZE]) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
 				_physics_update_cell(kv.value);
@@ -677,6 +682,25 @@ void TileMapLayer::_physics_update() {
 				_physics_update_cell(cell_data);
 			}
 		}
+
+		// Rebuild the bodies of the quadrants whose cells changed, once per quadrant.
+		// This stays on the main thread: most of the work is PhysicsServer2D calls, and the shapes come from
+		// the TileMap's transformed polygon cache, which isn't thread-safe.
+		SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first();
+		while (quadrant_list_element) {
+			SelfList<PhysicsQuadrant> *next_quadrant_list_element = quadrant_list_element->next();
+			Ref<PhysicsQuadrant> physics_quadrant = quadrant_list_element->self();
+			quadrant_list_element->remove_from_list();
+
+			if (physics_quadrant->cells.first()) {
+				_physics_update_quadrant(**physics_quadrant);
+			} else {
+				_physics_clear_quadrant(**physics_quadrant);
+				physics_quadrant_map.erase(physics_quadrant->quadrant_coords);
+			}
+
+			quadrant_list_element = next_quadrant_list_element;
+		}
 	}
 
 	// -----------
@@ -691,38 +715,46 @@ void TileMapLayer::_physics_notify_tilemap_change(TileMapLayer::DirtyFlags p_wha
 	in_editor = Engine::get_singleton()->is_editor_hint();
 #endif
 
+	bool update_bodies = false;
 	if (p_what == DIRTY_FLAGS_TILE_MAP_XFORM) {
-		if (tile_map_node->is_inside_tree() && (!tile_map_node->is_collision_animatable() || in_editor)) {
-			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
-				const CellData &cell_data = kv.value;
+		update_bodies = tile_map_node->is_inside_tree() && (!tile_map_node->is_collision_animatable() || in_editor);
+	} else if (p_what == DIRTY_FLAGS_TILE_MAP_LOCAL_XFORM) {
+		update_bodies = tile_map_node->is_inside_tree() && tile_map_node->is_collision_animatable() && !in_editor;
+	}
+	if (!update_bodies) {
+		return;
+	}
 
-				for (RID body : cell_data.bodies) {
-					if (body.is_valid()) {
-						Transform2D xform(0, tile_map_node->map_to_local(bodies_coords[body]));
-						xform = gl_transform * xform;
-						PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-					}
-				}
+	for (KeyValue<Vector2i, CellData> &kv : tile_map) {
+		const CellData &cell_data = kv.value;
+
+		for (RID body : cell_data.bodies) {
+			if (body.is_valid()) {
+				Transform2D xform(0, tile_map_node->map_to_local(bodies_coords[body]));
+				xform = gl_transform * xform;
+				PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
 			}
 		}
-	} else if (p_what == DIRTY_FLAGS_TILE_MAP_LOCAL_XFORM) {
-		if (tile_map_node->is_inside_tree() && tile_map_node->is_collision_animatable() && !in_editor) {
-			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
-				const CellData &cell_data = kv.value;
+	}
 
-				for (RID body : cell_data.bodies) {
-					if (body.is_valid()) {
-						Transform2D xform(0, tile_map_node->map_to_local(bodies_coords[body]));
-						xform = gl_transform * xform;
-						PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-					}
-				}
+	for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+		const Ref<PhysicsQuadrant> &physics_quadrant = kv.value;
+
+		for (RID body : physics_quadrant->bodies) {
+			if (body.is_valid()) {
+				Transform2D xform = gl_transform * Transform2D(0, physics_quadrant->bodies_position);
+				PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
 			}
 		}
 	}
 }
 
 void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
+	_physics_clear_cell_bodies(r_cell_data);
+	_physics_quadrants_update_cell(r_cell_data, false);
+}
+
+void TileMapLayer::_physics_clear_cell_bodies(CellData &r_cell_data) {
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	// Clear bodies.
@@ -735,10 +767,40 @@ void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
 	r_cell_data.bodies.clear();
 }
 
+void TileMapLayer::_physics_setup_body(RID p_body, int p_tile_set_physics_layer, const Transform2D &p_xform, const TileData *p_tile_data) {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(p_tile_set_physics_layer);
+	uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(p_tile_set_physics_layer);
+	uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(p_tile_set_physics_layer);
+
+	ps->body_set_mode(p_body, tile_map_node->is_collision_animatable() ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_set_space(p_body, tile_map_node->get_world_2d()->get_space());
+	ps->body_set_state(p_body, PhysicsServer2D::BODY_STATE_TRANSFORM, tile_map_node->get_global_transform() * p_xform);
+
+	ps->body_attach_object_instance_id(p_body, tile_map_node->get_instance_id());
+	ps->body_set_collision_layer(p_body, physics_layer);
+	ps->body_set_collision_mask(p_body, physics_mask);
+	ps->body_set_pickable(p_body, false);
+	// Merged bodies only contain tiles without constant velocities.
+	ps->body_set_state(p_body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, p_tile_data ? p_tile_data->get_constant_linear_velocity(p_tile_set_physics_layer) : Vector2());
+	ps->body_set_state(p_body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, p_tile_data ? p_tile_data->get_constant_angular_velocity(p_tile_set_physics_layer) : 0.0);
+
+	if (!physics_material.is_valid()) {
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+	} else {
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+	}
+
+	// Clear body's shape if needed.
+	ps->body_clear_shapes(p_body);
+}
+
 void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
-	Transform2D gl_transform = tile_map_node->get_global_transform();
-	RID space = tile_map_node->get_world_2d()->get_space();
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	// Recreate bodies and shapes.
@@ -758,6 +820,18 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 					tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
 				}
 
+				// Tiles modified at runtime or with constant velocities keep their own bodies.
+				bool merge = tile_map_node->get_physics_quadrant_size() > 1 && !r_cell_data.runtime_tile_data_cache;
+				for (int tile_set_physics_layer = 0; merge && tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+					merge = tile_data->get_constant_linear_velocity(tile_set_physics_layer) == Vector2() && tile_data->get_constant_angular_velocity(tile_set_physics_layer) == 0.0;
+				}
+				if (merge) {
+					_physics_clear_cell_bodies(r_cell_data);
+					_physics_quadrants_update_cell(r_cell_data, true);
+					return;
+				}
+				_physics_quadrants_update_cell(r_cell_data, false);
+
 				// Free unused bodies then resize the bodies array.
 				for (unsigned int i = tile_set->get_physics_layers_count(); i < r_cell_data.bodies.size(); i++) {
 					RID body = r_cell_data.bodies[i];
@@ -769,10 +843,6 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 				r_cell_data.bodies.resize(tile_set->get_physics_layers_count());
 
 				for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-					Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-					uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-					uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
-
 					RID body = r_cell_data.bodies[tile_set_physics_layer];
 					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
 						// No body needed, free it if it exists.
@@ -787,31 +857,7 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 							body = ps->body_create();
 						}
 						bodies_coords[body] = r_cell_data.coords;
-						ps->body_set_mode(body, tile_map_node->is_collision_animatable() ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
-
-						Transform2D xform;
-						xform.set_origin(tile_map_node->map_to_local(r_cell_data.coords));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, tile_map_node->get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (!physics_material.is_valid()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
-						}
-
-						// Clear body's shape if needed.
-						ps->body_clear_shapes(body);
+						_physics_setup_body(body, tile_set_physics_layer, Transform2D(0, tile_map_node->map_to_local(r_cell_data.coords)), tile_data);
 
 						// Add the shapes to the body.
 						int body_shape_index = 0;
@@ -845,6 +891,117 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	_physics_clear_cell(r_cell_data);
 }
 
+void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, bool p_merge) {
+	Ref<PhysicsQuadrant> old_physics_quadrant = r_cell_data.physics_quadrant;
+
+	Ref<PhysicsQuadrant> physics_quadrant;
+	if (p_merge) {
+		int quad_size = tile_map_node->get_physics_quadrant_size();
+		const Vector2i &coords = r_cell_data.coords;
+
+		// Rounding down, instead of simply rounding towards zero (truncating).
+		Vector2i quadrant_coords = Vector2i(
+				coords.x > 0 ? coords.x / quad_size : (coords.x - (quad_size - 1)) / quad_size,
+				coords.y > 0 ? coords.y / quad_size : (coords.y - (quad_size - 1)) / quad_size);
+
+		if (physics_quadrant_map.has(quadrant_coords)) {
+			// Reuse existing physics quadrant.
+			physics_quadrant = physics_quadrant_map[quadrant_coords];
+		} else {
+			// Create a new physics quadrant.
+			physics_quadrant.instantiate();
+			physics_quadrant->quadrant_coords = quadrant_coords;
+			physics_quadrant->bodies_position = tile_map_node->map_to_local(quad_size * quadrant_coords);
+			physics_quadrant_map[quadrant_coords] = physics_quadrant;
+		}
+	}
+
+	// Remove the cell from its old quadrant, which needs to be rebuilt.
+	if (old_physics_quadrant.is_valid()) {
+		if (r_cell_data.physics_quadrant_list_element.in_list()) {
+			old_physics_quadrant->cells.remove(&r_cell_data.physics_quadrant_list_element);
+		}
+		if (!old_physics_quadrant->dirty_quadrant_list_element.in_list()) {
+			dirty_physics_quadrant_list.add(&old_physics_quadrant->dirty_quadrant_list_element);
+		}
+	}
+	r_cell_data.physics_quadrant = physics_quadrant;
+
+	// Add the cell to its new quadrant.
+	if (physics_quadrant.is_valid()) {
+		physics_quadrant->cells.add(&r_cell_data.physics_quadrant_list_element);
+		if (!physics_quadrant->dirty_quadrant_list_element.in_list()) {
+			dirty_physics_quadrant_list.add(&physics_quadrant->dirty_quadrant_list_element);
+		}
+	}
+}
+
+void TileMapLayer::_physics_clear_quadrant(PhysicsQuadrant &r_quadrant) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	for (RID body : r_quadrant.bodies) {
+		if (body.is_valid()) {
+			bodies_coords.erase(body);
+			bodies_physics_quadrants.erase(body);
+			ps->free(body);
+		}
+	}
+	r_quadrant.bodies.clear();
+	r_quadrant.bodies_shapes_coords.clear();
+}
+
+void TileMapLayer::_physics_update_quadrant(PhysicsQuadrant &r_quadrant) {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	_physics_clear_quadrant(r_quadrant);
+	r_quadrant.bodies.resize(tile_set->get_physics_layers_count());
+
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		RID body;
+		LocalVector<Vector2i> shapes_coords;
+
+		for (SelfList<CellData> *cell_data_list_element = r_quadrant.cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			const CellData &cell_data = *cell_data_list_element->self();
+			const TileMapCell &c = cell_data.cell;
+
+			// Cells are only added to quadrants once validated, and the quadrant is rebuilt whenever the TileSet changes.
+			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id));
+			const TileData *tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+			if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
+				continue;
+			}
+
+			if (!body.is_valid()) {
+				body = ps->body_create();
+				_physics_setup_body(body, tile_set_physics_layer, Transform2D(0, r_quadrant.bodies_position), nullptr);
+			}
+
+			Transform2D shape_xform(0, tile_map_node->map_to_local(cell_data.coords) - r_quadrant.bodies_position);
+			for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+				bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+				float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+				int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+				for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+					shape = tile_map_node->get_transformed_polygon(Ref<Resource>(shape), c.alternative_tile);
+					ps->body_add_shape(body, shape->get_rid(), shape_xform);
+					ps->body_set_shape_as_one_way_collision(body, shapes_coords.size(), one_way_collision, one_way_collision_margin);
+					shapes_coords.push_back(cell_data.coords);
+				}
+			}
+		}
+
+		if (body.is_valid()) {
+			// The body is reported as belonging to the first cell of the quadrant, use get_coords_for_body_shape() to find the exact cell.
+			bodies_coords[body] = shapes_coords[0];
+			bodies_physics_quadrants[body] = Ref<PhysicsQuadrant>(&r_quadrant);
+			r_quadrant.bodies_shapes_coords[body] = shapes_coords;
+		}
+		r_quadrant.bodies[tile_set_physics_layer] = body;
+	}
+}
+
 #ifdef DEBUG_ENABLED
 void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vector2i &p_quadrant_pos, const CellData &r_cell_data) {
 	// Draw the debug collision shapes.
@@ -897,6 +1054,30 @@ void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vect
 			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
 		}
 	}
+
+	// Merged bodies are shared by the cells of a physics quadrant, only draw the shapes of this cell.
+	if (r_cell_data.physics_quadrant.is_valid()) {
+		for (RID body : r_cell_data.physics_quadrant->bodies) {
+			if (body.is_valid()) {
+				const LocalVector<Vector2i> &shapes_coords = r_cell_data.physics_quadrant->bodies_shapes_coords[body];
+				Transform2D body_to_quadrant = global_to_quadrant * Transform2D(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM));
+				for (unsigned int shape_index = 0; shape_index < shapes_coords.size(); shape_index++) {
+					if (shapes_coords[shape_index] != r_cell_data.coords) {
+						continue;
+					}
+					const RID &shape = ps->body_get_shape(body, shape_index);
+					const PhysicsServer2D::ShapeType &type = ps->shape_get_type(shape);
+					if (type == PhysicsServer2D::SHAPE_CONVEX_POLYGON) {
+						rs->canvas_item_add_set_transform(p_canvas_item, body_to_quadrant * ps->body_get_shape_transform(body, shape_index));
+						rs->canvas_item_add_polygon(p_canvas_item, ps->shape_get_data(shape), color);
+					} else {
+						WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON.");
+					}
+				}
+				rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
+			}
+		}
+	}
 };
 #endif // DEBUG_ENABLED
 
@@ -2497,6 +2678,16 @@ Vector2i TileMapLayer::get_coords_for_body_rid(RID p_physics_body) const {
 	return bodies_coords[p_physics_body];
 }
 
+Vector2i TileMapLayer::get_coords_for_body_shape(RID p_physics_body, int p_body_shape_index) const {
+	HashMap<RID, Ref<PhysicsQuadrant>>::ConstIterator E = bodies_physics_quadrants.find(p_physics_body);
+	if (E) {
+		const LocalVector<Vector2i> &shapes_coords = E->value->bodies_shapes_coords[p_physics_body];
+		ERR_FAIL_INDEX_V(p_body_shape_index, (int)shapes_coords.size(), Vector2i());
+		return shapes_coords[p_body_shape_index];
+	}
+	return bodies_coords[p_physics_body];
+}
+
 TileMapLayer::~TileMapLayer() {
 	in_destructor = true;
 	clear();
@@ -3122,6 +3313,20 @@ int TileMap::get_rendering_quadrant_size() const {
 	return rendering_quadrant_size;
 }
 
+void TileMap::set_physics_quadrant_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 1, "Physics quadrant size cannot be smaller than 1.");
+
+	physics_quadrant_size = p_size;
+	for (Ref<TileMapLayer> &layer : layers) {
+		layer->notify_tile_map_change(TileMapLayer::DIRTY_FLAGS_TILE_MAP_PHYSICS_QUADRANT_SIZE);
+	}
+	emit_signal(CoreStringNames::get_singleton()->changed);
+}
+
+int TileMap::get_physics_quadrant_size() const {
+	return physics_quadrant_size;
+}
+
 void TileMap::draw_tile(RID p_canvas_item, const Vector2 &p_position, const Ref<TileSet> p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame, Color p_modulation, const TileData *p_tile_data_override, real_t p_animation_offset) {
 	ERR_FAIL_COND(!p_tile_set.is_valid());
 	ERR_FAIL_COND(!p_tile_set->has_source(p_atlas_source_id));
@@ -3497,6 +3702,15 @@ Vector2i TileMap::get_coords_for_body_rid(RID p_physics_body) {
 	ERR_FAIL_V_MSG(Vector2i(), vformat("No tiles for the given body RID %d.", p_physics_body.get_id()));
 }
 
+Vector2i TileMap::get_coords_for_body_shape(RID p_physics_body, int p_body_shape_index) {
+	for (const Ref<TileMapLayer> &layer : layers) {
+		if (layer->has_body_rid(p_physics_body)) {
+			return layer->get_coords_for_body_shape(p_physics_body, p_body_shape_index);
+		}
+	}
+	ERR_FAIL_V_MSG(Vector2i(), vformat("No tiles for the given body RID %d.", p_physics_body.get_id()));
+}
+
 int TileMap::get_layer_for_body_rid(RID p_physics_body) {
 	for (unsigned int i = 0; i < layers.size(); i++) {
 		if (layers[i]->has_body_rid(p_physics_body)) {
@@ -4628,6 +4842,8 @@ void TileMap::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_rendering_quadrant_size", "size"), &TileMap::set_rendering_quadrant_size);
 	ClassDB::bind_method(D_METHOD("get_rendering_quadrant_size"), &TileMap::get_rendering_quadrant_size);
+	ClassDB::bind_method(D_METHOD("set_physics_quadrant_size", "size"), &TileMap::set_physics_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_physics_quadrant_size"), &TileMap::get_physics_quadrant_size);
 
 	ClassDB::bind_method(D_METHOD("get_layers_count"), &TileMap::get_layers_count);
 	ClassDB::bind_method(D_METHOD("add_layer", "to_position"), &TileMap::add_layer);
@@ -4666,6 +4882,7 @@ void TileMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_cell_tile_data", "layer", "coords", "use_proxies"), &TileMap::get_cell_tile_data, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_coords_for_body_rid", "body"), &TileMap::get_coords_for_body_rid);
+	ClassDB::bind_method(D_METHOD("get_coords_for_body_shape", "body", "body_shape_index"), &TileMap::get_coords_for_body_shape);
 	ClassDB::bind_method(D_METHOD("get_layer_for_body_rid", "body"), &TileMap::get_layer_for_body_rid);
 
 	ClassDB::bind_method(D_METHOD("get_pattern", "layer", "coords_array"), &TileMap::get_pattern);
@@ -4698,6 +4915,7 @@ void TileMap::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tile_set", PROPERTY_HINT_RESOURCE_TYPE, "TileSet"), "set_tileset", "get_tileset");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "rendering_quadrant_size", PROPERTY_HINT_RANGE, "1,128,1"), "set_rendering_quadrant_size", "get_rendering_quadrant_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_quadrant_size", PROPERTY_HINT_RANGE, "1,128,1"), "set_physics_quadrant_size", "get_physics_quadrant_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_animatable"), "set_collision_animatable", "is_collision_animatable");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_navigation_visibility_mode", "get_navigation_visibility_mode");
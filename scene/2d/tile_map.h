@@ -93,6 +93,7 @@ public:
 class DebugQuadrant;
 #endif // DEBUG_ENABLED
 class RenderingQuadrant;
+class PhysicsQuadrant;
 
 struct CellData {
 	Vector2i coords;
@@ -108,6 +109,8 @@ struct CellData {
 
 	// Physics.
 	LocalVector<RID> bodies;
+	Ref<PhysicsQuadrant> physics_quadrant;
+	SelfList<CellData> physics_quadrant_list_element;
 
 	// Navigation.
 	LocalVector<RID> navigation_regions;
@@ -139,6 +142,7 @@ struct CellData {
 	CellData(const CellData &p_other) :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 		coords = p_other.coords;
 		cell = p_other.cell;
@@ -152,6 +156,7 @@ struct CellData {
 	CellData() :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 	}
 };
@@ -231,6 +236,39 @@ public:
 	}
 };
 
+// Groups the static collision of several cells into a single body per TileSet physics layer.
+class PhysicsQuadrant : public RefCounted {
+	GDCLASS(PhysicsQuadrant, RefCounted);
+
+public:
+	Vector2i quadrant_coords;
+	SelfList<CellData>::List cells;
+	LocalVector<RID> bodies;
+	Vector2 bodies_position;
+	// For each body, the coords of the cell each of its shapes comes from.
+	HashMap<RID, LocalVector<Vector2i>> bodies_shapes_coords;
+
+	SelfList<PhysicsQuadrant> dirty_quadrant_list_element;
+
+	// For those, copy everything but SelfList elements.
+	PhysicsQuadrant(const PhysicsQuadrant &p_other) :
+			dirty_quadrant_list_element(this) {
+		quadrant_coords = p_other.quadrant_coords;
+		cells = p_other.cells;
+		bodies = p_other.bodies;
+		bodies_position = p_other.bodies_position;
+		bodies_shapes_coords = p_other.bodies_shapes_coords;
+	}
+
+	PhysicsQuadrant() :
+			dirty_quadrant_list_element(this) {
+	}
+
+	~PhysicsQuadrant() {
+		cells.clear();
+	}
+};
+
 class TileMapLayer : public RefCounted {
 	GDCLASS(TileMapLayer, RefCounted);
 
@@ -263,6 +301,7 @@ public:
 		DIRTY_FLAGS_TILE_MAP_TEXTURE_REPEAT,
 		DIRTY_FLAGS_TILE_MAP_TILE_SET,
 		DIRTY_FLAGS_TILE_MAP_QUADRANT_SIZE,
+		DIRTY_FLAGS_TILE_MAP_PHYSICS_QUADRANT_SIZE,
 		DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE,
 		DIRTY_FLAGS_TILE_MAP_COLLISION_VISIBILITY_MODE,
 		DIRTY_FLAGS_TILE_MAP_NAVIGATION_VISIBILITY_MODE,
@@ -328,11 +367,19 @@ private:
 #endif // DEBUG_ENABLED
 
 	HashMap<RID, Vector2i> bodies_coords; // Mapping for RID to coords.
+	HashMap<Vector2i, Ref<PhysicsQuadrant>> physics_quadrant_map;
+	HashMap<RID, Ref<PhysicsQuadrant>> bodies_physics_quadrants;
+	SelfList<PhysicsQuadrant>::List dirty_physics_quadrant_list;
 	bool _physics_was_cleaned_up = false;
 	void _physics_update();
 	void _physics_notify_tilemap_change(DirtyFlags p_what);
 	void _physics_clear_cell(CellData &r_cell_data);
+	void _physics_clear_cell_bodies(CellData &r_cell_data);
 	void _physics_update_cell(CellData &r_cell_data);
+	void _physics_quadrants_update_cell(CellData &r_cell_data, bool p_merge);
+	void _physics_update_quadrant(PhysicsQuadrant &r_quadrant);
+	void _physics_clear_quadrant(PhysicsQuadrant &r_quadrant);
+	void _physics_setup_body(RID p_body, int p_tile_set_physics_layer, const Transform2D &p_xform, const TileData *p_tile_data);
 #ifdef DEBUG_ENABLED
 	void _physics_draw_cell_debug(const RID &p_canvas_item, const Vector2i &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -430,6 +477,7 @@ public:
 	// Find coords for body.
 	bool has_body_rid(RID p_physics_body) const;
 	Vector2i get_coords_for_body_rid(RID p_physics_body) const; // For finding tiles from collision.
+	Vector2i get_coords_for_body_shape(RID p_physics_body, int p_body_shape_index) const;
 
 	~TileMapLayer();
 };
@@ -455,6 +503,7 @@ private:
 	// Properties.
 	Ref<TileSet> tile_set;
 	int rendering_quadrant_size = 16;
+	int physics_quadrant_size = 1;
 	bool collision_animatable = false;
 	VisibilityMode collision_visibility_mode = VISIBILITY_MODE_DEFAULT;
 	VisibilityMode navigation_visibility_mode = VISIBILITY_MODE_DEFAULT;
@@ -512,6 +561,9 @@ public:
 	void set_rendering_quadrant_size(int p_size);
 	int get_rendering_quadrant_size() const;
 
+	void set_physics_quadrant_size(int p_size);
+	int get_physics_quadrant_size() const;
+
 	static void draw_tile(RID p_canvas_item, const Vector2 &p_position, const Ref<TileSet> p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame = -1, Color p_modulation = Color(1.0, 1.0, 1.0, 1.0), const TileData *p_tile_data_override = nullptr, real_t p_animation_offset = 0.0);
 
 	// Layers management.
@@ -599,6 +651,7 @@ public:
 
 	// For finding tiles from collision.
 	Vector2i get_coords_for_body_rid(RID p_physics_body);
+	Vector2i get_coords_for_body_shape(RID p_physics_body, int p_body_shape_index);
 	// For getting their layers as well.
 	int get_layer_for_body_rid(RID p_physics_body);
 
@@ -103,6 +103,7 @@ private:
 
 	double time = 0.0;
 	double frame_remainder = 0.0;
+	double inactive_time = 0.0; // Only used with the server profile.
 	int cycle = 0;
 	bool redraw = false;
 
@@ -186,7 +187,24 @@ private:
 	Vector3 gravity = Vector3(0, -9.8, 0);
 
 	void _update_internal();
+	// Below this many particles, dispatching them to the WorkerThreadPool costs more than it saves.
+	static const int PARALLEL_PROCESS_MIN_PARTICLES = 256;
+
+	struct ParticleProcessData {
+		Particle *particles = nullptr;
+		int particle_count = 0;
+		double delta = 0.0;
+		double prev_time = 0.0;
+		double system_phase = 0.0;
+		Transform3D emission_xform;
+		Basis velocity_xform;
+		uint32_t random_seed = 0;
+		SafeFlag should_be_active;
+	};
+
+	void _particle_process(uint32_t p_index, ParticleProcessData *p_data);
 	void _particles_process(double p_delta);
+	void _server_profile_step(double p_delta);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
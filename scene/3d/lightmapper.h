@@ -145,7 +145,8 @@ public:
 	enum BakeError {
 		BAKE_ERROR_LIGHTMAP_TOO_SMALL,
 		BAKE_ERROR_LIGHTMAP_CANT_PRE_BAKE_MESHES,
-		BAKE_OK
+		BAKE_OK,
+		BAKE_ERROR_USER_ABORTED,
 	};
 
 	enum BakeQuality {
@@ -163,7 +164,7 @@ public:
 
 protected:
 public:
-	typedef bool (*BakeStepFunc)(float, const String &, void *, bool); //step index, step total, step description, userdata
+	typedef bool (*BakeStepFunc)(float, const String &, void *, bool); //step index, step total, step description, userdata; returns true to abort the bake
 
 	struct MeshData {
 		//triangle data
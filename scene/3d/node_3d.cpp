@@ -109,25 +109,41 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	for (Node3D *&E : data.children) {
-		if (E->data.top_level) {
-			continue; //don't propagate to a top_level
-		}
-		E->_propagate_transform_changed(p_origin);
-	}
+	// The subtree is walked iteratively in pre-order, so deep hierarchies don't recurse and parents are queued
+	// before their children. When notifications are flushed, each global transform is then resolved against an
+	// already resolved parent instead of walking up the chain. Nothing here calls back into user code, so the
+	// stack can be shared by consecutive propagations on the same thread.
+	thread_local LocalVector<Node3D *> stack;
+	const uint32_t base = stack.size();
+	SceneTree *tree = get_tree();
+
+	stack.push_back(this);
+	while (stack.size() > base) {
+		Node3D *node = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+		if ((!node->data.gizmos.is_empty() || node->data.notify_transform) && !node->data.ignore_notification && !node->xform_change.in_list()) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+		if (node->data.notify_transform && !node->data.ignore_notification && !node->xform_change.in_list()) {
 #endif
-		if (likely(is_accessible_from_caller_thread())) {
-			get_tree()->xform_change_list.add(&xform_change);
-		} else {
-			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
-			MessageQueue::get_singleton()->push_callable(callable_mp(this, &Node3D::_propagate_transform_changed_deferred));
+			if (likely(node->is_accessible_from_caller_thread())) {
+				tree->xform_change_list.add_last(&node->xform_change);
+			} else {
+				// This should very rarely happen, but if it does at least make sure the notification is received eventually.
+				MessageQueue::get_singleton()->push_callable(callable_mp(node, &Node3D::_propagate_transform_changed_deferred));
+			}
+		}
+		node->_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+
+		// Pushed in reverse so children are visited in tree order.
+		for (List<Node3D *>::Element *E = node->data.children.back(); E; E = E->prev()) {
+			if (E->get()->data.top_level || !E->get()->is_inside_tree()) {
+				continue; //don't propagate to a top_level
+			}
+			stack.push_back(E->get());
 		}
 	}
-	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
 }
 
 void Node3D::_notification(int p_what) {
@@ -194,6 +194,7 @@ void Skeleton3D::_update_process_order() {
 	int len = bones.size();
 
 	parentless_bones.clear();
+	process_order.clear();
 
 	for (int i = 0; i < len; i++) {
 		bonesptr[i].child_bones.clear();
@@ -221,6 +222,17 @@ void Skeleton3D::_update_process_order() {
 		}
 	}
 
+	// Flatten the hierarchy breadth first, so global poses can be solved in a single linear pass.
+	for (int i = 0; i < parentless_bones.size(); i++) {
+		process_order.push_back(parentless_bones[i]);
+	}
+	for (uint32_t i = 0; i < process_order.size(); i++) {
+		const Vector<int> &children = bonesptr[process_order[i]].child_bones;
+		for (int j = 0; j < children.size(); j++) {
+			process_order.push_back(children[j]);
+		}
+	}
+
 	process_order_dirty = false;
 }
 
@@ -587,6 +599,20 @@ void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	}
 }
 
+void Skeleton3D::set_bone_pose_components(int p_bone, const Vector3 &p_position, const Quaternion &p_rotation, const Vector3 &p_scale) {
+	const int bone_size = bones.size();
+	ERR_FAIL_INDEX(p_bone, bone_size);
+
+	Bone &b = bones.write[p_bone];
+	b.pose_position = p_position;
+	b.pose_rotation = p_rotation;
+	b.pose_scale = p_scale;
+	b.pose_cache_dirty = true;
+	if (is_inside_tree()) {
+		_make_dirty();
+	}
+}
+
 Vector3 Skeleton3D::get_bone_pose_position(int p_bone) const {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX_V(p_bone, bone_size, Vector3());
@@ -903,8 +929,11 @@ void Skeleton3D::force_update_all_dirty_bones() {
 void Skeleton3D::force_update_all_bone_transforms() {
 	_update_process_order();
 
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		force_update_bone_children_transforms(parentless_bones[i]);
+	Bone *bonesptr = bones.ptrw();
+	const StringName &bone_pose_changed = SceneStringNames::get_singleton()->bone_pose_changed;
+	for (const int &bone_idx : process_order) {
+		_update_bone_global_pose(bonesptr, bone_idx);
+		emit_signal(bone_pose_changed, bone_idx);
 	}
 	rest_dirty = false;
 }
@@ -914,55 +943,58 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
 	Bone *bonesptr = bones.ptrw();
-	List<int> bones_to_process = List<int>();
+	const StringName &bone_pose_changed = SceneStringNames::get_singleton()->bone_pose_changed;
+	LocalVector<int> bones_to_process;
 	bones_to_process.push_back(p_bone_idx);
 
-	while (bones_to_process.size() > 0) {
-		int current_bone_idx = bones_to_process[0];
-		bones_to_process.erase(current_bone_idx);
+	for (uint32_t i = 0; i < bones_to_process.size(); i++) {
+		int current_bone_idx = bones_to_process[i];
+		_update_bone_global_pose(bonesptr, current_bone_idx);
+
+		// Add the bone's children to the list of bones to be processed.
+		const Vector<int> &children = bonesptr[current_bone_idx].child_bones;
+		for (int j = 0; j < children.size(); j++) {
+			bones_to_process.push_back(children[j]);
+		}
 
-		Bone &b = bonesptr[current_bone_idx];
-		bool bone_enabled = b.enabled && !show_rest_only;
+		emit_signal(bone_pose_changed, current_bone_idx);
+	}
+}
 
-		if (bone_enabled) {
-			b.update_pose_cache();
-			Transform3D pose = b.pose_cache;
+void Skeleton3D::_update_bone_global_pose(Bone *p_bones, int p_bone) {
+	Bone &b = p_bones[p_bone];
+	bool bone_enabled = b.enabled && !show_rest_only;
 
-			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * pose;
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * pose;
-			} else {
-				b.pose_global = pose;
-				b.pose_global_no_override = pose;
-			}
-		} else {
-			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * b.rest;
-			} else {
-				b.pose_global = b.rest;
-				b.pose_global_no_override = b.rest;
-			}
-		}
-		if (rest_dirty) {
-			b.global_rest = b.parent >= 0 ? bonesptr[b.parent].global_rest * b.rest : b.rest;
-		}
+	if (bone_enabled) {
+		b.update_pose_cache();
+		const Transform3D &pose = b.pose_cache;
 
-		if (b.global_pose_override_amount >= CMP_EPSILON) {
-			b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+		if (b.parent >= 0) {
+			b.pose_global = p_bones[b.parent].pose_global * pose;
+			b.pose_global_no_override = p_bones[b.parent].pose_global_no_override * pose;
+		} else {
+			b.pose_global = pose;
+			b.pose_global_no_override = pose;
 		}
-
-		if (b.global_pose_override_reset) {
-			b.global_pose_override_amount = 0.0;
+	} else {
+		if (b.parent >= 0) {
+			b.pose_global = p_bones[b.parent].pose_global * b.rest;
+			b.pose_global_no_override = p_bones[b.parent].pose_global_no_override * b.rest;
+		} else {
+			b.pose_global = b.rest;
+			b.pose_global_no_override = b.rest;
 		}
+	}
+	if (rest_dirty) {
+		b.global_rest = b.parent >= 0 ? p_bones[b.parent].global_rest * b.rest : b.rest;
+	}
 
-		// Add the bone's children to the list of bones to be processed.
-		int child_bone_size = b.child_bones.size();
-		for (int i = 0; i < child_bone_size; i++) {
-			bones_to_process.push_back(b.child_bones[i]);
-		}
+	if (b.global_pose_override_amount >= CMP_EPSILON) {
+		b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+	}
 
-		emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, current_bone_idx);
+	if (b.global_pose_override_reset) {
+		b.global_pose_override_amount = 0.0;
 	}
 }
 
@@ -996,6 +1028,7 @@ void Skeleton3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("clear_bones"), &Skeleton3D::clear_bones);
 
 	ClassDB::bind_method(D_METHOD("get_bone_pose", "bone_idx"), &Skeleton3D::get_bone_pose);
+	ClassDB::bind_method(D_METHOD("set_bone_pose_components", "bone_idx", "position", "rotation", "scale"), &Skeleton3D::set_bone_pose_components);
 	ClassDB::bind_method(D_METHOD("set_bone_pose_position", "bone_idx", "position"), &Skeleton3D::set_bone_pose_position);
 	ClassDB::bind_method(D_METHOD("set_bone_pose_rotation", "bone_idx", "rotation"), &Skeleton3D::set_bone_pose_rotation);
 	ClassDB::bind_method(D_METHOD("set_bone_pose_scale", "bone_idx", "scale"), &Skeleton3D::set_bone_pose_scale);
@@ -125,6 +125,7 @@ private:
 	bool process_order_dirty = false;
 
 	Vector<int> parentless_bones;
+	LocalVector<int> process_order; // All bones, parents always before their children.
 	HashMap<String, int> name_to_bone_index;
 
 	void _make_dirty();
@@ -137,6 +138,7 @@ private:
 	uint64_t version = 1;
 
 	void _update_process_order();
+	_FORCE_INLINE_ void _update_bone_global_pose(Bone *p_bones, int p_bone);
 
 protected:
 	bool _get(const StringName &p_path, Variant &r_ret) const;
@@ -191,6 +193,7 @@ public:
 	void set_bone_pose_position(int p_bone, const Vector3 &p_position);
 	void set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation);
 	void set_bone_pose_scale(int p_bone, const Vector3 &p_scale);
+	void set_bone_pose_components(int p_bone, const Vector3 &p_position, const Quaternion &p_rotation, const Vector3 &p_scale);
 
 	Transform3D get_bone_pose(int p_bone) const;
 
@@ -689,6 +689,7 @@ SoftBody3D::SoftBody3D() :
 		physics_rid(PhysicsServer3D::get_singleton()->soft_body_create()) {
 	rendering_server_handler = memnew(SoftBodyRenderingServerHandler);
 	PhysicsServer3D::get_singleton()->body_attach_object_instance_id(physics_rid, get_instance_id());
+	set_notify_transform(true); // Needed for the physics setup, even with the server profile.
 }
 
 SoftBody3D::~SoftBody3D() {
@@ -30,6 +30,7 @@
 
 #include "visual_instance_3d.h"
 
+#include "core/config/engine.h"
 #include "core/core_string_names.h"
 #include "scene/scene_string_names.h"
 
@@ -51,16 +52,26 @@ void VisualInstance3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_WORLD: {
 			ERR_FAIL_COND(get_world_3d().is_null());
+			if (Engine::get_singleton()->is_server_profile_enabled()) {
+				break; // Nothing is rendered, keep the instance out of the scenario.
+			}
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
 			_update_visibility();
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			if (Engine::get_singleton()->is_server_profile_enabled()) {
+				break;
+			}
 			Transform3D gt = get_global_transform();
-			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			if (!get_tree()->batch_instance_transform(instance, gt)) {
+				RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
+			// The instance may be freed right after, don't let a pending batched transform reach it.
+			get_tree()->cancel_instance_transform(instance);
 			RenderingServer::get_singleton()->instance_set_scenario(instance, RID());
 			RenderingServer::get_singleton()->instance_attach_skeleton(instance, RID());
 		} break;
@@ -159,7 +170,7 @@ RID VisualInstance3D::get_base() const {
 VisualInstance3D::VisualInstance3D() {
 	instance = RenderingServer::get_singleton()->instance_create();
 	RenderingServer::get_singleton()->instance_attach_object_instance_id(instance, get_instance_id());
-	set_notify_transform(true);
+	set_notify_transform(!Engine::get_singleton()->is_server_profile_enabled());
 }
 
 VisualInstance3D::~VisualInstance3D() {
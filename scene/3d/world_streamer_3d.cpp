@@ -0,0 +1,369 @@
+/**************************************************************************/
+/*  world_streamer_3d.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "world_streamer_3d.h"
+
+#include "core/config/engine.h"
+#include "core/io/resource_loader.h"
+#include "scene/3d/camera_3d.h"
+#include "scene/main/viewport.h"
+
+void WorldStreamer3D::_instantiate_cell(Cell *p_cell) {
+	// Nodes outside of the tree can be built from any thread, so only adding them is left for the main thread.
+	p_cell->instance = p_cell->scene->instantiate();
+}
+
+bool WorldStreamer3D::_get_observer_position(Vector3 &r_position) const {
+	const Node3D *observer_node = nullptr;
+	if (!observer.is_empty()) {
+		observer_node = Object::cast_to<Node3D>(get_node_or_null(observer));
+	} else if (get_viewport()) {
+		observer_node = get_viewport()->get_camera_3d();
+	}
+	if (!observer_node || !observer_node->is_inside_tree()) {
+		return false;
+	}
+
+	// Cells are laid out in the local space of the streamer.
+	r_position = get_global_transform().affine_inverse().xform(observer_node->get_global_position());
+	return true;
+}
+
+void WorldStreamer3D::_update_wanted_cells(const Vector3 &p_observer_position) {
+	real_t load_radius_sq = load_radius * load_radius;
+	real_t unload_radius_sq = (load_radius + unload_margin) * (load_radius + unload_margin);
+
+	for (KeyValue<Vector3i, Cell> &E : cells) {
+		Vector3 center = (Vector3(E.key) + Vector3(0.5, 0.5, 0.5)) * cell_size;
+		real_t distance_sq = center.distance_squared_to(p_observer_position);
+		if (distance_sq <= load_radius_sq) {
+			E.value.wanted = true;
+		} else if (distance_sq > unload_radius_sq) {
+			// Cells between both radii keep their current state, so moving along a border doesn't thrash them.
+			E.value.wanted = false;
+		}
+	}
+}
+
+void WorldStreamer3D::_process_cell(const Vector3i &p_coords, Cell &p_cell) {
+	switch (p_cell.state) {
+		case CELL_UNLOADED: {
+			if (p_cell.wanted) {
+				if (ResourceLoader::load_threaded_request(p_cell.scene_path, "PackedScene", use_sub_threads) == OK) {
+					p_cell.state = CELL_LOADING;
+				} else {
+					ERR_PRINT(vformat("Can't start loading the scene of cell %s: '%s'.", p_coords, p_cell.scene_path));
+					p_cell.state = CELL_FAILED;
+				}
+			}
+		} break;
+		case CELL_LOADING: {
+			ResourceLoader::ThreadLoadStatus status = ResourceLoader::load_threaded_get_status(p_cell.scene_path);
+			if (status == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+				break;
+			}
+			// Always fetch the result, to release the load request.
+			p_cell.scene = ResourceLoader::load_threaded_get(p_cell.scene_path);
+			if (p_cell.scene.is_null()) {
+				ERR_PRINT(vformat("Failed loading the scene of cell %s: '%s'.", p_coords, p_cell.scene_path));
+				p_cell.state = CELL_FAILED;
+			} else if (!p_cell.wanted) {
+				p_cell.scene.unref();
+				p_cell.state = CELL_UNLOADED;
+			} else {
+				p_cell.state = CELL_INSTANTIATING;
+				p_cell.task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &WorldStreamer3D::_instantiate_cell, &p_cell, false, SNAME("WorldStreamer3DInstantiateCell"));
+			}
+		} break;
+		case CELL_INSTANTIATING: {
+			if (!WorkerThreadPool::get_singleton()->is_task_completed(p_cell.task_id)) {
+				break;
+			}
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(p_cell.task_id);
+			p_cell.task_id = WorkerThreadPool::INVALID_TASK_ID;
+			p_cell.scene.unref();
+			if (!p_cell.instance) {
+				ERR_PRINT(vformat("Failed instantiating the scene of cell %s: '%s'.", p_coords, p_cell.scene_path));
+				p_cell.state = CELL_FAILED;
+			} else if (!p_cell.wanted) {
+				memdelete(p_cell.instance);
+				p_cell.instance = nullptr;
+				p_cell.state = CELL_UNLOADED;
+			} else {
+				p_cell.state = CELL_READY;
+				ready_queue.push_back(p_coords);
+			}
+		} break;
+		case CELL_READY:
+		case CELL_ADDED: {
+			if (!p_cell.wanted) {
+				_release_cell(p_coords, p_cell, false);
+			}
+		} break;
+		case CELL_FAILED: {
+		} break;
+	}
+}
+
+void WorldStreamer3D::_release_cell(const Vector3i &p_coords, Cell &p_cell, bool p_block) {
+	switch (p_cell.state) {
+		case CELL_LOADING: {
+			if (p_block) {
+				ResourceLoader::load_threaded_get(p_cell.scene_path);
+				p_cell.state = CELL_UNLOADED;
+			}
+		} break;
+		case CELL_INSTANTIATING: {
+			if (p_block) {
+				WorkerThreadPool::get_singleton()->wait_for_task_completion(p_cell.task_id);
+				p_cell.task_id = WorkerThreadPool::INVALID_TASK_ID;
+				p_cell.scene.unref();
+				if (p_cell.instance) {
+					memdelete(p_cell.instance);
+					p_cell.instance = nullptr;
+				}
+				p_cell.state = CELL_UNLOADED;
+			}
+		} break;
+		case CELL_READY: {
+			int64_t idx = ready_queue.find(p_coords);
+			if (idx != -1) {
+				ready_queue.remove_at(idx);
+			}
+			memdelete(p_cell.instance);
+			p_cell.instance = nullptr;
+			p_cell.state = CELL_UNLOADED;
+		} break;
+		case CELL_ADDED: {
+			// The instance may have been freed already, by the user or along with this node's children.
+			Node *instance = Object::cast_to<Node>(ObjectDB::get_instance(p_cell.instance_id));
+			p_cell.instance = nullptr;
+			p_cell.instance_id = ObjectID();
+			p_cell.state = CELL_UNLOADED;
+			if (instance) {
+				if (instance->get_parent() == this) {
+					remove_child(instance);
+				}
+				instance->queue_free();
+				emit_signal(SNAME("cell_unloaded"), p_coords);
+			}
+		} break;
+		default: {
+		} break;
+	}
+}
+
+void WorldStreamer3D::_release_all_cells() {
+	for (KeyValue<Vector3i, Cell> &E : cells) {
+		_release_cell(E.key, E.value, true);
+	}
+	ready_queue.clear();
+	observer_cell_valid = false;
+}
+
+void WorldStreamer3D::_process_streaming() {
+	Vector3 observer_position;
+	if (_get_observer_position(observer_position)) {
+		Vector3i cell = get_cell_at_position(observer_position);
+		if (!observer_cell_valid || cell != observer_cell) {
+			observer_cell = cell;
+			observer_cell_valid = true;
+			_update_wanted_cells(observer_position);
+		}
+	}
+
+	for (KeyValue<Vector3i, Cell> &E : cells) {
+		if (E.value.state != CELL_UNLOADED || E.value.wanted) {
+			_process_cell(E.key, E.value);
+		}
+	}
+
+	// Entering the tree and running _ready() are the only steps left on the main thread,
+	// so spread them over several frames to avoid hitches when many cells finish at once.
+	int added = 0;
+	while (!ready_queue.is_empty() && added < max_cells_added_per_frame) {
+		Vector3i coords = ready_queue[0];
+		ready_queue.remove_at(0);
+		Cell *cell = cells.getptr(coords);
+		if (!cell || cell->state != CELL_READY) {
+			continue;
+		}
+		add_child(cell->instance);
+		cell->instance_id = cell->instance->get_instance_id();
+		cell->state = CELL_ADDED;
+		added++;
+		emit_signal(SNAME("cell_loaded"), coords, cell->instance);
+	}
+}
+
+void WorldStreamer3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE: {
+			if (!Engine::get_singleton()->is_editor_hint()) {
+				set_process_internal(true);
+			}
+		} break;
+
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			_process_streaming();
+		} break;
+
+		case NOTIFICATION_EXIT_TREE: {
+			set_process_internal(false);
+		} break;
+	}
+}
+
+void WorldStreamer3D::set_cells(const Dictionary &p_cells) {
+	_release_all_cells();
+	cells.clear();
+
+	Array keys = p_cells.keys();
+	for (int i = 0; i < keys.size(); i++) {
+		ERR_CONTINUE_MSG(keys[i].get_type() != Variant::VECTOR3I, "Cell keys must be Vector3i coordinates.");
+		Cell cell;
+		cell.scene_path = p_cells[keys[i]];
+		cells.insert(keys[i], cell);
+	}
+}
+
+Dictionary WorldStreamer3D::get_cells() const {
+	Dictionary ret;
+	for (const KeyValue<Vector3i, Cell> &E : cells) {
+		ret[E.key] = E.value.scene_path;
+	}
+	return ret;
+}
+
+void WorldStreamer3D::set_cell_size(real_t p_size) {
+	ERR_FAIL_COND(p_size <= 0);
+	cell_size = p_size;
+	observer_cell_valid = false;
+}
+
+real_t WorldStreamer3D::get_cell_size() const {
+	return cell_size;
+}
+
+void WorldStreamer3D::set_load_radius(real_t p_radius) {
+	load_radius = MAX(p_radius, 0);
+	observer_cell_valid = false;
+}
+
+real_t WorldStreamer3D::get_load_radius() const {
+	return load_radius;
+}
+
+void WorldStreamer3D::set_unload_margin(real_t p_margin) {
+	unload_margin = MAX(p_margin, 0);
+	observer_cell_valid = false;
+}
+
+real_t WorldStreamer3D::get_unload_margin() const {
+	return unload_margin;
+}
+
+void WorldStreamer3D::set_observer(const NodePath &p_observer) {
+	observer = p_observer;
+	observer_cell_valid = false;
+}
+
+NodePath WorldStreamer3D::get_observer() const {
+	return observer;
+}
+
+void WorldStreamer3D::set_max_cells_added_per_frame(int p_count) {
+	max_cells_added_per_frame = MAX(p_count, 1);
+}
+
+int WorldStreamer3D::get_max_cells_added_per_frame() const {
+	return max_cells_added_per_frame;
+}
+
+void WorldStreamer3D::set_use_sub_threads(bool p_enable) {
+	use_sub_threads = p_enable;
+}
+
+bool WorldStreamer3D::is_using_sub_threads() const {
+	return use_sub_threads;
+}
+
+Vector3i WorldStreamer3D::get_cell_at_position(const Vector3 &p_position) const {
+	return Vector3i((p_position / cell_size).floor());
+}
+
+bool WorldStreamer3D::is_cell_loaded(const Vector3i &p_coords) const {
+	const Cell *cell = cells.getptr(p_coords);
+	return cell && cell->state == CELL_ADDED;
+}
+
+Node *WorldStreamer3D::get_cell_instance(const Vector3i &p_coords) const {
+	const Cell *cell = cells.getptr(p_coords);
+	if (!cell || cell->state != CELL_ADDED) {
+		return nullptr;
+	}
+	return Object::cast_to<Node>(ObjectDB::get_instance(cell->instance_id));
+}
+
+void WorldStreamer3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_cells", "cells"), &WorldStreamer3D::set_cells);
+	ClassDB::bind_method(D_METHOD("get_cells"), &WorldStreamer3D::get_cells);
+	ClassDB::bind_method(D_METHOD("set_cell_size", "size"), &WorldStreamer3D::set_cell_size);
+	ClassDB::bind_method(D_METHOD("get_cell_size"), &WorldStreamer3D::get_cell_size);
+	ClassDB::bind_method(D_METHOD("set_load_radius", "radius"), &WorldStreamer3D::set_load_radius);
+	ClassDB::bind_method(D_METHOD("get_load_radius"), &WorldStreamer3D::get_load_radius);
+	ClassDB::bind_method(D_METHOD("set_unload_margin", "margin"), &WorldStreamer3D::set_unload_margin);
+	ClassDB::bind_method(D_METHOD("get_unload_margin"), &WorldStreamer3D::get_unload_margin);
+	ClassDB::bind_method(D_METHOD("set_observer", "observer"), &WorldStreamer3D::set_observer);
+	ClassDB::bind_method(D_METHOD("get_observer"), &WorldStreamer3D::get_observer);
+	ClassDB::bind_method(D_METHOD("set_max_cells_added_per_frame", "count"), &WorldStreamer3D::set_max_cells_added_per_frame);
+	ClassDB::bind_method(D_METHOD("get_max_cells_added_per_frame"), &WorldStreamer3D::get_max_cells_added_per_frame);
+	ClassDB::bind_method(D_METHOD("set_use_sub_threads", "enable"), &WorldStreamer3D::set_use_sub_threads);
+	ClassDB::bind_method(D_METHOD("is_using_sub_threads"), &WorldStreamer3D::is_using_sub_threads);
+
+	ClassDB::bind_method(D_METHOD("get_cell_at_position", "position"), &WorldStreamer3D::get_cell_at_position);
+	ClassDB::bind_method(D_METHOD("is_cell_loaded", "coords"), &WorldStreamer3D::is_cell_loaded);
+	ClassDB::bind_method(D_METHOD("get_cell_instance", "coords"), &WorldStreamer3D::get_cell_instance);
+
+	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "cells"), "set_cells", "get_cells");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_size", PROPERTY_HINT_RANGE, "0.01,1024,0.01,or_greater,suffix:m"), "set_cell_size", "get_cell_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "load_radius", PROPERTY_HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_load_radius", "get_load_radius");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "unload_margin", PROPERTY_HINT_RANGE, "0,1024,0.01,or_greater,suffix:m"), "set_unload_margin", "get_unload_margin");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "observer", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "Node3D"), "set_observer", "get_observer");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_cells_added_per_frame", PROPERTY_HINT_RANGE, "1,64,1,or_greater"), "set_max_cells_added_per_frame", "get_max_cells_added_per_frame");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_sub_threads"), "set_use_sub_threads", "is_using_sub_threads");
+
+	ADD_SIGNAL(MethodInfo("cell_loaded", PropertyInfo(Variant::VECTOR3I, "coords"), PropertyInfo(Variant::OBJECT, "instance", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
+	ADD_SIGNAL(MethodInfo("cell_unloaded", PropertyInfo(Variant::VECTOR3I, "coords")));
+}
+
+WorldStreamer3D::~WorldStreamer3D() {
+	_release_all_cells();
+}
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  world_streamer_3d.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef WORLD_STREAMER_3D_H
+#define WORLD_STREAMER_3D_H
+
+#include "core/object/worker_thread_pool.h"
+#include "scene/3d/node_3d.h"
+#include "scene/resources/packed_scene.h"
+
+class WorldStreamer3D : public Node3D {
+	GDCLASS(WorldStreamer3D, Node3D);
+
+	enum CellState {
+		CELL_UNLOADED,
+		CELL_LOADING, // Threaded resource load in progress.
+		CELL_INSTANTIATING, // PackedScene being instantiated on a worker thread.
+		CELL_READY, // Instantiated, waiting for its turn to be added to the tree.
+		CELL_ADDED,
+		CELL_FAILED,
+	};
+
+	struct Cell {
+		String scene_path;
+		CellState state = CELL_UNLOADED;
+		bool wanted = false;
+		Ref<PackedScene> scene;
+		Node *instance = nullptr; // Only owned until added, then tracked through instance_id.
+		ObjectID instance_id;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	HashMap<Vector3i, Cell> cells;
+	LocalVector<Vector3i> ready_queue;
+
+	real_t cell_size = 64.0;
+	real_t load_radius = 128.0;
+	real_t unload_margin = 32.0;
+	NodePath observer;
+	int max_cells_added_per_frame = 1;
+	bool use_sub_threads = false;
+
+	bool observer_cell_valid = false;
+	Vector3i observer_cell;
+
+	void _instantiate_cell(Cell *p_cell);
+
+	bool _get_observer_position(Vector3 &r_position) const;
+	void _update_wanted_cells(const Vector3 &p_observer_position);
+	void _process_cell(const Vector3i &p_coords, Cell &p_cell);
+	void _release_cell(const Vector3i &p_coords, Cell &p_cell, bool p_block);
+	void _release_all_cells();
+	void _process_streaming();
+
+protected:
+	void _notification(int p_what);
+	static void _bind_methods();
+
+public:
+	void set_cells(const Dictionary &p_cells);
+	Dictionary get_cells() const;
+
+	void set_cell_size(real_t p_size);
+	real_t get_cell_size() const;
+
+	void set_load_radius(real_t p_radius);
+	real_t get_load_radius() const;
+
+	void set_unload_margin(real_t p_margin);
+	real_t get_unload_margin() const;
+
+	void set_observer(const NodePath &p_observer);
+	NodePath get_observer() const;
+
+	void set_max_cells_added_per_frame(int p_count);
+	int get_max_cells_added_per_frame() const;
+
+	void set_use_sub_threads(bool p_enable);
+	bool is_using_sub_threads() const;
+
+	Vector3i get_cell_at_position(const Vector3 &p_position) const;
+	bool is_cell_loaded(const Vector3i &p_coords) const;
+	Node *get_cell_instance(const Vector3i &p_coords) const;
+
+	WorldStreamer3D() {}
+	~WorldStreamer3D();
+};
+
+#endif // WORLD_STREAMER_3D_H
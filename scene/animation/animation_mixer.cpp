@@ -31,7 +31,11 @@
 #include "animation_mixer.h"
 
 #include "core/config/engine.h"
+#include "core/object/worker_thread_pool.h"
+#include "scene/3d/camera_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
@@ -461,6 +465,97 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_parallel_processing(bool p_enabled) {
+	parallel_processing = p_enabled;
+	if (!parallel_processing) {
+		_finish_parallel_process();
+	}
+}
+
+bool AnimationMixer::is_parallel_processing() const {
+	return parallel_processing;
+}
+
+/* -------------------------------------------- */
+/* -- Level of detail ------------------------- */
+/* -------------------------------------------- */
+
+void AnimationMixer::set_lod_distance(real_t p_distance) {
+	lod_distance = MAX(p_distance, 0.0);
+}
+
+real_t AnimationMixer::get_lod_distance() const {
+	return lod_distance;
+}
+
+void AnimationMixer::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+}
+
+NodePath AnimationMixer::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+void AnimationMixer::set_lod_update_interval(int p_interval) {
+	lod_update_interval = MAX(p_interval, 1);
+}
+
+int AnimationMixer::get_lod_update_interval() const {
+	return lod_update_interval;
+}
+
+void AnimationMixer::set_lod_skip_secondary_tracks(bool p_skip) {
+	lod_skip_secondary_tracks = p_skip;
+}
+
+bool AnimationMixer::is_skipping_lod_secondary_tracks() const {
+	return lod_skip_secondary_tracks;
+}
+
+bool AnimationMixer::is_lod_active() const {
+	return lod_active;
+}
+
+bool AnimationMixer::_is_lod_needed() const {
+#ifndef _3D_DISABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+	if (!lod_visibility_notifier.is_empty()) {
+		const VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(get_node_or_null(lod_visibility_notifier));
+		if (notifier && !notifier->is_on_screen()) {
+			return true;
+		}
+	}
+	if (lod_distance > 0.0) {
+		const Node3D *root = Object::cast_to<Node3D>(get_node_or_null(root_node));
+		const Camera3D *camera = get_viewport() ? get_viewport()->get_camera_3d() : nullptr;
+		if (root && camera && root->get_global_position().distance_squared_to(camera->get_global_position()) > lod_distance * lod_distance) {
+			return true;
+		}
+	}
+#endif // _3D_DISABLED
+	return false;
+}
+
+bool AnimationMixer::_lod_process_step(double &r_delta) {
+	lod_active = _is_lod_needed();
+	// Delta is accumulated while frames are skipped, so playback and blend state stay in sync.
+	lod_pending_delta += r_delta;
+	if (lod_active && ++lod_frames_skipped < lod_update_interval) {
+		// The next update reports the root motion of all the skipped frames at once, so report none until then
+		// instead of the last update's motion, which scripts applying it every frame would apply again.
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		return false;
+	}
+	r_delta = lod_pending_delta;
+	lod_pending_delta = 0.0;
+	lod_frames_skipped = 0;
+	return true;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -607,6 +702,9 @@ bool AnimationMixer::_update_caches() {
 		for (int i = 0; i < anim->get_track_count(); i++) {
 			NodePath path = anim->track_get_path(i);
 			Animation::TrackType track_type = anim->track_get_type(i);
+			if ((track_type == Animation::TYPE_BLEND_SHAPE || track_type == Animation::TYPE_AUDIO) && Engine::get_singleton()->is_server_profile_enabled()) {
+				continue; // Only affects rendering/audio output, which the server profile skips.
+			}
 
 			Animation::TrackType track_cache_type = track_type;
 			if (track_cache_type == Animation::TYPE_POSITION_3D || track_cache_type == Animation::TYPE_ROTATION_3D || track_cache_type == Animation::TYPE_SCALE_3D) {
@@ -939,6 +1037,7 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	_finish_parallel_process();
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
 		if (!deterministic) {
@@ -951,6 +1050,80 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+bool AnimationMixer::_can_process_in_parallel() const {
+	if (!parallel_processing || !Thread::is_main_thread()) {
+		return false;
+	}
+	// Root motion is read right after processing, and script overrides can't be assumed thread-safe.
+	return root_motion_track.is_empty() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_process_animation_parallel(double p_delta) {
+	_finish_parallel_process();
+	// Playback and blend tree evaluation may call scripts and emit signals, so they stay on the main thread.
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	if (!deterministic) {
+		_blend_calc_total_weight();
+	}
+	_blend_process(p_delta, false, BLEND_PASS_EFFECTS);
+	parallel_delta = p_delta;
+	parallel_queue.add(&parallel_element);
+}
+
+void AnimationMixer::_finish_parallel_process() {
+	if (!parallel_element.in_list()) {
+		return;
+	}
+	parallel_queue.remove(&parallel_element);
+	_blend_process(parallel_delta, false, BLEND_PASS_SAMPLE);
+	_blend_apply();
+	_blend_post_process();
+	clear_animation_instances();
+}
+
+void AnimationMixer::_cancel_parallel_process() {
+	if (!parallel_element.in_list()) {
+		return;
+	}
+	parallel_queue.remove(&parallel_element);
+	clear_animation_instances();
+}
+
+void AnimationMixer::_parallel_sample_task(void *p_mixers, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_mixers)[p_index];
+	mixer->_blend_process(mixer->parallel_delta, false, BLEND_PASS_SAMPLE);
+}
+
+void AnimationMixer::flush_parallel_processing() {
+	if (!parallel_queue.first()) {
+		return;
+	}
+	if (!parallel_queue.first()->next()) {
+		parallel_queue.first()->self()->_finish_parallel_process();
+		return;
+	}
+
+	LocalVector<AnimationMixer *> mixers;
+	while (parallel_queue.first()) {
+		mixers.push_back(parallel_queue.first()->self());
+		parallel_queue.remove(parallel_queue.first());
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_parallel_sample_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerSample"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	// Writing to nodes and properties must happen on the main thread.
+	for (AnimationMixer *mixer : mixers) {
+		mixer->_blend_apply();
+		mixer->_blend_post_process();
+		mixer->clear_animation_instances();
+	}
+}
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, const Object *p_object, int p_object_idx) {
 	Variant res;
 	if (GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, const_cast<Object *>(p_object), p_object_idx, res)) {
@@ -1069,7 +1242,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendPass p_pass) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1114,6 +1287,15 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				// Broken animation, but avoid error spamming.
 				continue;
 			}
+			if (lod_active && lod_skip_secondary_tracks && (ttype == Animation::TYPE_METHOD || ttype == Animation::TYPE_AUDIO || ttype == Animation::TYPE_BEZIER)) {
+				continue;
+			}
+			if (p_pass != BLEND_PASS_ALL) {
+				bool sampled = ttype != Animation::TYPE_METHOD && ttype != Animation::TYPE_AUDIO && ttype != Animation::TYPE_ANIMATION && (ttype != Animation::TYPE_VALUE || static_cast<TrackCacheValue *>(track)->is_continuous);
+				if (sampled != (p_pass == BLEND_PASS_SAMPLE)) {
+					continue;
+				}
+			}
 			track->root_motion = root_motion_track == path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1662,14 +1844,18 @@ void AnimationMixer::_blend_apply() {
 					root_motion_rotation_accumulator = t->rot;
 					root_motion_scale_accumulator = t->scale;
 				} else if (t->skeleton && t->bone_idx >= 0) {
-					if (t->loc_used) {
-						t->skeleton->set_bone_pose_position(t->bone_idx, t->loc);
-					}
-					if (t->rot_used) {
-						t->skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-					}
-					if (t->scale_used) {
-						t->skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
+					if (t->loc_used && t->rot_used && t->scale_used) {
+						t->skeleton->set_bone_pose_components(t->bone_idx, t->loc, t->rot, t->scale);
+					} else {
+						if (t->loc_used) {
+							t->skeleton->set_bone_pose_position(t->bone_idx, t->loc);
+						}
+						if (t->rot_used) {
+							t->skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
+						}
+						if (t->scale_used) {
+							t->skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
+						}
 					}
 
 				} else if (!t->skeleton) {
@@ -2027,18 +2213,26 @@ void AnimationMixer::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+			double delta = get_process_delta_time();
+			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE && _lod_process_step(delta)) {
+				if (_can_process_in_parallel()) {
+					_process_animation_parallel(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+			double delta = get_physics_process_delta_time();
+			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS && _lod_process_step(delta)) {
+				// Parallel results are only applied at the end of the idle frame, too late for physics.
+				_process_animation(delta);
 			}
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			_cancel_parallel_process();
 			_clear_caches();
 		} break;
 	}
@@ -2064,6 +2258,19 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
 
+	ClassDB::bind_method(D_METHOD("set_parallel_processing", "enabled"), &AnimationMixer::set_parallel_processing);
+	ClassDB::bind_method(D_METHOD("is_parallel_processing"), &AnimationMixer::is_parallel_processing);
+
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationMixer::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationMixer::get_lod_distance);
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationMixer::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationMixer::get_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("set_lod_update_interval", "interval"), &AnimationMixer::set_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval"), &AnimationMixer::get_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_skip_secondary_tracks", "skip"), &AnimationMixer::set_lod_skip_secondary_tracks);
+	ClassDB::bind_method(D_METHOD("is_skipping_lod_secondary_tracks"), &AnimationMixer::is_skipping_lod_secondary_tracks);
+	ClassDB::bind_method(D_METHOD("is_lod_active"), &AnimationMixer::is_lod_active);
+
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
@@ -2094,6 +2301,7 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "parallel_processing"), "set_parallel_processing", "is_parallel_processing");
 
 	ClassDB::bind_method(D_METHOD("set_reset_on_save_enabled", "enabled"), &AnimationMixer::set_reset_on_save_enabled);
 	ClassDB::bind_method(D_METHOD("is_reset_on_save_enabled"), &AnimationMixer::is_reset_on_save_enabled);
@@ -2105,6 +2313,12 @@ void AnimationMixer::_bind_methods() {
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibleOnScreenNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_update_interval", PROPERTY_HINT_RANGE, "1,60,1"), "set_lod_update_interval", "get_lod_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_skip_secondary_tracks"), "set_lod_skip_secondary_tracks", "is_skipping_lod_secondary_tracks");
+
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
@@ -2126,7 +2340,10 @@ void AnimationMixer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo(SNAME("caches_cleared")));
 }
 
-AnimationMixer::AnimationMixer() {
+SelfList<AnimationMixer>::List AnimationMixer::parallel_queue;
+
+AnimationMixer::AnimationMixer() :
+		parallel_element(this) {
 	root_node = SceneStringNames::get_singleton()->path_pp;
 }
 
@@ -128,6 +128,19 @@ protected:
 
 	bool processing = false;
 	bool active = true;
+	bool parallel_processing = false;
+
+	/* ---- Level of detail ---- */
+	real_t lod_distance = 0.0;
+	NodePath lod_visibility_notifier;
+	int lod_update_interval = 4;
+	bool lod_skip_secondary_tracks = false;
+	bool lod_active = false;
+	int lod_frames_skipped = 0;
+	double lod_pending_delta = 0.0;
+
+	bool _is_lod_needed() const;
+	bool _lod_process_step(double &r_delta);
 
 	void _set_process(bool p_process, bool p_force = false);
 
@@ -285,14 +298,33 @@ protected:
 	Variant post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, const Object *p_object, int p_object_idx = -1);
 	GDVIRTUAL5RC(Variant, _post_process_key_value, Ref<Animation>, int, Variant, Object *, int);
 
+	enum BlendPass {
+		BLEND_PASS_ALL,
+		BLEND_PASS_SAMPLE, // Interpolated tracks which only write to the track caches.
+		BLEND_PASS_EFFECTS, // Tracks which touch other objects (discrete values, methods, audio, animations).
+	};
+
 	void _blend_init();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const HashMap<NodePath, int> &p_track_map);
 	void _blend_calc_total_weight(); // For undeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	void _blend_process(double p_delta, bool p_update_only = false, BlendPass p_pass = BLEND_PASS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
 	void _call_object(Object *p_object, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
+	/* ---- Parallel processing ---- */
+	// Mixers queued here have their blend trees evaluated, and only wait for the sampling of
+	// interpolated tracks, which runs on the WorkerThreadPool for all of them at once.
+	static SelfList<AnimationMixer>::List parallel_queue;
+	SelfList<AnimationMixer> parallel_element;
+	double parallel_delta = 0.0;
+
+	bool _can_process_in_parallel() const;
+	void _process_animation_parallel(double p_delta);
+	void _finish_parallel_process();
+	void _cancel_parallel_process();
+	static void _parallel_sample_task(void *p_mixers, uint32_t p_index);
+
 public:
 	/* ---- Data lists ---- */
 	Dictionary *get_animation_libraries();
@@ -317,6 +349,24 @@ public:
 	void set_deterministic(bool p_deterministic);
 	bool is_deterministic() const;
 
+	void set_parallel_processing(bool p_enabled);
+	bool is_parallel_processing() const;
+
+	/* ---- Level of detail ---- */
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+
+	void set_lod_update_interval(int p_interval);
+	int get_lod_update_interval() const;
+
+	void set_lod_skip_secondary_tracks(bool p_skip);
+	bool is_skipping_lod_secondary_tracks() const;
+
+	bool is_lod_active() const;
+
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
@@ -350,6 +400,8 @@ public:
 	void set_reset_on_save_enabled(bool p_enabled);
 	bool is_reset_on_save_enabled() const;
 
+	static void flush_parallel_processing();
+
 #ifdef TOOLS_ENABLED
 	void set_editing(bool p_editing);
 	bool is_editing() const;
@@ -82,7 +82,24 @@ void Container::remove_child_notify(Node *p_child) {
 }
 
 void Container::_sort_children() {
-	if (!is_inside_tree()) {
+	if (!is_inside_tree() || !pending_sort) {
+		return; // Already sorted, e.g. by a descendant sorting its ancestors first.
+	}
+
+	// Sort ancestor containers first, as they may resize this one and would otherwise force a second sort of the whole subtree.
+	for (Control *parent = get_parent_control(); parent; parent = parent->get_parent_control()) {
+		Container *parent_container = Object::cast_to<Container>(parent);
+		if (parent_container && parent_container->pending_sort) {
+			parent_container->_sort_children();
+			break;
+		}
+		if (parent->is_set_as_top_level()) {
+			break;
+		}
+	}
+
+	// The ancestor's sort callbacks may have removed this container from the tree, or sorted it already.
+	if (!is_inside_tree() || !pending_sort) {
 		return;
 	}
 
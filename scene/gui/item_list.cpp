@@ -1481,18 +1481,54 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 		pos.x = get_size().width - pos.x;
 	}
 
+	// Items are laid out in rows of increasing height, do a binary search to find the first item whose rect reaches below pos.y.
+	int first_row_item;
+	{
+		int lo = 0;
+		int hi = items.size();
+		while (lo < hi) {
+			const int mid = (lo + hi) / 2;
+			const Rect2 &rcache = items[mid].rect_cache;
+			if (rcache.position.y + rcache.size.y < pos.y) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		// Start from the first column of the previous row, which may hold the closest item.
+		if (lo > 0) {
+			lo -= 1;
+		}
+		while (lo > 0 && items[lo].column > 0) {
+			lo -= 1;
+		}
+		first_row_item = lo;
+	}
+
 	int closest = -1;
-	int closest_dist = 0x7FFFFFFF;
+	float closest_dist = 1e20;
 
-	for (int i = 0; i < items.size(); i++) {
-		Rect2 rc = items[i].rect_cache;
-		if (i % current_columns == current_columns - 1) {
-			rc.size.width = get_size().width - rc.position.x; // Make sure you can still select the last item when clicking past the column.
+	// Items above the found row can only be closer than the best candidate if they are vertically closer to it.
+	for (int i = first_row_item - 1; !p_exact && i >= 0; i--) {
+		const Rect2 &rc = items[i].rect_cache;
+		if (pos.y - (rc.position.y + rc.size.y) > closest_dist) {
+			break;
 		}
+		float dist = _get_item_rect_for_position(i).distance_to(pos);
+		if (dist <= closest_dist) {
+			closest = i;
+			closest_dist = dist;
+		}
+	}
 
+	for (int i = first_row_item; i < items.size(); i++) {
+		if (items[i].rect_cache.position.y - pos.y > (p_exact ? 0 : closest_dist)) {
+			break; // All the remaining items are further down.
+		}
+
+		Rect2 rc = _get_item_rect_for_position(i);
 		if (rc.has_point(pos)) {
-			closest = i;
-			break;
+			return i;
 		}
 
 		float dist = rc.distance_to(pos);
@@ -1505,6 +1541,14 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 	return closest;
 }
 
+Rect2 ItemList::_get_item_rect_for_position(int p_idx) const {
+	Rect2 rc = items[p_idx].rect_cache;
+	if (p_idx % current_columns == current_columns - 1) {
+		rc.size.width = get_size().width - rc.position.x; // Make sure you can still select the last item when clicking past the column.
+	}
+	return rc;
+}
+
 bool ItemList::is_pos_at_end_of_items(const Point2 &p_pos) const {
 	if (items.is_empty()) {
 		return true;
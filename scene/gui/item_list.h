@@ -149,6 +149,7 @@ private:
 
 	void _scroll_changed(double);
 	void _shape_text(int p_idx);
+	Rect2 _get_item_rect_for_position(int p_idx) const;
 	void _mouse_exited();
 
 protected:
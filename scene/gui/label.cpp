@@ -312,7 +312,10 @@ inline void draw_glyph(const Glyph &p_gl, const RID &p_canvas, const Color &p_fo
 
 inline void draw_glyph_outline(const Glyph &p_gl, const RID &p_canvas, const Color &p_font_color, const Color &p_font_shadow_color, const Color &p_font_outline_color, const int &p_shadow_outline_size, const int &p_outline_size, const Vector2 &p_ofs, const Vector2 &shadow_ofs) {
 	if (p_gl.font_rid != RID()) {
-		if (p_font_shadow_color.a > 0) {
+		// MSDF outlines are drawn as the dilated glyph, so an opaque shadow outline covers the shadow fill underneath.
+		// Outlines of other fonts are stroked and hollow, they still need the fill.
+		bool shadow_fill_covered = p_font_shadow_color.a >= 1.0 && p_shadow_outline_size > 0 && TS->font_is_multichannel_signed_distance_field(p_gl.font_rid);
+		if (p_font_shadow_color.a > 0 && !shadow_fill_covered) {
 			TS->font_draw_glyph(p_gl.font_rid, p_canvas, p_gl.font_size, p_ofs + Vector2(p_gl.x_off, p_gl.y_off) + shadow_ofs, p_gl.index, p_font_shadow_color);
 		}
 		if (p_font_shadow_color.a > 0 && p_shadow_outline_size > 0) {
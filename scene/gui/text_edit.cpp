@@ -178,6 +178,10 @@ void TextEdit::Text::_calculate_max_line_width() {
 void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_changed, const String &p_ime_text, const Array &p_bidi_override) {
 	ERR_FAIL_INDEX(p_line, text.size());
 
+	if (text[p_line].data_buf.is_null()) {
+		text.write[p_line].data_buf.instantiate();
+	}
+
 	if (font.is_null()) {
 		return; // Not in tree?
 	}
@@ -346,11 +350,12 @@ void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector
 			set(p_at + i, p_text[i], p_bidi_override[i]);
 			continue;
 		}
-		Line line;
+		// Reset the slot in place, it may still reference a line that was shifted down.
+		Line &line = text.write[p_at + i];
+		line = Line();
 		line.gutters.resize(gutter_count);
 		line.data = p_text[i];
 		line.bidi_override = p_bidi_override[i];
-		text.write[p_at + i] = line;
 		invalidate_cache(p_at + i, -1, true);
 	}
 }
@@ -6517,10 +6522,6 @@ void TextEdit::_bind_methods() {
 	BIND_THEME_ITEM(Theme::DATA_TYPE_COLOR, TextEdit, background_color);
 	BIND_THEME_ITEM(Theme::DATA_TYPE_COLOR, TextEdit, current_line_color);
 	BIND_THEME_ITEM(Theme::DATA_TYPE_COLOR, TextEdit, word_highlighted_color);
-
-	/* Settings. */
-	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "gui/timers/text_edit_idle_detect_sec", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"), 3);
-	GLOBAL_DEF(PropertyInfo(Variant::INT, "gui/common/text_edit_undo_stack_max_size", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"), 1024);
 }
 
 /* Internal API for CodeEdit. */
@@ -149,16 +149,12 @@ private:
 
 			String data;
 			Array bidi_override;
-			Ref<TextParagraph> data_buf;
+			Ref<TextParagraph> data_buf; // Created by invalidate_cache(), so placeholder lines don't allocate shaped text.
 
 			Color background_color = Color(0, 0, 0, 0);
 			bool hidden = false;
 			int height = 0;
 			int width = 0;
-
-			Line() {
-				data_buf.instantiate();
-			}
 		};
 
 	private:
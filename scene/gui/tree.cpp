@@ -1785,6 +1785,9 @@ int Tree::get_item_height(TreeItem *p_item) const {
 	if (!p_item->is_visible()) {
 		return 0;
 	}
+	if (item_heights_cached && p_item->subtree_height_version == item_heights_version) {
+		return p_item->subtree_height_cache;
+	}
 	int height = compute_item_height(p_item);
 	height += theme_cache.v_separation;
 
@@ -1799,6 +1802,11 @@ int Tree::get_item_height(TreeItem *p_item) const {
 		}
 	}
 
+	if (item_heights_cached) {
+		p_item->subtree_height_cache = height;
+		p_item->subtree_height_version = item_heights_version;
+	}
+
 	return height;
 }
 
@@ -2409,7 +2417,14 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 			int child_h = -1;
 			int child_self_height = 0;
 			if (htotal >= 0) {
-				child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c, child_self_height);
+				int subtree_h = item_heights_cached ? get_item_height(c) : -1;
+				if (subtree_h >= 0 && children_pos.y + subtree_h - theme_cache.offset.y < 0) {
+					// The whole branch is above the visible area, skip it.
+					child_h = subtree_h;
+					child_self_height = c->is_visible() ? compute_item_height(c) : 0;
+				} else {
+					child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c, child_self_height);
+				}
 				child_self_height += theme_cache.v_separation;
 			}
 
@@ -4172,6 +4187,9 @@ void Tree::_notification(int p_what) {
 		case NOTIFICATION_DRAW: {
 			v_scroll->set_custom_step(theme_cache.font->get_height(theme_cache.font_size));
 
+			item_heights_version++;
+			item_heights_cached = true;
+
 			update_scrollbars();
 			RID ci = get_canvas_item();
 
@@ -4195,6 +4213,8 @@ void Tree::_notification(int p_what) {
 				draw_item(Point2(), draw_ofs, draw_size, root, self_height);
 			}
 
+			item_heights_cached = false;
+
 			if (show_column_titles) {
 				//title buttons
 				int ofs2 = theme_cache.panel_style->get_margin(SIDE_LEFT);
@@ -132,6 +132,10 @@ private:
 	bool disable_folding = false;
 	int custom_min_height = 0;
 
+	// Height of the item and its visible children, only valid during the draw matching subtree_height_version.
+	int subtree_height_cache = 0;
+	uint64_t subtree_height_version = 0;
+
 	TreeItem *parent = nullptr; // parent item
 	TreeItem *prev = nullptr; // previous in list
 	TreeItem *next = nullptr; // next in list
@@ -443,6 +447,10 @@ private:
 	bool hide_root = false;
 	SelectMode select_mode = SELECT_SINGLE;
 
+	// Subtree heights are cached for the duration of a draw, so offscreen branches can be skipped without walking them again.
+	uint64_t item_heights_version = 0;
+	bool item_heights_cached = false;
+
 	int blocked = 0;
 
 	int drop_mode_flags = 0;
@@ -32,10 +32,118 @@
 #include "core/io/compression.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::connection_pool_mutex;
+HashMap<String, List<HTTPRequest::PooledConnection>> HTTPRequest::connection_pool;
+int HTTPRequest::instance_count = 0;
+
 Error HTTPRequest::_request() {
+	if (reused_connection && client->get_status() == HTTPClient::STATUS_CONNECTED) {
+		return OK;
+	}
+	reused_connection = false;
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+String HTTPRequest::_get_connection_key() const {
+	String key = (use_tls ? "https://" : "http://") + url + ":" + itos(port);
+	if (use_tls) {
+		key += "|" + itos(tls_options->get_verify_mode()) + "|" + tls_options->get_common_name();
+		Ref<X509Certificate> cas = tls_options->get_trusted_ca_chain();
+		if (cas.is_valid()) {
+			key += "|" + itos(cas->get_instance_id());
+		}
+		key += "|" + https_proxy_host + ":" + itos(https_proxy_port);
+	} else {
+		key += "|" + http_proxy_host + ":" + itos(http_proxy_port);
+	}
+	return key;
+}
+
+bool HTTPRequest::_acquire_pooled_connection() {
+	const String key = _get_connection_key();
+	const uint64_t now = OS::get_singleton()->get_ticks_usec();
+
+	MutexLock lock(connection_pool_mutex);
+	HashMap<String, List<PooledConnection>>::Iterator E = connection_pool.find(key);
+	if (!E) {
+		return false;
+	}
+
+	bool acquired = false;
+	while (!acquired && !E->value.is_empty()) {
+		// Most recently used first, older ones are more likely to have been closed by the server.
+		PooledConnection pooled = E->value.back()->get();
+		E->value.pop_back();
+		if (now - pooled.idle_since > POOLED_CONNECTION_TIMEOUT_USEC) {
+			continue;
+		}
+
+		pooled.client->set_blocking_mode(false);
+		pooled.client->poll();
+		if (pooled.client->get_status() != HTTPClient::STATUS_CONNECTED) {
+			continue;
+		}
+
+		pooled.client->set_read_chunk_size(client->get_read_chunk_size());
+		client = pooled.client;
+		acquired = true;
+	}
+
+	if (E->value.is_empty()) {
+		connection_pool.remove(E);
+	}
+	return acquired;
+}
+
+void HTTPRequest::_release_connection_to_pool() {
+	PooledConnection pooled;
+	pooled.client = client;
+	pooled.idle_since = OS::get_singleton()->get_ticks_usec();
+
+	{
+		MutexLock lock(connection_pool_mutex);
+		List<PooledConnection> &pool = connection_pool[_get_connection_key()];
+		pool.push_back(pooled);
+		if (pool.size() > MAX_POOLED_CONNECTIONS_PER_HOST) {
+			pool.pop_front();
+		}
+	}
+
+	// The pooled client may be picked up by another node, continue with a new one.
+	client = Ref<HTTPClient>(HTTPClient::create());
+	client->set_read_chunk_size(pooled.client->get_read_chunk_size());
+	client->set_http_proxy(http_proxy_host, http_proxy_port);
+	client->set_https_proxy(https_proxy_host, https_proxy_port);
+}
+
+bool HTTPRequest::_is_connection_reusable() {
+	// Either side may ask to close the connection after this request.
+	return !get_header_value(response_headers, "Connection").to_lower().contains("close") && !get_header_value(headers, "Connection").to_lower().contains("close");
+}
+
+bool HTTPRequest::_retry_stale_connection() {
+	// The server may have closed a pooled connection while it was idle, try again once on a new one.
+	if (!reused_connection || got_response) {
+		return false;
+	}
+	// The server may still have processed the request, only send it again if that's harmless.
+	switch (method) {
+		case HTTPClient::METHOD_GET:
+		case HTTPClient::METHOD_HEAD:
+		case HTTPClient::METHOD_PUT:
+		case HTTPClient::METHOD_DELETE:
+		case HTTPClient::METHOD_OPTIONS:
+		case HTTPClient::METHOD_TRACE:
+			break;
+		default:
+			return false;
+	}
+	client->close();
+	reused_connection = false;
+	request_sent = false;
+	return _request() == OK;
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -47,6 +155,7 @@ Error HTTPRequest::_parse_url(const String &p_url) {
 	downloaded.set(0);
 	final_body_size.set(0);
 	redirections = 0;
+	reused_connection = false;
 
 	String scheme;
 	Error err = p_url.parse_url(scheme, url, port, request_string);
@@ -138,6 +247,10 @@ Error HTTPRequest::request_raw(const String &p_url, const Vector<String> &p_cust
 
 	request_data = p_request_data_raw;
 
+	if (keep_alive) {
+		reused_connection = _acquire_pooled_connection();
+	}
+
 	requesting = true;
 
 	if (use_threads.is_set()) {
@@ -180,6 +293,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_finish_request(false);
+}
+
+void HTTPRequest::_finish_request(bool p_reuse_connection) {
 	timer->stop();
 
 	if (!requesting) {
@@ -197,7 +314,12 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
-	client->close();
+	if (p_reuse_connection && keep_alive && client->get_status() == HTTPClient::STATUS_CONNECTED && _is_connection_reusable()) {
+		_release_connection_to_pool();
+	} else {
+		client->close();
+	}
+	reused_connection = false;
 	body.clear();
 	got_response = false;
 	response_code = -1;
@@ -288,6 +410,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_stale_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -340,6 +465,9 @@ bool HTTPRequest::_update_connection() {
 				int size = request_data.size();
 				Error err = client->request(method, request_string, headers, size > 0 ? request_data.ptr() : nullptr, size);
 				if (err != OK) {
+					if (_retry_stale_connection()) {
+						return false;
+					}
 					_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 					return true;
 				}
@@ -459,6 +587,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_stale_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -476,7 +607,7 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	_finish_request(p_status == RESULT_SUCCESS);
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
 }
@@ -569,13 +700,25 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
 	client->set_https_proxy(p_host, p_port);
 }
 
+void HTTPRequest::set_keep_alive(bool p_enable) {
+	keep_alive = p_enable;
+}
+
+bool HTTPRequest::is_keep_alive_enabled() const {
+	return keep_alive;
+}
+
 void HTTPRequest::set_timeout(double p_timeout) {
 	ERR_FAIL_COND(p_timeout < 0);
 	timeout = p_timeout;
@@ -632,10 +775,14 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_http_proxy", "host", "port"), &HTTPRequest::set_http_proxy);
 	ClassDB::bind_method(D_METHOD("set_https_proxy", "host", "port"), &HTTPRequest::set_https_proxy);
 
+	ClassDB::bind_method(D_METHOD("set_keep_alive", "enable"), &HTTPRequest::set_keep_alive);
+	ClassDB::bind_method(D_METHOD("is_keep_alive_enabled"), &HTTPRequest::is_keep_alive_enabled);
+
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "download_file", PROPERTY_HINT_FILE), "set_download_file", "get_download_file");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "keep_alive"), "set_keep_alive", "is_keep_alive_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "timeout", PROPERTY_HINT_RANGE, "0,3600,0.1,or_greater,suffix:s"), "set_timeout", "get_timeout");
@@ -665,4 +812,16 @@ HTTPRequest::HTTPRequest() {
 	timer->set_one_shot(true);
 	timer->connect("timeout", callable_mp(this, &HTTPRequest::_timeout));
 	add_child(timer);
+
+	MutexLock lock(connection_pool_mutex);
+	instance_count++;
+}
+
+HTTPRequest::~HTTPRequest() {
+	MutexLock lock(connection_pool_mutex);
+	instance_count--;
+	if (instance_count == 0) {
+		// Don't keep connections open once nothing can use them anymore.
+		connection_pool.clear();
+	}
 }
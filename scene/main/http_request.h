@@ -33,7 +33,10 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -75,6 +78,12 @@ private:
 
 	bool request_sent = false;
 	Ref<HTTPClient> client;
+	bool keep_alive = true;
+	bool reused_connection = false;
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
 	PackedByteArray body;
 	SafeFlag use_threads;
 	bool accept_gzip = true;
@@ -107,6 +116,25 @@ private:
 
 	Error _parse_url(const String &p_url);
 	Error _request();
+	void _finish_request(bool p_reuse_connection);
+
+	// Idle keep-alive connections, shared by all HTTPRequest nodes and keyed by host, port, TLS options and proxy.
+	struct PooledConnection {
+		Ref<HTTPClient> client;
+		uint64_t idle_since = 0;
+	};
+
+	static const int MAX_POOLED_CONNECTIONS_PER_HOST = 6;
+	static const uint64_t POOLED_CONNECTION_TIMEOUT_USEC = 15000000;
+	static Mutex connection_pool_mutex;
+	static HashMap<String, List<PooledConnection>> connection_pool;
+	static int instance_count;
+
+	String _get_connection_key() const;
+	bool _acquire_pooled_connection();
+	void _release_connection_to_pool();
+	bool _is_connection_reusable();
+	bool _retry_stale_connection();
 
 	bool has_header(const PackedStringArray &p_headers, const String &p_header_name);
 	String get_header_value(const PackedStringArray &p_headers, const String &header_name);
@@ -163,7 +191,11 @@ public:
 
 	void set_tls_options(const Ref<TLSOptions> &p_options);
 
+	void set_keep_alive(bool p_enable);
+	bool is_keep_alive_enabled() const;
+
 	HTTPRequest();
+	~HTTPRequest();
 };
 
 VARIANT_ENUM_CAST(HTTPRequest::Result);
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/input/input.h"
 #include "core/io/dir_access.h"
 #include "core/io/image_loader.h"
@@ -74,15 +75,44 @@ void SceneTreeTimer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("timeout"));
 }
 
+uint32_t SceneTreeTimer::_get_clock() const {
+	uint32_t clock = 0;
+	if (process_in_physics) {
+		clock |= SceneTree::TIMER_CLOCK_PHYSICS;
+	}
+	if (ignore_time_scale) {
+		clock |= SceneTree::TIMER_CLOCK_IGNORE_TIME_SCALE;
+	}
+	if (process_always) {
+		clock |= SceneTree::TIMER_CLOCK_PROCESS_ALWAYS;
+	}
+	return clock;
+}
+
+double SceneTreeTimer::_get_scheduled_time_left() const {
+	return deadline - SceneTree::get_singleton()->timer_clocks[_get_clock()];
+}
+
 void SceneTreeTimer::set_time_left(double p_time) {
-	time_left = p_time;
+	if (scheduled) {
+		SceneTree::get_singleton()->_schedule_timer(this, p_time);
+	} else {
+		time_left = p_time;
+	}
 }
 
 double SceneTreeTimer::get_time_left() const {
-	return MAX(time_left, 0.0);
+	return MAX(scheduled ? _get_scheduled_time_left() : time_left, 0.0);
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
+	if (scheduled && process_always != p_process_always) {
+		// Moves to another clock, keep the time left.
+		double left = _get_scheduled_time_left();
+		process_always = p_process_always;
+		SceneTree::get_singleton()->_schedule_timer(this, left);
+		return;
+	}
 	process_always = p_process_always;
 }
 
@@ -91,6 +121,12 @@ bool SceneTreeTimer::is_process_always() {
 }
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
+	if (scheduled && process_in_physics != p_process_in_physics) {
+		double left = _get_scheduled_time_left();
+		process_in_physics = p_process_in_physics;
+		SceneTree::get_singleton()->_schedule_timer(this, left);
+		return;
+	}
 	process_in_physics = p_process_in_physics;
 }
 
@@ -99,6 +135,12 @@ bool SceneTreeTimer::is_process_in_physics() {
 }
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
+	if (scheduled && ignore_time_scale != p_ignore) {
+		double left = _get_scheduled_time_left();
+		ignore_time_scale = p_ignore;
+		SceneTree::get_singleton()->_schedule_timer(this, left);
+		return;
+	}
 	ignore_time_scale = p_ignore;
 }
 
@@ -180,6 +222,11 @@ void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
 	SelfList<Node> *n = xform_change_list.first();
+	if (!n) {
+		return;
+	}
+
+	batching_instance_transforms = true;
 	while (n) {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
@@ -187,6 +234,55 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+	batching_instance_transforms = false;
+
+	if (canceled_instance_transforms > 0) {
+		// Remove the instances that left their world or were freed during the flush.
+		int count = 0;
+		for (int i = 0; i < batched_instances.size(); i++) {
+			if (batched_instances[i].is_valid()) {
+				batched_instances.write[count] = batched_instances[i];
+				batched_instance_transforms.write[count] = batched_instance_transforms[i];
+				count++;
+			}
+		}
+		batched_instances.resize(count);
+		batched_instance_transforms.resize(count);
+		canceled_instance_transforms = 0;
+	}
+
+	if (!batched_instances.is_empty()) {
+		RS::get_singleton()->instances_set_transforms(batched_instances, batched_instance_transforms);
+		batched_instances.clear();
+		batched_instance_transforms.clear();
+	}
+	batched_instance_indices.clear();
+}
+
+bool SceneTree::batch_instance_transform(RID p_instance, const Transform3D &p_transform) {
+	if (!batching_instance_transforms) {
+		return false;
+	}
+	HashMap<RID, int>::Iterator E = batched_instance_indices.find(p_instance);
+	if (E) {
+		// Updated again during the same flush, e.g. through force_update_transform().
+		batched_instance_transforms.write[E->value] = p_transform;
+		return true;
+	}
+	batched_instance_indices.insert(p_instance, batched_instances.size());
+	batched_instances.push_back(p_instance);
+	batched_instance_transforms.push_back(p_transform);
+	return true;
+}
+
+void SceneTree::cancel_instance_transform(RID p_instance) {
+	HashMap<RID, int>::Iterator E = batched_instance_indices.find(p_instance);
+	if (!E) {
+		return;
+	}
+	batched_instances.write[E->value] = RID();
+	batched_instance_indices.remove(E);
+	canceled_instance_transforms++;
 }
 
 void SceneTree::_flush_ugc() {
@@ -450,6 +546,7 @@ void SceneTree::initialize() {
 }
 
 bool SceneTree::physics_process(double p_time) {
+	ENGINE_TRACE_ZONE("SceneTree::physics_process");
 	root_lock++;
 
 	current_frame++;
@@ -484,6 +581,7 @@ bool SceneTree::physics_process(double p_time) {
 }
 
 bool SceneTree::process(double p_time) {
+	ENGINE_TRACE_ZONE("SceneTree::process");
 	root_lock++;
 
 	if (MainLoop::process(p_time)) {
@@ -557,36 +655,116 @@ bool SceneTree::process(double p_time) {
 	return _quit;
 }
 
+void SceneTree::_schedule_timer(SceneTreeTimer *p_timer, double p_time_left) {
+	if (p_timer->scheduled) {
+		timer_heap_stale++; // The entry pushed earlier is now outdated.
+	}
+	p_timer->scheduled = true;
+	p_timer->schedule_version++;
+	p_timer->deadline = timer_clocks[p_timer->_get_clock()] + p_time_left;
+
+	TimerHeapEntry entry;
+	entry.deadline = p_timer->deadline;
+	entry.order = p_timer->order;
+	entry.version = p_timer->schedule_version;
+	entry.timer = Ref<SceneTreeTimer>(p_timer);
+
+	if (processing_timers) {
+		// Timers (re)started from a timeout callback wait for the next frame, as if they were added after the ones being processed.
+		timers_to_push.push_back(entry);
+	} else {
+		_push_timer_entry(entry);
+	}
+}
+
+void SceneTree::_push_timer_entry(const TimerHeapEntry &p_entry) {
+	LocalVector<TimerHeapEntry> &heap = timer_heaps[p_entry.timer->_get_clock()];
+	heap.push_back(p_entry);
+	SortArray<TimerHeapEntry, TimerHeapCompare> sorter;
+	sorter.push_heap(0, heap.size() - 1, 0, p_entry, heap.ptr());
+}
+
+void SceneTree::_compact_timer_heaps() {
+	SortArray<TimerHeapEntry, TimerHeapCompare> sorter;
+	for (LocalVector<TimerHeapEntry> &heap : timer_heaps) {
+		LocalVector<TimerHeapEntry> valid;
+		valid.reserve(heap.size());
+		for (const TimerHeapEntry &E : heap) {
+			if (E.timer->scheduled && E.version == E.timer->schedule_version) {
+				valid.push_back(E);
+			}
+		}
+		heap = valid;
+		if (heap.size() > 1) {
+			sorter.make_heap(0, heap.size(), heap.ptr());
+		}
+	}
+	timer_heap_stale = 0;
+}
+
 void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 	_THREAD_SAFE_METHOD_
-	List<Ref<SceneTreeTimer>>::Element *L = timers.back(); //last element
+	SortArray<TimerHeapEntry, TimerHeapCompare> sorter;
 
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		if ((paused && !E->get()->is_process_always()) || (E->get()->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; //break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
+	for (uint32_t clock = 0; clock < TIMER_CLOCK_MAX; clock++) {
+		if (bool(clock & TIMER_CLOCK_PHYSICS) != p_physics_frame || (paused && !(clock & TIMER_CLOCK_PROCESS_ALWAYS))) {
 			continue;
 		}
 
-		double time_left = E->get()->get_time_left();
-		if (E->get()->is_ignore_time_scale()) {
-			time_left -= Engine::get_singleton()->get_process_step();
+		if (clock & TIMER_CLOCK_IGNORE_TIME_SCALE) {
+			timer_clocks[clock] += Engine::get_singleton()->get_process_step();
 		} else {
-			time_left -= p_delta;
+			timer_clocks[clock] += p_delta;
 		}
-		E->get()->set_time_left(time_left);
 
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+		LocalVector<TimerHeapEntry> &heap = timer_heaps[clock];
+		while (!heap.is_empty() && heap[0].deadline <= timer_clocks[clock]) {
+			TimerHeapEntry top = heap[0];
+			sorter.pop_heap(0, heap.size(), heap.ptr());
+			heap.resize(heap.size() - 1);
+
+			if (top.version != top.timer->schedule_version) {
+				if (timer_heap_stale > 0) {
+					timer_heap_stale--;
+				}
+				continue;
+			}
+			timers_expired.push_back(top);
 		}
-		if (E == L) {
-			break; //break on last, so if new timers were added during list traversal, ignore them.
+	}
+
+	if (timers_expired.size() > 1) {
+		// Emit in creation order, regardless of which clock the timers belong to.
+		timers_expired.sort_custom<TimerOrderCompare>();
+	}
+
+	processing_timers = true;
+	for (const TimerHeapEntry &E : timers_expired) {
+		SceneTreeTimer *timer = E.timer.ptr();
+		if (!timer->scheduled || E.version != timer->schedule_version) {
+			continue; // Changed by the timeout of another timer.
 		}
-		E = N;
+		timer->time_left = timer->_get_scheduled_time_left();
+		timer->scheduled = false;
+		timer->schedule_version++;
+		timer->emit_signal(SNAME("timeout"));
+	}
+	processing_timers = false;
+	timers_expired.clear();
+
+	for (const TimerHeapEntry &E : timers_to_push) {
+		if (E.timer->scheduled && E.version == E.timer->schedule_version) {
+			_push_timer_entry(E);
+		}
+	}
+	timers_to_push.clear();
+
+	uint32_t heap_entries = 0;
+	for (const LocalVector<TimerHeapEntry> &heap : timer_heaps) {
+		heap_entries += heap.size();
+	}
+	if (timer_heap_stale > 64 && timer_heap_stale > heap_entries / 2) {
+		_compact_timer_heaps();
 	}
 }
 
@@ -636,10 +814,14 @@ void SceneTree::finalize() {
 	MainLoop::finalize();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
-		timer->release_connections();
+	for (LocalVector<TimerHeapEntry> &heap : timer_heaps) {
+		for (TimerHeapEntry &E : heap) {
+			E.timer->scheduled = false;
+			E.timer->release_connections();
+		}
+		heap.clear();
 	}
-	timers.clear();
+	timers_to_push.clear();
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
@@ -926,13 +1108,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 
 	for (uint32_t i = 0; i < node_count; i++) {
 		Node *n = nodes_ptr[i];
-		if (nodes_removed_on_group_call.has(n)) {
+		if (!nodes_removed_on_group_call.is_empty() && nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
 			continue;
 		}
 
-		if (!n->can_process() || !n->is_inside_tree()) {
+		// Read the pause state for each node, as a previous node's callback may have changed it.
+		if (!n->is_inside_tree() || !n->_can_process(paused)) {
 			continue;
 		}
 
@@ -957,9 +1140,19 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	ProcessGroup *pg = local_process_group_cache[p_index];
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	Node::current_process_thread_group = pg->owner;
+	_process_group(pg, p_physics);
 	Node::current_process_thread_group = nullptr;
+
+	uint64_t elapsed_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+	if (p_physics) {
+		pg->physics_process_usec = elapsed_usec;
+	} else {
+		pg->process_usec = elapsed_usec;
+	}
 }
 
 void SceneTree::_process(bool p_physics) {
@@ -1031,6 +1224,13 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
+					// Start with the groups that took longest last time, so the cheaper ones can fill the gaps
+					// on the other threads instead of a costly one being picked up last and running alone.
+					if (p_physics) {
+						local_process_group_cache.sort_custom<ProcessGroupCostSort<true>>();
+					} else {
+						local_process_group_cache.sort_custom<ProcessGroupCostSort<false>>();
+					}
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 				}
@@ -1459,7 +1659,8 @@ Ref<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool p_process_a
 	stt->set_time_left(p_delay_sec);
 	stt->set_process_in_physics(p_process_in_physics);
 	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	stt->order = timer_order++;
+	_schedule_timer(stt.ptr(), p_delay_sec);
 	return stt;
 }
 
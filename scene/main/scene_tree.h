@@ -57,6 +57,17 @@ class SceneTreeTimer : public RefCounted {
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	// While scheduled in the SceneTree, the timer expires once the tree's clock for its
+	// category reaches `deadline`, so it doesn't need to be touched every frame.
+	friend class SceneTree;
+	bool scheduled = false;
+	double deadline = 0.0;
+	uint64_t schedule_version = 0;
+	uint64_t order = 0;
+
+	uint32_t _get_clock() const;
+	double _get_scheduled_time_left() const;
+
 protected:
 	static void _bind_methods();
 
@@ -98,12 +109,22 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		// Time spent on the last pass, used to balance sub-threaded groups.
+		uint64_t process_usec = 0;
+		uint64_t physics_process_usec = 0;
 	};
 
 	struct ProcessGroupSort {
 		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const;
 	};
 
+	template <bool p_physics>
+	struct ProcessGroupCostSort {
+		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
+			return p_physics ? p_left->physics_process_usec > p_right->physics_process_usec : p_left->process_usec > p_right->process_usec;
+		}
+	};
+
 	PagedAllocator<ProcessGroup, true> group_allocator; // Allocate groups on pages, to enhance cache usage.
 
 	LocalVector<ProcessGroup *> process_groups;
@@ -192,7 +213,45 @@ private:
 
 	void _flush_scene_change();
 
-	List<Ref<SceneTreeTimer>> timers;
+	// Timers are kept in one min-heap per clock, ordered by deadline. Each clock only advances
+	// in the frames its timers are processed in, so processing costs O(expired * log(timers)).
+	enum {
+		TIMER_CLOCK_PHYSICS = 1,
+		TIMER_CLOCK_IGNORE_TIME_SCALE = 2,
+		TIMER_CLOCK_PROCESS_ALWAYS = 4,
+		TIMER_CLOCK_MAX = 8,
+	};
+
+	// Rescheduling a timer leaves its previous entry in the heap, it's recognized as stale
+	// by its version and dropped when popped (or when the heaps are compacted).
+	struct TimerHeapEntry {
+		double deadline = 0.0;
+		uint64_t order = 0;
+		uint64_t version = 0;
+		Ref<SceneTreeTimer> timer;
+	};
+
+	struct TimerHeapCompare {
+		_FORCE_INLINE_ bool operator()(const TimerHeapEntry &p_a, const TimerHeapEntry &p_b) const {
+			// Earliest deadline on top.
+			return p_a.deadline > p_b.deadline || (p_a.deadline == p_b.deadline && p_a.order > p_b.order);
+		}
+	};
+
+	struct TimerOrderCompare {
+		_FORCE_INLINE_ bool operator()(const TimerHeapEntry &p_a, const TimerHeapEntry &p_b) const {
+			return p_a.order < p_b.order;
+		}
+	};
+
+	double timer_clocks[TIMER_CLOCK_MAX] = {};
+	LocalVector<TimerHeapEntry> timer_heaps[TIMER_CLOCK_MAX];
+	uint32_t timer_heap_stale = 0;
+	uint64_t timer_order = 0;
+	bool processing_timers = false;
+	LocalVector<TimerHeapEntry> timers_to_push; // Scheduled while emitting timeouts, pushed afterwards.
+	LocalVector<TimerHeapEntry> timers_expired;
+
 	List<Ref<Tween>> tweens;
 
 	///network///
@@ -203,12 +262,16 @@ private:
 
 	static SceneTree *singleton;
 	friend class Node;
+	friend class SceneTreeTimer;
 
 	void tree_changed();
 	void node_added(Node *p_node);
 	void node_removed(Node *p_node);
 	void node_renamed(Node *p_node);
 	void process_timers(double p_delta, bool p_physics_frame);
+	void _schedule_timer(SceneTreeTimer *p_timer, double p_time_left);
+	void _push_timer_entry(const TimerHeapEntry &p_entry);
+	void _compact_timer_heaps();
 	void process_tweens(double p_delta, bool p_physics_frame);
 
 	Group *add_to_group(const StringName &p_group, Node *p_node);
@@ -235,6 +298,13 @@ private:
 
 	SelfList<Node>::List xform_change_list;
 
+	// Instance transforms sent while flushing transform notifications, passed to the RenderingServer in one call.
+	bool batching_instance_transforms = false;
+	Vector<RID> batched_instances;
+	Vector<Transform3D> batched_instance_transforms;
+	HashMap<RID, int> batched_instance_indices;
+	int canceled_instance_transforms = 0;
+
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
 #endif
@@ -310,6 +380,8 @@ public:
 	}
 
 	void flush_transform_notifications();
+	bool batch_instance_transform(RID p_instance, const Transform3D &p_transform);
+	void cancel_instance_transform(RID p_instance);
 
 	virtual void initialize() override;
 
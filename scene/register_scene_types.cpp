@@ -185,6 +185,7 @@
 #include "scene/resources/primitive_meshes.h"
 #include "scene/resources/rectangle_shape_2d.h"
 #include "scene/resources/resource_format_text.h"
+#include "scene/resources/scene_pool.h"
 #include "scene/resources/segment_shape_2d.h"
 #include "scene/resources/separation_ray_shape_2d.h"
 #include "scene/resources/separation_ray_shape_3d.h"
@@ -272,6 +273,7 @@
 #include "scene/3d/visible_on_screen_notifier_3d.h"
 #include "scene/3d/voxel_gi.h"
 #include "scene/3d/world_environment.h"
+#include "scene/3d/world_streamer_3d.h"
 #include "scene/3d/xr_nodes.h"
 #include "scene/resources/environment.h"
 #include "scene/resources/fog_material.h"
@@ -331,6 +333,9 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Object);
 
 	GDREGISTER_CLASS(Node);
+	// Project settings are defined here rather than in _bind_methods(), which may be deferred.
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/naming/node_name_num_separator", PROPERTY_HINT_ENUM, "None,Space,Underscore,Dash"), 0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/naming/node_name_casing", PROPERTY_HINT_ENUM, "PascalCase,camelCase,snake_case"), Node::NAME_CASING_PASCAL_CASE);
 	GDREGISTER_VIRTUAL_CLASS(MissingNode);
 	GDREGISTER_ABSTRACT_CLASS(InstancePlaceholder);
 
@@ -354,6 +359,7 @@ void register_scene_types() {
 
 	GDREGISTER_CLASS(ButtonGroup);
 	GDREGISTER_VIRTUAL_CLASS(BaseButton);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "gui/timers/button_shortcut_feedback_highlight_time", PROPERTY_HINT_RANGE, "0.01,10,0.01,suffix:s"), 0.2);
 
 	OS::get_singleton()->yield(); // may take time to init
 
@@ -397,6 +403,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(GridContainer);
 	GDREGISTER_CLASS(CenterContainer);
 	GDREGISTER_CLASS(ScrollContainer);
+	GLOBAL_DEF("gui/common/default_scroll_deadzone", 0);
 	GDREGISTER_CLASS(PanelContainer);
 	GDREGISTER_CLASS(FlowContainer);
 	GDREGISTER_CLASS(HFlowContainer);
@@ -420,6 +427,8 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Tree);
 
 	GDREGISTER_CLASS(TextEdit);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "gui/timers/text_edit_idle_detect_sec", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"), 3);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "gui/common/text_edit_undo_stack_max_size", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"), 1024);
 	GDREGISTER_CLASS(CodeEdit);
 	GDREGISTER_CLASS(SyntaxHighlighter);
 	GDREGISTER_CLASS(CodeHighlighter);
@@ -463,6 +472,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(MethodTweener);
 
 	GDREGISTER_ABSTRACT_CLASS(AnimationMixer);
+	SceneTree::add_idle_callback(AnimationMixer::flush_parallel_processing);
 	GDREGISTER_CLASS(AnimationPlayer);
 	GDREGISTER_CLASS(AnimationTree);
 	GDREGISTER_CLASS(AnimationNode);
@@ -578,6 +588,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Path3D);
 	GDREGISTER_CLASS(PathFollow3D);
 	GDREGISTER_CLASS(VisibleOnScreenNotifier3D);
+	GDREGISTER_CLASS(WorldStreamer3D);
 	GDREGISTER_CLASS(VisibleOnScreenEnabler3D);
 	GDREGISTER_CLASS(WorldEnvironment);
 	GDREGISTER_CLASS(FogVolume);
@@ -970,6 +981,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_CLASS(ScenePool);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
@@ -1220,6 +1232,7 @@ void unregister_scene_types() {
 	PhysicalSkyMaterial::cleanup_shader();
 	PanoramaSkyMaterial::cleanup_shader();
 	ProceduralSkyMaterial::cleanup_shader();
+	ImporterMesh::clear_decomposition_cache();
 #endif // _3D_DISABLED
 
 	ParticleProcessMaterial::finish_shaders();
@@ -2327,6 +2327,17 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) co
 
 	const K *keys = &p_keys[0];
 
+	// Every interpolation looks up the last key before the track length first, and playback
+	// often sits before the first or after the last key, so skip the search for those.
+	if (!p_backward) {
+		if (p_time >= keys[high].time) {
+			return high;
+		}
+		if (p_time < keys[0].time && !Math::is_equal_approx(p_time, (double)keys[0].time)) {
+			return -1;
+		}
+	}
+
 	while (low <= high) {
 		middle = (low + high) / 2;
 
@@ -5151,13 +5162,18 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	// Pages and packets are sorted by time, so binary search for the last one starting at or before p_time.
+	uint32_t low = 0;
+	uint32_t high = compression.pages.size();
+	while (low < high) {
+		uint32_t middle = (low + high) / 2;
+		if (compression.pages[middle].time_offset > p_time) {
+			high = middle;
+		} else {
+			low = middle + 1;
 		}
-		page_index = i;
 	}
+	int32_t page_index = int32_t(low) - 1;
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -5168,25 +5184,24 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	const uint16_t *time_keys = (const uint16_t *)&page_data[indices[p_compressed_track * 3 + 0]];
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
-	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
-
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
-
-		if (frame_time > p_time) {
-			break;
+	low = 1;
+	high = time_key_count;
+	while (low < high) {
+		uint32_t middle = (low + high) / 2;
+		if (double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+			high = middle;
+		} else {
+			low = middle + 1;
 		}
+	}
+	int32_t packet_idx = int32_t(low) - 1;
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
+	double packet_time = double(base_frame) * frame_to_sec + page_base_time;
 
-		if (key_index) {
-			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
+	if (key_index) {
+		for (int32_t i = 0; i < packet_idx; i++) {
+			(*key_index) += (time_keys[i * 2 + 1] >> 12) + 1;
 		}
-
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
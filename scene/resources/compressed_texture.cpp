@@ -30,6 +30,9 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/bit_map.h"
 
 Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
@@ -75,7 +78,8 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	r_request_normal = false;
 
 #endif
-	if (!(df & FORMAT_BIT_STREAM)) {
+	if (!(df & (FORMAT_BIT_STREAM | FORMAT_BIT_HAS_MIPMAPS))) {
+		// Without mipmaps there is no smaller level to fall back to.
 		p_size_limit = 0;
 	}
 
@@ -134,8 +138,16 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_normal;
 	bool request_roughness;
 	int mipmap_limit;
+	// Skipping the largest mipmaps at load time saves memory and I/O; the size
+	// override below keeps the texture reporting its original size.
+	int size_limit = GLOBAL_GET("rendering/textures/limits/max_load_size");
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		size_limit = 0; // Always show full resolution textures in the editor.
+	}
+#endif
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit);
 	if (err) {
 		return err;
 	}
@@ -296,6 +308,18 @@ void CompressedTexture2D::reload_from_file() {
 void CompressedTexture2D::_validate_property(PropertyInfo &p_property) const {
 }
 
+void CompressedTexture2D::_decode_mipmap(void *p_userdata, uint32_t p_index) {
+	MipmapDecodeData *decode_data = (MipmapDecodeData *)p_userdata;
+
+	Ref<Image> img;
+	if (decode_data->data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+		img = Image::png_unpacker(decode_data->encoded[p_index]);
+	} else if (decode_data->data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+		img = Image::webp_unpacker(decode_data->encoded[p_index]);
+	}
+	decode_data->decoded.write[p_index] = img;
+}
+
 Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_size_limit) {
 	uint32_t data_format = f->get_32();
 	uint32_t w = f->get_16();
@@ -314,11 +338,16 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		uint64_t total_size = 0;
 
 		bool first = true;
+		int base_w = w;
+		int base_h = h;
+
+		MipmapDecodeData decode_data;
+		decode_data.data_format = DataFormat(data_format);
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
@@ -332,13 +361,27 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				uint8_t *wr = pv.ptrw();
 				f->get_buffer(wr, size);
 			}
+			decode_data.encoded.push_back(pv);
+
+			sw = MAX(sw >> 1, 1);
+			sh = MAX(sh >> 1, 1);
+		}
 
-			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+		// Decoding dominates the load time and every level is independent, so decode them in parallel
+		// once the (sequential) file reads are done. Textures loaded from a pool thread (threaded resource
+		// loads) decode serially, as waiting for a group from a pool thread can deadlock.
+		decode_data.decoded.resize(decode_data.encoded.size());
+		if (decode_data.encoded.size() > 1 && !WorkerThreadPool::get_singleton()->is_pool_thread()) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&CompressedTexture2D::_decode_mipmap, &decode_data, decode_data.encoded.size(), -1, true, SNAME("CompressedTexture2DDecodeMipmaps"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (int i = 0; i < decode_data.encoded.size(); i++) {
+				_decode_mipmap(&decode_data, i);
 			}
+		}
+
+		for (int i = 0; i < decode_data.decoded.size(); i++) {
+			Ref<Image> img = decode_data.decoded[i];
 
 			if (img.is_null() || img->is_empty()) {
 				ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
@@ -348,6 +391,8 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				//format will actually be the format of the first image,
 				//as it may have changed on compression
 				format = img->get_format();
+				base_w = img->get_width();
+				base_h = img->get_height();
 				first = false;
 			} else if (img->get_format() != format) {
 				img->convert(format); //all needs to be the same format
@@ -356,9 +401,6 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			total_size += img->get_data().size();
 
 			mipmap_images.push_back(img);
-
-			sw = MAX(sw >> 1, 1);
-			sh = MAX(sh >> 1, 1);
 		}
 
 		//print_line("mipmap read total: " + itos(mipmap_images.size()));
@@ -389,21 +431,13 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->set_data(base_w, base_h, true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
 	} else if (data_format == DATA_FORMAT_BASIS_UNIVERSAL) {
-		int sw = w;
-		int sh = h;
+		// Basis Universal stores all the mipmaps in a single blob, so the size limit can't be applied.
 		uint32_t size = f->get_32();
-		if (p_size_limit > 0 && (sw > p_size_limit || sh > p_size_limit)) {
-			//can't load this due to size limit
-			sw = MAX(sw >> 1, 1);
-			sh = MAX(sh >> 1, 1);
-			f->seek(f->get_position() + size);
-			return Ref<Image>();
-		}
 		Vector<uint8_t> pv;
 		pv.resize(size);
 		{
@@ -415,24 +449,22 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		if (img.is_null() || img->is_empty()) {
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
-		format = img->get_format();
-		sw = MAX(sw >> 1, 1);
-		sh = MAX(sh >> 1, 1);
 		return img;
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_start = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			// Only read the mipmap chain from the first level that fits onwards.
+			f->seek(data_start + ofs);
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -74,6 +74,14 @@ private:
 	static void _requested_roughness(void *p_ud, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
 	static void _requested_normal(void *p_ud);
 
+	struct MipmapDecodeData {
+		DataFormat data_format = DATA_FORMAT_PNG;
+		Vector<Vector<uint8_t>> encoded;
+		Vector<Ref<Image>> decoded;
+	};
+
+	static void _decode_mipmap(void *p_userdata, uint32_t p_index);
+
 protected:
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &p_property) const;
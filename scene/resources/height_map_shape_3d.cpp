@@ -30,6 +30,7 @@
 
 #include "height_map_shape_3d.h"
 
+#include "core/io/image.h"
 #include "servers/physics_server_3d.h"
 
 Vector<Vector3> HeightMapShape3D::get_debug_mesh_lines() const {
@@ -151,12 +152,13 @@ void HeightMapShape3D::set_map_data(Vector<real_t> p_new) {
 		return;
 	}
 
-	// copy
-	real_t *w = map_data.ptrw();
-	const real_t *r = p_new.ptr();
+	// Share the buffer instead of copying it, so the caller (e.g. a terrain holding the same heights
+	// for rendering), this resource and the physics server all reference a single copy of the data.
+	map_data = p_new;
+
+	const real_t *r = map_data.ptr();
 	for (int i = 0; i < size; i++) {
 		real_t val = r[i];
-		w[i] = val;
 		if (i == 0) {
 			min_height = val;
 			max_height = val;
@@ -179,6 +181,69 @@ Vector<real_t> HeightMapShape3D::get_map_data() const {
 	return map_data;
 }
 
+real_t HeightMapShape3D::get_min_height() const {
+	return min_height;
+}
+
+real_t HeightMapShape3D::get_max_height() const {
+	return max_height;
+}
+
+void HeightMapShape3D::update_map_data_from_image(const Ref<Image> &p_image, real_t p_height_min, real_t p_height_max) {
+	ERR_FAIL_COND(p_image.is_null());
+	ERR_FAIL_COND_MSG(p_image->get_width() < 2 || p_image->get_height() < 2, "Height map images must be at least 2x2 pixels.");
+	ERR_FAIL_COND_MSG(p_height_min > p_height_max, "The minimum height can't be greater than the maximum height.");
+
+	Ref<Image> image = p_image;
+	if (image->is_compressed()) {
+		image = p_image->duplicate();
+		image->decompress();
+		ERR_FAIL_COND_MSG(image->is_compressed(), "Couldn't decompress the height map image.");
+	}
+
+	const int width = image->get_width();
+	const int depth = image->get_height();
+
+	Vector<real_t> new_data;
+	new_data.resize(width * depth);
+	real_t *w = new_data.ptrw();
+
+	const Image::Format format = image->get_format();
+	if (format == Image::FORMAT_RF) {
+		// Heights stored as-is, read them directly.
+		const Vector<uint8_t> image_data = image->get_data();
+		const float *r = (const float *)image_data.ptr();
+		for (int i = 0; i < width * depth; i++) {
+			w[i] = r[i];
+		}
+	} else {
+		// Half float formats store heights as-is, other formats hold normalized values remapped to the given range.
+		const bool is_float = format == Image::FORMAT_RH || format == Image::FORMAT_RGH || format == Image::FORMAT_RGBH || format == Image::FORMAT_RGBAH || format == Image::FORMAT_RGF || format == Image::FORMAT_RGBF || format == Image::FORMAT_RGBAF;
+		const real_t range = p_height_max - p_height_min;
+		int idx = 0;
+		for (int y = 0; y < depth; y++) {
+			for (int x = 0; x < width; x++) {
+				const real_t value = image->get_pixel(x, y).r;
+				w[idx++] = is_float ? value : p_height_min + value * range;
+			}
+		}
+	}
+
+	min_height = w[0];
+	max_height = w[0];
+	for (int i = 1; i < width * depth; i++) {
+		min_height = MIN(min_height, w[i]);
+		max_height = MAX(max_height, w[i]);
+	}
+
+	map_width = width;
+	map_depth = depth;
+	map_data = new_data;
+
+	_update_shape();
+	emit_changed();
+}
+
 void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_map_width", "width"), &HeightMapShape3D::set_map_width);
 	ClassDB::bind_method(D_METHOD("get_map_width"), &HeightMapShape3D::get_map_width);
@@ -186,6 +251,9 @@ void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_map_depth"), &HeightMapShape3D::get_map_depth);
 	ClassDB::bind_method(D_METHOD("set_map_data", "data"), &HeightMapShape3D::set_map_data);
 	ClassDB::bind_method(D_METHOD("get_map_data"), &HeightMapShape3D::get_map_data);
+	ClassDB::bind_method(D_METHOD("get_min_height"), &HeightMapShape3D::get_min_height);
+	ClassDB::bind_method(D_METHOD("get_max_height"), &HeightMapShape3D::get_max_height);
+	ClassDB::bind_method(D_METHOD("update_map_data_from_image", "image", "height_min", "height_max"), &HeightMapShape3D::update_map_data_from_image);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "map_width", PROPERTY_HINT_RANGE, "0.001,100,0.001,or_greater"), "set_map_width", "get_map_width");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "map_depth", PROPERTY_HINT_RANGE, "0.001,100,0.001,or_greater"), "set_map_depth", "get_map_depth");
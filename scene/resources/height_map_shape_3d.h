@@ -33,6 +33,8 @@
 
 #include "scene/resources/shape_3d.h"
 
+class Image;
+
 class HeightMapShape3D : public Shape3D {
 	GDCLASS(HeightMapShape3D, Shape3D);
 
@@ -54,6 +56,11 @@ public:
 	void set_map_data(Vector<real_t> p_new);
 	Vector<real_t> get_map_data() const;
 
+	real_t get_min_height() const;
+	real_t get_max_height() const;
+
+	void update_map_data_from_image(const Ref<Image> &p_image, real_t p_height_min, real_t p_height_max);
+
 	virtual Vector<Vector3> get_debug_mesh_lines() const override;
 	virtual real_t get_enclosing_radius() const override;
 
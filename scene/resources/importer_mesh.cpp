@@ -30,6 +30,7 @@
 
 #include "importer_mesh.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/marshalls.h"
 #include "core/math/convex_hull.h"
 #include "core/math/random_pcg.h"
@@ -38,6 +39,9 @@
 
 #include <cstdint>
 
+Mutex ImporterMesh::decomposition_cache_mutex;
+HashMap<String, Vector<Vector<Vector3>>> ImporterMesh::decomposition_cache;
+
 void ImporterMesh::Surface::split_normals(const LocalVector<int> &p_indices, const LocalVector<Vector3> &p_normals) {
 	_split_normals(arrays, p_indices, p_normals);
 
@@ -979,7 +983,68 @@ Vector<Ref<Shape3D>> ImporterMesh::convex_decompose(const Ref<MeshConvexDecompos
 	}
 	vertices.resize(vertex_count);
 
-	Vector<Vector<Vector3>> decomposed = Mesh::convex_decomposition_function((real_t *)vertices.ptr(), vertex_count, indices.ptr(), face_count, p_settings, nullptr);
+	String cache_key;
+	{
+		struct {
+			real_t max_concavity;
+			real_t symmetry_planes_clipping_bias;
+			real_t revolution_axes_clipping_bias;
+			real_t min_volume_per_convex_hull;
+			uint32_t resolution;
+			uint32_t max_num_vertices_per_convex_hull;
+			uint32_t plane_downsampling;
+			uint32_t convex_hull_downsampling;
+			uint32_t max_convex_hulls;
+			uint32_t mode;
+			uint8_t normalize_mesh;
+			uint8_t convex_hull_approximation;
+			uint8_t project_hull_vertices;
+		} params;
+		memset(&params, 0, sizeof(params));
+		params.max_concavity = p_settings->get_max_concavity();
+		params.symmetry_planes_clipping_bias = p_settings->get_symmetry_planes_clipping_bias();
+		params.revolution_axes_clipping_bias = p_settings->get_revolution_axes_clipping_bias();
+		params.min_volume_per_convex_hull = p_settings->get_min_volume_per_convex_hull();
+		params.resolution = p_settings->get_resolution();
+		params.max_num_vertices_per_convex_hull = p_settings->get_max_num_vertices_per_convex_hull();
+		params.plane_downsampling = p_settings->get_plane_downsampling();
+		params.convex_hull_downsampling = p_settings->get_convex_hull_downsampling();
+		params.max_convex_hulls = p_settings->get_max_convex_hulls();
+		params.mode = p_settings->get_mode();
+		params.normalize_mesh = p_settings->get_normalize_mesh();
+		params.convex_hull_approximation = p_settings->get_convex_hull_approximation();
+		params.project_hull_vertices = p_settings->get_project_hull_vertices();
+
+		CryptoCore::SHA256Context ctx;
+		ctx.start();
+		ctx.update((const uint8_t *)&params, sizeof(params));
+		ctx.update((const uint8_t *)vertices.ptr(), vertices.size() * sizeof(Vector3));
+		ctx.update((const uint8_t *)indices.ptr(), indices.size() * sizeof(uint32_t));
+		unsigned char hash[32];
+		ctx.finish(hash);
+		cache_key = String::hex_encode_buffer(hash, 32);
+	}
+
+	Vector<Vector<Vector3>> decomposed;
+	bool cached = false;
+	{
+		MutexLock lock(decomposition_cache_mutex);
+		HashMap<String, Vector<Vector<Vector3>>>::Iterator E = decomposition_cache.find(cache_key);
+		if (E) {
+			decomposed = E->value;
+			cached = true;
+		}
+	}
+
+	if (!cached) {
+		decomposed = Mesh::convex_decomposition_function((real_t *)vertices.ptr(), vertex_count, indices.ptr(), face_count, p_settings, nullptr);
+
+		MutexLock lock(decomposition_cache_mutex);
+		if (decomposition_cache.size() >= DECOMPOSITION_CACHE_MAX_ENTRIES) {
+			decomposition_cache.clear();
+		}
+		decomposition_cache[cache_key] = decomposed;
+	}
 
 	Vector<Ref<Shape3D>> ret;
 
@@ -993,6 +1058,11 @@ Vector<Ref<Shape3D>> ImporterMesh::convex_decompose(const Ref<MeshConvexDecompos
 	return ret;
 }
 
+void ImporterMesh::clear_decomposition_cache() {
+	MutexLock lock(decomposition_cache_mutex);
+	decomposition_cache.clear();
+}
+
 Ref<ConvexPolygonShape3D> ImporterMesh::create_convex_shape(bool p_clean, bool p_simplify) const {
 	if (p_simplify) {
 		Ref<MeshConvexDecompositionSettings> settings;
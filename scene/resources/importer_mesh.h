@@ -32,6 +32,8 @@
 #define IMPORTER_MESH_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "scene/resources/concave_polygon_shape_3d.h"
 #include "scene/resources/convex_polygon_shape_3d.h"
@@ -82,6 +84,14 @@ class ImporterMesh : public Resource {
 
 	Size2i lightmap_size_hint;
 
+	// Decomposition results keyed by a hash of the input geometry and settings, so unchanged meshes are not
+	// decomposed again when a scene is reimported. Cleared once it grows past DECOMPOSITION_CACHE_MAX_ENTRIES, and on shutdown.
+	enum {
+		DECOMPOSITION_CACHE_MAX_ENTRIES = 512
+	};
+	static Mutex decomposition_cache_mutex;
+	static HashMap<String, Vector<Vector<Vector3>>> decomposition_cache;
+
 protected:
 	void _set_data(const Dictionary &p_data);
 	Dictionary _get_data() const;
@@ -119,6 +129,7 @@ public:
 
 	Vector<Face3> get_faces() const;
 	Vector<Ref<Shape3D>> convex_decompose(const Ref<MeshConvexDecompositionSettings> &p_settings) const;
+	static void clear_decomposition_cache();
 	Ref<ConvexPolygonShape3D> create_convex_shape(bool p_clean = true, bool p_simplify = false) const;
 	Ref<ConcavePolygonShape3D> create_trimesh_shape() const;
 	Ref<NavigationMesh> create_navigation_mesh();
@@ -89,6 +89,7 @@ protected:
 	float edge_max_length = 0.0f;
 	float edge_max_error = 1.3f;
 	float vertices_per_polygon = 6.0f;
+	float border_size = 0.0f;
 	float detail_sample_distance = 6.0f;
 	float detail_sample_max_error = 1.0f;
 
@@ -158,6 +159,9 @@ public:
 	void set_vertices_per_polygon(float p_value);
 	float get_vertices_per_polygon() const;
 
+	void set_border_size(float p_value);
+	float get_border_size() const;
+
 	void set_detail_sample_distance(float p_value);
 	float get_detail_sample_distance() const;
 
@@ -53,6 +53,38 @@ bool SceneState::can_instantiate() const {
 	return nodes.size() > 0;
 }
 
+#ifndef TOOLS_ENABLED
+void SceneState::_build_setter_cache() const {
+	MutexLock lock(setter_cache_mutex);
+	if (setter_cache_valid.is_set()) {
+		return; // Built by another thread meanwhile.
+	}
+
+	setter_cache.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		NodeSetterCache &cache = setter_cache[i];
+
+		// Only nodes created from their class here have a known type; instanced and inherited ones
+		// fall back to Object::set(), as does any node whose class turns out to differ (e.g. placeholders).
+		bool created_here = n.type != TYPE_INSTANTIATED && n.instance < 0 && !(i == 0 && base_scene_idx >= 0);
+		cache.class_name = created_here && n.type >= 0 && n.type < names.size() ? names[n.type] : StringName();
+
+		cache.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			int name_idx = n.properties[j].name;
+			MethodBind *setter = nullptr;
+			if (cache.class_name != StringName() && !(name_idx & FLAG_PATH_PROPERTY_IS_NODE) && name_idx < names.size() && names[name_idx] != CoreStringNames::get_singleton()->_script) {
+				setter = ClassDB::get_property_setter_method(cache.class_name, names[name_idx]);
+			}
+			cache.setters[j] = setter;
+		}
+	}
+
+	setter_cache_valid.set();
+}
+#endif
+
 static Array _sanitize_node_pinned_properties(Node *p_node) {
 	Array pinned = p_node->get_meta("_edit_pinned_properties_", Array());
 	if (pinned.is_empty()) {
@@ -164,6 +196,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+#ifndef TOOLS_ENABLED
+	if (!setter_cache_valid.is_set()) {
+		_build_setter_cache();
+	}
+	const NodeSetterCache *node_setters = setter_cache.ptr();
+#endif
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -377,7 +416,20 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+#ifndef TOOLS_ENABLED
+							MethodBind *setter = nullptr;
+							if (!node->get_script_instance() && node->get_class_name() == node_setters[i].class_name) {
+								setter = node_setters[i].setters[j];
+							}
+							if (setter) {
+								const Variant *args[1] = { &value };
+								Callable::CallError ce;
+								setter->call(node, args, 1, ce);
+							} else
+#endif
+							{
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -566,6 +618,90 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+void SceneState::reset_instance_properties(Node *p_root) const {
+	ERR_FAIL_NULL(p_root);
+
+	int nc = nodes.size();
+	LocalVector<Node *> resolved;
+	resolved.resize(nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+
+		Node *node = nullptr;
+		if (i == 0) {
+			node = p_root;
+		} else {
+			Node *parent = nullptr;
+			if (n.parent & FLAG_ID_IS_PATH) {
+				parent = p_root->get_node_or_null(node_paths[n.parent & FLAG_MASK]);
+			} else if (n.parent >= 0 && n.parent < i) {
+				parent = resolved[n.parent];
+			}
+			node = parent ? parent->_get_child_by_name(names[n.name]) : nullptr;
+		}
+		resolved[i] = node;
+
+		if (!node) {
+			continue; // Removed since it was instantiated.
+		}
+
+		// Reset sub-scenes first, so the overrides stored in this scene win.
+		Ref<PackedScene> sub_scene;
+		if (i == 0 && base_scene_idx >= 0) {
+			sub_scene = variants[base_scene_idx];
+		} else if (n.instance >= 0 && !(n.instance & FLAG_INSTANCE_IS_PLACEHOLDER)) {
+			sub_scene = variants[n.instance & FLAG_MASK];
+		}
+		if (sub_scene.is_valid()) {
+			sub_scene->get_state()->reset_instance_properties(node);
+		} else if (n.type != TYPE_INSTANTIATED) {
+			// Properties left at their default value are not stored in the scene, restore those too.
+			HashSet<StringName> stored;
+			for (int j = 0; j < n.properties.size(); j++) {
+				stored.insert(names[n.properties[j].name & FLAG_PROP_NAME_MASK]);
+			}
+
+			List<PropertyInfo> plist;
+			node->get_property_list(&plist);
+			const Vector<PackState> no_states; // Only the class and script defaults apply to nodes created here.
+			for (const PropertyInfo &pi : plist) {
+				if (!(pi.usage & PROPERTY_USAGE_STORAGE) || stored.has(pi.name) || pi.name == CoreStringNames::get_singleton()->_script) {
+					continue;
+				}
+				bool valid = false;
+				Variant default_value = PropertyUtils::get_property_default_value(node, pi.name, &valid, &no_states);
+				if (valid && PropertyUtils::is_property_value_different(node->get(pi.name), default_value)) {
+					node->set(pi.name, default_value);
+				}
+			}
+		}
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			if (prop.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				continue; // Node references keep pointing to the nodes of this same instance.
+			}
+			ERR_CONTINUE(prop.name >= names.size() || prop.value >= variants.size());
+
+			const StringName &name = names[prop.name];
+			if (name == CoreStringNames::get_singleton()->_script) {
+				continue; // Keep the script instance, its exported values are reset below as regular properties.
+			}
+
+			const Variant &value = variants[prop.value];
+			if (value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					continue; // The instance owns its own copy already, assigning the shared one would be wrong.
+				}
+			}
+
+			node->set(name, value);
+		}
+	}
+}
+
 static int _nm_get_string(const String &p_string, HashMap<StringName, int> &name_map) {
 	if (name_map.has(p_string)) {
 		return name_map[p_string];
@@ -1120,6 +1256,9 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+#ifndef TOOLS_ENABLED
+	setter_cache_valid.clear();
+#endif
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1328,6 +1467,10 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+#ifndef TOOLS_ENABLED
+	setter_cache_valid.clear();
+#endif
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1797,6 +1940,9 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+#ifndef TOOLS_ENABLED
+	setter_cache_valid.clear();
+#endif
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1813,6 +1959,9 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+#ifndef TOOLS_ENABLED
+	setter_cache_valid.clear();
+#endif
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -32,6 +32,9 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +92,22 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+#ifndef TOOLS_ENABLED
+	// Property setters resolved once per node, so instantiating the same scene repeatedly
+	// can skip the ClassDB lookups. Indexed like `nodes` and their `properties`.
+	// Not used in the editor, where Object::set() also marks the object as edited.
+	struct NodeSetterCache {
+		StringName class_name;
+		LocalVector<MethodBind *> setters;
+	};
+
+	mutable LocalVector<NodeSetterCache> setter_cache;
+	mutable SafeFlag setter_cache_valid;
+	mutable BinaryMutex setter_cache_mutex;
+
+	void _build_setter_cache() const;
+#endif
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -156,6 +175,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	void reset_instance_properties(Node *p_root) const;
 
 	Ref<SceneState> get_base_scene_state() const;
 
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+Node *ScenePool::_pop_available() {
+	while (!available.is_empty()) {
+		ObjectID id = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node && !node->is_queued_for_deletion()) {
+			return node;
+		}
+	}
+	return nullptr;
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear(); // Pooled instances belong to the previous scene.
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+	while ((int)available.size() > max_size) {
+		Node *node = _pop_available();
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+void ScenePool::set_reset_on_release(bool p_enable) {
+	reset_on_release = p_enable;
+}
+
+bool ScenePool::is_reset_on_release() const {
+	return reset_on_release;
+}
+
+void ScenePool::fill(int p_count) {
+	ERR_FAIL_COND_MSG(scene.is_null(), "A scene must be set before filling the pool.");
+	int count = MIN(p_count, max_size);
+	while ((int)available.size() < count) {
+		Node *node = scene->instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+Node *ScenePool::acquire() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "A scene must be set before acquiring instances from the pool.");
+
+	Node *node = _pop_available();
+	if (!node) {
+		return scene->instantiate();
+	}
+	// Let the instance go through _ready() again when it's added back to the tree.
+	node->request_ready();
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(scene.is_null(), "A scene must be set before releasing instances to the pool.");
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(available.find(p_node->get_instance_id()) != -1, "Node was already released to this pool.");
+#endif
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		// Leaving the tree also takes the node out of the physics spaces and render scenarios,
+		// while keeping its server resources allocated for the next use.
+		parent->remove_child(p_node);
+	}
+
+	if ((int)available.size() >= max_size) {
+		p_node->queue_free();
+		return;
+	}
+
+	if (reset_on_release) {
+		scene->get_state()->reset_instance_properties(p_node);
+	}
+	available.push_back(p_node->get_instance_id());
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+void ScenePool::clear() {
+	while (!available.is_empty()) {
+		Node *node = _pop_available();
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+	ClassDB::bind_method(D_METHOD("set_reset_on_release", "enable"), &ScenePool::set_reset_on_release);
+	ClassDB::bind_method(D_METHOD("is_reset_on_release"), &ScenePool::is_reset_on_release);
+
+	ClassDB::bind_method(D_METHOD("fill", "count"), &ScenePool::fill);
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reset_on_release"), "set_reset_on_release", "is_reset_on_release");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
@@ -30,6 +30,8 @@
 
 #include "surface_tool.h"
 
+#include "core/io/marshalls.h"
+
 #define EQ_VERTEX_DIST 0.00001
 
 SurfaceTool::OptimizeVertexCacheFunc SurfaceTool::optimize_vertex_cache_func = nullptr;
@@ -40,6 +42,9 @@ SurfaceTool::SimplifySloppyFunc SurfaceTool::simplify_sloppy_func = nullptr;
 SurfaceTool::GenerateRemapFunc SurfaceTool::generate_remap_func = nullptr;
 SurfaceTool::RemapVertexFunc SurfaceTool::remap_vertex_func = nullptr;
 SurfaceTool::RemapIndexFunc SurfaceTool::remap_index_func = nullptr;
+SurfaceTool::BuildMeshletsBoundFunc SurfaceTool::build_meshlets_bound_func = nullptr;
+SurfaceTool::BuildMeshletsFunc SurfaceTool::build_meshlets_func = nullptr;
+SurfaceTool::ComputeClusterBoundsFunc SurfaceTool::compute_cluster_bounds_func = nullptr;
 
 void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices) {
 	ERR_FAIL_COND_MSG(!generate_remap_func || !remap_vertex_func || !remap_index_func, "Meshoptimizer library is not initialized.");
@@ -76,6 +81,68 @@ void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32A
 	r_indices.resize(filtered_indices_count * 3);
 }
 
+Vector<SurfaceTool::Meshlet> SurfaceTool::build_meshlets(const PackedVector3Array &p_vertices, PackedInt32Array &r_indices, uint32_t p_max_vertices, uint32_t p_max_triangles, float p_cone_weight) {
+	Vector<Meshlet> meshlets;
+	ERR_FAIL_COND_V_MSG(!build_meshlets_bound_func || !build_meshlets_func || !compute_cluster_bounds_func, meshlets, "Meshoptimizer library is not initialized.");
+	ERR_FAIL_COND_V(r_indices.size() % 3 != 0, meshlets);
+	ERR_FAIL_COND_V(p_max_vertices < 3 || p_max_vertices > 255, meshlets);
+	ERR_FAIL_COND_V(p_max_triangles < 4 || p_max_triangles > 512, meshlets);
+	ERR_FAIL_COND_V_MSG(p_max_triangles % 4 != 0, meshlets, "The maximum triangle count of a meshlet must be a multiple of 4.");
+
+	const size_t index_count = r_indices.size();
+	const size_t vertex_count = p_vertices.size();
+	if (index_count == 0) {
+		return meshlets;
+	}
+
+	Vector<float> vertices_f32 = vector3_to_float32_array(p_vertices.ptr(), vertex_count);
+
+	const size_t max_meshlets = build_meshlets_bound_func(index_count, p_max_vertices, p_max_triangles);
+	LocalVector<uint32_t> meshlet_data;
+	meshlet_data.resize(max_meshlets * 4);
+	LocalVector<unsigned int> meshlet_vertices;
+	meshlet_vertices.resize(max_meshlets * p_max_vertices);
+	LocalVector<unsigned char> meshlet_triangles;
+	meshlet_triangles.resize(max_meshlets * p_max_triangles * 3);
+
+	const size_t meshlet_count = build_meshlets_func(meshlet_data.ptr(), meshlet_vertices.ptr(), meshlet_triangles.ptr(), (const unsigned int *)r_indices.ptr(), index_count, vertices_f32.ptr(), vertex_count, sizeof(float) * 3, p_max_vertices, p_max_triangles, p_cone_weight);
+
+	PackedInt32Array new_indices;
+	new_indices.resize(index_count);
+	int32_t *w = new_indices.ptrw();
+	uint32_t offset = 0;
+
+	meshlets.resize(meshlet_count);
+	Meshlet *meshlets_ptr = meshlets.ptrw();
+	for (size_t i = 0; i < meshlet_count; i++) {
+		const uint32_t *m = &meshlet_data[i * 4];
+		const uint32_t triangle_count = m[3];
+		ERR_FAIL_COND_V(offset + triangle_count * 3 > index_count, Vector<Meshlet>());
+
+		for (uint32_t j = 0; j < triangle_count * 3; j++) {
+			w[offset + j] = meshlet_vertices[m[0] + meshlet_triangles[m[1] + j]];
+		}
+
+		float bounds[11];
+		compute_cluster_bounds_func(bounds, (const unsigned int *)&w[offset], triangle_count * 3, vertices_f32.ptr(), vertex_count, sizeof(float) * 3);
+
+		Meshlet &meshlet = meshlets_ptr[i];
+		meshlet.index_offset = offset;
+		meshlet.index_count = triangle_count * 3;
+		meshlet.center = Vector3(bounds[0], bounds[1], bounds[2]);
+		meshlet.radius = bounds[3];
+		meshlet.cone_apex = Vector3(bounds[4], bounds[5], bounds[6]);
+		meshlet.cone_axis = Vector3(bounds[7], bounds[8], bounds[9]);
+		meshlet.cone_cutoff = bounds[10];
+
+		offset += triangle_count * 3;
+	}
+	ERR_FAIL_COND_V(offset != index_count, Vector<Meshlet>());
+
+	r_indices = new_indices;
+	return meshlets;
+}
+
 bool SurfaceTool::Vertex::operator==(const Vertex &p_vertex) const {
 	if (vertex != p_vertex.vertex) {
 		return false;
@@ -98,8 +98,31 @@ public:
 	static RemapVertexFunc remap_vertex_func;
 	typedef void (*RemapIndexFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const unsigned int *remap);
 	static RemapIndexFunc remap_index_func;
+	typedef size_t (*BuildMeshletsBoundFunc)(size_t index_count, size_t max_vertices, size_t max_triangles);
+	static BuildMeshletsBoundFunc build_meshlets_bound_func;
+	// Meshlets are written as (vertex_offset, triangle_offset, vertex_count, triangle_count) quadruplets.
+	typedef size_t (*BuildMeshletsFunc)(uint32_t *meshlets, unsigned int *meshlet_vertices, unsigned char *meshlet_triangles, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride, size_t max_vertices, size_t max_triangles, float cone_weight);
+	static BuildMeshletsFunc build_meshlets_func;
+	// Bounds are written as center (3), radius, cone apex (3), cone axis (3) and cone cutoff.
+	typedef void (*ComputeClusterBoundsFunc)(float *bounds, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride);
+	static ComputeClusterBoundsFunc compute_cluster_bounds_func;
 	static void strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices);
 
+	struct Meshlet {
+		uint32_t index_offset = 0;
+		uint32_t index_count = 0;
+		// Bounding sphere, for frustum and occlusion culling.
+		Vector3 center;
+		float radius = 0.0;
+		// Normal cone, for backface culling: the cluster is invisible when dot(normalize(apex - eye), axis) >= cutoff.
+		Vector3 cone_apex;
+		Vector3 cone_axis;
+		float cone_cutoff = 1.0;
+	};
+
+	// Reorders the triangles of r_indices so each meshlet occupies a contiguous range, and returns the meshlets.
+	static Vector<Meshlet> build_meshlets(const PackedVector3Array &p_vertices, PackedInt32Array &r_indices, uint32_t p_max_vertices = 64, uint32_t p_max_triangles = 124, float p_cone_weight = 0.25);
+
 private:
 	struct VertexHasher {
 		static _FORCE_INLINE_ uint32_t hash(const Vertex &p_vtx);
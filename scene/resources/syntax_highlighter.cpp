@@ -56,11 +56,18 @@ void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
-			highlighting_cache.erase(i);
-		}
+	// Only walk the cached lines, large files may have very few of them highlighted.
+	int from_line = MIN(p_from_line, p_to_line) - 1;
+	RBMap<int, Dictionary>::Element *E = highlighting_cache.find_closest(from_line);
+	if (!E) {
+		E = highlighting_cache.front();
+	} else if (E->key() < from_line) {
+		E = E->next();
+	}
+	while (E) {
+		RBMap<int, Dictionary>::Element *N = E->next();
+		highlighting_cache.erase(E);
+		E = N;
 	}
 }
 
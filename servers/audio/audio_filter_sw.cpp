@@ -246,15 +246,48 @@ void AudioFilterSW::Processor::process(float *p_samples, int p_amount, int p_str
 		return;
 	}
 
+	// Keep the filter state in locals while processing, so it can stay in
+	// registers instead of being written back to memory on every sample.
+	Coeffs c = coeffs;
+	float h_a1 = ha1;
+	float h_a2 = ha2;
+	float h_b1 = hb1;
+	float h_b2 = hb2;
+
 	if (p_interpolate) {
+		const Coeffs incr = incr_coeffs;
 		for (int i = 0; i < p_amount; i++) {
-			process_one_interp(*p_samples);
+			float pre = *p_samples;
+			float out = pre * c.b0 + h_b1 * c.b1 + h_b2 * c.b2 + h_a1 * c.a1 + h_a2 * c.a2;
+			h_a2 = h_a1;
+			h_b2 = h_b1;
+			h_b1 = pre;
+			h_a1 = out;
+			*p_samples = out;
 			p_samples += p_stride;
+
+			c.b0 += incr.b0;
+			c.b1 += incr.b1;
+			c.b2 += incr.b2;
+			c.a1 += incr.a1;
+			c.a2 += incr.a2;
 		}
+		coeffs = c;
 	} else {
 		for (int i = 0; i < p_amount; i++) {
-			process_one(*p_samples);
+			float pre = *p_samples;
+			float out = pre * c.b0 + h_b1 * c.b1 + h_b2 * c.b2 + h_a1 * c.a1 + h_a2 * c.a2;
+			h_a2 = h_a1;
+			h_b2 = h_b1;
+			h_b1 = pre;
+			h_a1 = out;
+			*p_samples = out;
 			p_samples += p_stride;
 		}
 	}
+
+	ha1 = h_a1;
+	ha2 = h_a2;
+	hb1 = h_b1;
+	hb2 = h_b2;
 }
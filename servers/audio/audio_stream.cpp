@@ -99,10 +99,131 @@ void AudioStreamPlaybackResampled::begin_resample() {
 	internal_buffer[2] = AudioFrame(0.0, 0.0);
 	internal_buffer[3] = AudioFrame(0.0, 0.0);
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_mix_decoded(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
 }
 
+void AudioStreamPlaybackResampled::_decode_ahead_task(void *p_playback) {
+	AudioStreamPlaybackResampled *playback = (AudioStreamPlaybackResampled *)p_playback;
+	AudioFrame chunk[INTERNAL_BUFFER_LEN];
+
+	while (true) {
+		// Lock per chunk, so seeking and underruns on the audio thread don't wait for the whole buffer to fill.
+		MutexLock decoder_lock(playback->decoder_mutex);
+		if (playback->decode_ahead_finished.is_set()) {
+			break;
+		}
+		{
+			MutexLock lock(playback->decode_ahead_buffer_mutex);
+			if (playback->decode_ahead_buffer.space_left() < INTERNAL_BUFFER_LEN) {
+				break;
+			}
+		}
+
+		int decoded = playback->_mix_internal(chunk, INTERNAL_BUFFER_LEN);
+		{
+			MutexLock lock(playback->decode_ahead_buffer_mutex);
+			playback->decode_ahead_buffer.write(chunk, decoded);
+		}
+		if (decoded < INTERNAL_BUFFER_LEN) {
+			playback->decode_ahead_finished.set();
+		}
+	}
+}
+
+void AudioStreamPlaybackResampled::_request_decode_ahead() {
+	if (decode_ahead_finished.is_set()) {
+		return;
+	}
+
+	if (decode_ahead_task != WorkerThreadPool::INVALID_TASK_ID) {
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(decode_ahead_task)) {
+			return;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(decode_ahead_task);
+		decode_ahead_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	{
+		MutexLock lock(decode_ahead_buffer_mutex);
+		if (decode_ahead_buffer.data_left() >= decode_ahead_buffer.size() / 2) {
+			return;
+		}
+	}
+
+	decode_ahead_task = WorkerThreadPool::get_singleton()->add_native_task(&AudioStreamPlaybackResampled::_decode_ahead_task, this, true, SNAME("AudioStreamDecodeAhead"));
+}
+
+int AudioStreamPlaybackResampled::_mix_decoded(AudioFrame *p_buffer, int p_frames) {
+	if (!decode_ahead) {
+		return _mix_internal(p_buffer, p_frames);
+	}
+
+	int mixed = 0;
+	{
+		MutexLock lock(decode_ahead_buffer_mutex);
+		mixed = decode_ahead_buffer.read(p_buffer, p_frames);
+	}
+
+	if (mixed < p_frames) {
+		// Underrun, or the end of the stream. Wait for any chunk being decoded, then decode the rest here if needed.
+		MutexLock decoder_lock(decoder_mutex);
+		{
+			MutexLock lock(decode_ahead_buffer_mutex);
+			mixed += decode_ahead_buffer.read(p_buffer + mixed, p_frames - mixed);
+		}
+		if (mixed < p_frames && !decode_ahead_finished.is_set()) {
+			int decoded = _mix_internal(p_buffer + mixed, p_frames - mixed);
+			if (decoded < p_frames - mixed) {
+				decode_ahead_finished.set();
+			}
+			mixed += decoded;
+		}
+		for (int i = mixed; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+	}
+
+	_request_decode_ahead();
+	return mixed;
+}
+
+void AudioStreamPlaybackResampled::_set_decode_ahead(bool p_enable) {
+	if (!p_enable) {
+		_finish_decode_ahead();
+		return;
+	}
+	MutexLock decoder_lock(decoder_mutex);
+	decode_ahead = true;
+	decode_ahead_buffer.resize(DECODE_AHEAD_BUFFER_BITS);
+	_clear_decode_ahead();
+}
+
+void AudioStreamPlaybackResampled::_clear_decode_ahead() {
+	if (!decode_ahead) {
+		return;
+	}
+	MutexLock lock(decode_ahead_buffer_mutex);
+	decode_ahead_buffer.clear();
+	decode_ahead_finished.clear();
+}
+
+void AudioStreamPlaybackResampled::_finish_decode_ahead() {
+	if (decode_ahead_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(decode_ahead_task);
+		decode_ahead_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	decode_ahead = false;
+}
+
+int AudioStreamPlaybackResampled::_get_decode_ahead_frames() const {
+	if (!decode_ahead) {
+		return 0;
+	}
+	MutexLock lock(decode_ahead_buffer_mutex);
+	return decode_ahead_buffer.data_left();
+}
+
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	int ret = 0;
 	GDVIRTUAL_REQUIRED_CALL(_mix_resampled, p_buffer, p_frames, ret);
@@ -160,7 +281,7 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
 			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
 			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			int mixed_frames = _mix_decoded(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
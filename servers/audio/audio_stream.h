@@ -33,6 +33,9 @@
 
 #include "core/io/image.h"
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/ring_buffer.h"
 #include "servers/audio/audio_filter_sw.h"
 #include "servers/audio_server.h"
 
@@ -77,14 +80,38 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 		FP_LEN = (1 << FP_BITS),
 		FP_MASK = FP_LEN - 1,
 		INTERNAL_BUFFER_LEN = 128, // 128 warrants 3ms positional jitter at much at 44100hz
-		CUBIC_INTERP_HISTORY = 4
+		CUBIC_INTERP_HISTORY = 4,
+		DECODE_AHEAD_BUFFER_BITS = 14, // 16384 frames, about 370ms at 44100hz
 	};
 
 	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	// When decoding ahead, _mix_internal() runs on a worker thread which fills a ring buffer,
+	// so the audio thread only has to resample and mix.
+	bool decode_ahead = false;
+	RingBuffer<AudioFrame> decode_ahead_buffer;
+	BinaryMutex decode_ahead_buffer_mutex;
+	SafeFlag decode_ahead_finished;
+	WorkerThreadPool::TaskID decode_ahead_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _decode_ahead_task(void *p_playback);
+	void _request_decode_ahead();
+	int _mix_decoded(AudioFrame *p_buffer, int p_frames);
+
 protected:
+	// Held while decoding. Subclasses decoding ahead must also hold it while seeking, starting or stopping.
+	Mutex decoder_mutex;
+
+	void _set_decode_ahead(bool p_enable);
+	// Drops the frames decoded ahead. Must be called with decoder_mutex held, after the decoder was moved.
+	void _clear_decode_ahead();
+	// Waits for pending decoding, must be called without holding decoder_mutex before subclasses free their decoder.
+	void _finish_decode_ahead();
+	// Decoded frames that were not mixed yet, to compensate the decoder position.
+	int _get_decode_ahead_frames() const;
+
 	void begin_resample();
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
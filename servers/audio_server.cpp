@@ -305,6 +305,9 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
+	uint64_t mix_step_begin = OS::get_singleton()->get_ticks_usec();
+	uint32_t active_voices = 0;
+	uint32_t virtual_voices = 0;
 	bool solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
@@ -345,13 +348,25 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	if (virtualize_inaudible_voices && max_audible_voices > 0) {
+		_update_voice_budget();
+	}
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
 			continue;
 		}
 
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		// Inaudible streams only advance their playback position.
+		if (_update_playback_virtualization(playback)) {
+			virtual_voices++;
+			continue;
+		}
+		active_voices++;
+
+		// Voices over budget fade out, and are virtualized once silent.
+		bool fading_out = playback->over_voice_budget || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -361,7 +376,13 @@ void AudioServer::_mix_step() {
 		}
 
 		// Mix the audio stream
+#ifdef DEBUG_ENABLED
+		uint64_t stream_ticks = OS::get_singleton()->get_ticks_usec();
+#endif
 		unsigned int mixed_frames = playback->stream_playback->mix(&buf[LOOKAHEAD_BUFFER_SIZE], playback->pitch_scale.get(), buffer_size);
+#ifdef DEBUG_ENABLED
+		stream_prof_time[playback->stream_playback->get_class_name()] += OS::get_singleton()->get_ticks_usec() - stream_ticks;
+#endif
 
 		if (tag_used_audio_streams && playback->stream_playback->is_playing()) {
 			playback->stream_playback->tag_used_streams();
@@ -487,6 +508,10 @@ void AudioServer::_mix_step() {
 		//go bus by bus
 		Bus *bus = buses[i];
 
+#ifdef DEBUG_ENABLED
+		uint64_t bus_ticks = OS::get_singleton()->get_ticks_usec();
+#endif
+
 		for (int k = 0; k < bus->channels.size(); k++) {
 			if (bus->channels[k].active && !bus->channels[k].used) {
 				//buffer was not used, but it's still active, so it must be cleaned
@@ -569,9 +594,12 @@ void AudioServer::_mix_step() {
 			}
 
 			//apply volume and compute peak
+			if (volume != 1.0) {
+				for (uint32_t j = 0; j < buffer_size; j++) {
+					buf[j] *= volume;
+				}
+			}
 			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
-
 				float l = ABS(buf[j].l);
 				if (l > peak.l) {
 					peak.l = l;
@@ -604,10 +632,19 @@ void AudioServer::_mix_step() {
 				}
 			}
 		}
+
+#ifdef DEBUG_ENABLED
+		bus->prof_time += OS::get_singleton()->get_ticks_usec() - bus_ticks;
+#endif
 	}
 
 	mix_frames += buffer_size;
 	to_mix = buffer_size;
+
+	active_voice_count.store(active_voices);
+	virtual_voice_count.store(virtual_voices);
+	mix_step_time_accum += OS::get_singleton()->get_ticks_usec() - mix_step_begin;
+	mix_step_count_accum++;
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -629,25 +666,122 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
+		// Make this buffer size invariant if buffer_size ever becomes a project setting.
+		AudioFrame vol = p_vol_start;
+		const AudioFrame vol_step = (p_vol_final - p_vol_start) / float(buffer_size);
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.l);
 			p_processor_r->process_one_interp(mixed.r);
 			p_out_buf[frame_idx] += mixed;
+			vol += vol_step;
 		}
 
+	} else if (p_vol_start.l == p_vol_final.l && p_vol_start.r == p_vol_final.r) {
+		// Constant volume, no ramp needed. Silent voices don't contribute at all.
+		if (p_vol_start.l == 0 && p_vol_start.r == 0) {
+			return;
+		}
+		const AudioFrame vol = p_vol_start;
+		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
+			p_out_buf[frame_idx] += vol * p_source_buf[frame_idx];
+		}
 	} else {
+		// Make this buffer size invariant if buffer_size ever becomes a project setting.
+		AudioFrame vol = p_vol_start;
+		const AudioFrame vol_step = (p_vol_final - p_vol_start) / float(buffer_size);
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
+			p_out_buf[frame_idx] += vol * p_source_buf[frame_idx];
+			vol += vol_step;
+		}
+	}
+}
+
+float AudioServer::_get_bus_details_max_volume(const AudioStreamPlaybackBusDetails *p_bus_details) const {
+	float max_volume = 0.0f;
+	for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		if (!p_bus_details->bus_active[idx]) {
+			continue;
+		}
+		for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+			const AudioFrame &vol = p_bus_details->volume[idx][channel_idx];
+			max_volume = MAX(max_volume, MAX(ABS(vol.l), ABS(vol.r)));
+		}
+	}
+	return max_volume;
+}
+
+void AudioServer::_update_voice_budget() {
+	voice_budget_entries.clear();
+	uint32_t fixed_voices = 0;
+
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->over_voice_budget = false;
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING) {
+			continue;
+		}
+		float volume = _get_bus_details_max_volume(playback->bus_details.load());
+		if (volume == 0.0f) {
+			continue; // Silent, doesn't need a voice.
+		}
+		if (playback->virtual_length.get() <= 0.0f) {
+			fixed_voices++; // Can't be virtualized, so it always uses a voice.
+			continue;
 		}
+
+		VoiceBudgetEntry entry;
+		entry.playback = playback;
+		entry.priority = playback->virtual_priority.get();
+		entry.volume = volume;
+		voice_budget_entries.push_back(entry);
+	}
+
+	if (fixed_voices + voice_budget_entries.size() <= max_audible_voices) {
+		return;
+	}
+
+	// Keep the highest priority and loudest voices audible.
+	voice_budget_entries.sort();
+	uint32_t available = max_audible_voices > fixed_voices ? max_audible_voices - fixed_voices : 0;
+	for (uint32_t i = available; i < voice_budget_entries.size(); i++) {
+		voice_budget_entries[i].playback->over_voice_budget = true;
 	}
 }
 
+bool AudioServer::_update_playback_virtualization(AudioStreamPlaybackListNode *p_playback) {
+	float length = p_playback->virtual_length.get();
+	bool virtualize = virtualize_inaudible_voices && length > 0.0f && p_playback->state.load() == AudioStreamPlaybackListNode::PLAYING;
+	// Only virtualize once the volume ramp from the previous mix has faded out completely.
+	virtualize = virtualize && _get_bus_details_max_volume(p_playback->prev_bus_details) == 0.0f;
+	virtualize = virtualize && (p_playback->over_voice_budget || _get_bus_details_max_volume(p_playback->bus_details.load()) == 0.0f);
+
+	float position = 0.0f;
+	if (virtualize) {
+		position = p_playback->virtualized.is_set() ? p_playback->virtual_position.get() : float(p_playback->stream_playback->get_playback_position());
+		p_playback->virtual_position.set(position);
+		p_playback->virtualized.set();
+
+		position += buffer_size * p_playback->pitch_scale.get() * playback_speed_scale / get_mix_rate();
+		// Let the stream mix (silently) across its end, so it decides whether to loop or finish.
+		virtualize = position < length;
+	}
+
+	if (!virtualize) {
+		if (p_playback->virtualized.is_set()) {
+			// Resume where the stream would be if it had been mixed all along.
+			p_playback->stream_playback->seek(p_playback->virtual_position.get());
+			for (AudioFrame &frame : p_playback->lookahead) {
+				frame = AudioFrame(0, 0);
+			}
+			p_playback->virtualized.clear();
+		}
+		return false;
+	}
+
+	p_playback->virtual_position.set(position);
+	return true;
+}
+
 AudioServer::AudioStreamPlaybackListNode *AudioServer::_find_playback_list_node(Ref<AudioStreamPlayback> p_playback) {
 	for (AudioStreamPlaybackListNode *playback_list_node : playback_list) {
 		if (playback_list_node->stream_playback == p_playback) {
@@ -1290,6 +1424,18 @@ void AudioServer::set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playb
 	playback_node->highshelf_gain.set(p_gain);
 }
 
+void AudioServer::set_playback_virtualization(Ref<AudioStreamPlayback> p_playback, float p_stream_length, int p_priority) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->virtual_priority.set(p_priority);
+	playback_node->virtual_length.set(p_stream_length);
+}
+
 bool AudioServer::is_playback_active(Ref<AudioStreamPlayback> p_playback) {
 	ERR_FAIL_COND_V(p_playback.is_null(), false);
 
@@ -1309,6 +1455,9 @@ float AudioServer::get_playback_position(Ref<AudioStreamPlayback> p_playback) {
 		return 0;
 	}
 
+	if (playback_node->virtualized.is_set()) {
+		return playback_node->virtual_position.get();
+	}
 	return playback_node->stream_playback->get_playback_position();
 }
 
@@ -1323,6 +1472,17 @@ bool AudioServer::is_playback_paused(Ref<AudioStreamPlayback> p_playback) {
 	return playback_node->state.load() == AudioStreamPlaybackListNode::PAUSED || playback_node->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 }
 
+bool AudioServer::is_playback_virtualized(Ref<AudioStreamPlayback> p_playback) {
+	ERR_FAIL_COND_V(p_playback.is_null(), false);
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return false;
+	}
+
+	return playback_node->virtualized.is_set();
+}
+
 uint64_t AudioServer::get_mix_count() const {
 	return mix_count;
 }
@@ -1358,6 +1518,9 @@ void AudioServer::init_channels_and_buffers() {
 void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
+	decode_ahead = GLOBAL_DEF_RST("audio/general/decode_compressed_streams_ahead", false);
+	virtualize_inaudible_voices = GLOBAL_DEF_RST("audio/general/virtualize_inaudible_voices", true);
+	max_audible_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/general/max_audible_voices", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), 0);
 	buffer_size = 512; //hardcoded for now
 
 	init_channels_and_buffers();
@@ -1394,27 +1557,53 @@ void AudioServer::update() {
 
 		for (int i = buses.size() - 1; i >= 0; i--) {
 			Bus *bus = buses[i];
-			if (bus->bypass) {
-				continue;
-			}
+			// Bus time includes its effects times, only report the rest of the bus processing.
+			uint64_t bus_time = bus->prof_time;
 
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+			if (!bus->bypass) {
+				for (int j = 0; j < bus->effects.size(); j++) {
+					if (!bus->effects[j].enabled) {
+						continue;
+					}
 
-				values.push_back(String(bus->name) + bus->effects[j].effect->get_name());
-				values.push_back(USEC_TO_SEC(bus->effects[j].prof_time));
+					values.push_back(String(bus->name) + bus->effects[j].effect->get_name());
+					values.push_back(USEC_TO_SEC(bus->effects[j].prof_time));
 
-				// Subtract the effect time from the driver and server times
-				if (driver_time > bus->effects[j].prof_time) {
-					driver_time -= bus->effects[j].prof_time;
-				}
-				if (server_time > bus->effects[j].prof_time) {
-					server_time -= bus->effects[j].prof_time;
+					// Subtract the effect time from the driver, server and bus times
+					if (driver_time > bus->effects[j].prof_time) {
+						driver_time -= bus->effects[j].prof_time;
+					}
+					if (server_time > bus->effects[j].prof_time) {
+						server_time -= bus->effects[j].prof_time;
+					}
+					if (bus_time > bus->effects[j].prof_time) {
+						bus_time -= bus->effects[j].prof_time;
+					}
 				}
 			}
+
+			values.push_back("bus_" + String(bus->name));
+			values.push_back(USEC_TO_SEC(bus_time));
+			if (driver_time > bus_time) {
+				driver_time -= bus_time;
+			}
+			if (server_time > bus_time) {
+				server_time -= bus_time;
+			}
+		}
+
+		lock();
+		for (const KeyValue<StringName, uint64_t> &E : stream_prof_time) {
+			values.push_back("stream_" + String(E.key));
+			values.push_back(USEC_TO_SEC(E.value));
+			if (driver_time > E.value) {
+				driver_time -= E.value;
+			}
+			if (server_time > E.value) {
+				server_time -= E.value;
+			}
 		}
+		unlock();
 
 		values.push_back("audio_server");
 		values.push_back(USEC_TO_SEC(server_time));
@@ -1426,8 +1615,15 @@ void AudioServer::update() {
 	}
 
 	// Reset profiling times
+	lock();
+	for (KeyValue<StringName, uint64_t> &E : stream_prof_time) {
+		E.value = 0;
+	}
+	unlock();
+
 	for (int i = buses.size() - 1; i >= 0; i--) {
 		Bus *bus = buses[i];
+		bus->prof_time = 0;
 		if (bus->bypass) {
 			continue;
 		}
@@ -1445,6 +1641,12 @@ void AudioServer::update() {
 	prof_time = 0;
 #endif
 
+	uint64_t mix_steps = mix_step_count_accum.exchange(0);
+	uint64_t mix_steps_time = mix_step_time_accum.exchange(0);
+	if (mix_steps > 0) {
+		mix_step_time = mix_steps_time / mix_steps;
+	}
+
 	for (CallbackItem *ci : update_callback_list) {
 		ci->callback(ci->userdata);
 	}
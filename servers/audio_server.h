@@ -34,6 +34,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -184,8 +185,17 @@ private:
 	uint64_t mix_frames = 0;
 #ifdef DEBUG_ENABLED
 	uint64_t prof_time = 0;
+	// Time spent in AudioStreamPlayback::mix(), per playback class.
+	HashMap<StringName, uint64_t> stream_prof_time;
 #endif
 
+	// Always measured, so they can be monitored in release builds too.
+	std::atomic<uint64_t> mix_step_time_accum = 0;
+	std::atomic<uint64_t> mix_step_count_accum = 0;
+	uint64_t mix_step_time = 0;
+	std::atomic<uint32_t> active_voice_count = 0;
+	std::atomic<uint32_t> virtual_voice_count = 0;
+
 	float channel_disable_threshold_db = 0.0f;
 	uint32_t channel_disable_frames = 0;
 
@@ -196,6 +206,10 @@ private:
 
 	bool tag_used_audio_streams = false;
 
+	bool decode_ahead = false;
+	bool virtualize_inaudible_voices = true;
+	uint32_t max_audible_voices = 0;
+
 	struct Bus {
 		StringName name;
 		bool solo = false;
@@ -226,6 +240,9 @@ private:
 		};
 
 		Vector<Effect> effects;
+#ifdef DEBUG_ENABLED
+		uint64_t prof_time = 0;
+#endif
 		float volume_db = 0.0f;
 		StringName send;
 		int index_cache = 0;
@@ -261,8 +278,31 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Length of the stream in seconds. Only playbacks with a known length can be virtualized.
+		SafeNumeric<float> virtual_length;
+		SafeNumeric<int> virtual_priority;
+		// Virtualized playbacks are inaudible, so only their position is advanced instead of mixing them.
+		SafeFlag virtualized;
+		SafeNumeric<float> virtual_position;
+		// Set on the audio thread when the playback doesn't fit in the audible voice budget.
+		bool over_voice_budget = false;
+	};
+
+	struct VoiceBudgetEntry {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		int priority = 0;
+		float volume = 0.0f;
+
+		bool operator<(const VoiceBudgetEntry &p_other) const {
+			if (priority == p_other.priority) {
+				return volume > p_other.volume;
+			}
+			return priority > p_other.priority;
+		}
 	};
 
+	LocalVector<VoiceBudgetEntry> voice_budget_entries;
+
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard;
 
@@ -286,6 +326,10 @@ private:
 	// Should only be called on the main thread.
 	AudioStreamPlaybackListNode *_find_playback_list_node(Ref<AudioStreamPlayback> p_playback);
 
+	float _get_bus_details_max_volume(const AudioStreamPlaybackBusDetails *p_bus_details) const;
+	void _update_voice_budget();
+	bool _update_playback_virtualization(AudioStreamPlaybackListNode *p_playback);
+
 	struct CallbackItem {
 		AudioCallback callback;
 		void *userdata = nullptr;
@@ -383,10 +427,19 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	void set_playback_virtualization(Ref<AudioStreamPlayback> p_playback, float p_stream_length, int p_priority = 0);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
 	bool is_playback_paused(Ref<AudioStreamPlayback> p_playback);
+	bool is_playback_virtualized(Ref<AudioStreamPlayback> p_playback);
+
+	bool is_decode_ahead_enabled() const { return decode_ahead; }
+
+	// Average time of a mix step during the last frame, in microseconds.
+	uint64_t get_mix_step_time_usec() const { return mix_step_time; }
+	uint32_t get_active_voice_count() const { return active_voice_count.load(); }
+	uint32_t get_virtual_voice_count() const { return virtual_voice_count.load(); }
 
 	uint64_t get_mix_count() const;
 	uint64_t get_mixed_frames() const;
@@ -61,6 +61,15 @@ CameraServer *CameraServer::get_singleton() {
 	return singleton;
 };
 
+void CameraServer::_ensure_feeds_enumerated() {
+	if (feeds_enumerated) {
+		return;
+	}
+	// Set first, feeds added while enumerating must not recurse.
+	feeds_enumerated = true;
+	_enumerate_feeds();
+}
+
 int CameraServer::get_free_id() {
 	bool id_exists = true;
 	int newid = 0;
@@ -80,6 +89,8 @@ int CameraServer::get_free_id() {
 };
 
 int CameraServer::get_feed_index(int p_id) {
+	_ensure_feeds_enumerated();
+
 	for (int i = 0; i < feeds.size(); i++) {
 		if (feeds[i]->get_id() == p_id) {
 			return i;
@@ -129,12 +140,14 @@ void CameraServer::remove_feed(const Ref<CameraFeed> &p_feed) {
 };
 
 Ref<CameraFeed> CameraServer::get_feed(int p_index) {
+	_ensure_feeds_enumerated();
 	ERR_FAIL_INDEX_V(p_index, feeds.size(), nullptr);
 
 	return feeds[p_index];
 };
 
 int CameraServer::get_feed_count() {
+	_ensure_feeds_enumerated();
 	return feeds.size();
 };
 
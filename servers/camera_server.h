@@ -66,9 +66,15 @@ protected:
 	static CreateFunc create_func;
 
 	Vector<Ref<CameraFeed>> feeds;
+	bool feeds_enumerated = false;
 
 	static CameraServer *singleton;
 
+	// Enumerating devices can be slow and may trigger permission prompts, so
+	// implementations do it here, on the first feed query, rather than at startup.
+	virtual void _enumerate_feeds() {}
+	void _ensure_feeds_enumerated();
+
 	static void _bind_methods();
 
 	template <class T>
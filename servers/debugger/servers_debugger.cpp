@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/engine_profiler.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource.h"
 #include "servers/display_server.h"
 
 #define CHECK_SIZE(arr, expected, what) ERR_FAIL_COND_V_MSG((uint32_t)arr.size() < (uint32_t)(expected), false, String("Malformed ") + what + " message from script debugger, message too short. Expected size: " + itos(expected) + ", actual size: " + itos(arr.size()))
@@ -191,6 +192,44 @@ bool ServersDebugger::VisualProfilerFrame::deserialize(const Array &p_arr) {
 	CHECK_END(p_arr, idx, "VisualProfilerFrame");
 	return true;
 }
+
+Array ServersDebugger::RenderStatsFrame::serialize() {
+	Array arr;
+	arr.push_back(materials.size() * 7);
+	for (const MaterialRenderStats &E : materials) {
+		arr.push_back(E.material);
+		arr.push_back(E.shader_path);
+		arr.push_back(E.pass);
+		arr.push_back(E.draw_calls);
+		arr.push_back(E.instances);
+		arr.push_back(E.primitives);
+		arr.push_back(E.shader_changes);
+	}
+	return arr;
+}
+
+bool ServersDebugger::RenderStatsFrame::deserialize(const Array &p_arr) {
+	CHECK_SIZE(p_arr, 1, "RenderStatsFrame");
+	uint32_t size = p_arr[0];
+	ERR_FAIL_COND_V(size % 7, false);
+	CHECK_SIZE(p_arr, 1 + size, "RenderStatsFrame");
+	uint32_t idx = 1;
+	while (idx < 1 + size) {
+		MaterialRenderStats stats;
+		stats.material = p_arr[idx];
+		stats.shader_path = p_arr[idx + 1];
+		stats.pass = p_arr[idx + 2];
+		stats.draw_calls = p_arr[idx + 3];
+		stats.instances = p_arr[idx + 4];
+		stats.primitives = p_arr[idx + 5];
+		stats.shader_changes = p_arr[idx + 6];
+		materials.push_back(stats);
+		idx += 7;
+	}
+	CHECK_END(p_arr, idx, "RenderStatsFrame");
+	return true;
+}
+
 class ServersDebugger::ScriptsProfiler : public EngineProfiler {
 	typedef ServersDebugger::ScriptFunctionSignature FunctionSignature;
 	typedef ServersDebugger::ScriptFunctionInfo FunctionInfo;
@@ -336,10 +375,13 @@ public:
 		}
 		ServerInfo &srv = server_data[name];
 
-		ServerFunctionInfo fi;
-		fi.name = p_data[1];
-		fi.time = p_data[2];
-		srv.functions.push_back(fi);
+		// Servers send name and time pairs for each of their functions.
+		for (int i = 1; i + 1 < p_data.size(); i += 2) {
+			ServerFunctionInfo fi;
+			fi.name = p_data[i];
+			fi.time = p_data[i + 1];
+			srv.functions.push_back(fi);
+		}
 	}
 
 	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
@@ -381,6 +423,66 @@ public:
 	}
 };
 
+class ServersDebugger::RenderStatsProfiler : public EngineProfiler {
+	RID viewport;
+	uint64_t last_send_usec = 0;
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (viewport.is_valid()) {
+			RS::get_singleton()->viewport_set_material_render_stats_enabled(viewport, false);
+			viewport = RID();
+		}
+		if (p_enable) {
+			viewport = RS::get_singleton()->viewport_find_from_screen_attachment(DisplayServer::MAIN_WINDOW_ID);
+			ERR_FAIL_COND_MSG(viewport.is_null(), "No viewport is attached to the main window, render statistics can't be collected.");
+			RS::get_singleton()->viewport_set_material_render_stats_enabled(viewport, true);
+			last_send_usec = 0;
+		}
+	}
+
+	void add(const Array &p_data) {}
+
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		if (viewport.is_null()) {
+			return;
+		}
+		// Statistics describe a single frame, sending them once per second is enough for the table.
+		uint64_t now = OS::get_singleton()->get_ticks_usec();
+		if (last_send_usec && now - last_send_usec < 1000000) {
+			return;
+		}
+		last_send_usec = now;
+
+		// Materials saved to disk are shown by path, built-in ones by their RID.
+		HashMap<RID, String> material_paths;
+		List<Ref<Resource>> cached;
+		ResourceCache::get_cached_resources(&cached);
+		for (const Ref<Resource> &E : cached) {
+			if (E->get_rid().is_valid()) {
+				material_paths[E->get_rid()] = E->get_path();
+			}
+		}
+
+		ServersDebugger::RenderStatsFrame frame;
+		TypedArray<Dictionary> stats = RS::get_singleton()->viewport_get_material_render_stats(viewport);
+		for (int i = 0; i < stats.size(); i++) {
+			Dictionary d = stats[i];
+			RID material = d["material"];
+			ServersDebugger::MaterialRenderStats entry;
+			entry.material = material_paths.has(material) ? material_paths[material] : vformat("Material %d", material.get_id());
+			entry.shader_path = d["shader_path"];
+			entry.pass = d["pass"];
+			entry.draw_calls = d["draw_calls"];
+			entry.instances = d["instances"];
+			entry.primitives = d["primitives"];
+			entry.shader_changes = d["shader_changes"];
+			frame.materials.push_back(entry);
+		}
+		EngineDebugger::get_singleton()->send_message("render_stats:frame", frame.serialize());
+	}
+};
+
 ServersDebugger *ServersDebugger::singleton = nullptr;
 
 void ServersDebugger::initialize() {
@@ -456,6 +558,10 @@ ServersDebugger::ServersDebugger() {
 	visual_profiler.instantiate();
 	visual_profiler->bind("visual");
 
+	// Render statistics per material (draw calls, primitives, shader changes)
+	render_stats_profiler.instantiate();
+	render_stats_profiler->bind("render_stats");
+
 	EngineDebugger::Capture servers_cap(nullptr, &_capture);
 	EngineDebugger::register_message_capture("servers", servers_cap);
 }
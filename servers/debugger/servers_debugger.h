@@ -105,14 +105,34 @@ public:
 		bool deserialize(const Array &p_arr);
 	};
 
+	// Render statistics per material
+	struct MaterialRenderStats {
+		String material;
+		String shader_path;
+		String pass;
+		int draw_calls = 0;
+		int instances = 0;
+		uint64_t primitives = 0;
+		int shader_changes = 0;
+	};
+
+	struct RenderStatsFrame {
+		Vector<MaterialRenderStats> materials;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
 private:
 	class ScriptsProfiler;
 	class ServersProfiler;
 	class VisualProfiler;
+	class RenderStatsProfiler;
 
 	double last_draw_time = 0.0;
 	Ref<ServersProfiler> servers_profiler;
 	Ref<VisualProfiler> visual_profiler;
+	Ref<RenderStatsProfiler> render_stats_profiler;
 
 	static ServersDebugger *singleton;
 
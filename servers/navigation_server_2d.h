@@ -96,6 +96,9 @@ public:
 	virtual Vector2 map_get_closest_point(RID p_map, const Vector2 &p_point) const = 0;
 	virtual RID map_get_closest_point_owner(RID p_map, const Vector2 &p_point) const = 0;
 
+	/// Returns, for each position, the point to move toward to reach the target along the cheapest route.
+	virtual Vector<Vector2> map_get_flow_field_targets(RID p_map, const Vector2 &p_target, const Vector<Vector2> &p_positions, uint32_t p_navigation_layers = 1) const = 0;
+
 	virtual TypedArray<RID> map_get_links(RID p_map) const = 0;
 	virtual TypedArray<RID> map_get_regions(RID p_map) const = 0;
 	virtual TypedArray<RID> map_get_agents(RID p_map) const = 0;
@@ -107,6 +107,9 @@ public:
 	virtual Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const = 0;
 	virtual RID map_get_closest_point_owner(RID p_map, const Vector3 &p_point) const = 0;
 
+	/// Returns, for each position, the point to move toward to reach the target along the cheapest route.
+	virtual Vector<Vector3> map_get_flow_field_targets(RID p_map, const Vector3 &p_target, const Vector<Vector3> &p_positions, uint32_t p_navigation_layers = 1) const = 0;
+
 	virtual TypedArray<RID> map_get_links(RID p_map) const = 0;
 	virtual TypedArray<RID> map_get_regions(RID p_map) const = 0;
 	virtual TypedArray<RID> map_get_agents(RID p_map) const = 0;
@@ -310,6 +313,9 @@ public:
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const = 0;
 
+	/// Queries many paths at once, possibly on other threads, and calls `p_callback` once all the results are set.
+	virtual void query_path_batch_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable());
+
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
@@ -327,6 +333,11 @@ public:
 		INFO_EDGE_MERGE_COUNT,
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
+		INFO_SYNC_TIME_USEC,
+		INFO_AVOIDANCE_TIME_USEC,
+		INFO_PATH_QUERY_COUNT,
+		INFO_PATH_QUERY_TIME_USEC,
+		INFO_PATH_QUERY_EXPANDED_POLYGON_AVERAGE,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
@@ -41,6 +41,8 @@ class GodotAreaPair2D : public GodotConstraint2D {
 	int body_shape = 0;
 	int area_shape = 0;
 	bool colliding = false;
+	uint64_t body_shapes_version = 0;
+	uint64_t area_shapes_version = 0;
 	bool has_space_override = false;
 	bool process_collision = false;
 
@@ -60,6 +62,8 @@ class GodotArea2Pair2D : public GodotConstraint2D {
 	int shape_b = 0;
 	bool colliding_a = false;
 	bool colliding_b = false;
+	uint64_t area_a_shapes_version = 0;
+	uint64_t area_b_shapes_version = 0;
 	bool process_collision_a = false;
 	bool process_collision_b = false;
 	bool area_a_monitorable;
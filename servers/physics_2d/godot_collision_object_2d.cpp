@@ -162,6 +162,8 @@ void GodotCollisionObject2D::_update_shapes() {
 		return;
 	}
 
+	shapes_version++;
+
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 		if (s.disabled) {
@@ -189,6 +191,8 @@ void GodotCollisionObject2D::_update_shapes_with_motion(const Vector2 &p_motion)
 		return;
 	}
 
+	shapes_version++;
+
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 		if (s.disabled) {
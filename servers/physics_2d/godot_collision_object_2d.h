@@ -65,6 +65,7 @@ private:
 	};
 
 	Vector<Shape> shapes;
+	uint64_t shapes_version = 0; // Increased when the shapes move or change, lets pairs skip testing objects that didn't.
 	GodotSpace2D *space = nullptr;
 	Transform2D transform;
 	Transform2D inv_transform;
@@ -108,6 +109,7 @@ public:
 	void _shape_changed() override;
 
 	_FORCE_INLINE_ Type get_type() const { return type; }
+	_FORCE_INLINE_ uint64_t get_shapes_version() const { return shapes_version; }
 	void add_shape(GodotShape2D *p_shape, const Transform2D &p_transform = Transform2D(), bool p_disabled = false);
 	void set_shape(int p_index, GodotShape2D *p_shape);
 	void set_shape_transform(int p_index, const Transform2D &p_transform);
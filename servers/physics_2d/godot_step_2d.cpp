@@ -90,9 +90,13 @@ void GodotStep2D::_pre_solve_island(LocalVector<GodotConstraint2D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
-void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const {
+void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	const LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[p_island_index];
 
+	if (solve_large_islands_colored && constraint_island.size() >= COLORED_ISLAND_MIN_CONSTRAINTS) {
+		return; // Solved separately, spread across threads.
+	}
+
 	for (int i = 0; i < iterations; i++) {
 		uint32_t constraint_count = constraint_island.size();
 		for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
@@ -101,6 +105,71 @@ void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const
 	}
 }
 
+void GodotStep2D::_solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint2D *> *p_batch) {
+	(*p_batch)[p_constraint_index]->solve(delta);
+}
+
+void GodotStep2D::_solve_island_colored(const LocalVector<GodotConstraint2D *> &p_constraint_island) {
+	// Greedy coloring: each constraint gets the first color not used yet by any of the dynamic bodies it affects.
+	// Static and kinematic bodies are only read during solving, so they don't prevent constraints from sharing a color.
+	color_batches.resize(MAX_CONSTRAINT_COLORS + 1);
+	for (LocalVector<GodotConstraint2D *> &batch : color_batches) {
+		batch.clear();
+	}
+	body_colors.clear();
+
+	for (GodotConstraint2D *constraint : p_constraint_island) {
+		uint64_t used_colors = 0;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody2D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
+				const uint64_t *colors = body_colors.getptr(body);
+				if (colors) {
+					used_colors |= *colors;
+				}
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < MAX_CONSTRAINT_COLORS && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+		color_batches[color].push_back(constraint);
+
+		if (color == MAX_CONSTRAINT_COLORS) {
+			continue; // Serial batch, no need to track it.
+		}
+
+		uint64_t color_bit = uint64_t(1) << color;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody2D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
+				uint64_t *colors = body_colors.getptr(body);
+				if (colors) {
+					*colors |= color_bit;
+				} else {
+					body_colors.insert(body, color_bit);
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < iterations; i++) {
+		// Go through all iterations, one color at a time.
+		for (uint32_t color = 0; color <= MAX_CONSTRAINT_COLORS; color++) {
+			LocalVector<GodotConstraint2D *> &batch = color_batches[color];
+			if (color < MAX_CONSTRAINT_COLORS && batch.size() >= COLORED_BATCH_MIN_CONSTRAINTS) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_colored_constraint, &batch, batch.size(), -1, true, SNAME("Physics2DConstraintSolveColor"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				for (GodotConstraint2D *constraint : batch) {
+					constraint->solve(delta);
+				}
+			}
+		}
+	}
+}
+
 void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -240,8 +309,16 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::GroupID group_task;
+	if (total_constraint_count >= PARALLEL_SETUP_MIN_CONSTRAINTS && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		// Each pair only writes its own contact cache, so setups can run concurrently.
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < total_constraint_count; i++) {
+			_setup_constraint(i);
+		}
+	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -252,15 +329,27 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
 	// Warning: This doesn't run on threads, because it involves thread-unsafe processing.
+	large_islands.clear();
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
 		_pre_solve_island(constraint_islands[island_index]);
+		if (constraint_islands[island_index].size() >= COLORED_ISLAND_MIN_CONSTRAINTS) {
+			large_islands.push_back(island_index);
+		}
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
+	// The largest islands would otherwise bound the solving time to what a single thread can do,
+	// so they are solved here instead, while the worker threads handle the rest.
+	solve_large_islands_colored = WorkerThreadPool::get_singleton()->get_thread_count() > 1 && !large_islands.is_empty();
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics2DConstraintSolveIslands"));
+	if (solve_large_islands_colored) {
+		for (uint32_t island_index : large_islands) {
+			_solve_island_colored(constraint_islands[island_index]);
+		}
+	}
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -33,6 +33,7 @@
 
 #include "godot_space_2d.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep2D {
@@ -45,10 +46,32 @@ class GodotStep2D {
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
 
+	// Large islands are split into batches of constraints that share no dynamic body,
+	// so each batch can be solved in parallel. The last batch collects the constraints
+	// that didn't fit in any color and must be solved serially.
+	enum {
+		COLORED_ISLAND_MIN_CONSTRAINTS = 256,
+		COLORED_BATCH_MIN_CONSTRAINTS = 32,
+		MAX_CONSTRAINT_COLORS = 64,
+	};
+
+	// Below this many constraints, the narrowphase setup is cheaper to run inline
+	// than to dispatch and wait for a group task.
+	enum {
+		PARALLEL_SETUP_MIN_CONSTRAINTS = 16,
+	};
+
+	bool solve_large_islands_colored = false;
+	LocalVector<uint32_t> large_islands;
+	LocalVector<LocalVector<GodotConstraint2D *>> color_batches;
+	HashMap<const GodotBody2D *, uint64_t> body_colors;
+
 	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
-	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
+	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_island_colored(const LocalVector<GodotConstraint2D *> &p_constraint_island);
+	void _solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint2D *> *p_batch);
 	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island) const;
 
 public:
@@ -33,9 +33,13 @@
 #include "godot_collision_solver_3d.h"
 
 bool GodotAreaPair3D::setup(real_t p_step) {
-	bool result = false;
-	if (area->collides_with(body) && GodotCollisionSolver3D::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), nullptr, this)) {
-		result = true;
+	bool result = colliding;
+	// Sleeping or unmoved objects keep the previous result, the shapes are only tested again when either side changed.
+	if (body->get_shapes_version() != body_shapes_version || area->get_shapes_version() != area_shapes_version) {
+		body_shapes_version = body->get_shapes_version();
+		area_shapes_version = area->get_shapes_version();
+
+		result = area->collides_with(body) && GodotCollisionSolver3D::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), nullptr, this);
 	}
 
 	process_collision = false;
@@ -118,11 +122,18 @@ GodotAreaPair3D::~GodotAreaPair3D() {
 ////////////////////////////////////////////////////
 
 bool GodotArea2Pair3D::setup(real_t p_step) {
-	bool result_a = area_a->collides_with(area_b);
-	bool result_b = area_b->collides_with(area_a);
-	if ((result_a || result_b) && !GodotCollisionSolver3D::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), nullptr, this)) {
-		result_a = false;
-		result_b = false;
+	bool result_a = colliding_a;
+	bool result_b = colliding_b;
+	if (area_a->get_shapes_version() != area_a_shapes_version || area_b->get_shapes_version() != area_b_shapes_version) {
+		area_a_shapes_version = area_a->get_shapes_version();
+		area_b_shapes_version = area_b->get_shapes_version();
+
+		result_a = area_a->collides_with(area_b);
+		result_b = area_b->collides_with(area_a);
+		if ((result_a || result_b) && !GodotCollisionSolver3D::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), nullptr, this)) {
+			result_a = false;
+			result_b = false;
+		}
 	}
 
 	bool process_collision = false;
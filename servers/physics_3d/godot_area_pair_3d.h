@@ -42,6 +42,8 @@ class GodotAreaPair3D : public GodotConstraint3D {
 	int body_shape;
 	int area_shape;
 	bool colliding = false;
+	uint64_t body_shapes_version = 0;
+	uint64_t area_shapes_version = 0;
 	bool process_collision = false;
 	bool has_space_override = false;
 
@@ -61,6 +63,8 @@ class GodotArea2Pair3D : public GodotConstraint3D {
 	int shape_b;
 	bool colliding_a = false;
 	bool colliding_b = false;
+	uint64_t area_a_shapes_version = 0;
+	uint64_t area_b_shapes_version = 0;
 	bool process_collision_a = false;
 	bool process_collision_b = false;
 	bool area_a_monitorable;
@@ -205,14 +205,13 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	int segment_support_idx = -1;
 	float segment_hit_length = FLT_MAX;
 	Vector3 segment_hit_local;
+	Transform3D from_inv = predicted_xform_B.affine_inverse();
 	for (int i = 0; i < support_count_A; i++) {
 		supports_A[i] = p_xform_A.xform(supports_A[i]);
 
 		Vector3 from = supports_A[i];
 		Vector3 to = from + motion;
 
-		Transform3D from_inv = predicted_xform_B.affine_inverse();
-
 		// Back up 10% of the per-frame motion behind the support point and use that as the beginning of our cast.
 		// At high speeds, this may mean we're actually casting from well behind the body instead of inside it, which is odd.
 		// But it still works out.
@@ -232,9 +231,9 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	}
 
 	if (segment_support_idx == -1) {
-		// There was no hit. Since the segment is the length of per-frame motion, this means the bodies will not
-		// actually collide yet on next frame. We'll probably check again next frame once they're closer.
-		return false;
+		// The support point segments can slip past edges and thin geometry (e.g. a sphere grazing a corner),
+		// so confirm with the swept shape and find the time of impact by bisection, like cast_motion does.
+		return _test_ccd_swept(p_step, p_A, shape_A_ptr, p_xform_A, motion, max - min, p_B->get_shape(p_shape_B), predicted_xform_B);
 	}
 
 	Vector3 hitpos = predicted_xform_B.xform(segment_hit_local);
@@ -250,6 +249,50 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	return true;
 }
 
+bool GodotBodyPair3D::_test_ccd_swept(real_t p_step, GodotBody3D *p_A, GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const Vector3 &p_motion, real_t p_size_A, GodotShape3D *p_shape_B, const Transform3D &p_xform_B) {
+	Transform3D xform_A_inv = p_xform_A.affine_inverse();
+	GodotMotionShape3D mshape;
+	mshape.shape = p_shape_A;
+	mshape.motion = xform_A_inv.basis.xform(p_motion);
+
+	AABB aabb = p_xform_A.xform(p_shape_A->get_aabb());
+	aabb = aabb.merge(AABB(aabb.position + p_motion, aabb.size));
+
+	real_t mlen = p_motion.length();
+	Vector3 mnormal = p_motion / mlen;
+
+	Vector3 point_A, point_B;
+	Vector3 sep_axis = mnormal;
+	if (GodotCollisionSolver3D::solve_distance(&mshape, p_xform_A, p_shape_B, p_xform_B, point_A, point_B, aabb, &sep_axis)) {
+		return false; // Separated during the whole motion, no tunneling possible this frame.
+	}
+
+	sep_axis = mnormal;
+	if (!GodotCollisionSolver3D::solve_distance(p_shape_A, p_xform_A, p_shape_B, p_xform_B, point_A, point_B, aabb, &sep_axis)) {
+		return false; // Already overlapping, regular contacts take care of it.
+	}
+
+	real_t low = 0.0;
+	real_t hi = 1.0;
+	for (int i = 0; i < 8; i++) {
+		real_t fraction = (low + hi) * 0.5;
+		mshape.motion = xform_A_inv.basis.xform(p_motion * fraction);
+
+		Vector3 sep = mnormal;
+		if (GodotCollisionSolver3D::solve_distance(&mshape, p_xform_A, p_shape_B, p_xform_B, point_A, point_B, aabb, &sep)) {
+			low = fraction;
+		} else {
+			hi = fraction;
+		}
+	}
+
+	// Same as the segment based test: arrive just within B's collider next frame.
+	real_t newlen = mlen * hi + p_size_A * 0.01;
+	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+
+	return true;
+}
+
 real_t combine_bounce(GodotBody3D *A, GodotBody3D *B) {
 	return CLAMP(A->get_bounce() + B->get_bounce(), 0, 1);
 }
@@ -103,6 +103,7 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 
 	void validate_contacts();
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
+	bool _test_ccd_swept(real_t p_step, GodotBody3D *p_A, GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const Vector3 &p_motion, real_t p_size_A, GodotShape3D *p_shape_B, const Transform3D &p_xform_B);
 
 public:
 	virtual bool setup(real_t p_step) override;
@@ -157,6 +157,8 @@ void GodotCollisionObject3D::_update_shapes() {
 		return;
 	}
 
+	shapes_version++;
+
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 		if (s.disabled) {
@@ -187,6 +189,8 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 		return;
 	}
 
+	shapes_version++;
+
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 		if (s.disabled) {
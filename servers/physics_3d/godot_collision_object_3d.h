@@ -72,6 +72,7 @@ private:
 	};
 
 	Vector<Shape> shapes;
+	uint64_t shapes_version = 0; // Increased when the shapes move or change, lets pairs skip testing objects that didn't.
 	GodotSpace3D *space = nullptr;
 	Transform3D transform;
 	Transform3D inv_transform;
@@ -116,6 +117,7 @@ public:
 	void _shape_changed() override;
 
 	_FORCE_INLINE_ Type get_type() const { return type; }
+	_FORCE_INLINE_ uint64_t get_shapes_version() const { return shapes_version; }
 	void add_shape(GodotShape3D *p_shape, const Transform3D &p_transform = Transform3D(), bool p_disabled = false);
 	void set_shape(int p_index, GodotShape3D *p_shape);
 	void set_shape_transform(int p_index, const Transform3D &p_transform);
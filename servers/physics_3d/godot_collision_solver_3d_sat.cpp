@@ -779,11 +779,16 @@ static void analytic_sphere_collision(const Vector3 &p_origin_a, real_t p_radius
 	// Get the vector from sphere B to A
 	Vector3 b_to_a = p_origin_a - p_origin_b;
 
+	// Most pairs from the broadphase don't touch, reject them before paying for the square root
+	real_t radius_sum = p_radius_a + p_radius_b;
+	if (b_to_a.length_squared() > radius_sum * radius_sum)
+		return;
+
 	// Get the length from B to A
 	real_t b_to_a_len = b_to_a.length();
 
 	// Calculate the sphere overlap, and bail if not overlapping
-	real_t overlap = p_radius_a + p_radius_b - b_to_a_len;
+	real_t overlap = radius_sum - b_to_a_len;
 	if (overlap < 0)
 		return;
 
@@ -852,11 +857,12 @@ static void _collision_sphere_box(const GodotShape3D *p_a, const Transform3D &p_
 	// See if it is inside the sphere.
 
 	Vector3 delta = nearest - p_transform_a.origin;
-	real_t length = delta.length();
 	real_t radius = sphere_A->get_radius() * p_transform_a.basis[0].length();
-	if (length > radius + p_margin_a + p_margin_b) {
+	real_t max_length = radius + p_margin_a + p_margin_b;
+	if (delta.length_squared() > max_length * max_length) {
 		return;
 	}
+	real_t length = delta.length();
 	p_collector->collided = true;
 	if (!p_collector->callback) {
 		return;
@@ -214,6 +214,102 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+// Raw copy of the body state, snapshots are only meant to be restored by the same build.
+struct GodotBodySnapshot3D {
+	uint64_t rid = 0;
+	Transform3D transform;
+	Vector3 linear_velocity;
+	Vector3 angular_velocity;
+	uint32_t sleeping = 0;
+
+	// Fields are copied one by one, so the struct padding never ends up in the snapshot.
+	static constexpr uint32_t SIZE = sizeof(uint64_t) + sizeof(Transform3D) + sizeof(Vector3) * 2 + sizeof(uint32_t);
+
+	template <typename T>
+	static void _write(uint8_t *&r_dst, const T &p_value) {
+		memcpy(r_dst, &p_value, sizeof(T));
+		r_dst += sizeof(T);
+	}
+
+	template <typename T>
+	static void _read(const uint8_t *&r_src, T &r_value) {
+		memcpy(&r_value, r_src, sizeof(T));
+		r_src += sizeof(T);
+	}
+
+	void write(uint8_t *&r_dst) const {
+		_write(r_dst, rid);
+		_write(r_dst, transform);
+		_write(r_dst, linear_velocity);
+		_write(r_dst, angular_velocity);
+		_write(r_dst, sleeping);
+	}
+
+	void read(const uint8_t *&r_src) {
+		_read(r_src, rid);
+		_read(r_src, transform);
+		_read(r_src, linear_velocity);
+		_read(r_src, angular_velocity);
+		_read(r_src, sleeping);
+	}
+};
+
+Vector<uint8_t> GodotPhysicsServer3D::space_save_snapshot(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+
+	LocalVector<GodotBodySnapshot3D> bodies;
+	for (const GodotCollisionObject3D *E : space->get_objects()) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody3D *body = static_cast<const GodotBody3D *>(E);
+		if (body->get_mode() < PhysicsServer3D::BODY_MODE_RIGID) {
+			continue; // Static and kinematic bodies are driven by the game, not the simulation.
+		}
+
+		GodotBodySnapshot3D snapshot;
+		snapshot.rid = body->get_self().get_id();
+		snapshot.transform = body->get_transform();
+		snapshot.linear_velocity = body->get_linear_velocity();
+		snapshot.angular_velocity = body->get_angular_velocity();
+		snapshot.sleeping = body->is_active() ? 0 : 1;
+		bodies.push_back(snapshot);
+	}
+
+	Vector<uint8_t> ret;
+	ret.resize(bodies.size() * GodotBodySnapshot3D::SIZE);
+	uint8_t *dst = ret.ptrw();
+	for (const GodotBodySnapshot3D &snapshot : bodies) {
+		snapshot.write(dst);
+	}
+	return ret;
+}
+
+void GodotPhysicsServer3D::space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(p_snapshot.size() % GodotBodySnapshot3D::SIZE != 0, "Invalid physics space snapshot.");
+
+	uint32_t count = p_snapshot.size() / GodotBodySnapshot3D::SIZE;
+	const uint8_t *src = p_snapshot.ptr();
+
+	for (uint32_t i = 0; i < count; i++) {
+		GodotBodySnapshot3D snapshot;
+		snapshot.read(src);
+
+		GodotBody3D *body = body_owner.get_or_null(RID::from_uint64(snapshot.rid));
+		if (!body || body->get_space() != space) {
+			continue; // Removed since the snapshot was taken.
+		}
+
+		body->set_state(BODY_STATE_TRANSFORM, snapshot.transform);
+		body->set_state(BODY_STATE_LINEAR_VELOCITY, snapshot.linear_velocity);
+		body->set_state(BODY_STATE_ANGULAR_VELOCITY, snapshot.angular_velocity);
+		body->set_state(BODY_STATE_SLEEPING, snapshot.sleeping != 0);
+	}
+}
+
 RID GodotPhysicsServer3D::area_create() {
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -56,12 +56,12 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	GodotStep3D *stepper = nullptr;
 	HashSet<const GodotSpace3D *> active_spaces;
 
-	mutable RID_PtrOwner<GodotShape3D, true> shape_owner;
+	mutable RID_PtrOwner<GodotShape3D, true> shape_owner{ 65536, 1048576 };
 	mutable RID_PtrOwner<GodotSpace3D, true> space_owner;
-	mutable RID_PtrOwner<GodotArea3D, true> area_owner;
-	mutable RID_PtrOwner<GodotBody3D, true> body_owner;
-	mutable RID_PtrOwner<GodotSoftBody3D, true> soft_body_owner;
-	mutable RID_PtrOwner<GodotJoint3D, true> joint_owner;
+	mutable RID_PtrOwner<GodotArea3D, true> area_owner{ 65536, 1048576 };
+	mutable RID_PtrOwner<GodotBody3D, true> body_owner{ 65536, 1048576 };
+	mutable RID_PtrOwner<GodotSoftBody3D, true> soft_body_owner{ 65536, 1048576 };
+	mutable RID_PtrOwner<GodotJoint3D, true> joint_owner{ 65536, 1048576 };
 
 	//void _clear_query(QuerySW *p_query);
 	friend class GodotCollisionObject3D;
@@ -117,6 +117,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) const override;
+	virtual void space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
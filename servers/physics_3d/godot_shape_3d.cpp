@@ -2055,8 +2055,29 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
+	// Cells entirely above or below the query can't produce contacts, skip them without building faces.
+	real_t min_y = p_local_aabb.position.y;
+	real_t max_y = p_local_aabb.position.y + p_local_aabb.size.y;
+
 	for (int z = start_z; z < end_z; z++) {
 		for (int x = start_x; x < end_x; x++) {
+			if (!bounds_grid.is_empty() && (x == start_x || x % BOUNDS_CHUNK_SIZE == 0)) {
+				// Skip the rest of this chunk's row at once when the whole chunk is out of range.
+				const Range &chunk = _get_bounds_chunk(x / BOUNDS_CHUNK_SIZE, z / BOUNDS_CHUNK_SIZE);
+				if (chunk.min > max_y || chunk.max < min_y) {
+					x = MIN(end_x, (x / BOUNDS_CHUNK_SIZE + 1) * BOUNDS_CHUNK_SIZE) - 1;
+					continue;
+				}
+			}
+
+			real_t h00 = _get_height(x, z);
+			real_t h10 = _get_height(x + 1, z);
+			real_t h01 = _get_height(x, z + 1);
+			real_t h11 = _get_height(x + 1, z + 1);
+			if (MIN(MIN(h00, h10), MIN(h01, h11)) > max_y || MAX(MAX(h00, h10), MAX(h01, h11)) < min_y) {
+				continue;
+			}
+
 			// First triangle.
 			_get_point(x, z, face.vertex[0]);
 			_get_point(x + 1, z, face.vertex[1]);
@@ -116,6 +116,12 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 
 	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
 
+	bool rewind = p_parameters.rewind_ticks > 0 && space->history_count > 0;
+	if (rewind) {
+		const Vector3 segment[2] = { begin, end };
+		amount = space->_rewind_query_results(amount, p_parameters.rewind_ticks, AABB(), segment);
+	}
+
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -141,7 +147,8 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
 
 		int shape_idx = space->intersection_query_subindex_results[i];
-		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
+		const Transform3D &col_xform = rewind ? space->intersection_query_transforms[i] : col_obj->get_transform();
+		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * (rewind ? col_xform.affine_inverse() : col_obj->get_inv_transform());
 
 		Vector3 local_from = inv_xform.xform(begin);
 		Vector3 local_to = inv_xform.xform(end);
@@ -168,7 +175,7 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 		}
 
 		if (shape->intersect_segment(local_from, local_to, shape_point, shape_normal, shape_face_index, p_parameters.hit_back_faces)) {
-			Transform3D xform = col_obj->get_transform() * col_obj->get_shape_transform(shape_idx);
+			Transform3D xform = col_xform * col_obj->get_shape_transform(shape_idx);
 			shape_point = xform.xform(shape_point);
 
 			real_t ld = normal.dot(shape_point);
@@ -217,6 +224,11 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 
 	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
 
+	bool rewind = p_parameters.rewind_ticks > 0 && space->history_count > 0;
+	if (rewind) {
+		amount = space->_rewind_query_results(amount, p_parameters.rewind_ticks, aabb.grow(p_parameters.margin));
+	}
+
 	int cc = 0;
 
 	//Transform3D ai = p_xform.affine_inverse();
@@ -239,7 +251,9 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
 		int shape_idx = space->intersection_query_subindex_results[i];
 
-		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
+		const Transform3D &col_xform = rewind ? space->intersection_query_transforms[i] : col_obj->get_transform();
+
+		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_xform * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
 		}
 
@@ -1114,6 +1128,16 @@ void GodotSpace3D::add_object(GodotCollisionObject3D *p_object) {
 void GodotSpace3D::remove_object(GodotCollisionObject3D *p_object) {
 	ERR_FAIL_COND(!objects.has(p_object));
 	objects.erase(p_object);
+
+	// Don't keep dangling pointers around in the history.
+	for (HistoryFrame &frame : history) {
+		for (uint32_t i = 0; i < frame.bodies.size(); i++) {
+			if (frame.bodies[i].object == p_object) {
+				frame.bodies.remove_at_unordered(i);
+				break;
+			}
+		}
+	}
 }
 
 const HashSet<GodotCollisionObject3D *> &GodotSpace3D::get_objects() const {
@@ -1186,6 +1210,82 @@ void GodotSpace3D::update() {
 	broadphase->update();
 }
 
+void GodotSpace3D::record_history() {
+	if (history_ticks == 0) {
+		return;
+	}
+
+	HistoryFrame &frame = history[history_pos];
+	frame.bodies.clear();
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY || static_cast<GodotBody3D *>(E)->get_mode() == PhysicsServer3D::BODY_MODE_STATIC) {
+			continue;
+		}
+		HistoryBody hb;
+		hb.object = E;
+		hb.transform = E->get_transform();
+		frame.bodies.push_back(hb);
+	}
+
+	history_pos = (history_pos + 1) % history_ticks;
+	if (history_count < history_ticks) {
+		history_count++;
+	}
+}
+
+const GodotSpace3D::HistoryFrame *GodotSpace3D::_get_history_frame(int p_ticks_ago) const {
+	if (history_count == 0) {
+		return nullptr;
+	}
+	// The newest frame matches the current state, so N ticks ago is N frames before it.
+	uint32_t ago = MIN((uint32_t)p_ticks_ago, history_count - 1);
+	return &history[(history_pos + history_ticks - 1 - ago) % history_ticks];
+}
+
+int GodotSpace3D::_rewind_query_results(int p_amount, int p_ticks_ago, const AABB &p_aabb, const Vector3 *p_segment) {
+	const HistoryFrame *frame = _get_history_frame(p_ticks_ago);
+	ERR_FAIL_NULL_V(frame, 0);
+
+	// Keep static bodies and areas from the broadphase at their current transform,
+	// drop everything that was recorded, since it is re-added below at its past transform.
+	int amount = 0;
+	for (int i = 0; i < p_amount; i++) {
+		GodotCollisionObject3D *col_obj = intersection_query_results[i];
+		if (col_obj->get_type() == GodotCollisionObject3D::TYPE_BODY && static_cast<GodotBody3D *>(col_obj)->get_mode() != PhysicsServer3D::BODY_MODE_STATIC) {
+			continue;
+		}
+		intersection_query_results[amount] = col_obj;
+		intersection_query_subindex_results[amount] = intersection_query_subindex_results[i];
+		intersection_query_transforms[amount] = col_obj->get_transform();
+		amount++;
+	}
+
+	for (const HistoryBody &hb : frame->bodies) {
+		GodotCollisionObject3D *col_obj = hb.object;
+		if (col_obj->get_type() == GodotCollisionObject3D::TYPE_BODY && static_cast<GodotBody3D *>(col_obj)->get_mode() == PhysicsServer3D::BODY_MODE_STATIC) {
+			continue; // Became static since it was recorded, the broadphase already has it.
+		}
+		for (int j = 0; j < col_obj->get_shape_count(); j++) {
+			if (amount >= INTERSECTION_QUERY_MAX) {
+				return amount;
+			}
+			if (col_obj->is_shape_disabled(j)) {
+				continue;
+			}
+			AABB shape_aabb = (hb.transform * col_obj->get_shape_transform(j)).xform(col_obj->get_shape(j)->get_aabb());
+			if (p_segment ? !shape_aabb.intersects_segment(p_segment[0], p_segment[1]) : !shape_aabb.intersects(p_aabb)) {
+				continue;
+			}
+			intersection_query_results[amount] = col_obj;
+			intersection_query_subindex_results[amount] = j;
+			intersection_query_transforms[amount] = hb.transform;
+			amount++;
+		}
+	}
+
+	return amount;
+}
+
 void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS:
@@ -1212,6 +1312,13 @@ void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_v
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			solver_iterations = p_value;
 			break;
+		case PhysicsServer3D::SPACE_PARAM_HISTORY_TICKS:
+			history_ticks = MAX((int)p_value, 0);
+			history.clear();
+			history.resize(history_ticks);
+			history_pos = 0;
+			history_count = 0;
+			break;
 	}
 }
 
@@ -1233,6 +1340,8 @@ real_t GodotSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 			return body_time_to_sleep;
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			return solver_iterations;
+		case PhysicsServer3D::SPACE_PARAM_HISTORY_TICKS:
+			return history_ticks;
 	}
 	return 0;
 }
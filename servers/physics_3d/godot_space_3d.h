@@ -106,6 +106,22 @@ private:
 
 	GodotCollisionObject3D *intersection_query_results[INTERSECTION_QUERY_MAX];
 	int intersection_query_subindex_results[INTERSECTION_QUERY_MAX];
+	Transform3D intersection_query_transforms[INTERSECTION_QUERY_MAX]; // Only filled by _rewind_query_results().
+
+	// Ring of non-static body transforms for the last history_ticks steps, used for lag-compensated queries.
+	struct HistoryBody {
+		GodotCollisionObject3D *object = nullptr;
+		Transform3D transform;
+	};
+
+	struct HistoryFrame {
+		LocalVector<HistoryBody> bodies;
+	};
+
+	LocalVector<HistoryFrame> history;
+	uint32_t history_ticks = 0;
+	uint32_t history_pos = 0;
+	uint32_t history_count = 0;
 
 	real_t body_linear_velocity_sleep_threshold = 0.0;
 	real_t body_angular_velocity_sleep_threshold = 0.0;
@@ -128,6 +144,9 @@ private:
 
 	int _cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb);
 
+	const HistoryFrame *_get_history_frame(int p_ticks_ago) const;
+	int _rewind_query_results(int p_amount, int p_ticks_ago, const AABB &p_aabb, const Vector3 *p_segment = nullptr);
+
 public:
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
@@ -171,6 +190,7 @@ public:
 
 	void update();
 	void setup();
+	void record_history();
 	void call_queries();
 
 	bool is_locked() const;
@@ -32,6 +32,8 @@
 
 #include "godot_joint_3d.h"
 
+#include "core/config/project_settings.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
@@ -55,9 +57,29 @@ void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D
 			continue; // Already processed.
 		}
 		constraint->set_island_step(_step);
-		p_constraint_island.push_back(constraint);
 
-		all_constraints.push_back(constraint);
+		bool reaches_sleeping_body = false;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody3D *other_body = constraint->get_body_ptr()[i];
+			if (i != E.value && other_body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC && !other_body->is_active() && other_body->get_island_step() != _step) {
+				reaches_sleeping_body = true;
+				break;
+			}
+		}
+
+		if (reaches_sleeping_body) {
+			// Sleeping islands are only woken up by constraints that actually act on them, not by
+			// active bodies merely entering their broadphase margin. This setup runs serially, during
+			// island generation, and is not part of the setup pass below. It only concerns the
+			// constraints on the boundary of sleeping islands, which are few.
+			if (!constraint->setup(delta)) {
+				continue;
+			}
+			p_constraint_island.push_back(constraint);
+		} else {
+			p_constraint_island.push_back(constraint);
+			all_constraints.push_back(constraint);
+		}
 
 		// Find connected rigid bodies.
 		for (int i = 0; i < constraint->get_body_count(); i++) {
@@ -117,6 +139,10 @@ void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
@@ -133,6 +159,10 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
+	if (solve_large_islands_colored && constraint_island.size() >= COLORED_ISLAND_MIN_CONSTRAINTS) {
+		return; // Solved separately, spread across threads.
+	}
+
 	int current_priority = 1;
 
 	uint32_t constraint_count = constraint_island.size();
@@ -158,6 +188,107 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_batch) {
+	(*p_batch)[p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_island_colored(LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	// Greedy coloring: each constraint gets the first color not used yet by any of the dynamic bodies it affects.
+	// Static and kinematic bodies are only read during solving, so they don't prevent constraints from sharing a color.
+	color_batches.resize(MAX_CONSTRAINT_COLORS + 1);
+	for (LocalVector<GodotConstraint3D *> &batch : color_batches) {
+		batch.clear();
+	}
+	object_colors.clear();
+
+	for (GodotConstraint3D *constraint : p_constraint_island) {
+		uint64_t used_colors = 0;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				const uint64_t *colors = object_colors.getptr(body);
+				if (colors) {
+					used_colors |= *colors;
+				}
+			}
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			const uint64_t *colors = object_colors.getptr(constraint->get_soft_body_ptr(i));
+			if (colors) {
+				used_colors |= *colors;
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < MAX_CONSTRAINT_COLORS && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+		color_batches[color].push_back(constraint);
+
+		if (color == MAX_CONSTRAINT_COLORS) {
+			continue; // Serial batch, no need to track it.
+		}
+
+		uint64_t color_bit = uint64_t(1) << color;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				uint64_t *colors = object_colors.getptr(body);
+				if (colors) {
+					*colors |= color_bit;
+				} else {
+					object_colors.insert(body, color_bit);
+				}
+			}
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			const GodotSoftBody3D *soft_body = constraint->get_soft_body_ptr(i);
+			uint64_t *colors = object_colors.getptr(soft_body);
+			if (colors) {
+				*colors |= color_bit;
+			} else {
+				object_colors.insert(soft_body, color_bit);
+			}
+		}
+	}
+
+	int current_priority = 1;
+
+	uint32_t constraint_count = p_constraint_island.size();
+	while (constraint_count > 0) {
+		for (int i = 0; i < iterations; i++) {
+			// Go through all iterations, one color at a time.
+			for (uint32_t color = 0; color <= MAX_CONSTRAINT_COLORS; color++) {
+				LocalVector<GodotConstraint3D *> &batch = color_batches[color];
+				if (color < MAX_CONSTRAINT_COLORS && batch.size() >= COLORED_BATCH_MIN_CONSTRAINTS) {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_colored_constraint, &batch, batch.size(), -1, true, SNAME("Physics3DConstraintSolveColor"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				} else {
+					for (GodotConstraint3D *constraint : batch) {
+						constraint->solve(delta);
+					}
+				}
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		constraint_count = 0;
+		++current_priority;
+		for (LocalVector<GodotConstraint3D *> &batch : color_batches) {
+			uint32_t priority_constraint_count = 0;
+			for (uint32_t constraint_index = 0; constraint_index < batch.size(); ++constraint_index) {
+				GodotConstraint3D *constraint = batch[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					// Keep this constraint for the next iteration.
+					batch[priority_constraint_count++] = constraint;
+				}
+			}
+			batch.resize(priority_constraint_count);
+			constraint_count += priority_constraint_count;
+		}
+	}
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -183,6 +314,7 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 }
 
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
+	ENGINE_TRACE_ZONE("GodotStep3D::step");
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -344,8 +476,16 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::GroupID group_task;
+	if (total_constraint_count >= PARALLEL_SETUP_MIN_CONSTRAINTS && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		// Each pair only writes its own contact cache, so setups can run concurrently.
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < total_constraint_count; i++) {
+			_setup_constraint(i);
+		}
+	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -356,15 +496,27 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
 	// Warning: This doesn't run on threads, because it involves thread-unsafe processing.
+	large_islands.clear();
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
 		_pre_solve_island(constraint_islands[island_index]);
+		if (constraint_islands[island_index].size() >= COLORED_ISLAND_MIN_CONSTRAINTS) {
+			large_islands.push_back(island_index);
+		}
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
+	// The largest islands would otherwise bound the solving time to what a single thread can do,
+	// so they are solved here instead, while the worker threads handle the rest.
+	solve_large_islands_colored = !deterministic && WorkerThreadPool::get_singleton()->get_thread_count() > 1 && !large_islands.is_empty();
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+	if (solve_large_islands_colored) {
+		for (uint32_t island_index : large_islands) {
+			_solve_island_colored(constraint_islands[island_index]);
+		}
+	}
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -390,12 +542,23 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
+	// Soft bodies only touch their own nodes, links and faces here, so they can be solved concurrently.
+	active_soft_bodies.clear();
 	sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->solve_constraints(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 	}
 
+	if (active_soft_bodies.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodySolve"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < active_soft_bodies.size(); i++) {
+			_solve_soft_body_constraints(i);
+		}
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
@@ -404,6 +567,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	all_constraints.clear();
 
+	p_space->record_history();
+
 	p_space->unlock();
 	_step++;
 }
@@ -412,6 +577,8 @@ GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+
+	deterministic = GLOBAL_GET("physics/3d/solver/deterministic");
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -44,13 +44,41 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotSoftBody3D *> active_soft_bodies;
+
+	// Large islands are split into batches of constraints that share no dynamic body,
+	// so each batch can be solved in parallel. The last batch collects the constraints
+	// that didn't fit in any color and must be solved serially.
+	enum {
+		COLORED_ISLAND_MIN_CONSTRAINTS = 256,
+		COLORED_BATCH_MIN_CONSTRAINTS = 32,
+		MAX_CONSTRAINT_COLORS = 64,
+	};
+
+	// Below this many constraints, the narrowphase setup is cheaper to run inline
+	// than to dispatch and wait for a group task.
+	enum {
+		PARALLEL_SETUP_MIN_CONSTRAINTS = 16,
+	};
+
+	// Keeps the solving order independent from the amount of worker threads, so the same
+	// simulation gives the same results on every machine.
+	bool deterministic = false;
+
+	bool solve_large_islands_colored = false;
+	LocalVector<uint32_t> large_islands;
+	LocalVector<LocalVector<GodotConstraint3D *>> color_batches;
+	HashMap<const void *, uint64_t> object_colors;
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_island_colored(LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_batch);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata = nullptr);
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
@@ -122,9 +122,11 @@ class PhysicsDirectSpaceState3D : public Object {
 
 private:
 	Dictionary _intersect_ray(const Ref<PhysicsRayQueryParameters3D> &p_ray_query);
+	Dictionary _intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	PackedVector2Array _cast_motion_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_motions);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 
@@ -145,6 +147,8 @@ public:
 		bool hit_back_faces = true;
 
 		bool pick_ray = false;
+
+		int rewind_ticks = 0; // Test against body transforms from this many physics ticks ago.
 	};
 
 	struct RayResult {
@@ -158,6 +162,9 @@ public:
 	};
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
+	// Casts p_count rays sharing the same filters, only from/to in p_parameters are ignored.
+	// Writes one result per ray and returns the amount of rays that hit something.
+	virtual int intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits);
 
 	struct ShapeResult {
 		RID rid;
@@ -187,6 +194,8 @@ public:
 
 		bool collide_with_bodies = true;
 		bool collide_with_areas = false;
+
+		int rewind_ticks = 0; // Only used by intersect_shape().
 	};
 
 	struct ShapeRestInfo {
@@ -294,6 +303,7 @@ public:
 		SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD,
 		SPACE_PARAM_BODY_TIME_TO_SLEEP,
 		SPACE_PARAM_SOLVER_ITERATIONS,
+		SPACE_PARAM_HISTORY_TICKS,
 	};
 
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
@@ -306,6 +316,10 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Transforms, velocities and sleep state of all the rigid bodies in the space, for rollback.
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) const = 0;
+	virtual void space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -847,6 +861,9 @@ public:
 	void set_hit_back_faces(bool p_enable) { parameters.hit_back_faces = p_enable; }
 	bool is_hit_back_faces_enabled() const { return parameters.hit_back_faces; }
 
+	void set_rewind_ticks(int p_ticks) { parameters.rewind_ticks = MAX(p_ticks, 0); }
+	int get_rewind_ticks() const { return parameters.rewind_ticks; }
+
 	void set_exclude(const TypedArray<RID> &p_exclude);
 	TypedArray<RID> get_exclude() const;
 };
@@ -906,6 +923,9 @@ public:
 	void set_margin(real_t p_margin) { parameters.margin = p_margin; }
 	real_t get_margin() const { return parameters.margin; }
 
+	void set_rewind_ticks(int p_ticks) { parameters.rewind_ticks = MAX(p_ticks, 0); }
+	int get_rewind_ticks() const { return parameters.rewind_ticks; }
+
 	void set_collision_mask(uint32_t p_mask) { parameters.collision_mask = p_mask; }
 	uint32_t get_collision_mask() const { return parameters.collision_mask; }
 
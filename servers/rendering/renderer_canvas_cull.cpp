@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -43,8 +44,49 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	memset(z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
 	memset(z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
 
-	for (int i = 0; i < p_child_item_count; i++) {
-		_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, true, canvas_cull_mask);
+	uint32_t split_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), uint32_t(p_child_item_count / THREADED_CULL_MIN_ITEMS_PER_SPLIT));
+
+	if (split_count > 1) {
+		// Each split culls a contiguous range of the top level items into its own z lists,
+		// which are then appended in order, so the result is the same as culling serially.
+		if (cull_splits.size() < split_count) {
+			uint32_t from = cull_splits.size();
+			cull_splits.resize(split_count);
+			for (uint32_t i = from; i < split_count; i++) {
+				cull_splits[i].z_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+				cull_splits[i].z_last_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			}
+		}
+
+		CullTreeData data;
+		data.child_items = p_child_items;
+		data.child_item_count = p_child_item_count;
+		data.split_count = split_count;
+		data.transform = p_transform;
+		data.clip_rect = p_clip_rect;
+		data.canvas_cull_mask = canvas_cull_mask;
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasCull::_cull_canvas_item_tree_split, &data, split_count, -1, true, SNAME("RenderCanvasCull"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (uint32_t i = 0; i < split_count; i++) {
+			const CullSplit &split = cull_splits[i];
+			for (int j = 0; j < z_range; j++) {
+				if (!split.z_list[j]) {
+					continue;
+				}
+				if (z_last_list[j]) {
+					z_last_list[j]->next = split.z_list[j];
+				} else {
+					z_list[j] = split.z_list[j];
+				}
+				z_last_list[j] = split.z_last_list[j];
+			}
+		}
+	} else {
+		for (int i = 0; i < p_child_item_count; i++) {
+			_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, true, canvas_cull_mask);
+		}
 	}
 	if (p_canvas_item) {
 		_cull_canvas_item(p_canvas_item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, true, canvas_cull_mask);
@@ -75,6 +117,18 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	}
 }
 
+void RendererCanvasCull::_cull_canvas_item_tree_split(uint32_t p_split, CullTreeData *p_data) {
+	CullSplit &split = cull_splits[p_split];
+	memset(split.z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+	memset(split.z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+
+	int from = p_split * p_data->child_item_count / p_data->split_count;
+	int to = (p_split + 1) * p_data->child_item_count / p_data->split_count;
+	for (int i = from; i < to; i++) {
+		_cull_canvas_item(p_data->child_items[i].item, p_data->transform, p_data->clip_rect, Color(1, 1, 1, 1), 0, split.z_list, split.z_last_list, nullptr, nullptr, true, p_data->canvas_cull_mask);
+	}
+}
+
 void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, Transform2D p_transform, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z) {
 	int child_item_count = p_canvas_item->child_items.size();
 	RendererCanvasCull::Item **child_items = p_canvas_item->child_items.ptrw();
@@ -186,6 +240,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		//something to draw?
 
 		if (ci->update_when_visible) {
+			MutexLock lock(cull_mutex);
 			RenderingServerDefault::redraw_request();
 		}
 
@@ -213,6 +268,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		}
 
 		if (ci->visibility_notifier) {
+			MutexLock lock(cull_mutex);
 			if (!ci->visibility_notifier->visible_element.in_list()) {
 				visibility_notifier_list.add(&ci->visibility_notifier->visible_element);
 				ci->visibility_notifier->just_visible = true;
@@ -239,7 +295,14 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 		ci->children_order_dirty = false;
 	}
 
-	Rect2 rect = ci->get_rect();
+	Rect2 rect;
+	if (ci->custom_rect || (!ci->rect_dirty && !ci->update_when_visible && ci->skeleton == RID())) {
+		rect = ci->get_rect();
+	} else {
+		// Updating the rect may query (and update) mesh and particle storage.
+		MutexLock lock(cull_mutex);
+		rect = ci->get_rect();
+	}
 
 	if (ci->visibility_notifier) {
 		if (ci->visibility_notifier->area.size != Vector2()) {
@@ -2174,4 +2237,8 @@ RendererCanvasCull::RendererCanvasCull() {
 RendererCanvasCull::~RendererCanvasCull() {
 	memfree(z_list);
 	memfree(z_last_list);
+	for (CullSplit &split : cull_splits) {
+		memfree(split.z_list);
+		memfree(split.z_last_list);
+	}
 }
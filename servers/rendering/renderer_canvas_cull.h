@@ -167,7 +167,7 @@ public:
 	};
 
 	mutable RID_Owner<Canvas, true> canvas_owner;
-	RID_Owner<Item, true> canvas_item_owner;
+	RID_Owner<Item, true> canvas_item_owner{ 65536, 4194304 };
 	RID_Owner<RendererCanvasRender::Light, true> canvas_light_owner;
 
 	bool disable_scale;
@@ -192,6 +192,30 @@ private:
 	RendererCanvasRender::Item **z_list;
 	RendererCanvasRender::Item **z_last_list;
 
+	enum {
+		// Top level items are split across threads in contiguous ranges of at least this size.
+		THREADED_CULL_MIN_ITEMS_PER_SPLIT = 16,
+	};
+
+	struct CullSplit {
+		RendererCanvasRender::Item **z_list = nullptr;
+		RendererCanvasRender::Item **z_last_list = nullptr;
+	};
+
+	struct CullTreeData {
+		Canvas::ChildItem *child_items = nullptr;
+		int child_item_count = 0;
+		uint32_t split_count = 0;
+		Transform2D transform;
+		Rect2 clip_rect;
+		uint32_t canvas_cull_mask = 0;
+	};
+
+	LocalVector<CullSplit> cull_splits;
+	Mutex cull_mutex; // Protects state shared by all splits while culling on threads.
+
+	void _cull_canvas_item_tree_split(uint32_t p_split, CullTreeData *p_data);
+
 public:
 	void render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask);
 
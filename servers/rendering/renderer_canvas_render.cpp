@@ -31,6 +31,83 @@
 #include "renderer_canvas_render.h"
 #include "servers/rendering/rendering_server_globals.h"
 
+RendererCanvasRender::PolygonID RendererCanvasRender::request_shared_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights) {
+	PolygonCacheKey key;
+	key.indices = p_indices;
+	key.points = p_points;
+	key.colors = p_colors;
+	key.uvs = p_uvs;
+	key.bones = p_bones;
+	key.weights = p_weights;
+
+	uint32_t h = hash_murmur3_one_32(p_points.size());
+	h = hash_murmur3_buffer(p_indices.ptr(), p_indices.size() * sizeof(int), h);
+	h = hash_murmur3_buffer(p_points.ptr(), p_points.size() * sizeof(Point2), h);
+	h = hash_murmur3_buffer(p_colors.ptr(), p_colors.size() * sizeof(Color), h);
+	h = hash_murmur3_buffer(p_uvs.ptr(), p_uvs.size() * sizeof(Point2), h);
+	h = hash_murmur3_buffer(p_bones.ptr(), p_bones.size() * sizeof(int), h);
+	h = hash_murmur3_buffer(p_weights.ptr(), p_weights.size() * sizeof(float), h);
+	key.hash = hash_fmix32(h);
+
+	PolygonCacheEntry *entry = polygon_cache.getptr(key);
+	if (entry) {
+		if (entry->unused_element) {
+			unused_polygons.erase(entry->unused_element);
+			entry->unused_element = nullptr;
+		}
+		entry->refcount++;
+		return entry->polygon_id;
+	}
+
+	PolygonID id = request_polygon(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
+	if (id == 0) {
+		return 0;
+	}
+
+	PolygonCacheEntry new_entry;
+	new_entry.polygon_id = id;
+	new_entry.refcount = 1;
+	polygon_cache.insert(key, new_entry);
+	polygon_cache_keys.insert(id, key);
+
+	return id;
+}
+
+void RendererCanvasRender::free_shared_polygon(PolygonID p_polygon) {
+	HashMap<PolygonID, PolygonCacheKey>::Iterator E = polygon_cache_keys.find(p_polygon);
+	ERR_FAIL_COND(!E);
+
+	PolygonCacheEntry *entry = polygon_cache.getptr(E->value);
+	ERR_FAIL_NULL(entry);
+
+	entry->refcount--;
+	if (entry->refcount > 0) {
+		return;
+	}
+
+	entry->unused_element = unused_polygons.push_back(p_polygon);
+	if (unused_polygons.size() > MAX_UNUSED_SHARED_POLYGONS) {
+		_evict_unused_shared_polygon();
+	}
+}
+
+void RendererCanvasRender::_evict_unused_shared_polygon() {
+	PolygonID polygon = unused_polygons.front()->get();
+	unused_polygons.pop_front();
+
+	HashMap<PolygonID, PolygonCacheKey>::Iterator E = polygon_cache_keys.find(polygon);
+	ERR_FAIL_COND(!E);
+	polygon_cache.erase(E->value);
+	polygon_cache_keys.remove(E);
+	free_polygon(polygon);
+}
+
+void RendererCanvasRender::free_unused_shared_polygons() {
+	while (!unused_polygons.is_empty()) {
+		_evict_unused_shared_polygon();
+	}
+}
+
 const Rect2 &RendererCanvasRender::Item::get_rect() const {
 	if (custom_rect || (!rect_dirty && !update_when_visible && skeleton == RID())) {
 		return rect;
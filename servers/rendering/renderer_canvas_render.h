@@ -130,6 +130,53 @@ public:
 	virtual PolygonID request_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>()) = 0;
 	virtual void free_polygon(PolygonID p_polygon) = 0;
 
+private:
+	// Polygons with identical contents (e.g. a StyleBox redrawn every frame) share
+	// one set of GPU buffers, so re-recording an unchanged item doesn't reupload them.
+	// Clearing an item releases its polygons before they are recorded again, so the
+	// unused ones are kept around (oldest evicted first) to be picked up by the redraw.
+	enum {
+		MAX_UNUSED_SHARED_POLYGONS = 1024,
+	};
+
+	struct PolygonCacheKey {
+		Vector<int> indices;
+		Vector<Point2> points;
+		Vector<Color> colors;
+		Vector<Point2> uvs;
+		Vector<int> bones;
+		Vector<float> weights;
+		uint32_t hash = 0;
+
+		bool operator==(const PolygonCacheKey &p_key) const {
+			return hash == p_key.hash && indices == p_key.indices && points == p_key.points && colors == p_key.colors && uvs == p_key.uvs && bones == p_key.bones && weights == p_key.weights;
+		}
+	};
+
+	struct PolygonCacheKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const PolygonCacheKey &p_key) { return p_key.hash; }
+	};
+
+	struct PolygonCacheEntry {
+		PolygonID polygon_id = 0;
+		uint32_t refcount = 0;
+		List<PolygonID>::Element *unused_element = nullptr;
+	};
+
+	HashMap<PolygonCacheKey, PolygonCacheEntry, PolygonCacheKeyHasher> polygon_cache;
+	HashMap<PolygonID, PolygonCacheKey> polygon_cache_keys;
+	List<PolygonID> unused_polygons;
+
+	void _evict_unused_shared_polygon();
+
+protected:
+	// Must be called by the implementations before they are destroyed, as it frees polygons.
+	void free_unused_shared_polygons();
+
+public:
+	PolygonID request_shared_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>());
+	void free_shared_polygon(PolygonID p_polygon);
+
 	//also easier to wrap to avoid mistakes
 	struct Polygon {
 		PolygonID polygon_id;
@@ -145,13 +192,13 @@ public:
 					rect_cache.expand_to(v2[i]);
 				}
 			}
-			polygon_id = singleton->request_polygon(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
+			polygon_id = singleton->request_shared_polygon(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
 		}
 
 		_FORCE_INLINE_ Polygon() { polygon_id = 0; }
 		_FORCE_INLINE_ ~Polygon() {
 			if (polygon_id) {
-				singleton->free_polygon(polygon_id);
+				singleton->free_shared_polygon(polygon_id);
 			}
 		}
 	};
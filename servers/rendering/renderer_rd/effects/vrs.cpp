@@ -108,11 +108,15 @@ Size2i VRS::get_vrs_texture_size(const Size2i p_base_size) const {
 void VRS::update_vrs_texture(RID p_vrs_fb, RID p_render_target) {
 	TextureStorage *texture_storage = TextureStorage::get_singleton();
 	RS::ViewportVRSMode vrs_mode = texture_storage->render_target_get_vrs_mode(p_render_target);
+	RS::ViewportVRSUpdateMode vrs_update_mode = texture_storage->render_target_get_vrs_update_mode(p_render_target);
 
-	if (vrs_mode != RS::VIEWPORT_VRS_DISABLED) {
-		RD::get_singleton()->draw_command_begin_label("VRS Setup");
+	if (vrs_mode != RS::VIEWPORT_VRS_DISABLED && vrs_update_mode != RS::VIEWPORT_VRS_UPDATE_DISABLED) {
+		if (vrs_mode == RS::VIEWPORT_VRS_TEXTURE && vrs_update_mode == RS::VIEWPORT_VRS_UPDATE_ONCE && texture_storage->render_target_get_vrs_updated_framebuffer(p_render_target) == p_vrs_fb) {
+			// Density buffer already holds this texture, and it's not expected to change.
+			return;
+		}
 
-		// TODO figure out if image has changed since it was last copied so we can save some resources..
+		RD::get_singleton()->draw_command_begin_label("VRS Setup");
 
 		if (vrs_mode == RS::VIEWPORT_VRS_TEXTURE) {
 			RID vrs_texture = texture_storage->render_target_get_vrs_texture(p_render_target);
@@ -122,6 +126,7 @@ void VRS::update_vrs_texture(RID p_vrs_fb, RID p_render_target) {
 				if (rd_texture.is_valid()) {
 					// Copy into our density buffer
 					copy_vrs(rd_texture, p_vrs_fb, layers > 1);
+					texture_storage->render_target_set_vrs_updated_framebuffer(p_render_target, p_vrs_fb);
 				}
 			}
 		} else if (vrs_mode == RS::VIEWPORT_VRS_XR) {
@@ -727,7 +727,7 @@ void Fog::volumetric_fog_update(const VolumetricFogSettings &p_settings, const P
 
 		RD::get_singleton()->draw_command_end_label();
 
-		RD::get_singleton()->compute_list_end();
+		RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_COMPUTE); // The density map is only read by the volumetric fog shaders.
 	}
 
 	bool gi_dependent_sets_valid = fog->sync_gi_dependent_sets_validity();
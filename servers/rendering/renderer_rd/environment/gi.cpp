@@ -1187,9 +1187,21 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
-	for (SDFGI::Cascade &cascade : cascades) {
+	// Compute where every cascade wants to scroll to, but don't commit anything yet,
+	// as the amount of cascades updated in a single frame may be limited.
+	Vector3i new_positions[SDFGI::MAX_CASCADES];
+	Vector3i new_dirty_regions[SDFGI::MAX_CASCADES];
+	uint32_t pending_count = 0;
+
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		SDFGI::Cascade &cascade = cascades[i];
 		cascade.dirty_regions = Vector3i();
 
+		Vector3i &position = new_positions[i];
+		Vector3i &dirty_regions = new_dirty_regions[i];
+		position = cascade.position;
+		dirty_regions = Vector3i();
+
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
 
@@ -1198,40 +1210,88 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 		Vector3i pos_in_cascade = Vector3i((world_position + probe_half_size) / cascade.cell_size);
 
 		for (int j = 0; j < 3; j++) {
-			if (pos_in_cascade[j] < cascade.position[j]) {
-				while (pos_in_cascade[j] < (cascade.position[j] - drag_margin)) {
-					cascade.position[j] -= drag_margin * 2;
-					cascade.dirty_regions[j] += drag_margin * 2;
+			if (pos_in_cascade[j] < position[j]) {
+				while (pos_in_cascade[j] < (position[j] - drag_margin)) {
+					position[j] -= drag_margin * 2;
+					dirty_regions[j] += drag_margin * 2;
 				}
-			} else if (pos_in_cascade[j] > cascade.position[j]) {
-				while (pos_in_cascade[j] > (cascade.position[j] + drag_margin)) {
-					cascade.position[j] += drag_margin * 2;
-					cascade.dirty_regions[j] -= drag_margin * 2;
+			} else if (pos_in_cascade[j] > position[j]) {
+				while (pos_in_cascade[j] > (position[j] + drag_margin)) {
+					position[j] += drag_margin * 2;
+					dirty_regions[j] -= drag_margin * 2;
 				}
 			}
 
-			if (cascade.dirty_regions[j] == 0) {
+			if (dirty_regions[j] == 0) {
 				continue; // not dirty
-			} else if (uint32_t(ABS(cascade.dirty_regions[j])) >= cascade_size) {
+			} else if (uint32_t(ABS(dirty_regions[j])) >= cascade_size) {
 				//moved too much, just redraw everything (make all dirty)
-				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				dirty_regions = SDFGI::Cascade::DIRTY_ALL;
 				break;
 			}
 		}
 
-		if (cascade.dirty_regions != Vector3i() && cascade.dirty_regions != SDFGI::Cascade::DIRTY_ALL) {
+		if (dirty_regions != Vector3i() && dirty_regions != SDFGI::Cascade::DIRTY_ALL) {
 			//see how much the total dirty volume represents from the total volume
 			uint32_t total_volume = cascade_size * cascade_size * cascade_size;
 			uint32_t safe_volume = 1;
 			for (int j = 0; j < 3; j++) {
-				safe_volume *= cascade_size - ABS(cascade.dirty_regions[j]);
+				safe_volume *= cascade_size - ABS(dirty_regions[j]);
 			}
 			uint32_t dirty_volume = total_volume - safe_volume;
 			if (dirty_volume > (safe_volume / 2)) {
 				//more than half the volume is dirty, make all dirty so its only rendered once
-				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+			}
+		}
+
+		if (dirty_regions != Vector3i()) {
+			pending_count++;
+		}
+	}
+
+	uint32_t budget = gi->sdfgi_max_cascade_updates_per_frame;
+	if (budget == 0 || pending_count <= budget) {
+		for (uint32_t i = 0; i < cascades.size(); i++) {
+			cascades[i].position = new_positions[i];
+			cascades[i].dirty_regions = new_dirty_regions[i];
+			cascades[i].scroll_deferred_frames = 0;
+		}
+		return;
+	}
+
+	// Over budget: scroll the nearest cascades first, as they hold the most visible detail.
+	// Every frame a cascade waits raises its priority, so far cascades can't be starved
+	// while the camera keeps moving. Deferred cascades keep their old position and will
+	// scroll by the accumulated distance (or redraw fully) once they get their turn.
+	bool committed[SDFGI::MAX_CASCADES] = {};
+	for (uint32_t n = 0; n < budget; n++) {
+		int32_t best = -1;
+		int32_t best_priority = 0;
+		for (uint32_t i = 0; i < cascades.size(); i++) {
+			if (committed[i] || new_dirty_regions[i] == Vector3i()) {
+				continue;
+			}
+			int32_t priority = int32_t(i) - int32_t(cascades[i].scroll_deferred_frames);
+			if (best == -1 || priority < best_priority) {
+				best = i;
+				best_priority = priority;
 			}
 		}
+		if (best == -1) {
+			break;
+		}
+		committed[best] = true;
+	}
+
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		if (committed[i]) {
+			cascades[i].position = new_positions[i];
+			cascades[i].dirty_regions = new_dirty_regions[i];
+			cascades[i].scroll_deferred_frames = 0;
+		} else if (new_dirty_regions[i] != Vector3i()) {
+			cascades[i].scroll_deferred_frames++;
+		}
 	}
 }
 
@@ -3336,6 +3396,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_max_cascade_updates_per_frame = MAX(0, int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/max_cascade_updates_per_frame")));
 }
 
 GI::~GI() {
@@ -607,6 +607,9 @@ public:
 			float baked_exposure_normalization = 1.0;
 
 			bool all_dynamic_lights_dirty = true;
+
+			// Frames this cascade has been waiting to scroll because of the per-frame update budget.
+			uint32_t scroll_deferred_frames = 0;
 		};
 
 		// access to our containers
@@ -696,6 +699,7 @@ public:
 	RS::EnvironmentSDFGIRayCount sdfgi_ray_count = RS::ENV_SDFGI_RAY_COUNT_16;
 	RS::EnvironmentSDFGIFramesToConverge sdfgi_frames_to_converge = RS::ENV_SDFGI_CONVERGE_IN_30_FRAMES;
 	RS::EnvironmentSDFGIFramesToUpdateLight sdfgi_frames_to_update_light = RS::ENV_SDFGI_UPDATE_LIGHT_IN_4_FRAMES;
+	uint32_t sdfgi_max_cascade_updates_per_frame = 0; // 0 is unlimited.
 
 	float sdfgi_solid_cell_ratio = 0.25;
 	Vector3 sdfgi_debug_probe_pos;
@@ -578,7 +578,7 @@ void RenderForwardClustered::_render_list(RenderingDevice::DrawListID p_draw_lis
 
 void RenderForwardClustered::_render_list_thread_function(uint32_t p_thread, RenderListParameters *p_params) {
 	uint32_t render_total = p_params->element_count;
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t total_threads = thread_draw_lists.size();
 	uint32_t render_from = p_thread * render_total / total_threads;
 	uint32_t render_to = (p_thread + 1 == total_threads) ? render_total : ((p_thread + 1) * render_total / total_threads);
 	_render_list(thread_draw_lists[p_thread], p_params->framebuffer_format, p_params, render_from, render_to);
@@ -588,9 +588,11 @@ void RenderForwardClustered::_render_list_with_threads(RenderListParameters *p_p
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(p_framebuffer);
 	p_params->framebuffer_format = fb_format;
 
-	if ((uint32_t)p_params->element_count > render_list_thread_threshold && false) { // secondary command buffers need more testing at this time
+	if (render_list_threaded && (uint32_t)p_params->element_count > render_list_thread_threshold) { // Opt-in, secondary command buffers need more testing at this time.
 		//multi threaded
-		thread_draw_lists.resize(WorkerThreadPool::get_singleton()->get_thread_count());
+		// Don't split into more lists than there are threshold-sized batches of elements.
+		uint32_t split_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), (uint32_t)p_params->element_count / MAX(render_list_thread_threshold, 1u));
+		thread_draw_lists.resize(MAX(split_count, 1u));
 		RD::get_singleton()->draw_list_begin_split(p_framebuffer, thread_draw_lists.size(), thread_draw_lists.ptr(), p_initial_color_action, p_final_color_action, p_initial_depth_action, p_final_depth_action, p_clear_color_values, p_clear_depth, p_clear_stencil, p_region, p_storage_textures);
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderForwardClustered::_render_list_thread_function, p_params, thread_draw_lists.size(), -1, true, SNAME("ForwardClusteredRenderList"));
 		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
@@ -699,7 +701,7 @@ void RenderForwardClustered::_update_instance_data_buffer(RenderListType p_rende
 		RD::get_singleton()->buffer_update(scene_state.instance_buffer[p_render_list], 0, sizeof(SceneState::InstanceData) * scene_state.instance_data[p_render_list].size(), scene_state.instance_data[p_render_list].ptr(), RD::BARRIER_MASK_RASTER);
 	}
 }
-void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, int *p_render_info, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
+void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, int *p_render_info, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer, HashMap<RID, RenderingMethod::MaterialStats> *p_material_stats) {
 	RenderList *rl = &render_list[p_render_list];
 	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
 
@@ -712,6 +714,9 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 	uint64_t frame = RSG::rasterizer->get_frame_number();
 	uint32_t repeats = 0;
 	GeometryInstanceSurfaceDataCache *prev_surface = nullptr;
+#ifdef DEBUG_ENABLED
+	const SceneShaderForwardClustered::ShaderData *prev_shader = nullptr;
+#endif
 	for (uint32_t i = 0; i < element_total; i++) {
 		GeometryInstanceSurfaceDataCache *surface = rl->elements[i + p_offset];
 		GeometryInstanceForwardClustered *inst = surface->owner;
@@ -785,6 +790,17 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 			if (p_render_info) {
 				p_render_info[RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 			}
+#ifdef DEBUG_ENABLED
+			if (unlikely(p_material_stats)) {
+				const SceneShaderForwardClustered::ShaderData *shader = p_render_list == RENDER_LIST_SECONDARY ? surface->shader_shadow : surface->shader;
+				RenderingMethod::MaterialStats &stats = (*p_material_stats)[surface->material->get_self()];
+				stats.draw_calls++;
+				if (shader != prev_shader) {
+					stats.shader_changes++;
+					prev_shader = shader;
+				}
+			}
+#endif
 		}
 
 		RenderElementInfo &element_info = rl->element_info[p_offset + i];
@@ -818,6 +834,17 @@ _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primit
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
+#ifdef DEBUG_ENABLED
+void RenderForwardClustered::_add_material_surface_stats(HashMap<RID, RenderingMethod::MaterialStats> &r_material_stats, const GeometryInstanceSurfaceDataCache *p_surface, const SceneShaderForwardClustered::ShaderData *p_shader, uint32_t p_primitives) {
+	RenderingMethod::MaterialStats &stats = r_material_stats[p_surface->material->get_self()];
+	if (stats.instances == 0 && p_shader) {
+		stats.shader_path = p_shader->path;
+	}
+	stats.instances += MAX(p_surface->owner->instance_count, 1u);
+	stats.primitives += p_primitives;
+}
+#endif
+
 void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi, bool p_using_opaque_gi, bool p_using_motion_pass, bool p_append) {
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
 	uint64_t frame = RSG::rasterizer->get_frame_number();
@@ -977,6 +1004,9 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		while (surf) {
 			surf->sort.uses_forward_gi = 0;
 			surf->sort.uses_lightmap = 0;
+#ifdef DEBUG_ENABLED
+			uint32_t surface_primitives = 0;
+#endif
 
 			// LOD
 
@@ -1010,6 +1040,9 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
 				if (p_render_data->render_info) {
 					indices = _indices_to_primitives(surf->primitive, indices);
+#ifdef DEBUG_ENABLED
+					surface_primitives = indices;
+#endif
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
 						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += indices;
 					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
@@ -1022,6 +1055,9 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 					uint32_t to_draw = mesh_storage->mesh_surface_get_vertices_drawn_count(surf->surface);
 					to_draw = _indices_to_primitives(surf->primitive, to_draw);
 					to_draw *= inst->instance_count;
+#ifdef DEBUG_ENABLED
+					surface_primitives = to_draw;
+#endif
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
 						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += to_draw;
 					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
@@ -1046,6 +1082,13 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 					rl->add_element(surf);
 				}
 
+#ifdef DEBUG_ENABLED
+				if (unlikely(p_render_data->render_info && p_render_data->render_info->material_stats)) {
+					bool alpha = force_alpha || (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_ALPHA);
+					_add_material_surface_stats(p_render_data->render_info->material_stats[alpha ? RenderingMethod::MATERIAL_STATS_PASS_ALPHA : RenderingMethod::MATERIAL_STATS_PASS_OPAQUE], surf, surf->shader, surface_primitives);
+				}
+#endif
+
 				if (force_alpha || (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_ALPHA)) {
 					surf->color_pass_inclusion_mask = COLOR_PASS_FLAG_TRANSPARENT;
 					render_list[RENDER_LIST_ALPHA].add_element(surf);
@@ -1079,6 +1122,11 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			} else if (p_pass_mode == PASS_MODE_SHADOW || p_pass_mode == PASS_MODE_SHADOW_DP) {
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_SHADOW) {
 					rl->add_element(surf);
+#ifdef DEBUG_ENABLED
+					if (unlikely(p_render_data->render_info && p_render_data->render_info->material_stats)) {
+						_add_material_surface_stats(p_render_data->render_info->material_stats[RenderingMethod::MATERIAL_STATS_PASS_SHADOW], surf, surf->shader_shadow, surface_primitives);
+					}
+#endif
 				}
 			} else {
 				if (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE)) {
@@ -1747,9 +1795,10 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	render_list[RENDER_LIST_ALPHA].sort_by_reverse_depth_and_priority();
 
 	int *render_info = p_render_data->render_info ? p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE] : (int *)nullptr;
-	_fill_instance_data(RENDER_LIST_OPAQUE, render_info);
-	_fill_instance_data(RENDER_LIST_MOTION, render_info);
-	_fill_instance_data(RENDER_LIST_ALPHA);
+	HashMap<RID, RenderingMethod::MaterialStats> *material_stats = p_render_data->render_info ? p_render_data->render_info->material_stats : nullptr;
+	_fill_instance_data(RENDER_LIST_OPAQUE, render_info, 0, -1, true, material_stats ? &material_stats[RenderingMethod::MATERIAL_STATS_PASS_OPAQUE] : nullptr);
+	_fill_instance_data(RENDER_LIST_MOTION, render_info, 0, -1, true, material_stats ? &material_stats[RenderingMethod::MATERIAL_STATS_PASS_OPAQUE] : nullptr);
+	_fill_instance_data(RENDER_LIST_ALPHA, nullptr, 0, -1, true, material_stats ? &material_stats[RenderingMethod::MATERIAL_STATS_PASS_ALPHA] : nullptr);
 
 	RD::get_singleton()->draw_command_end_label();
 
@@ -2539,7 +2588,7 @@ void RenderForwardClustered::_render_shadow_append(RID p_framebuffer, const Page
 	_fill_render_list(RENDER_LIST_SECONDARY, &render_data, pass_mode, false, false, false, true);
 	uint32_t render_list_size = render_list[RENDER_LIST_SECONDARY].elements.size() - render_list_from;
 	render_list[RENDER_LIST_SECONDARY].sort_by_key_range(render_list_from, render_list_size);
-	_fill_instance_data(RENDER_LIST_SECONDARY, p_render_info ? p_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW] : (int *)nullptr, render_list_from, render_list_size, false);
+	_fill_instance_data(RENDER_LIST_SECONDARY, p_render_info ? p_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW] : (int *)nullptr, render_list_from, render_list_size, false, p_render_info && p_render_info->material_stats ? &p_render_info->material_stats[RenderingMethod::MATERIAL_STATS_PASS_SHADOW] : nullptr);
 
 	{
 		//regular forward for now
@@ -4153,6 +4202,7 @@ RenderForwardClustered::RenderForwardClustered() {
 	}
 
 	render_list_thread_threshold = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render_minimum_instances");
+	render_list_threaded = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render_lists");
 
 	_update_shader_quality_settings();
 
@@ -31,6 +31,7 @@
 #ifndef RENDER_FORWARD_CLUSTERED_H
 #define RENDER_FORWARD_CLUSTERED_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/paged_allocator.h"
 #include "servers/rendering/renderer_rd/cluster_builder_rd.h"
 #include "servers/rendering/renderer_rd/effects/fsr2.h"
@@ -379,9 +380,13 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	void _render_list_with_threads(RenderListParameters *p_params, RID p_framebuffer, RD::InitialAction p_initial_color_action, RD::FinalAction p_final_color_action, RD::InitialAction p_initial_depth_action, RD::FinalAction p_final_depth_action, const Vector<Color> &p_clear_color_values = Vector<Color>(), float p_clear_depth = 1.0, uint32_t p_clear_stencil = 0, const Rect2 &p_region = Rect2(), const Vector<RID> &p_storage_textures = Vector<RID>());
 
 	uint32_t render_list_thread_threshold = 500;
+	bool render_list_threaded = false;
 
 	void _update_instance_data_buffer(RenderListType p_render_list);
-	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
+#ifdef DEBUG_ENABLED
+	void _add_material_surface_stats(HashMap<RID, RenderingMethod::MaterialStats> &r_material_stats, const GeometryInstanceSurfaceDataCache *p_surface, const SceneShaderForwardClustered::ShaderData *p_shader, uint32_t p_primitives);
+#endif
+	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true, HashMap<RID, RenderingMethod::MaterialStats> *p_material_stats = nullptr);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi = false, bool p_using_opaque_gi = false, bool p_using_motion_pass = false, bool p_append = false);
 
 	HashMap<Size2i, RID> sdfgi_framebuffer_size_cache;
@@ -514,6 +519,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	struct RenderList {
 		LocalVector<GeometryInstanceSurfaceDataCache *> elements;
 		LocalVector<RenderElementInfo> element_info;
+		LocalVector<GeometryInstanceSurfaceDataCache *> sort_buffer;
 
 		void clear() {
 			elements.clear();
@@ -529,8 +535,8 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		};
 
 		void sort_by_key() {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			// Large scenes are sorted in parallel, smaller lists end up sorted inline as a single chunk.
+			WorkerThreadPool::get_singleton()->parallel_sort(elements.ptr(), elements.size(), 4096, SortByKey(), "RenderListSortByKey", &sort_buffer);
 		}
 
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
@@ -70,69 +70,33 @@ void RenderForwardMobile::ForwardIDStorageMobile::map_forward_id(RendererRD::For
 	forward_id_allocators[p_type].last_pass[p_id] = p_last_pass;
 }
 
-void RenderForwardMobile::fill_push_constant_instance_indices(SceneState::InstanceData *p_instance_data, const GeometryInstanceForwardMobile *p_instance) {
-	uint64_t current_frame = RSG::rasterizer->get_frame_number();
-
-	p_instance_data->omni_lights[0] = 0xFFFFFFFF;
-	p_instance_data->omni_lights[1] = 0xFFFFFFFF;
+void RenderForwardMobile::_fill_forward_id_indices(uint32_t *r_indices, RendererRD::ForwardIDType p_type, const RendererRD::ForwardID *p_ids, uint32_t p_count, uint64_t p_frame) const {
+	// Up to MAX_RDL_CULL 8-bit indices packed in two words, 0xFF marks an unused slot.
+	r_indices[0] = 0xFFFFFFFF;
+	r_indices[1] = 0xFFFFFFFF;
 
+	const ForwardIDStorageMobile::ForwardIDAllocator &allocator = forward_id_storage_mobile->forward_id_allocators[p_type];
 	uint32_t idx = 0;
-	for (uint32_t i = 0; i < p_instance->omni_light_count; i++) {
-		uint32_t ofs = idx < 4 ? 0 : 1;
-		uint32_t shift = (idx & 0x3) << 3;
-		uint32_t mask = ~(0xFF << shift);
-
-		if (forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_OMNI_LIGHT].last_pass[p_instance->omni_lights[i]] == current_frame) {
-			p_instance_data->omni_lights[ofs] &= mask;
-			p_instance_data->omni_lights[ofs] |= uint32_t(forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_OMNI_LIGHT].map[p_instance->omni_lights[i]]) << shift;
-			idx++;
+	for (uint32_t i = 0; i < p_count && idx < (uint32_t)MAX_RDL_CULL; i++) {
+		// Paired elements that were culled this frame don't take a slot, so the next candidate can use it.
+		if (allocator.last_pass[p_ids[i]] != p_frame) {
+			continue;
 		}
-	}
-
-	p_instance_data->spot_lights[0] = 0xFFFFFFFF;
-	p_instance_data->spot_lights[1] = 0xFFFFFFFF;
-
-	idx = 0;
-	for (uint32_t i = 0; i < p_instance->spot_light_count; i++) {
 		uint32_t ofs = idx < 4 ? 0 : 1;
 		uint32_t shift = (idx & 0x3) << 3;
-		uint32_t mask = ~(0xFF << shift);
-		if (forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_SPOT_LIGHT].last_pass[p_instance->spot_lights[i]] == current_frame) {
-			p_instance_data->spot_lights[ofs] &= mask;
-			p_instance_data->spot_lights[ofs] |= uint32_t(forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_SPOT_LIGHT].map[p_instance->spot_lights[i]]) << shift;
-			idx++;
-		}
-	}
-
-	p_instance_data->decals[0] = 0xFFFFFFFF;
-	p_instance_data->decals[1] = 0xFFFFFFFF;
-
-	idx = 0;
-	for (uint32_t i = 0; i < p_instance->decals_count; i++) {
-		uint32_t ofs = idx < 4 ? 0 : 1;
-		uint32_t shift = (idx & 0x3) << 3;
-		uint32_t mask = ~(0xFF << shift);
-		if (forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_DECAL].last_pass[p_instance->decals[i]] == current_frame) {
-			p_instance_data->decals[ofs] &= mask;
-			p_instance_data->decals[ofs] |= uint32_t(forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_DECAL].map[p_instance->decals[i]]) << shift;
-			idx++;
-		}
+		r_indices[ofs] &= ~(0xFF << shift);
+		r_indices[ofs] |= uint32_t(allocator.map[p_ids[i]]) << shift;
+		idx++;
 	}
+}
 
-	p_instance_data->reflection_probes[0] = 0xFFFFFFFF;
-	p_instance_data->reflection_probes[1] = 0xFFFFFFFF;
+void RenderForwardMobile::fill_push_constant_instance_indices(SceneState::InstanceData *p_instance_data, const GeometryInstanceForwardMobile *p_instance) {
+	uint64_t current_frame = RSG::rasterizer->get_frame_number();
 
-	idx = 0;
-	for (uint32_t i = 0; i < p_instance->reflection_probe_count; i++) {
-		uint32_t ofs = idx < 4 ? 0 : 1;
-		uint32_t shift = (idx & 0x3) << 3;
-		uint32_t mask = ~(0xFF << shift);
-		if (forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_REFLECTION_PROBE].last_pass[p_instance->reflection_probes[i]] == current_frame) {
-			p_instance_data->reflection_probes[ofs] &= mask;
-			p_instance_data->reflection_probes[ofs] |= uint32_t(forward_id_storage_mobile->forward_id_allocators[RendererRD::FORWARD_ID_TYPE_REFLECTION_PROBE].map[p_instance->reflection_probes[i]]) << shift;
-			idx++;
-		}
-	}
+	_fill_forward_id_indices(p_instance_data->omni_lights, RendererRD::FORWARD_ID_TYPE_OMNI_LIGHT, p_instance->omni_lights, p_instance->omni_light_count, current_frame);
+	_fill_forward_id_indices(p_instance_data->spot_lights, RendererRD::FORWARD_ID_TYPE_SPOT_LIGHT, p_instance->spot_lights, p_instance->spot_light_count, current_frame);
+	_fill_forward_id_indices(p_instance_data->decals, RendererRD::FORWARD_ID_TYPE_DECAL, p_instance->decals, p_instance->decals_count, current_frame);
+	_fill_forward_id_indices(p_instance_data->reflection_probes, RendererRD::FORWARD_ID_TYPE_REFLECTION_PROBE, p_instance->reflection_probes, p_instance->reflection_probe_count, current_frame);
 }
 
 /* Render buffer */
@@ -702,8 +666,9 @@ void RenderForwardMobile::_render_scene(RenderDataRD *p_render_data, const Color
 	_fill_render_list(RENDER_LIST_OPAQUE, p_render_data, PASS_MODE_COLOR);
 	render_list[RENDER_LIST_OPAQUE].sort_by_key();
 	render_list[RENDER_LIST_ALPHA].sort_by_reverse_depth_and_priority();
-	_fill_instance_data(RENDER_LIST_OPAQUE);
-	_fill_instance_data(RENDER_LIST_ALPHA);
+	HashMap<RID, RenderingMethod::MaterialStats> *material_stats = p_render_data->render_info ? p_render_data->render_info->material_stats : nullptr;
+	_fill_instance_data(RENDER_LIST_OPAQUE, 0, -1, true, material_stats ? &material_stats[RenderingMethod::MATERIAL_STATS_PASS_OPAQUE] : nullptr);
+	_fill_instance_data(RENDER_LIST_ALPHA, 0, -1, true, material_stats ? &material_stats[RenderingMethod::MATERIAL_STATS_PASS_ALPHA] : nullptr);
 
 	if (p_render_data->render_info) {
 		p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME] = p_render_data->instances->size();
@@ -1310,7 +1275,7 @@ void RenderForwardMobile::_render_shadow_append(RID p_framebuffer, const PagedAr
 	_fill_render_list(RENDER_LIST_SECONDARY, &render_data, pass_mode, true);
 	uint32_t render_list_size = render_list[RENDER_LIST_SECONDARY].elements.size() - render_list_from;
 	render_list[RENDER_LIST_SECONDARY].sort_by_key_range(render_list_from, render_list_size);
-	_fill_instance_data(RENDER_LIST_SECONDARY, render_list_from, render_list_size);
+	_fill_instance_data(RENDER_LIST_SECONDARY, render_list_from, render_list_size, true, p_render_info && p_render_info->material_stats ? &p_render_info->material_stats[RenderingMethod::MATERIAL_STATS_PASS_SHADOW] : nullptr);
 
 	{
 		//regular forward for now
@@ -1725,17 +1690,44 @@ void RenderForwardMobile::_update_instance_data_buffer(RenderListType p_render_l
 	}
 }
 
-void RenderForwardMobile::_fill_instance_data(RenderListType p_render_list, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
+#ifdef DEBUG_ENABLED
+void RenderForwardMobile::_add_material_surface_stats(HashMap<RID, RenderingMethod::MaterialStats> &r_material_stats, const GeometryInstanceSurfaceDataCache *p_surface, const SceneShaderForwardMobile::ShaderData *p_shader, uint32_t p_primitives) {
+	RenderingMethod::MaterialStats &stats = r_material_stats[p_surface->material->get_self()];
+	if (stats.instances == 0 && p_shader) {
+		stats.shader_path = p_shader->path;
+	}
+	stats.instances += MAX(p_surface->owner->instance_count, 1u);
+	stats.primitives += p_primitives;
+}
+#endif
+
+void RenderForwardMobile::_fill_instance_data(RenderListType p_render_list, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer, HashMap<RID, RenderingMethod::MaterialStats> *p_material_stats) {
 	RenderList *rl = &render_list[p_render_list];
 	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
 
 	scene_state.instance_data[p_render_list].resize(p_offset + element_total);
 	rl->element_info.resize(p_offset + element_total);
 
+#ifdef DEBUG_ENABLED
+	const SceneShaderForwardMobile::ShaderData *prev_shader = nullptr;
+#endif
 	for (uint32_t i = 0; i < element_total; i++) {
 		GeometryInstanceSurfaceDataCache *surface = rl->elements[i + p_offset];
 		GeometryInstanceForwardMobile *inst = surface->owner;
 
+#ifdef DEBUG_ENABLED
+		if (unlikely(p_material_stats)) {
+			// No instancing on mobile, every element is a draw.
+			const SceneShaderForwardMobile::ShaderData *shader = p_render_list == RENDER_LIST_SECONDARY ? surface->shader_shadow : surface->shader;
+			RenderingMethod::MaterialStats &stats = (*p_material_stats)[surface->material->get_self()];
+			stats.draw_calls++;
+			if (shader != prev_shader) {
+				stats.shader_changes++;
+				prev_shader = shader;
+			}
+		}
+#endif
+
 		SceneState::InstanceData &instance_data = scene_state.instance_data[p_render_list][i + p_offset];
 
 		if (inst->store_transform_cache) {
@@ -1901,6 +1893,9 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 
 		while (surf) {
 			surf->sort.uses_lightmap = 0;
+#ifdef DEBUG_ENABLED
+			uint32_t surface_primitives = 0;
+#endif
 
 			// LOD
 
@@ -1932,6 +1927,9 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 				surf->lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
 				if (p_render_data->render_info) {
 					indices = _indices_to_primitives(surf->primitive, indices);
+#ifdef DEBUG_ENABLED
+					surface_primitives = indices;
+#endif
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
 						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += indices;
 					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
@@ -1944,6 +1942,9 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 					uint32_t to_draw = mesh_storage->mesh_surface_get_vertices_drawn_count(surf->surface);
 					to_draw = _indices_to_primitives(surf->primitive, to_draw);
 					to_draw *= inst->instance_count;
+#ifdef DEBUG_ENABLED
+					surface_primitives = to_draw;
+#endif
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
 						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += to_draw;
 					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
@@ -1966,6 +1967,13 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 					render_list[RENDER_LIST_ALPHA].add_element(surf);
 				}
 
+#ifdef DEBUG_ENABLED
+				if (unlikely(p_render_data->render_info && p_render_data->render_info->material_stats)) {
+					bool alpha = force_alpha || (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_ALPHA);
+					_add_material_surface_stats(p_render_data->render_info->material_stats[alpha ? RenderingMethod::MATERIAL_STATS_PASS_ALPHA : RenderingMethod::MATERIAL_STATS_PASS_OPAQUE], surf, surf->shader, surface_primitives);
+				}
+#endif
+
 				if (uses_lightmap) {
 					surf->sort.uses_lightmap = 1; // This needs to become our lightmap index but we'll do that in a separate PR.
 				}
@@ -1986,6 +1994,11 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 			} else if (p_pass_mode == PASS_MODE_SHADOW || p_pass_mode == PASS_MODE_SHADOW_DP) {
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_SHADOW) {
 					rl->add_element(surf);
+#ifdef DEBUG_ENABLED
+					if (unlikely(p_render_data->render_info && p_render_data->render_info->material_stats)) {
+						_add_material_surface_stats(p_render_data->render_info->material_stats[RenderingMethod::MATERIAL_STATS_PASS_SHADOW], surf, surf->shader_shadow, surface_primitives);
+					}
+#endif
 				}
 			} else {
 				if (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE)) {
@@ -2352,13 +2365,13 @@ void RenderForwardMobile::GeometryInstanceForwardMobile::pair_light_instances(co
 		RS::LightType type = RendererRD::LightStorage::get_singleton()->light_instance_get_type(p_light_instances[i]);
 		switch (type) {
 			case RS::LIGHT_OMNI: {
-				if (omni_light_count < (uint32_t)MAX_RDL_CULL) {
+				if (omni_light_count < (uint32_t)MAX_RDL_PAIRED) {
 					omni_lights[omni_light_count] = RendererRD::LightStorage::get_singleton()->light_instance_get_forward_id(p_light_instances[i]);
 					omni_light_count++;
 				}
 			} break;
 			case RS::LIGHT_SPOT: {
-				if (spot_light_count < (uint32_t)MAX_RDL_CULL) {
+				if (spot_light_count < (uint32_t)MAX_RDL_PAIRED) {
 					spot_lights[spot_light_count] = RendererRD::LightStorage::get_singleton()->light_instance_get_forward_id(p_light_instances[i]);
 					spot_light_count++;
 				}
@@ -2370,14 +2383,14 @@ void RenderForwardMobile::GeometryInstanceForwardMobile::pair_light_instances(co
 }
 
 void RenderForwardMobile::GeometryInstanceForwardMobile::pair_reflection_probe_instances(const RID *p_reflection_probe_instances, uint32_t p_reflection_probe_instance_count) {
-	reflection_probe_count = p_reflection_probe_instance_count < (uint32_t)MAX_RDL_CULL ? p_reflection_probe_instance_count : (uint32_t)MAX_RDL_CULL;
+	reflection_probe_count = MIN(p_reflection_probe_instance_count, (uint32_t)MAX_RDL_PAIRED);
 	for (uint32_t i = 0; i < reflection_probe_count; i++) {
 		reflection_probes[i] = RendererRD::LightStorage::get_singleton()->reflection_probe_instance_get_forward_id(p_reflection_probe_instances[i]);
 	}
 }
 
 void RenderForwardMobile::GeometryInstanceForwardMobile::pair_decal_instances(const RID *p_decal_instances, uint32_t p_decal_instance_count) {
-	decals_count = p_decal_instance_count < (uint32_t)MAX_RDL_CULL ? p_decal_instance_count : (uint32_t)MAX_RDL_CULL;
+	decals_count = MIN(p_decal_instance_count, (uint32_t)MAX_RDL_PAIRED);
 	for (uint32_t i = 0; i < decals_count; i++) {
 		decals[i] = RendererRD::TextureStorage::get_singleton()->decal_instance_get_forward_id(p_decal_instances[i]);
 	}
@@ -88,6 +88,7 @@ private:
 	enum {
 		MAX_LIGHTMAPS = 8,
 		MAX_RDL_CULL = 8, // maximum number of reflection probes, decals or lights we can cull per geometry instance
+		MAX_RDL_PAIRED = 16, // candidates kept per geometry instance, the first MAX_RDL_CULL visible ones this frame are used
 		INSTANCE_DATA_BUFFER_MIN_SIZE = 4096
 	};
 
@@ -203,7 +204,10 @@ private:
 	void _update_render_base_uniform_set(const RendererRD::MaterialStorage::Samplers &p_samplers);
 
 	void _update_instance_data_buffer(RenderListType p_render_list);
-	void _fill_instance_data(RenderListType p_render_list, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
+#ifdef DEBUG_ENABLED
+	void _add_material_surface_stats(HashMap<RID, RenderingMethod::MaterialStats> &r_material_stats, const GeometryInstanceSurfaceDataCache *p_surface, const SceneShaderForwardMobile::ShaderData *p_shader, uint32_t p_primitives);
+#endif
+	void _fill_instance_data(RenderListType p_render_list, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true, HashMap<RID, RenderingMethod::MaterialStats> *p_material_stats = nullptr);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_append = false);
 
 	void _setup_environment(const RenderDataRD *p_render_data, bool p_no_fog, const Size2i &p_screen_size, bool p_flip_y, const Color &p_default_bg_color, bool p_opaque_render_buffers = false, bool p_pancake_shadows = false, int p_index = 0);
@@ -490,13 +494,13 @@ protected:
 
 		// culled light info
 		uint32_t reflection_probe_count = 0;
-		RendererRD::ForwardID reflection_probes[MAX_RDL_CULL];
+		RendererRD::ForwardID reflection_probes[MAX_RDL_PAIRED];
 		uint32_t omni_light_count = 0;
-		RendererRD::ForwardID omni_lights[MAX_RDL_CULL];
+		RendererRD::ForwardID omni_lights[MAX_RDL_PAIRED];
 		uint32_t spot_light_count = 0;
-		RendererRD::ForwardID spot_lights[MAX_RDL_CULL];
+		RendererRD::ForwardID spot_lights[MAX_RDL_PAIRED];
 		uint32_t decals_count = 0;
-		RendererRD::ForwardID decals[MAX_RDL_CULL];
+		RendererRD::ForwardID decals[MAX_RDL_PAIRED];
 
 		GeometryInstanceSurfaceDataCache *surface_caches = nullptr;
 
@@ -549,6 +553,7 @@ protected:
 
 	ForwardIDStorageMobile *forward_id_storage_mobile = nullptr;
 
+	_FORCE_INLINE_ void _fill_forward_id_indices(uint32_t *r_indices, RendererRD::ForwardIDType p_type, const RendererRD::ForwardID *p_ids, uint32_t p_count, uint64_t p_frame) const;
 	void fill_push_constant_instance_indices(SceneState::InstanceData *p_instance_data, const GeometryInstanceForwardMobile *p_instance);
 
 	virtual RendererRD::ForwardIDStorage *create_forward_id_storage() override {
@@ -471,6 +471,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 	PipelineVariants *pipeline_variants = p_pipeline_variants;
 
+	// Items often draw long runs of the same command type (e.g. one rect per text glyph),
+	// so resolve their pipelines once per item instead of looking them up for every command.
+	RID quad_pipeline;
+	RID quad_lcd_pipeline;
+	RID ninepatch_pipeline;
+
 	bool reclip = false;
 
 	RID last_texture;
@@ -497,12 +503,16 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind pipeline
 				if (rect->flags & CANVAS_RECT_LCD) {
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					if (quad_lcd_pipeline.is_null()) {
+						quad_lcd_pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+					}
+					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, quad_lcd_pipeline);
 					RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, rect->modulate);
 				} else {
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					if (quad_pipeline.is_null()) {
+						quad_pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+					}
+					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, quad_pipeline);
 				}
 
 				//bind textures
@@ -598,10 +608,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
 
 				//bind pipeline
-				{
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+				if (ninepatch_pipeline.is_null()) {
+					ninepatch_pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
 				}
+				RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, ninepatch_pipeline);
 
 				//bind textures
 
@@ -1265,6 +1275,11 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 
 			state.light_uniforms[index].flags = l->blend_mode << LIGHT_FLAGS_BLEND_SHIFT;
 			state.light_uniforms[index].flags |= l->shadow_filter << LIGHT_FLAGS_FILTER_SHIFT;
+			if (l->shadow_filter == RS::CANVAS_LIGHT_FILTER_SDF) {
+				// Shadows are ray-marched from the canvas SDF, so pass the smoothing and march range instead of shadow map data.
+				state.light_uniforms[index].shadow_pixel_size = l->shadow_smooth;
+				state.light_uniforms[index].shadow_z_far_inv = 1.0 / MAX(l->directional_distance, 1.0);
+			}
 			if (clight->shadow.enabled) {
 				state.light_uniforms[index].flags |= LIGHT_FLAGS_HAS_SHADOW;
 			}
@@ -1327,6 +1342,11 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 
 			state.light_uniforms[index].flags = l->blend_mode << LIGHT_FLAGS_BLEND_SHIFT;
 			state.light_uniforms[index].flags |= l->shadow_filter << LIGHT_FLAGS_FILTER_SHIFT;
+			if (l->shadow_filter == RS::CANVAS_LIGHT_FILTER_SDF) {
+				// Shadows are ray-marched from the canvas SDF, so pass the smoothing and march range instead of shadow map data.
+				state.light_uniforms[index].shadow_pixel_size = l->shadow_smooth;
+				state.light_uniforms[index].shadow_z_far_inv = 1.0 / MAX(l->directional_distance, 1.0);
+			}
 			if (clight->shadow.enabled) {
 				state.light_uniforms[index].flags |= LIGHT_FLAGS_HAS_SHADOW;
 			}
@@ -2790,6 +2810,8 @@ void RendererCanvasRenderRD::set_debug_redraw(bool p_enabled, double p_time, con
 }
 
 RendererCanvasRenderRD::~RendererCanvasRenderRD() {
+	free_unused_shared_polygons();
+
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	//canvas state
 
@@ -491,11 +491,11 @@ void ShaderRD::_allocate_placeholders(Version *p_version, int p_group) {
 	}
 }
 
-// Try to compile all variants for a given group.
-// Will skip variants that are disabled.
-void ShaderRD::_compile_version(Version *p_version, int p_group) {
+// Prepare a version for compiling the variants of a group.
+// Returns false if there is nothing left to compile, e.g. when it was loaded from cache.
+bool ShaderRD::_compile_version_start(Version *p_version, int p_group) {
 	if (!group_enabled[p_group]) {
-		return;
+		return false;
 	}
 
 	typedef Vector<uint8_t> ShaderStageData;
@@ -505,10 +505,29 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 
 	if (shader_cache_dir_valid) {
 		if (_load_from_cache(p_version, p_group)) {
-			return;
+			return false;
 		}
 	}
 
+	return true;
+}
+
+void ShaderRD::_compile_version_batch_variant(uint32_t p_index, const CompileBatchData *p_data) {
+	const uint32_t variant_count = group_to_variant_map[p_data->group].size();
+
+	CompileData compile_data;
+	compile_data.version = p_data->versions[p_index / variant_count];
+	compile_data.group = p_data->group;
+	_compile_variant(p_index % variant_count, &compile_data);
+}
+
+// Try to compile all variants for a given group.
+// Will skip variants that are disabled.
+void ShaderRD::_compile_version(Version *p_version, int p_group) {
+	if (!_compile_version_start(p_version, p_group)) {
+		return;
+	}
+
 	CompileData compile_data;
 	compile_data.version = p_version;
 	compile_data.group = p_group;
@@ -523,6 +542,11 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 	}
 #endif
 
+	_compile_version_end(p_version, p_group);
+}
+
+// Validate the compiled variants of a group, and save them to cache.
+void ShaderRD::_compile_version_end(Version *p_version, int p_group) {
 	bool all_valid = true;
 
 	for (uint32_t i = 0; i < group_to_variant_map[p_group].size(); i++) {
@@ -681,11 +705,31 @@ void ShaderRD::enable_group(int p_group) {
 	group_enabled.write[p_group] = true;
 
 	// Compile all versions again to include the new group.
+	// Variants of all the versions are compiled as a single batch, so worker
+	// threads don't sit idle waiting for each version to finish.
 	List<RID> all_versions;
 	version_owner.get_owned_list(&all_versions);
-	for (int i = 0; i < all_versions.size(); i++) {
-		Version *version = version_owner.get_or_null(all_versions[i]);
-		_compile_version(version, p_group);
+	LocalVector<Version *> versions_to_compile;
+	for (const RID &E : all_versions) {
+		Version *version = version_owner.get_or_null(E);
+		if (_compile_version_start(version, p_group)) {
+			versions_to_compile.push_back(version);
+		}
+	}
+
+	if (versions_to_compile.is_empty()) {
+		return;
+	}
+
+	CompileBatchData batch_data;
+	batch_data.versions = versions_to_compile.ptr();
+	batch_data.group = p_group;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_version_batch_variant, &batch_data, versions_to_compile.size() * group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (Version *version : versions_to_compile) {
+		_compile_version_end(version, p_group);
 	}
 }
 
@@ -85,11 +85,19 @@ private:
 		int group = 0;
 	};
 
+	struct CompileBatchData {
+		Version **versions = nullptr;
+		int group = 0;
+	};
+
 	void _compile_variant(uint32_t p_variant, const CompileData *p_data);
+	void _compile_version_batch_variant(uint32_t p_index, const CompileBatchData *p_data);
 
 	void _initialize_version(Version *p_version);
 	void _clear_version(Version *p_version);
+	bool _compile_version_start(Version *p_version, int p_group);
 	void _compile_version(Version *p_version, int p_group);
+	void _compile_version_end(Version *p_version, int p_group);
 	void _allocate_placeholders(Version *p_version, int p_group);
 
 	RID_Owner<Version> version_owner;
@@ -96,6 +96,7 @@ canvas_data;
 #define LIGHT_FLAGS_SHADOW_NEAREST (0 << 22)
 #define LIGHT_FLAGS_SHADOW_PCF5 (1 << 22)
 #define LIGHT_FLAGS_SHADOW_PCF13 (2 << 22)
+#define LIGHT_FLAGS_SHADOW_SDF (3 << 22)
 
 struct Light {
 	mat2x4 texture_matrix; //light to texture coordinate matrix (transposed)
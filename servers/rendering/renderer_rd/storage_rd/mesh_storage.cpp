@@ -1937,6 +1937,49 @@ void MeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_b
 	}
 }
 
+void MeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride_cache == 0 || p_buffer.size() % multimesh->stride_cache != 0);
+	int count = p_buffer.size() / multimesh->stride_cache;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + count > multimesh->instances);
+	if (count == 0) {
+		return;
+	}
+
+	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0);
+	if (uses_motion_vectors) {
+		_multimesh_enable_motion_vectors(multimesh);
+	}
+
+	if (multimesh->data_cache.size() || multimesh->motion_vectors_enabled || !multimesh->buffer_set) {
+		// The instances outside the range must stay valid, including the previous frame's copy when motion vectors are used,
+		// so go through the data cache and only upload the dirty regions touched by the range.
+		_multimesh_make_local(multimesh);
+		_multimesh_update_motion_vectors_data_cache(multimesh);
+
+		float *w = multimesh->data_cache.ptrw();
+		memcpy(w + (multimesh->motion_vectors_current_offset + p_first_instance) * multimesh->stride_cache, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+		int last = p_first_instance + count - 1;
+		for (int i = p_first_instance; i <= last; i += MULTIMESH_DIRTY_REGION_SIZE) {
+			_multimesh_mark_dirty(multimesh, i, true);
+		}
+		_multimesh_mark_dirty(multimesh, last, true);
+		return;
+	}
+
+	RD::get_singleton()->buffer_update(multimesh->buffer, p_first_instance * multimesh->stride_cache * sizeof(float), p_buffer.size() * sizeof(float), p_buffer.ptr());
+
+	if (multimesh->mesh.is_valid()) {
+		// Without a data cache the AABB can only grow, instances moved inward keep the previous bounds.
+		AABB previous_aabb = multimesh->aabb;
+		_multimesh_re_create_aabb(multimesh, p_buffer.ptr(), count);
+		multimesh->aabb.merge_with(previous_aabb);
+		multimesh->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
+	}
+}
+
 Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
@@ -2134,20 +2177,26 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 12;
+	float bone[12];
+	bone[0] = p_transform.basis.rows[0][0];
+	bone[1] = p_transform.basis.rows[0][1];
+	bone[2] = p_transform.basis.rows[0][2];
+	bone[3] = p_transform.origin.x;
+	bone[4] = p_transform.basis.rows[1][0];
+	bone[5] = p_transform.basis.rows[1][1];
+	bone[6] = p_transform.basis.rows[1][2];
+	bone[7] = p_transform.origin.y;
+	bone[8] = p_transform.basis.rows[2][0];
+	bone[9] = p_transform.basis.rows[2][1];
+	bone[10] = p_transform.basis.rows[2][2];
+	bone[11] = p_transform.origin.z;
 
-	dataptr[0] = p_transform.basis.rows[0][0];
-	dataptr[1] = p_transform.basis.rows[0][1];
-	dataptr[2] = p_transform.basis.rows[0][2];
-	dataptr[3] = p_transform.origin.x;
-	dataptr[4] = p_transform.basis.rows[1][0];
-	dataptr[5] = p_transform.basis.rows[1][1];
-	dataptr[6] = p_transform.basis.rows[1][2];
-	dataptr[7] = p_transform.origin.y;
-	dataptr[8] = p_transform.basis.rows[2][0];
-	dataptr[9] = p_transform.basis.rows[2][1];
-	dataptr[10] = p_transform.basis.rows[2][2];
-	dataptr[11] = p_transform.origin.z;
+	float *dataptr = skeleton->data.ptrw() + p_bone * 12;
+	if (memcmp(dataptr, bone, sizeof(bone)) == 0) {
+		// Unchanged bone, don't bump the skeleton version so skinned mesh instances keep their cached result.
+		return;
+	}
+	memcpy(dataptr, bone, sizeof(bone));
 
 	_skeleton_make_dirty(skeleton);
 }
@@ -2186,16 +2235,21 @@ void MeshStorage::skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, con
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(!skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 8;
+	float bone[8];
+	bone[0] = p_transform.columns[0][0];
+	bone[1] = p_transform.columns[1][0];
+	bone[2] = 0;
+	bone[3] = p_transform.columns[2][0];
+	bone[4] = p_transform.columns[0][1];
+	bone[5] = p_transform.columns[1][1];
+	bone[6] = 0;
+	bone[7] = p_transform.columns[2][1];
 
-	dataptr[0] = p_transform.columns[0][0];
-	dataptr[1] = p_transform.columns[1][0];
-	dataptr[2] = 0;
-	dataptr[3] = p_transform.columns[2][0];
-	dataptr[4] = p_transform.columns[0][1];
-	dataptr[5] = p_transform.columns[1][1];
-	dataptr[6] = 0;
-	dataptr[7] = p_transform.columns[2][1];
+	float *dataptr = skeleton->data.ptrw() + p_bone * 8;
+	if (memcmp(dataptr, bone, sizeof(bone)) == 0) {
+		return;
+	}
+	memcpy(dataptr, bone, sizeof(bone));
 
 	_skeleton_make_dirty(skeleton);
 }
@@ -38,6 +38,9 @@ using namespace RendererRD;
 
 ParticlesStorage *ParticlesStorage::singleton = nullptr;
 
+// About cos(0.25°), smaller camera rotations keep the last view dependent copy of the particles.
+static const float VIEW_AXIS_COPY_THRESHOLD = 0.99999;
+
 ParticlesStorage *ParticlesStorage::get_singleton() {
 	return singleton;
 }
@@ -1169,7 +1172,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, process_amount, 1, 1);
 	}
 
-	RD::get_singleton()->compute_list_end();
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_COMPUTE); // Only read by the copy and sort shaders.
 }
 
 void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) {
@@ -1242,6 +1245,22 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		axis = particles->emission_transform.basis.xform_inv(axis).normalized();
 	}
 
+	// The same particles are often drawn again with (almost) the same view, e.g. when
+	// they are simulated at a lower fixed FPS than the framerate, or rendered by several passes.
+	// Tiny camera rotations are ignored, they are measured against the last copy so they can't accumulate.
+	Particles::ViewCopyState &last = particles->last_view_copy;
+	if (last.instance_buffer == particles->particle_instance_buffer && last.frame_counter == particles->frame_counter && last.frame_remainder == copy_push_constant.frame_remainder && last.motion_vectors_offset == particles->instance_motion_vectors_current_offset && last.draw_order == particles->draw_order && last.transform_align == particles->transform_align && last.axis.dot(axis) > VIEW_AXIS_COPY_THRESHOLD && last.up_axis.dot(p_up_axis) > VIEW_AXIS_COPY_THRESHOLD) {
+		return;
+	}
+	last.instance_buffer = particles->particle_instance_buffer;
+	last.frame_counter = particles->frame_counter;
+	last.frame_remainder = copy_push_constant.frame_remainder;
+	last.motion_vectors_offset = particles->instance_motion_vectors_current_offset;
+	last.draw_order = particles->draw_order;
+	last.transform_align = particles->transform_align;
+	last.axis = axis;
+	last.up_axis = p_up_axis;
+
 	copy_push_constant.sort_direction[0] = axis.x;
 	copy_push_constant.sort_direction[1] = axis.y;
 	copy_push_constant.sort_direction[2] = axis.z;
@@ -1263,7 +1282,7 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
 
-		RD::get_singleton()->compute_list_end();
+		RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_COMPUTE);
 		sort_effects->sort_buffer(particles->particles_sort_uniform_set, particles->amount);
 	}
 
@@ -1286,7 +1305,7 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 
 	RD::get_singleton()->compute_list_dispatch_threads(compute_list, copy_push_constant.total_particles, 1, 1);
 
-	RD::get_singleton()->compute_list_end();
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_VERTEX); // Instances are only read when drawing.
 }
 
 void ParticlesStorage::_particles_update_buffers(Particles *particles) {
@@ -1603,7 +1622,7 @@ void ParticlesStorage::update_particles() {
 
 			RD::get_singleton()->compute_list_dispatch_threads(compute_list, total_amount, 1, 1);
 
-			RD::get_singleton()->compute_list_end();
+			RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_VERTEX);
 		}
 
 		particles->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
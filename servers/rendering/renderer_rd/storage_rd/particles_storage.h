@@ -208,6 +208,19 @@ private:
 		RID particles_sort_buffer;
 		RID particles_sort_uniform_set;
 
+		// State the instance buffer was last filled with by a view dependent copy,
+		// so the copy (and sort) can be skipped when nothing changed since.
+		struct ViewCopyState {
+			RID instance_buffer;
+			uint32_t frame_counter = 0;
+			double frame_remainder = 0.0;
+			uint32_t motion_vectors_offset = 0;
+			RS::ParticlesDrawOrder draw_order = RS::PARTICLES_DRAW_ORDER_INDEX;
+			RS::ParticlesTransformAlign transform_align = RS::PARTICLES_TRANSFORM_ALIGN_DISABLED;
+			Vector3 axis;
+			Vector3 up_axis;
+		} last_view_copy;
+
 		bool dirty = false;
 		SelfList<Particles> update_list;
 
@@ -87,7 +87,19 @@ void RenderSceneBuffersRD::update_sizes(NamedTexture &p_named_texture) {
 
 void RenderSceneBuffersRD::free_named_texture(NamedTexture &p_named_texture) {
 	if (p_named_texture.texture.is_valid()) {
-		RD::get_singleton()->free(p_named_texture.texture);
+		bool in_use = false;
+		if (!p_named_texture.is_unique && !p_named_texture.is_view) {
+			// Shared textures are only freed once their last user goes away.
+			for (const KeyValue<NTKey, NamedTexture> &E : named_textures) {
+				if (&E.value != &p_named_texture && E.value.texture == p_named_texture.texture) {
+					in_use = true;
+					break;
+				}
+			}
+		}
+		if (!in_use) {
+			RD::get_singleton()->free(p_named_texture.texture);
+		}
 	}
 	p_named_texture.texture = RID();
 	p_named_texture.slices.clear(); // slices should be freed automatically as dependents...
@@ -306,8 +318,6 @@ RID RenderSceneBuffersRD::_create_texture_from_format(const StringName &p_contex
 }
 
 RID RenderSceneBuffersRD::create_texture_from_format(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format, RD::TextureView p_view, bool p_unique) {
-	// TODO p_unique, if p_unique is true, this is a texture that can be shared. This will be implemented later as an optimization.
-
 	NTKey key(p_context, p_texture_name);
 
 	// check if this is a known texture
@@ -315,10 +325,29 @@ RID RenderSceneBuffersRD::create_texture_from_format(const StringName &p_context
 		return named_textures[key].texture;
 	}
 
+	// Non-unique textures only hold scratch data for the duration of a single effect,
+	// so effects that run one after the other can alias the same memory.
+	RID shared_texture;
+	if (!p_unique) {
+		for (const KeyValue<NTKey, NamedTexture> &E : named_textures) {
+			const NamedTexture &other = E.value;
+			if (!other.is_unique && !other.is_view && E.key.context != p_context && other.format == p_texture_format && other.view == p_view) {
+				shared_texture = other.texture;
+				break;
+			}
+		}
+	}
+
 	// Add a new entry..
 	NamedTexture &named_texture = named_textures[key];
 	named_texture.format = p_texture_format;
+	named_texture.view = p_view;
 	named_texture.is_unique = p_unique;
+	if (shared_texture.is_valid()) {
+		named_texture.texture = shared_texture;
+		update_sizes(named_texture);
+		return named_texture.texture;
+	}
 	named_texture.texture = RD::get_singleton()->texture_create(p_texture_format, p_view);
 
 	Array arr;
@@ -358,7 +387,9 @@ RID RenderSceneBuffersRD::create_texture_view(const StringName &p_context, const
 	NamedTexture &view_texture = named_textures[view_key];
 
 	view_texture.format = named_texture.format;
+	view_texture.view = p_view;
 	view_texture.is_unique = named_texture.is_unique;
+	view_texture.is_view = true;
 
 	view_texture.texture = RD::get_singleton()->texture_create_shared(p_view, named_texture.texture);
 
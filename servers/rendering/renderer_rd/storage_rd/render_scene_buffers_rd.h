@@ -149,7 +149,9 @@ private:
 	struct NamedTexture {
 		// Cache the data used to create our texture
 		RD::TextureFormat format;
-		bool is_unique; // If marked as unique, we return it into our pool
+		RD::TextureView view;
+		bool is_unique; // If not marked as unique, the texture may be shared with other contexts that request an identical one.
+		bool is_view = false;
 
 		// Our texture objects, slices are lazy (i.e. only created when requested).
 		RID texture;
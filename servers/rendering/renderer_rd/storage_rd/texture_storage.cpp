@@ -3928,6 +3928,7 @@ void TextureStorage::render_target_set_vrs_mode(RID p_render_target, RS::Viewpor
 	ERR_FAIL_NULL(rt);
 
 	rt->vrs_mode = p_mode;
+	rt->vrs_updated_framebuffer = RID();
 }
 
 RS::ViewportVRSMode TextureStorage::render_target_get_vrs_mode(RID p_render_target) const {
@@ -3937,11 +3938,41 @@ RS::ViewportVRSMode TextureStorage::render_target_get_vrs_mode(RID p_render_targ
 	return rt->vrs_mode;
 }
 
+void TextureStorage::render_target_set_vrs_update_mode(RID p_render_target, RS::ViewportVRSUpdateMode p_mode) {
+	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+
+	rt->vrs_update_mode = p_mode;
+	rt->vrs_updated_framebuffer = RID();
+}
+
+RS::ViewportVRSUpdateMode TextureStorage::render_target_get_vrs_update_mode(RID p_render_target) const {
+	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, RS::VIEWPORT_VRS_UPDATE_DISABLED);
+
+	return rt->vrs_update_mode;
+}
+
+void TextureStorage::render_target_set_vrs_updated_framebuffer(RID p_render_target, RID p_framebuffer) {
+	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+
+	rt->vrs_updated_framebuffer = p_framebuffer;
+}
+
+RID TextureStorage::render_target_get_vrs_updated_framebuffer(RID p_render_target) const {
+	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, RID());
+
+	return rt->vrs_updated_framebuffer;
+}
+
 void TextureStorage::render_target_set_vrs_texture(RID p_render_target, RID p_texture) {
 	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
 	ERR_FAIL_NULL(rt);
 
 	rt->vrs_texture = p_texture;
+	rt->vrs_updated_framebuffer = RID();
 }
 
 RID TextureStorage::render_target_get_vrs_texture(RID p_render_target) const {
@@ -365,7 +365,9 @@ private:
 
 		// VRS
 		RS::ViewportVRSMode vrs_mode = RS::VIEWPORT_VRS_DISABLED;
+		RS::ViewportVRSUpdateMode vrs_update_mode = RS::VIEWPORT_VRS_UPDATE_ONCE;
 		RID vrs_texture;
+		RID vrs_updated_framebuffer; // Density framebuffer the VRS texture was last copied into.
 
 		// overridden textures
 		struct RTOverridden {
@@ -742,6 +744,10 @@ public:
 
 	virtual void render_target_set_vrs_mode(RID p_render_target, RS::ViewportVRSMode p_mode) override;
 	virtual RS::ViewportVRSMode render_target_get_vrs_mode(RID p_render_target) const override;
+	virtual void render_target_set_vrs_update_mode(RID p_render_target, RS::ViewportVRSUpdateMode p_mode) override;
+	virtual RS::ViewportVRSUpdateMode render_target_get_vrs_update_mode(RID p_render_target) const override;
+	void render_target_set_vrs_updated_framebuffer(RID p_render_target, RID p_framebuffer);
+	RID render_target_get_vrs_updated_framebuffer(RID p_render_target) const;
 	virtual void render_target_set_vrs_texture(RID p_render_target, RID p_texture) override;
 	virtual RID render_target_get_vrs_texture(RID p_render_target) const override;
 
@@ -31,6 +31,7 @@
 #include "renderer_scene_cull.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "rendering_server_default.h"
@@ -189,6 +190,8 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 		geom->reflection_probes.insert(B);
 		reflection_probe->geometries.insert(A);
 
+		self->_reflection_probe_mark_contents_dirty(B, A);
+
 		if (A->scenario && A->array_index >= 0) {
 			InstanceData &idata = A->scenario->instance_data[A->array_index];
 			idata.flags |= InstanceData::FLAG_GEOM_REFLECTION_DIRTY;
@@ -306,6 +309,8 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 		geom->reflection_probes.erase(B);
 		reflection_probe->geometries.erase(A);
 
+		self->_reflection_probe_mark_contents_dirty(B, A);
+
 		if (A->scenario && A->array_index >= 0) {
 			InstanceData &idata = A->scenario->instance_data[A->array_index];
 			idata.flags |= InstanceData::FLAG_GEOM_REFLECTION_DIRTY;
@@ -927,6 +932,37 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	// Dirty instances are only queued here; their AABBs and the scenario BVH
+	// are updated together for all of them in update_dirty_instances().
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		const Transform3D &transform = transforms[i];
+		if (instance->transform == transform) {
+			continue; //must be checked to avoid worst evil
+		}
+
+#ifdef DEBUG_ENABLED
+
+		bool finite = true;
+		for (int j = 0; j < 4; j++) {
+			const Vector3 &v = j < 3 ? transform.basis.rows[j] : transform.origin;
+			finite = finite && v.is_finite();
+		}
+		ERR_CONTINUE(!finite);
+
+#endif
+		instance->transform = transform;
+		_instance_queue_update(instance, true);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1557,6 +1593,58 @@ void RendererSceneCull::instance_geometry_get_shader_parameter_list(RID p_instan
 	}
 }
 
+bool RendererSceneCull::_light_shadow_intersects_aabb(const Instance *p_light, const AABB &p_aabb) const {
+	const RS::LightType type = RSG::light_storage->light_get_type(p_light->base);
+	if (type == RS::LIGHT_DIRECTIONAL) {
+		return true;
+	}
+
+	const Transform3D &xform = p_light->transform;
+	const Vector3 scale = xform.basis.get_scale_abs();
+	const real_t range = RSG::light_storage->light_get_param(p_light->base, RS::LIGHT_PARAM_RANGE) * MAX(scale.x, MAX(scale.y, scale.z));
+
+	// Test the bounding sphere of the AABB, which is conservative.
+	const Vector3 center = p_aabb.get_center();
+	const real_t radius = p_aabb.size.length() * 0.5;
+	const Vector3 to_center = center - xform.origin;
+	const real_t dist_sq = to_center.length_squared();
+	if (dist_sq > (range + radius) * (range + radius)) {
+		return false;
+	}
+
+	if (type == RS::LIGHT_SPOT) {
+		const real_t half_angle = Math::deg_to_rad(RSG::light_storage->light_get_param(p_light->base, RS::LIGHT_PARAM_SPOT_ANGLE));
+		if (half_angle < Math_PI * 0.5) {
+			const Vector3 axis = -xform.basis.get_column(Vector3::AXIS_Z).normalized();
+			const real_t along = to_center.dot(axis);
+			if (along < -radius) {
+				return false; // Behind the light.
+			}
+			const real_t across = Math::sqrt(MAX(dist_sq - along * along, (real_t)0.0));
+			if (Math::cos(half_angle) * across - along * Math::sin(half_angle) > radius) {
+				return false; // Outside the cone.
+			}
+		}
+	}
+
+	return true;
+}
+
+void RendererSceneCull::_reflection_probe_mark_contents_dirty(Instance *p_probe, const Instance *p_geometry) {
+	if (!reflection_probe_update_once_on_change || p_probe->scenario == nullptr || p_probe->array_index < 0) {
+		return;
+	}
+	if (RSG::light_storage->reflection_probe_get_update_mode(p_probe->base) != RS::REFLECTION_PROBE_UPDATE_ONCE) {
+		return; // "Update always" probes are redrawn anyway.
+	}
+	if (!(p_geometry->layer_mask & RSG::light_storage->reflection_probe_get_cull_mask(p_probe->base))) {
+		return; // Not captured by this probe.
+	}
+
+	InstanceData &idata = p_probe->scenario->instance_data[p_probe->array_index];
+	idata.flags |= InstanceData::FLAG_REFLECTION_PROBE_DIRTY;
+}
+
 void RendererSceneCull::_update_instance(Instance *p_instance) {
 	p_instance->version++;
 
@@ -1641,6 +1729,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 
 	AABB new_aabb;
 	new_aabb = p_instance->transform.xform(p_instance->aabb);
+	const AABB old_aabb = p_instance->transformed_aabb;
 	p_instance->transformed_aabb = new_aabb;
 
 	if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1650,10 +1739,21 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		if (geom->can_cast_shadows) {
 			for (const Instance *E : geom->lights) {
 				InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
-				light->shadow_dirty = true;
+				if (light->shadow_dirty) {
+					continue;
+				}
+				// Pairing only guarantees overlap with the light's box, so skip casters
+				// that stay outside the volume actually covered by its shadow.
+				if (_light_shadow_intersects_aabb(E, old_aabb) || _light_shadow_intersects_aabb(E, new_aabb)) {
+					light->shadow_dirty = true;
+				}
 			}
 		}
 
+		for (Instance *E : geom->reflection_probes) {
+			_reflection_probe_mark_contents_dirty(E, p_instance);
+		}
+
 		if (!p_instance->lightmap && geom->lightmap_captures.size()) {
 			//affected by lightmap captures, must update capture info!
 			_update_instance_lightmap_captures(p_instance);
@@ -1695,8 +1795,10 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 	if (!p_instance->indexer_id.is_valid()) {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
 			p_instance->indexer_id = p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].insert(bvh_aabb, p_instance);
+			p_instance->scenario->indexer_changes[Scenario::INDEXER_GEOMETRY]++;
 		} else {
 			p_instance->indexer_id = p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].insert(bvh_aabb, p_instance);
+			p_instance->scenario->indexer_changes[Scenario::INDEXER_VOLUMES]++;
 		}
 
 		p_instance->array_index = p_instance->scenario->instance_data.size();
@@ -1783,9 +1885,13 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
-			p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb);
+			if (p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb)) {
+				p_instance->scenario->indexer_changes[Scenario::INDEXER_GEOMETRY]++;
+			}
 		} else {
-			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
+			if (p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb)) {
+				p_instance->scenario->indexer_changes[Scenario::INDEXER_VOLUMES]++;
+			}
 		}
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
 	}
@@ -1862,8 +1968,10 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 
 	if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
 		p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].remove(p_instance->indexer_id);
+		p_instance->scenario->indexer_changes[Scenario::INDEXER_GEOMETRY]++;
 	} else {
 		p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].remove(p_instance->indexer_id);
+		p_instance->scenario->indexer_changes[Scenario::INDEXER_VOLUMES]++;
 	}
 
 	p_instance->indexer_id = DynamicBVH::ID();
@@ -2516,6 +2624,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info) {
 #ifndef _3D_DISABLED
+	ENGINE_TRACE_ZONE("RendererSceneCull::render_camera");
 
 	Camera *camera = camera_owner.get_or_null(p_camera);
 	ERR_FAIL_NULL(camera);
@@ -2939,12 +3048,13 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 				}
 			}
 
-			for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
-				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
-						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
-
-						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && LAYER_CHECK) {
+			// Only shadow casting geometry ends up in the cascades, so check the cheap flags
+			// once here instead of testing every cascade frustum for every instance.
+			uint32_t shadow_base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
+			if (cull_data.cull->shadow_count > 0 && ((1 << shadow_base_type) & RS::INSTANCE_GEOMETRY_MASK) && (idata.flags & InstanceData::FLAG_CAST_SHADOWS) && LAYER_CHECK) {
+				for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+					for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+						if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
 							cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
 							mesh_visible = true;
 						}
@@ -3482,6 +3592,7 @@ void RendererSceneCull::render_probes() {
 	SelfList<InstanceReflectionProbeData> *ref_probe = reflection_probe_render_list.first();
 
 	bool busy = false;
+	int always_steps_left = reflection_probe_update_always_steps;
 
 	while (ref_probe) {
 		SelfList<InstanceReflectionProbeData> *next = ref_probe->next();
@@ -3503,14 +3614,30 @@ void RendererSceneCull::render_probes() {
 				busy = true; //do not render another one of this kind
 			} break;
 			case RS::REFLECTION_PROBE_UPDATE_ALWAYS: {
-				int step = 0;
+				if (reflection_probe_update_always_steps == 0) {
+					int step = 0;
+					bool done = false;
+					while (!done) {
+						done = _render_reflection_probe_step(ref_probe->self()->owner, step);
+						step++;
+					}
+
+					reflection_probe_render_list.remove(ref_probe);
+					break;
+				}
+
+				// Time-sliced: continue where the previous frame left off, until the budget runs out.
+				// Probes that don't get a turn stay in the list and keep their current step.
 				bool done = false;
-				while (!done) {
-					done = _render_reflection_probe_step(ref_probe->self()->owner, step);
-					step++;
+				while (!done && always_steps_left > 0) {
+					done = _render_reflection_probe_step(ref_probe->self()->owner, ref_probe->self()->render_step);
+					ref_probe->self()->render_step++;
+					always_steps_left--;
 				}
 
-				reflection_probe_render_list.remove(ref_probe);
+				if (done) {
+					reflection_probe_render_list.remove(ref_probe);
+				}
 			} break;
 		}
 
@@ -4036,8 +4163,28 @@ void RendererSceneCull::update() {
 	scenario_owner.fill_owned_buffer(rids);
 	for (uint32_t i = 0; i < rid_count; i++) {
 		Scenario *s = scenario_owner.get_or_null(rids[i]);
-		s->indexers[Scenario::INDEXER_GEOMETRY].optimize_incremental(indexer_update_iterations);
-		s->indexers[Scenario::INDEXER_VOLUMES].optimize_incremental(indexer_update_iterations);
+		for (int j = 0; j < Scenario::INDEXER_MAX; j++) {
+			if (s->indexer_changes[j] == 0 && s->indexer_reinsertions_pending[j] == 0) {
+				continue; // Tree unchanged since the last refinement, nothing to do.
+			}
+			DynamicBVH &indexer = s->indexers[j];
+			s->indexer_changes_since_rebuild[j] += s->indexer_changes[j];
+			s->indexer_changes[j] = 0;
+
+			if (s->indexer_changes_since_rebuild[j] > uint32_t(indexer.get_leaf_count()) * INDEXER_REBUILD_CHANGES_PER_LEAF) {
+				// Reinsert every leaf once, spread over the next frames rather than rebuilding the tree at once.
+				s->indexer_reinsertions_pending[j] = indexer.get_leaf_count();
+				s->indexer_changes_since_rebuild[j] = 0;
+			}
+
+			int passes = indexer_update_iterations;
+			if (s->indexer_reinsertions_pending[j] > 0) {
+				uint32_t reinsertions = MIN(s->indexer_reinsertions_pending[j], uint32_t(INDEXER_REINSERTIONS_PER_FRAME));
+				s->indexer_reinsertions_pending[j] -= reinsertions;
+				passes = MAX(passes, int(reinsertions));
+			}
+			indexer.optimize_incremental(passes);
+		}
 	}
 	scene_render->update();
 	update_dirty_instances();
@@ -4164,6 +4311,9 @@ RendererSceneCull::RendererSceneCull() {
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
 
+	reflection_probe_update_always_steps = MAX(0, int(GLOBAL_GET("rendering/reflections/reflection_probes/update_always_steps_per_frame")));
+	reflection_probe_update_once_on_change = GLOBAL_GET("rendering/reflections/reflection_probes/update_once_on_contents_change");
+
 	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
 }
 
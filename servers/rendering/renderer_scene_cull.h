@@ -315,6 +315,11 @@ public:
 		};
 
 		DynamicBVH indexers[INDEXER_MAX];
+		// Leaf insertions, removals and moves, used to only refine the trees that changed
+		// and to reinsert all of their leaves once they changed a lot.
+		uint32_t indexer_changes[INDEXER_MAX] = {};
+		uint32_t indexer_changes_since_rebuild[INDEXER_MAX] = {};
+		uint32_t indexer_reinsertions_pending[INDEXER_MAX] = {};
 
 		RID self;
 
@@ -342,6 +347,14 @@ public:
 		}
 	};
 
+	enum {
+		// All leaves are reinserted once this many changes per leaf accumulated,
+		// so long-running local reinsertions don't degrade the tree quality indefinitely.
+		INDEXER_REBUILD_CHANGES_PER_LEAF = 4,
+		// Leaves reinserted per frame and tree meanwhile, if more than the regular update iterations.
+		INDEXER_REINSERTIONS_PER_FRAME = 256,
+	};
+
 	int indexer_update_iterations = 0;
 
 	mutable RID_Owner<Scenario, true> scenario_owner;
@@ -653,6 +666,11 @@ public:
 
 	SelfList<InstanceReflectionProbeData>::List reflection_probe_render_list;
 
+	// Maximum render steps (cubemap faces and the filter pass) spent on "update always" probes each frame, 0 is unlimited.
+	int reflection_probe_update_always_steps = 0;
+	// Re-render "update once" probes when geometry they capture moves, is added or is removed.
+	bool reflection_probe_update_once_on_change = false;
+
 	struct InstanceParticlesCollisionData : public InstanceBaseData {
 		RID instance;
 	};
@@ -950,7 +968,7 @@ public:
 
 	uint32_t thread_cull_threshold = 200;
 
-	RID_Owner<Instance, true> instance_owner;
+	RID_Owner<Instance, true> instance_owner{ 65536, 4194304 };
 
 	uint32_t geometry_instance_pair_mask = 0; // used in traditional forward, unnecessary on clustered
 
@@ -964,6 +982,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1005,10 +1024,12 @@ public:
 	virtual Variant instance_geometry_get_shader_parameter(RID p_instance, const StringName &p_parameter) const;
 	virtual Variant instance_geometry_get_shader_parameter_default_value(RID p_instance, const StringName &p_parameter) const;
 
+	bool _light_shadow_intersects_aabb(const Instance *p_light, const AABB &p_aabb) const;
 	_FORCE_INLINE_ void _update_instance(Instance *p_instance);
 	_FORCE_INLINE_ void _update_instance_aabb(Instance *p_instance);
 	_FORCE_INLINE_ void _update_dirty_instance(Instance *p_instance);
 	_FORCE_INLINE_ void _update_instance_lightmap_captures(Instance *p_instance);
+	_FORCE_INLINE_ void _reflection_probe_mark_contents_dirty(Instance *p_probe, const Instance *p_geometry);
 	void _unpair_instance(Instance *p_instance);
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
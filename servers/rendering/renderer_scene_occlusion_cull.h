@@ -81,23 +81,30 @@ public:
 			Vector2 rect_min = Vector2(FLT_MAX, FLT_MAX);
 			Vector2 rect_max = Vector2(FLT_MIN, FLT_MIN);
 
+			// Both transforms are linear, so instead of transforming all 8 corners, project
+			// one corner and the three box edges once, then combine them per corner.
+			const Vector3 bounds_max = Vector3(p_bounds[3], p_bounds[4], p_bounds[5]);
+			const Vector3 extents = bounds_max - Vector3(p_bounds[0], p_bounds[1], p_bounds[2]);
+			const Vector3 view_max = p_cam_inv_transform.xform(bounds_max);
+			const Vector4 projected_max = p_cam_projection.xform(Vector4(view_max.x, view_max.y, view_max.z, 1.0));
+			Vector4 projected_edges[3];
+			for (int k = 0; k < 3; k++) {
+				const Vector3 edge = p_cam_inv_transform.basis.get_column(k) * extents[k];
+				projected_edges[k] = p_cam_projection.xform(Vector4(edge.x, edge.y, edge.z, 0.0));
+			}
+
 			for (int j = 0; j < 8; j++) {
 				const Vector3 &c = RendererSceneOcclusionCull::HZBuffer::corners[j];
-				Vector3 nc = Vector3(1, 1, 1) - c;
-				Vector3 corner = Vector3(p_bounds[0] * c.x + p_bounds[3] * nc.x, p_bounds[1] * c.y + p_bounds[4] * nc.y, p_bounds[2] * c.z + p_bounds[5] * nc.z);
-				Vector3 view = p_cam_inv_transform.xform(corner);
-
-				Plane vp = Plane(view, 1.0);
-				Plane projected = p_cam_projection.xform4(vp);
+				const Vector4 projected = projected_max - projected_edges[0] * c.x - projected_edges[1] * c.y - projected_edges[2] * c.z;
 
-				float w = projected.d;
+				float w = projected.w;
 				if (w < 1.0) {
 					rect_min = Vector2(0.0f, 0.0f);
 					rect_max = Vector2(1.0f, 1.0f);
 					break;
 				}
 
-				Vector2 normalized = Vector2(projected.normal.x / w * 0.5f + 0.5f, projected.normal.y / w * 0.5f + 0.5f);
+				Vector2 normalized = Vector2(projected.x / w * 0.5f + 0.5f, projected.y / w * 0.5f + 0.5f);
 				rect_min = rect_min.min(normalized);
 				rect_max = rect_max.max(normalized);
 			}
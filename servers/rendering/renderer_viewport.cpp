@@ -281,6 +281,17 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		}
 	}
 
+#ifdef DEBUG_ENABLED
+	if (unlikely(p_viewport->material_stats_enabled)) {
+		for (int i = 0; i < RenderingMethod::MATERIAL_STATS_PASS_MAX; i++) {
+			p_viewport->material_stats[i].clear();
+		}
+		p_viewport->render_info.material_stats = p_viewport->material_stats;
+	} else {
+		p_viewport->render_info.material_stats = nullptr;
+	}
+#endif
+
 	if (RSG::scene->is_scenario(p_viewport->scenario)) {
 		RID environment = RSG::scene->scenario_get_environment(p_viewport->scenario);
 		if (RSG::scene->is_environment(environment)) {
@@ -329,43 +340,11 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		RendererCanvasRender::Light *directional_lights = nullptr;
 		RendererCanvasRender::Light *directional_lights_with_shadow = nullptr;
 
-		if (p_viewport->sdf_active) {
-			// Process SDF.
-
-			Rect2 sdf_rect = RSG::texture_storage->render_target_get_sdf_rect(p_viewport->render_target);
-
-			RendererCanvasRender::LightOccluderInstance *occluders = nullptr;
-
-			// Make list of occluders.
-			for (KeyValue<RID, Viewport::CanvasData> &E : p_viewport->canvas_map) {
-				RendererCanvasCull::Canvas *canvas = static_cast<RendererCanvasCull::Canvas *>(E.value.canvas);
-				Transform2D xf = _canvas_get_transform(p_viewport, canvas, &E.value, clip_rect.size);
-
-				for (RendererCanvasRender::LightOccluderInstance *F : canvas->occluders) {
-					if (!F->enabled) {
-						continue;
-					}
-					F->xform_cache = xf * F->xform;
-
-					if (sdf_rect.intersects_transformed(F->xform_cache, F->aabb_cache)) {
-						F->next = occluders;
-						occluders = F;
-					}
-				}
-			}
-
-			RSG::canvas_render->render_sdf(p_viewport->render_target, occluders);
-			RSG::texture_storage->render_target_mark_sdf_enabled(p_viewport->render_target, true);
-
-			p_viewport->sdf_active = false; // If used, gets set active again.
-		} else {
-			RSG::texture_storage->render_target_mark_sdf_enabled(p_viewport->render_target, false);
-		}
-
 		Rect2 shadow_rect;
 
 		int shadow_count = 0;
 		int directional_light_count = 0;
+		bool sdf_shadows_used = false;
 
 		RENDER_TIMESTAMP("Cull 2D Lights");
 		for (KeyValue<RID, Viewport::CanvasData> &E : p_viewport->canvas_map) {
@@ -393,7 +372,10 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 						scale.scale(cl->rect_cache.size);
 						scale.columns[2] = cl->rect_cache.position;
 						cl->light_shader_xform = xf * cl->xform * scale;
-						if (cl->use_shadow) {
+						if (cl->use_shadow && cl->shadow_filter == RS::CANVAS_LIGHT_FILTER_SDF) {
+							// Shadowed from the canvas SDF, no shadow map needed.
+							sdf_shadows_used = true;
+						} else if (cl->use_shadow) {
 							cl->shadows_next_ptr = lights_with_shadow;
 							if (lights_with_shadow == nullptr) {
 								shadow_rect = cl->xform_cache.xform(cl->rect_cache);
@@ -414,7 +396,9 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 					directional_lights = cl;
 					cl->xform_cache = xf * cl->xform;
 					cl->xform_cache.columns[2] = Vector2(); //translation is pointless
-					if (cl->use_shadow) {
+					if (cl->use_shadow && cl->shadow_filter == RS::CANVAS_LIGHT_FILTER_SDF) {
+						sdf_shadows_used = true;
+					} else if (cl->use_shadow) {
 						cl->shadows_next_ptr = directional_lights_with_shadow;
 						directional_lights_with_shadow = cl;
 					}
@@ -430,6 +414,39 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 			canvas_map[Viewport::CanvasKey(E.key, E.value.layer, E.value.sublayer)] = &E.value;
 		}
 
+		if (p_viewport->sdf_active || sdf_shadows_used) {
+			// Process SDF.
+
+			Rect2 sdf_rect = RSG::texture_storage->render_target_get_sdf_rect(p_viewport->render_target);
+
+			RendererCanvasRender::LightOccluderInstance *occluders = nullptr;
+
+			// Make list of occluders.
+			for (KeyValue<RID, Viewport::CanvasData> &E : p_viewport->canvas_map) {
+				RendererCanvasCull::Canvas *canvas = static_cast<RendererCanvasCull::Canvas *>(E.value.canvas);
+				Transform2D xf = _canvas_get_transform(p_viewport, canvas, &E.value, clip_rect.size);
+
+				for (RendererCanvasRender::LightOccluderInstance *F : canvas->occluders) {
+					if (!F->enabled) {
+						continue;
+					}
+					F->xform_cache = xf * F->xform;
+
+					if (sdf_rect.intersects_transformed(F->xform_cache, F->aabb_cache)) {
+						F->next = occluders;
+						occluders = F;
+					}
+				}
+			}
+
+			RSG::canvas_render->render_sdf(p_viewport->render_target, occluders);
+			RSG::texture_storage->render_target_mark_sdf_enabled(p_viewport->render_target, true);
+
+			p_viewport->sdf_active = false; // If used, gets set active again.
+		} else {
+			RSG::texture_storage->render_target_mark_sdf_enabled(p_viewport->render_target, false);
+		}
+
 		if (lights_with_shadow) {
 			//update shadows if any
 
@@ -1329,6 +1346,41 @@ void RendererViewport::viewport_set_debug_draw(RID p_viewport, RS::ViewportDebug
 	viewport->debug_draw = p_draw;
 }
 
+void RendererViewport::viewport_set_material_render_stats_enabled(RID p_viewport, bool p_enable) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	viewport->material_stats_enabled = p_enable;
+	if (!p_enable) {
+		for (int i = 0; i < RenderingMethod::MATERIAL_STATS_PASS_MAX; i++) {
+			viewport->material_stats[i].clear();
+		}
+	}
+}
+
+TypedArray<Dictionary> RendererViewport::viewport_get_material_render_stats(RID p_viewport) const {
+	const Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL_V(viewport, TypedArray<Dictionary>());
+
+	static const char *pass_names[RenderingMethod::MATERIAL_STATS_PASS_MAX] = { "opaque", "alpha", "shadow" };
+
+	TypedArray<Dictionary> ret;
+	for (int i = 0; i < RenderingMethod::MATERIAL_STATS_PASS_MAX; i++) {
+		for (const KeyValue<RID, RenderingMethod::MaterialStats> &E : viewport->material_stats[i]) {
+			Dictionary stats;
+			stats["material"] = E.key;
+			stats["shader_path"] = E.value.shader_path;
+			stats["pass"] = pass_names[i];
+			stats["draw_calls"] = E.value.draw_calls;
+			stats["instances"] = E.value.instances;
+			stats["primitives"] = E.value.primitives;
+			stats["shader_changes"] = E.value.shader_changes;
+			ret.push_back(stats);
+		}
+	}
+	return ret;
+}
+
 void RendererViewport::viewport_set_measure_render_time(RID p_viewport, bool p_enable) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
@@ -1406,6 +1458,13 @@ void RendererViewport::viewport_set_vrs_mode(RID p_viewport, RS::ViewportVRSMode
 	_configure_3d_render_buffers(viewport);
 }
 
+void RendererViewport::viewport_set_vrs_update_mode(RID p_viewport, RS::ViewportVRSUpdateMode p_mode) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	RSG::texture_storage->render_target_set_vrs_update_mode(viewport->render_target, p_mode);
+}
+
 void RendererViewport::viewport_set_vrs_texture(RID p_viewport, RID p_texture) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
@@ -154,6 +154,9 @@ public:
 
 		RenderingMethod::RenderInfo render_info;
 
+		bool material_stats_enabled = false;
+		HashMap<RID, RenderingMethod::MaterialStats> material_stats[RenderingMethod::MATERIAL_STATS_PASS_MAX];
+
 		Viewport() {
 			view_count = 1;
 			update_mode = RS::VIEWPORT_UPDATE_WHEN_VISIBLE;
@@ -279,6 +282,9 @@ public:
 	virtual int viewport_get_render_info(RID p_viewport, RS::ViewportRenderInfoType p_type, RS::ViewportRenderInfo p_info);
 	virtual void viewport_set_debug_draw(RID p_viewport, RS::ViewportDebugDraw p_draw);
 
+	void viewport_set_material_render_stats_enabled(RID p_viewport, bool p_enable);
+	TypedArray<Dictionary> viewport_get_material_render_stats(RID p_viewport) const;
+
 	void viewport_set_measure_render_time(RID p_viewport, bool p_enable);
 	float viewport_get_measured_render_time_cpu(RID p_viewport) const;
 	float viewport_get_measured_render_time_gpu(RID p_viewport) const;
@@ -294,6 +300,7 @@ public:
 	virtual RID viewport_find_from_screen_attachment(DisplayServer::WindowID p_id = DisplayServer::MAIN_WINDOW_ID) const;
 
 	void viewport_set_vrs_mode(RID p_viewport, RS::ViewportVRSMode p_mode);
+	void viewport_set_vrs_update_mode(RID p_viewport, RS::ViewportVRSUpdateMode p_mode);
 	void viewport_set_vrs_texture(RID p_viewport, RID p_texture);
 
 	void handle_timestamp(String p_timestamp, uint64_t p_cpu_time, uint64_t p_gpu_time);
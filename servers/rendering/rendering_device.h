@@ -1196,6 +1196,8 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size) = 0;
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0) = 0;
+	// Draw arguments are read from a buffer created with STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT, which may be filled by a compute pass.
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0) = 0;
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) = 0;
 	virtual void draw_list_disable_scissor(DrawListID p_list) = 0;
@@ -1300,6 +1302,8 @@ public:
 	virtual void prepare_screen_for_drawing() = 0;
 
 	virtual void swap_buffers() = 0;
+	// Blocks until the last swapped frame reached the display, returns the present latency in usec (0 if unsupported).
+	virtual uint64_t wait_for_present(uint64_t p_timeout_usec) = 0;
 
 	virtual uint32_t get_frame_delay() const = 0;
 
@@ -74,6 +74,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -297,8 +298,25 @@ public:
 
 	virtual void render_empty_scene(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_scenario, RID p_shadow_atlas) = 0;
 
+	enum MaterialStatsPass {
+		MATERIAL_STATS_PASS_OPAQUE,
+		MATERIAL_STATS_PASS_ALPHA,
+		MATERIAL_STATS_PASS_SHADOW,
+		MATERIAL_STATS_PASS_MAX
+	};
+
+	struct MaterialStats {
+		String shader_path;
+		uint32_t draw_calls = 0;
+		uint32_t instances = 0;
+		uint64_t primitives = 0;
+		uint32_t shader_changes = 0; // Draws that switched shader from the previous draw, an estimate of pipeline changes.
+	};
+
 	struct RenderInfo {
 		int info[RS::VIEWPORT_RENDER_INFO_TYPE_MAX][RS::VIEWPORT_RENDER_INFO_MAX] = {};
+		// Only set in debug builds when enabled on the viewport, one map per MaterialStatsPass keyed by material.
+		HashMap<RID, MaterialStats> *material_stats = nullptr;
 	};
 
 	virtual void render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info = nullptr) = 0;
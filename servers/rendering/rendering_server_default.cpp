@@ -31,6 +31,7 @@
 #include "rendering_server_default.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_tracer.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/templates/sort_array.h"
@@ -76,6 +77,8 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	RSG::rasterizer->begin_frame(frame_step);
 
+	RSG::utilities->capturing_timestamps = frame_profiling_enabled || print_gpu_profile || EngineTracer::is_enabled();
+
 	TIMESTAMP_BEGIN()
 
 	uint64_t time_usec = OS::get_singleton()->get_ticks_usec();
@@ -145,6 +148,7 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 		}
 
 		frame_profile = new_profile;
+		_update_frame_profile_area_times(base_cpu);
 	}
 
 	frame_profile_frame = RSG::utilities->get_captured_timestamps_frame();
@@ -262,8 +266,78 @@ RenderingDevice::DeviceType RenderingServerDefault::get_video_adapter_type() con
 	return RSG::utilities->get_video_adapter_type();
 }
 
+void RenderingServerDefault::_update_frame_profile_area_times(uint64_t p_base_cpu_usec) {
+	// Turns the markers into durations: "> Name" ... "< Name" pairs give nested areas,
+	// other markers last until the next marker. Areas reached several times per frame
+	// (e.g. once per viewport) are summed up.
+	frame_profile_area_gpu_times.clear();
+	const bool tracing = EngineTracer::is_enabled();
+
+	LocalVector<int> open_areas;
+	for (int i = 0; i < frame_profile.size(); i++) {
+		const String &marker = frame_profile[i].name;
+		if (marker.is_empty()) {
+			continue;
+		}
+
+		String name;
+		double begin_msec = frame_profile[i].gpu_msec;
+		double end_msec;
+		if (marker[0] == '>') {
+			open_areas.push_back(i);
+			continue;
+		} else if (marker[0] == '<') {
+			name = marker.substr(2);
+			int open_index = -1;
+			for (int j = int(open_areas.size()) - 1; j >= 0; j--) {
+				if (frame_profile[open_areas[j]].name.substr(2) == name) {
+					open_index = j;
+					break;
+				}
+			}
+			if (open_index == -1) {
+				continue;
+			}
+			begin_msec = frame_profile[open_areas[open_index]].gpu_msec;
+			end_msec = frame_profile[i].gpu_msec;
+			open_areas.resize(open_index);
+		} else {
+			if (i + 1 >= frame_profile.size()) {
+				break; // The last marker has nothing to end it.
+			}
+			name = marker;
+			end_msec = frame_profile[i + 1].gpu_msec;
+		}
+
+		HashMap<String, double>::Iterator E = frame_profile_area_gpu_times.find(name);
+		if (E) {
+			E->value += end_msec - begin_msec;
+		} else {
+			frame_profile_area_gpu_times.insert(name, end_msec - begin_msec);
+		}
+
+		if (tracing) {
+			// GPU times are placed on the CPU timeline relative to when the first timestamp was recorded.
+			EngineTracer::record_gpu(EngineTracer::intern_name(name), p_base_cpu_usec + uint64_t(begin_msec * 1000.0), p_base_cpu_usec + uint64_t(end_msec * 1000.0));
+		}
+	}
+}
+
 void RenderingServerDefault::set_frame_profiling_enabled(bool p_enable) {
-	RSG::utilities->capturing_timestamps = p_enable;
+	frame_profiling_enabled = p_enable;
+}
+
+double RenderingServerDefault::get_frame_profile_area_gpu_time(const String &p_area) const {
+	HashMap<String, double>::ConstIterator E = frame_profile_area_gpu_times.find(p_area);
+	return E ? E->value : 0.0;
+}
+
+PackedStringArray RenderingServerDefault::get_frame_profile_area_names() const {
+	PackedStringArray names;
+	for (const KeyValue<String, double> &E : frame_profile_area_gpu_times) {
+		names.push_back(E.key);
+	}
+	return names;
 }
 
 uint64_t RenderingServerDefault::get_frame_profile_frame() {
@@ -298,7 +372,6 @@ void RenderingServerDefault::sdfgi_set_debug_probe_select(const Vector3 &p_posit
 }
 
 void RenderingServerDefault::set_print_gpu_profile(bool p_enable) {
-	RSG::utilities->capturing_timestamps = p_enable;
 	print_gpu_profile = p_enable;
 }
 
@@ -386,6 +459,22 @@ void RenderingServerDefault::draw(bool p_swap_buffers, double frame_step) {
 	}
 }
 
+void RenderingServerDefault::_wait_for_frame_present(uint64_t p_timeout_usec, uint64_t *r_latency_usec) {
+	RenderingDevice *rd = RenderingDevice::get_singleton();
+	*r_latency_usec = rd ? rd->wait_for_present(p_timeout_usec) : 0;
+}
+
+uint64_t RenderingServerDefault::wait_for_frame_present(uint64_t p_timeout_usec) {
+	uint64_t latency_usec = 0;
+	if (create_thread) {
+		// Runs after the pending draw on the render thread.
+		command_queue.push_and_sync(this, &RenderingServerDefault::_wait_for_frame_present, p_timeout_usec, &latency_usec);
+	} else {
+		_wait_for_frame_present(p_timeout_usec, &latency_usec);
+	}
+	return latency_usec;
+}
+
 void RenderingServerDefault::_call_on_render_thread(const Callable &p_callable) {
 	p_callable.call();
 }
@@ -64,6 +64,10 @@ class RenderingServerDefault : public RenderingServer {
 
 	uint64_t frame_profile_frame;
 	Vector<FrameProfileArea> frame_profile;
+	bool frame_profiling_enabled = false;
+	HashMap<String, double> frame_profile_area_gpu_times;
+
+	void _update_frame_profile_area_times(uint64_t p_base_cpu_usec);
 
 	double frame_setup_time = 0;
 
@@ -92,6 +96,7 @@ class RenderingServerDefault : public RenderingServer {
 	Mutex alloc_mutex;
 
 	void _draw(bool p_swap_buffers, double frame_step);
+	void _wait_for_frame_present(uint64_t p_timeout_usec, uint64_t *r_latency_usec);
 	void _init();
 	void _finish();
 
@@ -341,6 +346,7 @@ public:
 	FUNC2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	FUNC2(multimesh_set_buffer, RID, const Vector<float> &)
+	FUNC3(multimesh_set_buffer_range, RID, int, const Vector<float> &)
 	FUNC1RC(Vector<float>, multimesh_get_buffer, RID)
 
 	FUNC2(multimesh_set_visible_instances, RID, int)
@@ -658,6 +664,8 @@ public:
 
 	FUNC3R(int, viewport_get_render_info, RID, ViewportRenderInfoType, ViewportRenderInfo)
 	FUNC2(viewport_set_debug_draw, RID, ViewportDebugDraw)
+	FUNC2(viewport_set_material_render_stats_enabled, RID, bool)
+	FUNC1RC(TypedArray<Dictionary>, viewport_get_material_render_stats, RID)
 
 	FUNC2(viewport_set_measure_render_time, RID, bool)
 	FUNC1RC(double, viewport_get_measured_render_time_cpu, RID)
@@ -667,6 +675,7 @@ public:
 	FUNC2(call_set_vsync_mode, DisplayServer::VSyncMode, DisplayServer::WindowID)
 
 	FUNC2(viewport_set_vrs_mode, RID, ViewportVRSMode)
+	FUNC2(viewport_set_vrs_update_mode, RID, ViewportVRSUpdateMode)
 	FUNC2(viewport_set_vrs_texture, RID, RID)
 
 	/* ENVIRONMENT API */
@@ -779,6 +788,7 @@ public:
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC3(instance_set_pivot_data, RID, float, bool)
 	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instances_set_transforms, const Vector<RID> &, const Vector<Transform3D> &)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
@@ -978,6 +988,8 @@ public:
 	virtual void set_frame_profiling_enabled(bool p_enable) override;
 	virtual Vector<FrameProfileArea> get_frame_profile() override;
 	virtual uint64_t get_frame_profile_frame() override;
+	virtual double get_frame_profile_area_gpu_time(const String &p_area) const override;
+	virtual PackedStringArray get_frame_profile_area_names() const override;
 
 	virtual RID get_test_cube() override;
 
@@ -998,6 +1010,7 @@ public:
 
 	virtual void draw(bool p_swap_buffers, double frame_step) override;
 	virtual void sync() override;
+	virtual uint64_t wait_for_frame_present(uint64_t p_timeout_usec) override;
 	virtual bool has_changed() const override;
 	virtual void init() override;
 	virtual void finish() override;
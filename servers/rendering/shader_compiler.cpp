@@ -1452,7 +1452,98 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+bool ShaderCompiler::_is_cache_entry_valid(const CacheEntry &p_entry) const {
+	// Global uniforms are validated against the project's global parameters while parsing,
+	// so make sure the ones used by the shader still exist with the same type.
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : p_entry.uniforms) {
+		if (E.value.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL && _get_global_shader_uniform_type(E.key) != E.value.type) {
+			return false;
+		}
+	}
+	return true;
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	const uint32_t key = hash_murmur3_one_32(uint32_t(p_mode), p_code.hash());
+
+	const CacheEntry *entry = compile_cache.getptr(key);
+	if (entry && entry->mode == p_mode && entry->code == p_code && _is_cache_entry_valid(*entry)) {
+		r_gen_code = entry->gen_code;
+		for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : entry->uniforms) {
+			p_actions->uniforms->insert(E.key, E.value);
+		}
+		for (const StringName &E : entry->render_mode_flags) {
+			*p_actions->render_mode_flags[E] = true;
+		}
+		for (const Pair<StringName, int> &E : entry->render_mode_values) {
+			*p_actions->render_mode_values[E.first].first = E.second;
+		}
+		for (const StringName &E : entry->usage_flags) {
+			*p_actions->usage_flag_pointers[E] = true;
+		}
+		for (const StringName &E : entry->write_flags) {
+			*p_actions->write_flag_pointers[E] = true;
+		}
+		return OK;
+	}
+
+	// Snapshot the flags, so the ones set by this compilation can be recorded.
+	HashMap<StringName, bool> prev_render_mode_flags;
+	for (const KeyValue<StringName, bool *> &E : p_actions->render_mode_flags) {
+		prev_render_mode_flags[E.key] = *E.value;
+	}
+	HashMap<StringName, int> prev_render_mode_values;
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		prev_render_mode_values[E.key] = *E.value.first;
+	}
+	HashMap<StringName, bool> prev_usage_flags;
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		prev_usage_flags[E.key] = *E.value;
+	}
+	HashMap<StringName, bool> prev_write_flags;
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		prev_write_flags[E.key] = *E.value;
+	}
+	Error err = _compile(p_mode, p_code, p_actions, p_path, r_gen_code);
+	if (err != OK) {
+		return err;
+	}
+
+	if (compile_cache.size() >= MAX_CACHE_ENTRIES) {
+		compile_cache.clear();
+	}
+
+	CacheEntry &new_entry = compile_cache[key];
+	new_entry = CacheEntry();
+	new_entry.mode = p_mode;
+	new_entry.code = p_code;
+	new_entry.gen_code = r_gen_code;
+	new_entry.uniforms = *p_actions->uniforms;
+	for (const KeyValue<StringName, bool *> &E : p_actions->render_mode_flags) {
+		if (*E.value && !prev_render_mode_flags[E.key]) {
+			new_entry.render_mode_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		if (*E.value.first != prev_render_mode_values[E.key]) {
+			new_entry.render_mode_values.push_back(Pair<StringName, int>(E.key, *E.value.first));
+		}
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		if (*E.value && !prev_usage_flags[E.key]) {
+			new_entry.usage_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		if (*E.value && !prev_write_flags[E.key]) {
+			new_entry.write_flags.push_back(E.key);
+		}
+	}
+
+	return OK;
+}
+
+Error ShaderCompiler::_compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
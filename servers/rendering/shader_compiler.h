@@ -125,6 +125,29 @@ private:
 
 	DefaultIdentifierActions actions;
 
+	// Successful compilations are cached by mode and source, along with the side effects
+	// they had on the IdentifierActions, so compiling the same code again (e.g. duplicated
+	// shaders across materials and scenes) skips parsing and code generation entirely.
+	struct CacheEntry {
+		RS::ShaderMode mode = RS::SHADER_MAX;
+		String code;
+		GeneratedCode gen_code;
+		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+		Vector<StringName> render_mode_flags;
+		Vector<Pair<StringName, int>> render_mode_values;
+		Vector<StringName> usage_flags;
+		Vector<StringName> write_flags;
+	};
+
+	enum {
+		MAX_CACHE_ENTRIES = 64,
+	};
+
+	HashMap<uint32_t, CacheEntry> compile_cache;
+
+	bool _is_cache_entry_valid(const CacheEntry &p_entry) const;
+	Error _compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
+
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
 public:
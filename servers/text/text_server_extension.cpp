@@ -1147,6 +1147,7 @@ double TextServerExtension::shaped_text_tab_align(const RID &p_shaped, const Pac
 }
 
 bool TextServerExtension::shaped_text_shape(const RID &p_shaped) {
+	MEMORY_TAG_SCOPE(TAG_TEXT);
 	bool ret = false;
 	GDVIRTUAL_CALL(_shaped_text_shape, p_shaped, ret);
 	return ret;
@@ -848,6 +848,24 @@ TEST_SUITE("[ClassDB]") {
 			}
 		}
 	}
+
+	TEST_CASE("[ClassDB] Look up classes without instantiating them") {
+		// With deferred class binding, these lookups are what binds the classes.
+		CHECK(ClassDB::has_method("AESContext", "start", true));
+		CHECK(ClassDB::get_method("AESContext", "finish") != nullptr);
+		CHECK(ClassDB::has_integer_constant("AESContext", "MODE_CBC_DECRYPT"));
+		CHECK(ClassDB::has_enum("AESContext", "Mode"));
+
+		List<PropertyInfo> properties;
+		ClassDB::get_property_list("JSON", &properties, true);
+		CHECK(properties.size() > 0);
+		CHECK(ClassDB::get_property_setter("JSON", "data") == StringName("set_data"));
+
+		// Inherited from classes that may not be bound either.
+		CHECK(ClassDB::has_signal("JSON", "changed"));
+		CHECK_FALSE(ClassDB::has_signal("JSON", "changed", true));
+		CHECK(ClassDB::has_method("JSON", "get_path"));
+	}
 }
 } // namespace TestClassDB
 
@@ -494,6 +494,34 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+TEST_CASE("[Object] ObjectDB class counts and allocations") {
+	HashMap<StringName, int> counts_before;
+	ObjectDB::get_class_counts(counts_before);
+
+	Object *object = memnew(Object);
+	NotificationObject1 *notification_object = memnew(NotificationObject1);
+
+	HashMap<StringName, int> counts_after;
+	ObjectDB::get_class_counts(counts_after);
+	CHECK_EQ(counts_after[SNAME("Object")], counts_before[SNAME("Object")] + 1);
+	CHECK_EQ(counts_after[NotificationObject1::get_class_static()], counts_before[NotificationObject1::get_class_static()] + 1);
+
+	LocalVector<ObjectDB::AllocationInfo> allocations;
+	ObjectDB::get_allocations(allocations);
+	bool found = false;
+	for (const ObjectDB::AllocationInfo &info : allocations) {
+		if (info.id == notification_object->get_instance_id()) {
+			found = true;
+			CHECK_EQ(info.class_name, NotificationObject1::get_class_static());
+			CHECK_MESSAGE(info.site.is_empty(), "Objects created from native code have no script allocation site.");
+		}
+	}
+	CHECK(found);
+
+	memdelete(object);
+	memdelete(notification_object);
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
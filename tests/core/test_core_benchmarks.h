@@ -0,0 +1,255 @@
+/**************************************************************************/
+/*  test_core_benchmarks.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CORE_BENCHMARKS_H
+#define TEST_CORE_BENCHMARKS_H
+
+#include "core/string/string_name.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/oa_hash_map.h"
+#include "core/templates/rb_map.h"
+#include "core/templates/vector.h"
+#include "core/variant/variant.h"
+
+#include "tests/test_benchmark.h"
+#include "tests/test_macros.h"
+
+namespace TestCoreBenchmarks {
+
+// Number of elements used by the container benchmarks.
+static const int BENCHMARK_ELEMENTS = 10000;
+
+TEST_CASE("[Benchmark][HashMap] Insert and lookup") {
+	int64_t sum = 0;
+	TestBenchmark::run("HashMap<int, int> insert", 100, [&]() {
+		HashMap<int, int> map;
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			map.insert(i, i);
+		}
+		sum += map.size();
+	});
+
+	HashMap<int, int> map;
+	for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+		map.insert(i, i);
+	}
+	TestBenchmark::run("HashMap<int, int> lookup", 100, [&]() {
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			sum += *map.getptr(i);
+		}
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][OAHashMap] Insert and lookup") {
+	int64_t sum = 0;
+	TestBenchmark::run("OAHashMap<int, int> insert", 100, [&]() {
+		OAHashMap<int, int> map;
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			map.insert(i, i);
+		}
+		sum += map.get_num_elements();
+	});
+
+	OAHashMap<int, int> map;
+	for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+		map.insert(i, i);
+	}
+	TestBenchmark::run("OAHashMap<int, int> lookup", 100, [&]() {
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			int value = 0;
+			map.lookup(i, value);
+			sum += value;
+		}
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][RBMap] Insert and lookup") {
+	int64_t sum = 0;
+	TestBenchmark::run("RBMap<int, int> insert", 100, [&]() {
+		RBMap<int, int> map;
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			map.insert(i, i);
+		}
+		sum += map.size();
+	});
+
+	RBMap<int, int> map;
+	for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+		map.insert(i, i);
+	}
+	TestBenchmark::run("RBMap<int, int> lookup", 100, [&]() {
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			sum += map.find(i)->value();
+		}
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][Vector] Push back, copy on write and iteration") {
+	int64_t sum = 0;
+	TestBenchmark::run("Vector<int> push_back", 100, [&]() {
+		Vector<int> vector;
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			vector.push_back(i);
+		}
+		sum += vector.size();
+	});
+
+	Vector<int> vector;
+	vector.resize(BENCHMARK_ELEMENTS);
+	TestBenchmark::run("Vector<int> copy on write", 1000, [&]() {
+		Vector<int> copy = vector;
+		copy.write[0] = 1; // Forces the copy.
+		sum += copy[0];
+	});
+	TestBenchmark::run("Vector<int> iterate", 1000, [&]() {
+		for (const int &value : vector) {
+			sum += value;
+		}
+		sum++;
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][LocalVector] Push back and iteration") {
+	int64_t sum = 0;
+	TestBenchmark::run("LocalVector<int> push_back", 100, [&]() {
+		LocalVector<int> vector;
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			vector.push_back(i);
+		}
+		sum += vector.size();
+	});
+
+	LocalVector<int> vector;
+	vector.resize(BENCHMARK_ELEMENTS);
+	TestBenchmark::run("LocalVector<int> iterate", 1000, [&]() {
+		for (const int &value : vector) {
+			sum += value;
+		}
+		sum++;
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][StringName] Construction and comparison") {
+	Vector<String> strings;
+	for (int i = 0; i < 1000; i++) {
+		strings.push_back("benchmark_name_" + itos(i));
+	}
+	int64_t sum = 0;
+	TestBenchmark::run("StringName from String", 100, [&]() {
+		for (const String &string : strings) {
+			StringName name = string;
+			sum += name.hash() & 1;
+		}
+	});
+	TestBenchmark::run("StringName from const char *", 100, [&]() {
+		for (int i = 0; i < 1000; i++) {
+			StringName name = "benchmark_static_name";
+			sum += name.hash() & 1;
+		}
+	});
+
+	Vector<StringName> names;
+	for (const String &string : strings) {
+		names.push_back(string);
+	}
+	TestBenchmark::run("StringName compare", 1000, [&]() {
+		for (int i = 0; i < names.size(); i++) {
+			sum += names[i] == names[names.size() - i - 1];
+		}
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][Variant] Evaluate and call") {
+	Variant a = 3;
+	Variant b = 4.5;
+	Variant ret;
+	bool valid = true;
+	double sum = 0;
+	TestBenchmark::run("Variant::evaluate int + float", 100000, [&]() {
+		Variant::evaluate(Variant::OP_ADD, a, b, ret, valid);
+		sum += double(ret);
+	});
+
+	Variant sa = String("benchmark");
+	Variant sb = String("_suffix");
+	TestBenchmark::run("Variant::evaluate String + String", 100000, [&]() {
+		Variant::evaluate(Variant::OP_ADD, sa, sb, ret, valid);
+	});
+	CHECK(valid);
+
+	Variant vector = Vector3(1, 2, 3);
+	Variant other = Vector3(4, 5, 6);
+	const Variant *args[1] = { &other };
+	const StringName dot = "dot";
+	TestBenchmark::run("Variant::callp Vector3.dot", 100000, [&]() {
+		Callable::CallError ce;
+		vector.callp(dot, args, 1, ret, ce);
+		sum += double(ret);
+	});
+	CHECK(sum > 0);
+}
+
+TEST_CASE("[Benchmark][Variant] Validated indexed access on packed arrays") {
+	PackedFloat32Array floats;
+	floats.resize(BENCHMARK_ELEMENTS);
+	Variant array = floats;
+	floats = PackedFloat32Array(); // Don't share the data with the Variant.
+
+	Variant::ValidatedIndexedSetter setter = Variant::get_member_validated_indexed_setter(Variant::PACKED_FLOAT32_ARRAY);
+	Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(Variant::PACKED_FLOAT32_ARRAY);
+	Variant value = 1.5;
+	Variant ret;
+	bool oob = false;
+	double sum = 0;
+	TestBenchmark::run("PackedFloat32Array validated indexed set", 100, [&]() {
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			setter(&array, i, &value, &oob);
+		}
+	});
+	TestBenchmark::run("PackedFloat32Array validated indexed get", 100, [&]() {
+		for (int i = 0; i < BENCHMARK_ELEMENTS; i++) {
+			getter(&array, i, &ret, &oob);
+			sum += double(ret);
+		}
+	});
+	CHECK(!oob);
+	CHECK(sum > 0);
+}
+
+} // namespace TestCoreBenchmarks
+
+#endif // TEST_CORE_BENCHMARKS_H
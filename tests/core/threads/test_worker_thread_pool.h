@@ -31,6 +31,7 @@
 #ifndef TEST_WORKER_THREAD_POOL_H
 #define TEST_WORKER_THREAD_POOL_H
 
+#include "core/object/message_queue.h"
 #include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
@@ -106,6 +107,163 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+TEST_CASE("[WorkerThreadPool] Process many elements in chunks using group tasks") {
+	for (int iterations = 0; iterations < 50; iterations++) {
+		// Enough elements per task for them to be claimed in chunks, with a remainder.
+		const int count = Math::random(1000, 5000);
+		const int tasks = Math::pow(2.0f, Math::random(0.0f, 3.0f));
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_test, (void *)0, count, tasks, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static void static_dependent_test(void *p_arg) {
+	// Each step must run after the previous one, which is the only one that could have incremented the counter.
+	uint64_t step = (uint64_t)p_arg;
+	if (counter[0].get() == (int)step) {
+		counter[0].increment();
+	}
+}
+TEST_CASE("[WorkerThreadPool] Chain tasks using dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int steps = Math::random(1, 32);
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(1);
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (int i = 0; i < steps; i++) {
+			Vector<WorkerThreadPool::TaskID> dependencies;
+			if (i > 0) {
+				dependencies.push_back(tasks[i - 1]);
+			}
+			tasks.push_back(WorkerThreadPool::get_singleton()->add_native_dependent_task(static_dependent_test, (void *)(uintptr_t)i, dependencies, !low_priority));
+		}
+		for (int i = steps - 1; i >= 0; i--) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+		}
+
+		CHECK(counter[0].get() == steps);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Parallel for, reduce and prefix sum") {
+	Math::seed(0);
+	for (int iterations = 0; iterations < 20; iterations++) {
+		const uint32_t count = Math::random(1, 20000);
+		const uint32_t grain = Math::random(1, 3000);
+
+		LocalVector<uint32_t> values;
+		values.resize(count);
+		WorkerThreadPool::get_singleton()->parallel_for(count, grain, [&](uint32_t p_from, uint32_t p_to) {
+			for (uint32_t i = p_from; i < p_to; i++) {
+				values[i] = i % 7;
+			}
+		});
+
+		uint64_t expected_total = 0;
+		bool all_set = true;
+		for (uint32_t i = 0; i < count; i++) {
+			all_set &= values[i] == i % 7;
+			expected_total += i % 7;
+		}
+		CHECK(all_set);
+
+		const uint64_t total = WorkerThreadPool::get_singleton()->parallel_reduce(
+				count, grain, uint64_t(0), [&](uint32_t p_from, uint32_t p_to) {
+					uint64_t sum = 0;
+					for (uint32_t i = p_from; i < p_to; i++) {
+						sum += values[i];
+					}
+					return sum;
+				},
+				[](uint64_t p_a, uint64_t p_b) { return p_a + p_b; });
+		CHECK(total == expected_total);
+
+		const uint32_t scan_total = WorkerThreadPool::get_singleton()->parallel_prefix_sum(values.ptr(), count, grain);
+		CHECK(scan_total == expected_total);
+
+		bool scan_correct = true;
+		uint32_t running = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			scan_correct &= values[i] == running;
+			running += i % 7;
+		}
+		CHECK(scan_correct);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Parallel sort") {
+	Math::seed(0);
+	LocalVector<int> buffer;
+	for (int iterations = 0; iterations < 20; iterations++) {
+		const uint32_t count = Math::random(0, 20000);
+		const uint32_t grain = Math::random(1, 3000);
+
+		LocalVector<int> values;
+		values.resize(count);
+		int64_t checksum = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			values[i] = Math::random(-1000, 1000);
+			checksum += values[i];
+		}
+
+		// Reuse the merge buffer across iterations, like callers sorting every frame.
+		WorkerThreadPool::get_singleton()->parallel_sort(values.ptr(), count, grain, _DefaultComparator<int>(), String(), &buffer);
+
+		bool sorted = true;
+		for (uint32_t i = 1; i < count; i++) {
+			sorted &= values[i - 1] <= values[i];
+			checksum -= values[i];
+		}
+		if (count > 0) {
+			checksum -= values[0];
+		}
+		CHECK(sorted);
+		CHECK(checksum == 0);
+	}
+}
+
+static void static_set_deferred_test(void *p_arg) {
+	Object *object = (Object *)p_arg;
+	object->set_deferred("metadata/value", 1);
+}
+
+TEST_CASE("[WorkerThreadPool] Deferred calls from tasks keep their order") {
+	MessageQueue *message_queue = MessageQueue::get_singleton() ? nullptr : memnew(MessageQueue);
+	Object *object = memnew(Object);
+
+	SUBCASE("Calls deferred after waiting for a task run after the task's") {
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(&static_set_deferred_test, object, true);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		object->set_deferred("metadata/value", 2);
+		MessageQueue::get_singleton()->flush();
+		CHECK(int(object->get_meta("value")) == 2);
+	}
+
+	SUBCASE("Calls deferred from a task are run by the next flush") {
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(&static_set_deferred_test, object, true);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		MessageQueue::get_singleton()->flush();
+		CHECK(int(object->get_meta("value", 0)) == 1);
+	}
+
+	memdelete(object);
+	if (message_queue) {
+		memdelete(message_queue);
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
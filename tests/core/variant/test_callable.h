@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  test_callable.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CALLABLE_H
+#define TEST_CALLABLE_H
+
+#include "core/object/callable_method_pointer.h"
+#include "core/variant/callable_bind.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCallable {
+
+static String concat_arguments(const String &p_a, const String &p_b, const String &p_c) {
+	return p_a + p_b + p_c;
+}
+
+TEST_CASE("[Callable] Nested binds") {
+	Callable callable = callable_mp_static(&concat_arguments);
+	Callable bound = callable.bind("c").bind("b");
+
+	// Binding twice results in a single bind over the original callable.
+	CallableCustomBind *ccb = dynamic_cast<CallableCustomBind *>(bound.get_custom());
+	REQUIRE(ccb != nullptr);
+	CHECK(ccb->get_callable() == callable);
+	CHECK(ccb->get_binds().size() == 2);
+	CHECK(bound.get_bound_arguments_count() == 2);
+
+	Variant arg = "a";
+	const Variant *args[1] = { &arg };
+	Variant ret;
+	Callable::CallError ce;
+	bound.callp(args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant("abc"));
+
+	Array bound_arguments = bound.get_bound_arguments();
+	REQUIRE(bound_arguments.size() == 2);
+	CHECK(bound_arguments[0] == Variant("b"));
+	CHECK(bound_arguments[1] == Variant("c"));
+
+	// Unbinds are kept as a separate level.
+	Callable unbound = callable.bind("c").unbind(1).bind("b");
+	ccb = dynamic_cast<CallableCustomBind *>(unbound.get_custom());
+	REQUIRE(ccb != nullptr);
+	CHECK(dynamic_cast<CallableCustomUnbind *>(ccb->get_callable().get_custom()) != nullptr);
+	CHECK(unbound.get_bound_arguments_count() == 1);
+}
+
+} // namespace TestCallable
+
+#endif // TEST_CALLABLE_H
@@ -31,6 +31,7 @@
 #ifndef TEST_VARIANT_H
 #define TEST_VARIANT_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -1755,6 +1756,43 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays") {
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant parsed;
+
+	ss.s = "PackedVector3Array(1, -2.5, 3e2,\n 4 , 5,6 ; comment\n, 7, inf, nan)";
+	CHECK_EQ(VariantParser::parse(&ss, parsed, errs, line), OK);
+	PackedVector3Array v3 = parsed;
+	REQUIRE_EQ(v3.size(), 3);
+	CHECK_EQ(v3[0], Vector3(1, -2.5, 300));
+	CHECK_EQ(v3[1], Vector3(4, 5, 6));
+	CHECK_EQ(v3[2].x, 7);
+	CHECK(Math::is_inf(v3[2].y));
+	CHECK(Math::is_nan(v3[2].z));
+	CHECK_EQ(line, 3);
+
+	VariantParser::StreamString ss_int;
+	ss_int.s = "PackedInt64Array(9007199254740993, -1)";
+	CHECK_EQ(VariantParser::parse(&ss_int, parsed, errs, line), OK);
+	PackedInt64Array i64 = parsed;
+	REQUIRE_EQ(i64.size(), 2);
+	CHECK_EQ(i64[0], 9007199254740993);
+	CHECK_EQ(i64[1], -1);
+
+	VariantParser::StreamString ss_empty;
+	ss_empty.s = "PackedFloat32Array( )";
+	CHECK_EQ(VariantParser::parse(&ss_empty, parsed, errs, line), OK);
+	CHECK_EQ(PackedFloat32Array(parsed).size(), 0);
+
+	ERR_PRINT_OFF;
+	VariantParser::StreamString ss_bad;
+	ss_bad.s = "PackedFloat32Array(1 2)";
+	CHECK_EQ(VariantParser::parse(&ss_bad, parsed, errs, line), ERR_PARSE_ERROR);
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -2204,6 +2242,76 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+struct HeapVariantFiller {
+	LocalVector<Variant> values;
+
+	void fill(uint32_t p_index, void *p_userdata) {
+		values[p_index] = Transform3D(Basis(), Vector3(p_index, 0, 0));
+	}
+};
+
+TEST_CASE("[Variant] Heap allocated types freed on another thread") {
+	// Heap allocated types are pooled per thread, but may be freed on any thread.
+	HeapVariantFiller filler;
+	filler.values.resize(1024);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&filler, &HeapVariantFiller::fill, nullptr, filler.values.size(), -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	for (uint32_t i = 0; i < filler.values.size(); i++) {
+		CHECK_EQ(Transform3D(filler.values[i]).origin.x, i);
+	}
+
+	filler.values.clear();
+	for (int i = 0; i < 1024; i++) {
+		filler.values.push_back(Transform3D(Basis(), Vector3(i, 0, 0)));
+	}
+	CHECK_EQ(Transform3D(filler.values[1023]).origin.x, 1023);
+}
+
+TEST_CASE("[Variant] Packed float array reductions") {
+	PackedFloat32Array a;
+	PackedFloat32Array b;
+	for (int i = 1; i <= 10; i++) {
+		a.push_back(i);
+		b.push_back(2);
+	}
+	a.push_back(-3);
+	b.push_back(1);
+
+	Variant va = a;
+	Variant vb = b;
+	Variant ret;
+	Callable::CallError ce;
+	const Variant *args[1] = { &vb };
+
+	va.callp("sum", nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(double(ret) == doctest::Approx(52.0));
+	va.callp("dot", args, 1, ret, ce);
+	CHECK(double(ret) == doctest::Approx(107.0));
+	va.callp("min", nullptr, 0, ret, ce);
+	CHECK(double(ret) == doctest::Approx(-3.0));
+	va.callp("max", nullptr, 0, ret, ce);
+	CHECK(double(ret) == doctest::Approx(10.0));
+
+	Variant empty = PackedFloat64Array();
+	empty.callp("sum", nullptr, 0, ret, ce);
+	CHECK(double(ret) == 0.0);
+	empty.callp("max", nullptr, 0, ret, ce);
+	CHECK(double(ret) == 0.0);
+
+	PackedFloat64Array c;
+	c.push_back(0.5);
+	c.push_back(4.5);
+	c.push_back(-1.5);
+	Variant vc = c;
+	vc.callp("sum", nullptr, 0, ret, ce);
+	CHECK(double(ret) == doctest::Approx(3.5));
+	vc.callp("min", nullptr, 0, ret, ce);
+	CHECK(double(ret) == doctest::Approx(-1.5));
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H
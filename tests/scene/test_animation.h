@@ -309,6 +309,31 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Compressed 3D position track") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(10.0);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	for (int i = 0; i <= 100; i++) {
+		animation->position_track_insert_key(track_index, i * 0.1, Vector3(Math::sin(i * 0.3), i * 0.05, 0));
+	}
+
+	Vector3 expected[21];
+	for (int i = 0; i <= 20; i++) {
+		CHECK(animation->try_position_track_interpolate(track_index, i * 0.5, &expected[i]) == OK);
+	}
+
+	// Small pages make the keys span several of them.
+	animation->compress(256, 30);
+	CHECK(animation->track_is_compressed(track_index));
+
+	Vector3 r_interpolation;
+	for (int i = 0; i <= 20; i++) {
+		CHECK(animation->try_position_track_interpolate(track_index, i * 0.5, &r_interpolation) == OK);
+		CHECK(r_interpolation.distance_to(expected[i]) < 0.02);
+	}
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
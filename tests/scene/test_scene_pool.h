@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  test_scene_pool.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_POOL_H
+#define TEST_SCENE_POOL_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/resources/scene_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+TEST_CASE("[ScenePool] Reuse and reset released instances") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	CHECK(packed_scene->pack(scene) == OK);
+	memdelete(scene);
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+
+	pool->fill(2);
+	CHECK(pool->get_available_count() == 2);
+
+	Node2D *instance = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(instance != nullptr);
+	CHECK(pool->get_available_count() == 1);
+	CHECK(instance->get_position() == Vector2(10, 20));
+
+	instance->set_position(Vector2(-5, 5));
+	// Left at its default value when packed, so not stored in the scene.
+	instance->set_rotation(1.5);
+	instance->set_z_index(3);
+	pool->release(instance);
+	CHECK(pool->get_available_count() == 2);
+
+	Node2D *reused = Object::cast_to<Node2D>(pool->acquire());
+	CHECK(reused == instance);
+	CHECK(reused->get_position() == Vector2(10, 20));
+	CHECK(reused->get_rotation() == doctest::Approx(0.0));
+	CHECK(reused->get_z_index() == 0);
+
+	SUBCASE("Instances are created on demand once the pool is empty") {
+		Node *other = pool->acquire();
+		Node *created = pool->acquire();
+		CHECK(pool->get_available_count() == 0);
+		CHECK(created != nullptr);
+		CHECK(created != reused);
+		memdelete(other);
+		memdelete(created);
+	}
+
+	memdelete(reused);
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+}
+
+} // namespace TestScenePool
+
+#endif // TEST_SCENE_POOL_H
@@ -0,0 +1,65 @@
+/**************************************************************************/
+/*  test_surface_tool.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SURFACE_TOOL_H
+#define TEST_SURFACE_TOOL_H
+
+#include "scene/resources/surface_tool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSurfaceTool {
+
+TEST_CASE("[SurfaceTool] Building meshlets") {
+	PackedVector3Array vertices = { Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(1, 1, 0), Vector3(0, 1, 0) };
+	PackedInt32Array indices = { 0, 1, 2, 0, 2, 3 };
+
+	SUBCASE("Triangle limits that aren't a multiple of 4 are rejected") {
+		ERR_PRINT_OFF;
+		CHECK(SurfaceTool::build_meshlets(vertices, indices, 64, 126).is_empty());
+		CHECK(SurfaceTool::build_meshlets(vertices, indices, 64, 2).is_empty());
+		ERR_PRINT_ON;
+	}
+
+	SUBCASE("A small mesh fits in a single meshlet") {
+		if (!SurfaceTool::build_meshlets_func) {
+			return; // Meshoptimizer is not available.
+		}
+		Vector<SurfaceTool::Meshlet> meshlets = SurfaceTool::build_meshlets(vertices, indices, 64, 124);
+		REQUIRE(meshlets.size() == 1);
+		CHECK(meshlets[0].index_offset == 0);
+		CHECK(meshlets[0].index_count == 6);
+		CHECK(indices.size() == 6);
+	}
+}
+
+} // namespace TestSurfaceTool
+
+#endif // TEST_SURFACE_TOOL_H
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  test_benchmark.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BENCHMARK_H
+#define TEST_BENCHMARK_H
+
+#include "core/io/json.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/array.h"
+#include "core/variant/dictionary.h"
+
+// Microbenchmarks are regular doctest cases tagged with [Benchmark]. They are
+// skipped by default and only run when the test binary is started with
+// `--benchmark`, which also prints the collected timings as JSON once done.
+
+namespace TestBenchmark {
+
+struct Result {
+	String name;
+	uint64_t iterations = 0;
+	uint64_t usec = 0;
+};
+
+inline LocalVector<Result> &get_results() {
+	static LocalVector<Result> results;
+	return results;
+}
+
+// Times `p_iterations` calls to `p_func` and records the result under `p_name`.
+template <class F>
+void run(const String &p_name, uint64_t p_iterations, F p_func) {
+	// Warm up caches and lazily initialized state first.
+	p_func();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		p_func();
+	}
+	uint64_t end = OS::get_singleton()->get_ticks_usec();
+
+	Result result;
+	result.name = p_name;
+	result.iterations = p_iterations;
+	result.usec = end - begin;
+	get_results().push_back(result);
+}
+
+inline String get_results_json() {
+	Array benchmarks;
+	for (const Result &result : get_results()) {
+		Dictionary entry;
+		entry["name"] = result.name;
+		entry["iterations"] = result.iterations;
+		entry["total_usec"] = result.usec;
+		entry["nsec_per_iteration"] = result.iterations > 0 ? double(result.usec) * 1000.0 / double(result.iterations) : 0.0;
+		benchmarks.push_back(entry);
+	}
+
+	Dictionary root;
+	root["benchmarks"] = benchmarks;
+	return JSON::stringify(root, "\t", false);
+}
+
+} // namespace TestBenchmark
+
+#endif // TEST_BENCHMARK_H
@@ -73,6 +73,7 @@
 #include "tests/core/string/test_string.h"
 #include "tests/core/string/test_translation.h"
 #include "tests/core/string/test_translation_server.h"
+#include "tests/core/templates/test_a_hash_map.h"
 #include "tests/core/templates/test_command_queue.h"
 #include "tests/core/templates/test_hash_map.h"
 #include "tests/core/templates/test_hash_set.h"
@@ -82,11 +83,13 @@
 #include "tests/core/templates/test_paged_array.h"
 #include "tests/core/templates/test_rid.h"
 #include "tests/core/templates/test_vector.h"
+#include "tests/core/test_core_benchmarks.h"
 #include "tests/core/test_crypto.h"
 #include "tests/core/test_hashing_context.h"
 #include "tests/core/test_time.h"
 #include "tests/core/threads/test_worker_thread_pool.h"
 #include "tests/core/variant/test_array.h"
+#include "tests/core/variant/test_callable.h"
 #include "tests/core/variant/test_dictionary.h"
 #include "tests/core/variant/test_variant.h"
 #include "tests/core/variant/test_variant_utility.h"
@@ -113,7 +116,9 @@
 #include "tests/scene/test_path_2d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_primitives.h"
+#include "tests/scene/test_scene_pool.h"
 #include "tests/scene/test_sprite_frames.h"
+#include "tests/scene/test_surface_tool.h"
 #include "tests/scene/test_text_edit.h"
 #include "tests/scene/test_theme.h"
 #include "tests/scene/test_viewport.h"
@@ -128,6 +133,7 @@
 #include "modules/modules_tests.gen.h"
 
 #include "tests/display_server_mock.h"
+#include "tests/test_benchmark.h"
 #include "tests/test_macros.h"
 
 #include "scene/theme/theme_db.h"
@@ -169,15 +175,26 @@ int test_main(int argc, char *argv[]) {
 	// Doctest runner.
 	doctest::Context test_context;
 	List<String> test_args;
+	bool run_benchmarks = false;
 
-	// Clean arguments of "--test" from the args.
+	// Clean arguments of "--test" and "--benchmark" from the args.
 	for (int x = 0; x < argc; x++) {
 		String arg = String(argv[x]);
-		if (arg != "--test") {
+		if (arg == "--benchmark") {
+			run_benchmarks = true;
+		} else if (arg != "--test") {
 			test_args.push_back(arg);
 		}
 	}
 
+	// Benchmarks are slow and their timings are meaningless as pass/fail checks,
+	// so they only run on request, and exclusively.
+	if (run_benchmarks) {
+		test_args.push_back("--test-case=*[Benchmark]*");
+	} else {
+		test_args.push_back("--test-case-exclude=*[Benchmark]*");
+	}
+
 	if (test_args.size() > 0) {
 		// Convert Godot command line arguments back to standard arguments.
 		char **doctest_args = new char *[test_args.size()];
@@ -199,7 +216,13 @@ int test_main(int argc, char *argv[]) {
 		delete[] doctest_args;
 	}
 
-	return test_context.run();
+	int result = test_context.run();
+
+	if (run_benchmarks) {
+		print_line(TestBenchmark::get_results_json());
+	}
+
+	return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
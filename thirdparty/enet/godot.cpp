@@ -39,6 +39,7 @@
 #include "core/io/packet_peer_dtls.h"
 #include "core/io/udp_server.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 
 // This must be last for windows to compile (tested with MinGW)
 #include "enet/enet.h"
@@ -66,10 +67,20 @@ class ENetUDP : public ENetGodotSocket {
 	friend class ENetDTLSServer;
 
 private:
+	enum {
+		RECV_BATCH_SIZE = 16,
+	};
+
 	Ref<NetSocket> sock;
 	IPAddress local_address;
 	bool bound = false;
 
+	// Datagrams are received in batches, and handed to ENet one at a time.
+	LocalVector<uint8_t> recv_buffer;
+	NetSocket::Datagram recv_batch[RECV_BATCH_SIZE];
+	int recv_count = 0;
+	int recv_next = 0;
+
 public:
 	ENetUDP() {
 		sock = Ref<NetSocket>(NetSocket::create());
@@ -104,11 +115,34 @@ public:
 	}
 
 	Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port) {
-		Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
-		if (err != OK) {
-			return err;
+		if (recv_next == recv_count) {
+			Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
+			if (err != OK) {
+				return err;
+			}
+			if (recv_buffer.is_empty()) {
+				recv_buffer.resize(RECV_BATCH_SIZE * ENET_PROTOCOL_MAXIMUM_MTU);
+			}
+			for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+				recv_batch[i].buffer = &recv_buffer[i * ENET_PROTOCOL_MAXIMUM_MTU];
+				recv_batch[i].len = ENET_PROTOCOL_MAXIMUM_MTU;
+			}
+			recv_next = 0;
+			recv_count = 0;
+			err = sock->recvfrom_batch(recv_batch, RECV_BATCH_SIZE, recv_count);
+			if (err != OK) {
+				return err;
+			}
 		}
-		return sock->recvfrom(p_buffer, p_len, r_read, r_ip, r_port);
+		const NetSocket::Datagram &d = recv_batch[recv_next++];
+		if (d.len > p_len) {
+			return ERR_OUT_OF_MEMORY;
+		}
+		memcpy(p_buffer, d.buffer, d.len);
+		r_read = d.len;
+		r_ip = d.ip;
+		r_port = d.port;
+		return OK;
 	}
 
 	int set_option(ENetSocketOption p_option, int p_value) {
@@ -156,6 +190,9 @@ public:
 	void close() {
 		sock->close();
 		local_address.clear();
+		recv_buffer.reset();
+		recv_count = 0;
+		recv_next = 0;
 	}
 };
 